@@ -0,0 +1,34 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "fake_odbc.h"
+
+#include <databricks/core/config.h>
+
+#include <string>
+
+namespace databricks {
+namespace bench {
+/**
+ * @brief Credentials for a workspace that is never contacted
+ */
+inline AuthConfig bench_auth(const std::string& host = "https://bench.cloud.databricks.com") {
+    AuthConfig auth;
+    auth.host = host;
+    auth.set_token("dapi-benchmark-token");
+    return auth;
+}
+
+/**
+ * @brief SQL settings that resolve to the fake ODBC driver
+ */
+inline SQLConfig bench_sql() {
+    SQLConfig sql;
+    sql.http_path = "/sql/1.0/warehouses/benchmark";
+    sql.odbc_driver_name = fake_driver_name();
+    return sql;
+}
+
+} // namespace bench
+} // namespace databricks
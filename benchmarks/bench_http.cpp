@@ -0,0 +1,84 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "bench_config.h"
+#include "local_http_server.h"
+
+#include "../src/internal/http_client.h"
+
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+using namespace databricks;
+
+namespace {
+std::unique_ptr<bench::LocalHttpServer> server;
+std::unique_ptr<internal::HttpClient> client;
+
+void start_server(const benchmark::State& state) {
+    server = std::make_unique<bench::LocalHttpServer>(std::string(static_cast<size_t>(state.range(0)), 'x'));
+
+    HttpConfig http;
+    http.retry.max_attempts = 1;
+    client = std::make_unique<internal::HttpClient>(bench::bench_auth(server->url()), "2.2", http);
+}
+
+void stop_server(const benchmark::State&) {
+    client.reset();
+    server.reset();
+}
+
+/**
+ * @brief One synchronous HttpClient::get over a kept-alive loopback connection
+ *
+ * range(0) is the response body size.
+ */
+void BM_HttpGet(benchmark::State& state) {
+    for (auto _ : state) {
+        auto response = client->get("/jobs/list");
+        benchmark::DoNotOptimize(response.body.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * @brief A burst of get_async requests, all started before any is awaited
+ *
+ * range(0) is the response body size, range(1) the burst size.
+ */
+void BM_HttpGetAsync(benchmark::State& state) {
+    const auto burst = static_cast<size_t>(state.range(1));
+    std::vector<std::future<internal::HttpResponse>> responses;
+    responses.reserve(burst);
+
+    for (auto _ : state) {
+        responses.clear();
+        for (size_t i = 0; i < burst; i++) {
+            responses.push_back(client->get_async("/jobs/list"));
+        }
+        for (auto& response : responses) {
+            benchmark::DoNotOptimize(response.get().status_code);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(1));
+    state.SetBytesProcessed(state.iterations() * state.range(1) * state.range(0));
+}
+} // namespace
+
+BENCHMARK(BM_HttpGet)
+    ->ArgName("body")
+    ->Arg(256)
+    ->Arg(64 << 10)
+    ->Setup(start_server)
+    ->Teardown(stop_server)
+    ->UseRealTime();
+BENCHMARK(BM_HttpGetAsync)
+    ->ArgNames({"body", "burst"})
+    ->ArgsProduct({{256, 64 << 10}, {16}})
+    ->Setup(start_server)
+    ->Teardown(stop_server)
+    ->UseRealTime();
@@ -0,0 +1,19 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include <cstdlib>
+
+#include <benchmark/benchmark.h>
+
+int main(int argc, char** argv) {
+    // The SDK logs every query at INFO and every pool wait at WARN; keep that out of
+    // the measurements unless DATABRICKS_LOG_LEVEL asks for it
+    setenv("DATABRICKS_LOG_LEVEL", "error", 0);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,139 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../src/internal/http_client_interface.h"
+
+#include <databricks/jobs/jobs.h>
+#include <databricks/unity_catalog/unity_catalog.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <nlohmann/json.hpp>
+
+using namespace databricks;
+using json = nlohmann::json;
+
+namespace {
+/**
+ * @brief IHttpClient answering every GET with one canned body, so only parsing is measured
+ */
+class CannedHttpClient : public internal::IHttpClient {
+public:
+    explicit CannedHttpClient(std::string body) {
+        response_.status_code = 200;
+        response_.body = std::move(body);
+    }
+
+    internal::HttpResponse get(const std::string&) override { return response_; }
+    internal::HttpResponse post(const std::string&, const std::string&) override { return response_; }
+    void check_response(const internal::HttpResponse& response, const std::string& operation_name) const override {
+        if (response.status_code != 200) {
+            throw std::runtime_error(operation_name + " failed");
+        }
+    }
+
+    size_t body_size() const { return response_.body.size(); }
+
+private:
+    internal::HttpResponse response_;
+};
+
+/**
+ * @brief /jobs/list page shaped like a real workspace: multi-task jobs with clusters and schedules
+ */
+std::string jobs_payload(size_t count) {
+    json jobs = json::array();
+    for (size_t i = 0; i < count; i++) {
+        json tasks = json::array();
+        for (int t = 0; t < 3; t++) {
+            tasks.push_back({{"task_key", "task_" + std::to_string(t)},
+                             {"notebook_task", {{"notebook_path", "/Repos/etl/pipeline/step_" + std::to_string(t)}}},
+                             {"new_cluster",
+                              {{"spark_version", "14.3.x-scala2.12"},
+                               {"node_type_id", "i3.xlarge"},
+                               {"num_workers", 4},
+                               {"spark_conf", {{"spark.sql.shuffle.partitions", "200"}}}}},
+                             {"timeout_seconds", 3600}});
+        }
+        jobs.push_back({{"job_id", 1000000 + i},
+                        {"creator_user_name", "data-eng@example.com"},
+                        {"created_time", 1700000000000 + i},
+                        {"settings",
+                         {{"name", "nightly_etl_" + std::to_string(i)},
+                          {"tasks", tasks},
+                          {"schedule", {{"quartz_cron_expression", "0 0 2 * * ?"}, {"timezone_id", "UTC"}}},
+                          {"max_concurrent_runs", 1},
+                          {"email_notifications", {{"on_failure", {"oncall@example.com"}}}}}}});
+    }
+    return json{{"jobs", jobs}, {"has_more", false}}.dump();
+}
+
+/**
+ * @brief /unity-catalog/tables page of managed Delta tables with 20 columns each
+ */
+std::string tables_payload(size_t count) {
+    json tables = json::array();
+    for (size_t i = 0; i < count; i++) {
+        json columns = json::array();
+        for (int c = 0; c < 20; c++) {
+            columns.push_back({{"name", "column_" + std::to_string(c)},
+                               {"type_text", c % 2 ? "string" : "bigint"},
+                               {"type_name", c % 2 ? "STRING" : "LONG"},
+                               {"position", c},
+                               {"nullable", true},
+                               {"comment", "Column " + std::to_string(c)}});
+        }
+        const std::string name = "table_" + std::to_string(i);
+        tables.push_back({{"name", name},
+                          {"catalog_name", "main"},
+                          {"schema_name", "analytics"},
+                          {"full_name", "main.analytics." + name},
+                          {"table_type", "MANAGED"},
+                          {"data_source_format", "DELTA"},
+                          {"owner", "data-eng@example.com"},
+                          {"created_at", 1700000000000 + i},
+                          {"updated_at", 1700000500000 + i},
+                          {"metastore_id", "11111111-2222-3333-4444-555555555555"},
+                          {"table_id", std::to_string(900000 + i)},
+                          {"storage_location", "s3://lake/main/analytics/" + name},
+                          {"properties", {{"delta.minReaderVersion", "1"}, {"delta.minWriterVersion", "2"}}},
+                          {"columns", columns}});
+    }
+    return json{{"tables", tables}}.dump();
+}
+
+/**
+ * @brief Jobs::list_jobs (request, response check and parse_jobs_list); range(0) jobs per page
+ */
+void BM_ParseJobsList(benchmark::State& state) {
+    auto http = std::make_shared<CannedHttpClient>(jobs_payload(static_cast<size_t>(state.range(0))));
+    Jobs jobs(http);
+
+    for (auto _ : state) {
+        auto list = jobs.list_jobs(static_cast<int>(state.range(0)));
+        benchmark::DoNotOptimize(list.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(http->body_size()));
+}
+
+/**
+ * @brief UnityCatalog::list_tables (uncached, so parse_table_list runs every time); range(0) tables
+ */
+void BM_ParseTableList(benchmark::State& state) {
+    auto http = std::make_shared<CannedHttpClient>(tables_payload(static_cast<size_t>(state.range(0))));
+    UnityCatalog uc(http);
+
+    for (auto _ : state) {
+        auto list = uc.list_tables("main", "analytics");
+        benchmark::DoNotOptimize(list.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(http->body_size()));
+}
+} // namespace
+
+BENCHMARK(BM_ParseJobsList)->ArgName("jobs")->Arg(25)->Arg(100)->Arg(1000);
+BENCHMARK(BM_ParseTableList)->ArgName("tables")->Arg(50)->Arg(500)->Arg(5000);
@@ -0,0 +1,64 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "bench_config.h"
+
+#include <databricks/connection_pool.h>
+#include <databricks/core/client.h>
+
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+using namespace databricks;
+
+namespace {
+// Shared by every thread of one run; created in setup so threads start together
+std::unique_ptr<ConnectionPool> pool;
+
+void create_pool(const benchmark::State& state) {
+    PoolingConfig pooling;
+    pooling.enabled = true;
+    pooling.min_connections = static_cast<size_t>(state.range(0));
+    pooling.max_connections = static_cast<size_t>(state.range(0));
+    pooling.connection_timeout_ms = 60000;
+    pooling.maintenance_interval_ms = 0; // Keep background eviction out of the measurement
+    pooling.shards = static_cast<size_t>(state.range(1));
+
+    pool = std::make_unique<ConnectionPool>(bench::bench_auth(), bench::bench_sql(), pooling);
+    pool->warm_up();
+}
+
+void destroy_pool(const benchmark::State&) {
+    pool.reset();
+}
+
+/**
+ * @brief ConnectionPool::acquire and return under contention
+ *
+ * range(0) is the pool size and range(1) the number of idle-list shards (0 =
+ * one per hardware thread). shards:1 puts every thread on one lock, like the
+ * pool before it was sharded, and is the baseline the sharded runs scale against.
+ * Run with more threads than connections to include waiting for a return.
+ * Borrow validation uses the driver's local liveness check.
+ */
+void BM_PoolAcquireRelease(benchmark::State& state) {
+    for (auto _ : state) {
+        auto connection = pool->acquire();
+        benchmark::DoNotOptimize(&connection.get());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+} // namespace
+
+BENCHMARK(BM_PoolAcquireRelease)
+    ->ArgNames({"pool", "shards"})
+    ->Args({4, 1})
+    ->Args({4, 0})
+    ->Args({16, 1})
+    ->Args({16, 0})
+    ->Args({64, 1})
+    ->Args({64, 0})
+    ->Setup(create_pool)
+    ->Teardown(destroy_pool)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
@@ -0,0 +1,78 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "bench_config.h"
+#include "fake_odbc.h"
+
+#include <databricks/core/client.h>
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+using namespace databricks;
+
+namespace {
+constexpr size_t VALUE_BYTES = 16;
+
+/**
+ * @brief Client::query over the fake driver; range(0) rows x range(1) VARCHAR columns
+ *
+ * With max_column_buffer_bytes at its default every column is bound and rows
+ * arrive in fetch_batch_rows blocks; a small limit forces the row-at-a-time
+ * SQLGetData path instead.
+ */
+void run_query(benchmark::State& state, size_t max_column_buffer_bytes) {
+    const auto rows = static_cast<size_t>(state.range(0));
+    const auto columns = static_cast<size_t>(state.range(1));
+    bench::set_fake_result({rows, columns, VALUE_BYTES, {}, {}, {}, {}, true});
+
+    SQLConfig sql = bench::bench_sql();
+    sql.max_column_buffer_bytes = max_column_buffer_bytes;
+    Client client = Client::Builder().with_auth(bench::bench_auth()).with_sql(sql).build();
+    client.connect();
+
+    for (auto _ : state) {
+        auto result = client.query("SELECT * FROM benchmark");
+        benchmark::DoNotOptimize(result.data());
+    }
+
+    const auto total_rows = static_cast<int64_t>(state.iterations() * rows);
+    state.SetItemsProcessed(total_rows);
+    state.SetBytesProcessed(total_rows * static_cast<int64_t>(columns * VALUE_BYTES));
+}
+
+void BM_QueryBlockFetch(benchmark::State& state) {
+    run_query(state, SQLConfig{}.max_column_buffer_bytes);
+}
+
+void BM_QueryRowFetch(benchmark::State& state) {
+    run_query(state, 1); // Narrower than any column, so nothing is bound
+}
+
+/**
+ * @brief Client::query_result over the fake driver, for comparison with BM_QueryBlockFetch
+ *
+ * Same result, but cells land in one buffer instead of a std::string each.
+ */
+void BM_QueryResultSet(benchmark::State& state) {
+    const auto rows = static_cast<size_t>(state.range(0));
+    const auto columns = static_cast<size_t>(state.range(1));
+    bench::set_fake_result({rows, columns, VALUE_BYTES, {}, {}, {}, {}, true});
+
+    Client client = Client::Builder().with_auth(bench::bench_auth()).with_sql(bench::bench_sql()).build();
+    client.connect();
+
+    for (auto _ : state) {
+        auto result = client.query_result("SELECT * FROM benchmark");
+        benchmark::DoNotOptimize(result.num_rows());
+    }
+
+    const auto total_rows = static_cast<int64_t>(state.iterations() * rows);
+    state.SetItemsProcessed(total_rows);
+    state.SetBytesProcessed(total_rows * static_cast<int64_t>(columns * VALUE_BYTES));
+}
+} // namespace
+
+BENCHMARK(BM_QueryBlockFetch)->ArgNames({"rows", "cols"})->ArgsProduct({{1, 1 << 10, 1 << 16}, {1, 8, 32}});
+BENCHMARK(BM_QueryResultSet)->ArgNames({"rows", "cols"})->ArgsProduct({{1, 1 << 10, 1 << 16}, {1, 8, 32}});
+BENCHMARK(BM_QueryRowFetch)->ArgNames({"rows", "cols"})->ArgsProduct({{1 << 10, 1 << 14}, {1, 8, 32}});
@@ -0,0 +1,420 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "fake_odbc.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <sql.h>
+#include <sqlext.h>
+
+namespace databricks {
+namespace bench {
+namespace {
+/**
+ * @brief Result set shared by every statement executed after set_fake_result()
+ */
+struct FakeResult {
+    FakeResultShape shape;
+    std::vector<std::string> values; // One value per column, repeated on every row (without a generator)
+
+    // Value of a cell, in scratch when it comes from the generator
+    const std::string& value(size_t row, size_t column, std::string& scratch) const {
+        if (!shape.generator) {
+            return values[column];
+        }
+        scratch = shape.generator(row, column);
+        return scratch;
+    }
+};
+
+std::shared_ptr<const FakeResult> make_result(const FakeResultShape& shape) {
+    auto result = std::make_shared<FakeResult>();
+    result->shape = shape;
+    for (size_t c = 0; c < shape.columns; c++) {
+        result->values.emplace_back(shape.value_bytes, static_cast<char>('a' + c % 26));
+    }
+    return result;
+}
+
+std::shared_ptr<const FakeResult>& current_result_slot() {
+    static std::shared_ptr<const FakeResult> slot = make_result(FakeResultShape{});
+    return slot;
+}
+
+std::shared_ptr<const FakeResult> current_result() {
+    return std::atomic_load(&current_result_slot());
+}
+
+struct Binding {
+    SQLSMALLINT c_type = 0;
+    char* buffer = nullptr;
+    SQLLEN buffer_length = 0;
+    SQLLEN* indicators = nullptr;
+};
+
+/**
+ * @brief State behind every handle the fake driver hands out
+ *
+ * Environment and connection handles only need to be distinct allocations;
+ * statements track the cursor and the application's bindings.
+ */
+struct FakeHandle {
+    FakeHandle* connection = nullptr; // Statements: the connection they were allocated on
+    bool dead = false;                // Connections: lost (see FakeResultShape::execute_error)
+    std::string sqlstate;             // Diagnostic of the last failed call ("" = none)
+    std::shared_ptr<const FakeResult> result;
+    size_t next_row = 0;
+    size_t rowset_start = 0; // First row of the last SQLFetch
+    size_t current_row = 0;  // Row SQLGetData reads (moved within the rowset by SQLSetPos)
+    SQLULEN row_array_size = 1;
+    SQLULEN* rows_fetched = nullptr;
+    SQLUSMALLINT* row_status = nullptr;
+    std::vector<Binding> bindings;
+    std::vector<size_t> read_offsets; // SQLGetData progress per column in the current row
+};
+
+// Marks a column whose current value has been read completely
+constexpr size_t READ_DONE = static_cast<size_t>(-1);
+
+FakeHandle* statement(SQLHSTMT hstmt) {
+    return static_cast<FakeHandle*>(hstmt);
+}
+
+SQLRETURN execute(SQLHSTMT hstmt) {
+    FakeHandle* stmt = statement(hstmt);
+    stmt->result = current_result();
+    if (stmt->result->shape.execute_latency) {
+        std::this_thread::sleep_for(stmt->result->shape.execute_latency());
+    }
+    stmt->sqlstate = stmt->result->shape.execute_error ? stmt->result->shape.execute_error() : "";
+    if (stmt->connection && stmt->connection->dead) {
+        stmt->sqlstate = "08S01";
+    }
+    if (!stmt->sqlstate.empty()) {
+        if (stmt->connection && stmt->sqlstate.compare(0, 2, "08") == 0) {
+            stmt->connection->dead = true;
+        }
+        stmt->result = nullptr;
+        return SQL_ERROR;
+    }
+    stmt->next_row = 0;
+    stmt->rowset_start = 0;
+    stmt->current_row = 0;
+    return SQL_SUCCESS;
+}
+
+void copy_name(const std::string& name, SQLCHAR* out, SQLSMALLINT capacity, SQLSMALLINT* length) {
+    if (length) {
+        *length = static_cast<SQLSMALLINT>(name.size());
+    }
+    if (out && capacity > 0) {
+        const size_t copied = std::min(name.size(), static_cast<size_t>(capacity - 1));
+        std::memcpy(out, name.data(), copied);
+        out[copied] = '\0';
+    }
+}
+} // namespace
+
+void set_fake_result(const FakeResultShape& shape) {
+    std::atomic_store(&current_result_slot(), make_result(shape));
+}
+
+std::string fake_driver_name() {
+    return "Simba Spark ODBC Driver";
+}
+
+} // namespace bench
+} // namespace databricks
+
+using databricks::bench::Binding;
+using databricks::bench::FakeHandle;
+using databricks::bench::READ_DONE;
+
+extern "C" {
+
+SQLRETURN SQLAllocHandle(SQLSMALLINT type, SQLHANDLE input, SQLHANDLE* output) {
+    auto* handle = new FakeHandle();
+    if (type == SQL_HANDLE_STMT) {
+        handle->connection = static_cast<FakeHandle*>(input);
+    }
+    *output = handle;
+    return SQL_SUCCESS;
+}
+
+SQLRETURN SQLFreeHandle(SQLSMALLINT, SQLHANDLE handle) {
+    delete static_cast<FakeHandle*>(handle);
+    return SQL_SUCCESS;
+}
+
+SQLRETURN SQLFreeStmt(SQLHSTMT hstmt, SQLUSMALLINT option) {
+    if (option == SQL_UNBIND) {
+        databricks::bench::statement(hstmt)->bindings.clear();
+    }
+    return SQL_SUCCESS;
+}
+
+SQLRETURN SQLSetEnvAttr(SQLHENV, SQLINTEGER, SQLPOINTER, SQLINTEGER) {
+    return SQL_SUCCESS;
+}
+
+SQLRETURN SQLSetConnectAttr(SQLHDBC, SQLINTEGER, SQLPOINTER, SQLINTEGER) {
+    return SQL_SUCCESS;
+}
+
+SQLRETURN SQLGetInfo(SQLHDBC, SQLUSMALLINT info_type, SQLPOINTER value, SQLSMALLINT, SQLSMALLINT*) {
+    const bool bound_rereads = databricks::bench::current_result()->shape.bound_rereads;
+    switch (info_type) {
+    case SQL_GETDATA_EXTENSIONS:
+        *static_cast<SQLUINTEGER*>(value) =
+            SQL_GD_ANY_COLUMN | SQL_GD_ANY_ORDER | (bound_rereads ? SQL_GD_BLOCK | SQL_GD_BOUND : 0);
+        return SQL_SUCCESS;
+    case SQL_FORWARD_ONLY_CURSOR_ATTRIBUTES1:
+        *static_cast<SQLUINTEGER*>(value) = bound_rereads ? SQL_CA1_NEXT | SQL_CA1_POS_POSITION : SQL_CA1_NEXT;
+        return SQL_SUCCESS;
+    default:
+        return SQL_ERROR;
+    }
+}
+
+SQLRETURN SQLGetConnectAttr(SQLHDBC hdbc, SQLINTEGER attribute, SQLPOINTER value, SQLINTEGER, SQLINTEGER*) {
+    if (attribute == SQL_ATTR_CONNECTION_DEAD) {
+        *static_cast<SQLUINTEGER*>(value) = static_cast<FakeHandle*>(hdbc)->dead ? SQL_CD_TRUE : SQL_CD_FALSE;
+        return SQL_SUCCESS;
+    }
+    return SQL_ERROR;
+}
+
+SQLRETURN SQLSetStmtAttr(SQLHSTMT hstmt, SQLINTEGER attribute, SQLPOINTER value, SQLINTEGER) {
+    FakeHandle* stmt = databricks::bench::statement(hstmt);
+    switch (attribute) {
+    case SQL_ATTR_ROW_ARRAY_SIZE:
+        stmt->row_array_size = std::max<SQLULEN>(reinterpret_cast<SQLULEN>(value), 1);
+        break;
+    case SQL_ATTR_ROWS_FETCHED_PTR:
+        stmt->rows_fetched = static_cast<SQLULEN*>(value);
+        break;
+    case SQL_ATTR_ROW_STATUS_PTR:
+        stmt->row_status = static_cast<SQLUSMALLINT*>(value);
+        break;
+    default:
+        break;
+    }
+    return SQL_SUCCESS;
+}
+
+SQLRETURN SQLGetStmtAttr(SQLHSTMT hstmt, SQLINTEGER attribute, SQLPOINTER value, SQLINTEGER, SQLINTEGER*) {
+    if (attribute == SQL_ATTR_ROW_ARRAY_SIZE) {
+        *static_cast<SQLULEN*>(value) = databricks::bench::statement(hstmt)->row_array_size;
+        return SQL_SUCCESS;
+    }
+    return SQL_ERROR;
+}
+
+SQLRETURN SQLDrivers(SQLHENV, SQLUSMALLINT direction, SQLCHAR* description, SQLSMALLINT description_capacity,
+                     SQLSMALLINT* description_length, SQLCHAR* attributes, SQLSMALLINT attributes_capacity,
+                     SQLSMALLINT* attributes_length) {
+    if (direction != SQL_FETCH_FIRST) {
+        return SQL_NO_DATA;
+    }
+    databricks::bench::copy_name(databricks::bench::fake_driver_name(), description, description_capacity,
+                                 description_length);
+    databricks::bench::copy_name("", attributes, attributes_capacity, attributes_length);
+    return SQL_SUCCESS;
+}
+
+SQLRETURN SQLDriverConnect(SQLHDBC hdbc, SQLHWND, SQLCHAR*, SQLSMALLINT, SQLCHAR* out, SQLSMALLINT out_capacity,
+                           SQLSMALLINT* out_length, SQLUSMALLINT) {
+    static_cast<FakeHandle*>(hdbc)->dead = false;
+    databricks::bench::copy_name("", out, out_capacity, out_length);
+    return SQL_SUCCESS;
+}
+
+SQLRETURN SQLDisconnect(SQLHDBC) {
+    return SQL_SUCCESS;
+}
+
+SQLRETURN SQLExecDirect(SQLHSTMT hstmt, SQLCHAR*, SQLINTEGER) {
+    return databricks::bench::execute(hstmt);
+}
+
+SQLRETURN SQLPrepare(SQLHSTMT, SQLCHAR*, SQLINTEGER) {
+    return SQL_SUCCESS;
+}
+
+SQLRETURN SQLExecute(SQLHSTMT hstmt) {
+    return databricks::bench::execute(hstmt);
+}
+
+SQLRETURN SQLBindParameter(SQLHSTMT, SQLUSMALLINT, SQLSMALLINT, SQLSMALLINT, SQLSMALLINT, SQLULEN, SQLSMALLINT,
+                           SQLPOINTER, SQLLEN, SQLLEN*) {
+    return SQL_SUCCESS;
+}
+
+SQLRETURN SQLRowCount(SQLHSTMT hstmt, SQLLEN* count) {
+    const FakeHandle* stmt = databricks::bench::statement(hstmt);
+    *count = stmt->result ? static_cast<SQLLEN>(stmt->result->shape.rows) : 0;
+    return SQL_SUCCESS;
+}
+
+SQLRETURN SQLNumResultCols(SQLHSTMT hstmt, SQLSMALLINT* count) {
+    const FakeHandle* stmt = databricks::bench::statement(hstmt);
+    if (!stmt->result) {
+        return SQL_ERROR;
+    }
+    *count = static_cast<SQLSMALLINT>(stmt->result->shape.columns);
+    return SQL_SUCCESS;
+}
+
+SQLRETURN SQLDescribeCol(SQLHSTMT hstmt, SQLUSMALLINT column, SQLCHAR* name, SQLSMALLINT name_capacity,
+                         SQLSMALLINT* name_length, SQLSMALLINT* data_type, SQLULEN* column_size,
+                         SQLSMALLINT* decimal_digits, SQLSMALLINT* nullable) {
+    const FakeHandle* stmt = databricks::bench::statement(hstmt);
+    if (!stmt->result || column == 0 || column > stmt->result->shape.columns) {
+        return SQL_ERROR;
+    }
+    databricks::bench::copy_name("col_" + std::to_string(column), name, name_capacity, name_length);
+    *data_type = SQL_VARCHAR;
+    *column_size = stmt->result->shape.value_bytes;
+    *decimal_digits = 0;
+    *nullable = SQL_NULLABLE;
+    return SQL_SUCCESS;
+}
+
+SQLRETURN SQLBindCol(SQLHSTMT hstmt, SQLUSMALLINT column, SQLSMALLINT c_type, SQLPOINTER buffer, SQLLEN buffer_length,
+                     SQLLEN* indicators) {
+    // Only character data is served; typed fetches are out of scope for these benchmarks
+    if (c_type != SQL_C_CHAR || column == 0) {
+        return SQL_ERROR;
+    }
+    FakeHandle* stmt = databricks::bench::statement(hstmt);
+    if (stmt->bindings.size() < column) {
+        stmt->bindings.resize(column);
+    }
+    stmt->bindings[column - 1] = Binding{c_type, static_cast<char*>(buffer), buffer_length, indicators};
+    return SQL_SUCCESS;
+}
+
+SQLRETURN SQLFetch(SQLHSTMT hstmt) {
+    FakeHandle* stmt = databricks::bench::statement(hstmt);
+    if (!stmt->result || stmt->next_row >= stmt->result->shape.rows) {
+        return SQL_NO_DATA;
+    }
+    if (stmt->result->shape.fetch_latency) {
+        std::this_thread::sleep_for(stmt->result->shape.fetch_latency());
+    }
+
+    const auto& values = stmt->result->values;
+    const size_t rows = stmt->bindings.empty()
+                            ? 1
+                            : std::min<size_t>(stmt->row_array_size, stmt->result->shape.rows - stmt->next_row);
+
+    SQLRETURN ret = SQL_SUCCESS;
+    std::string scratch;
+    for (size_t c = 0; c < stmt->bindings.size() && c < values.size(); c++) {
+        const Binding& binding = stmt->bindings[c];
+        if (!binding.buffer || binding.buffer_length <= 0) {
+            continue;
+        }
+        for (size_t r = 0; r < rows; r++) {
+            const std::string& value = stmt->result->value(stmt->next_row + r, c, scratch);
+            const size_t copied = std::min(value.size(), static_cast<size_t>(binding.buffer_length - 1));
+            if (copied < value.size()) {
+                ret = SQL_SUCCESS_WITH_INFO;
+            }
+            char* slot = binding.buffer + r * static_cast<size_t>(binding.buffer_length);
+            std::memcpy(slot, value.data(), copied);
+            slot[copied] = '\0';
+            if (binding.indicators) {
+                binding.indicators[r] = static_cast<SQLLEN>(value.size());
+            }
+        }
+    }
+
+    if (stmt->rows_fetched) {
+        *stmt->rows_fetched = rows;
+    }
+    if (stmt->row_status) {
+        for (size_t r = 0; r < stmt->row_array_size; r++) {
+            stmt->row_status[r] = r < rows ? SQL_ROW_SUCCESS : SQL_ROW_NOROW;
+        }
+    }
+
+    stmt->rowset_start = stmt->next_row;
+    stmt->current_row = stmt->next_row;
+    stmt->next_row += rows;
+    stmt->read_offsets.assign(values.size(), 0);
+    return ret;
+}
+
+SQLRETURN SQLSetPos(SQLHSTMT hstmt, SQLSETPOSIROW row, SQLUSMALLINT operation, SQLUSMALLINT) {
+    // Positioning within the current rowset is all SQLGetData needs; nothing is updatable
+    FakeHandle* stmt = databricks::bench::statement(hstmt);
+    if (!stmt->result || !stmt->result->shape.bound_rereads || operation != SQL_POSITION || row == 0 ||
+        stmt->rowset_start + row > stmt->next_row) {
+        return SQL_ERROR;
+    }
+    stmt->current_row = stmt->rowset_start + row - 1;
+    stmt->read_offsets.assign(stmt->result->values.size(), 0);
+    return SQL_SUCCESS;
+}
+
+SQLRETURN SQLCancel(SQLHSTMT) {
+    return SQL_SUCCESS;
+}
+
+SQLRETURN SQLGetData(SQLHSTMT hstmt, SQLUSMALLINT column, SQLSMALLINT c_type, SQLPOINTER buffer, SQLLEN buffer_length,
+                     SQLLEN* indicator) {
+    FakeHandle* stmt = databricks::bench::statement(hstmt);
+    if (!stmt->result || c_type != SQL_C_CHAR || column == 0 || column > stmt->read_offsets.size()) {
+        return SQL_ERROR;
+    }
+
+    size_t& offset = stmt->read_offsets[column - 1];
+    if (offset == READ_DONE) {
+        return SQL_NO_DATA;
+    }
+
+    // Like a real driver: the indicator is what remains before this call, truncated
+    // reads return SQL_SUCCESS_WITH_INFO and continue where they stopped
+    std::string scratch;
+    const std::string& value = stmt->result->value(stmt->current_row, column - 1, scratch);
+    const size_t remaining = value.size() - offset;
+    if (indicator) {
+        *indicator = static_cast<SQLLEN>(remaining);
+    }
+    if (buffer_length <= 0) {
+        return SQL_SUCCESS_WITH_INFO;
+    }
+
+    const size_t copied = std::min(remaining, static_cast<size_t>(buffer_length - 1));
+    char* out = static_cast<char*>(buffer);
+    std::memcpy(out, value.data() + offset, copied);
+    out[copied] = '\0';
+    if (copied < remaining) {
+        offset += copied;
+        return SQL_SUCCESS_WITH_INFO;
+    }
+    offset = READ_DONE;
+    return SQL_SUCCESS;
+}
+
+SQLRETURN SQLGetDiagRec(SQLSMALLINT, SQLHANDLE handle, SQLSMALLINT record, SQLCHAR* state, SQLINTEGER* native,
+                        SQLCHAR* message, SQLSMALLINT message_capacity, SQLSMALLINT* message_length) {
+    const std::string& sqlstate = static_cast<FakeHandle*>(handle)->sqlstate;
+    if (record != 1 || sqlstate.empty()) {
+        return SQL_NO_DATA;
+    }
+    databricks::bench::copy_name(sqlstate, state, 6, nullptr);
+    if (native) {
+        *native = 0;
+    }
+    databricks::bench::copy_name("Injected by the fake driver", message, message_capacity, message_length);
+    return SQL_SUCCESS;
+}
+
+} // extern "C"
@@ -0,0 +1,90 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace databricks {
+namespace bench {
+/**
+ * @brief In-process ODBC driver that serves a synthetic result set
+ *
+ * fake_odbc.cpp defines the SQL* entry points the SDK calls. They are linked
+ * into the benchmark executable, which exports them, so on ELF platforms they
+ * take precedence over the driver manager's and every Client, pooled or not,
+ * talks to this driver instead of a warehouse. Connecting always succeeds and
+ * every query returns the configured shape as VARCHAR columns, with block
+ * fetches filling the bound row arrays directly.
+ *
+ * Besides the benchmarks, the driver tests (tests/driver) link it to run the
+ * fetch paths end to end.
+ *
+ * The calls are plain functions rather than gmock expectations (see
+ * tests/mocks/mock_odbc.h) so the driver adds as little as possible to the
+ * code paths being measured.
+ */
+struct FakeResultShape {
+    size_t rows = 0;         ///< Rows returned by every query
+    size_t columns = 1;      ///< VARCHAR columns per row
+    size_t value_bytes = 16; ///< Length of every value (also the declared column size)
+
+    /**
+     * @brief Value of each cell; empty = value_bytes copies of one letter per column
+     *
+     * Called for every cell fetched, concurrently across statements. Values
+     * may exceed the declared column size, the way Databricks STRING values
+     * exceed their nominal VARCHAR(255); a bound buffer too small for one gets
+     * a truncated prefix and the full length in its indicator.
+     */
+    std::function<std::string(size_t row, size_t column)> generator;
+
+    /**
+     * @brief How long each execution takes, sampled per statement; empty = returns at once
+     *
+     * Stands in for warehouse time: the executing thread sleeps, as it would
+     * block in a real driver.
+     */
+    std::function<std::chrono::microseconds()> execute_latency;
+
+    /**
+     * @brief SQLSTATE each execution fails with, asked per statement; empty or "" = it succeeds
+     *
+     * A connection-class state (08xxx) also kills the statement's connection:
+     * every later execution on it fails with 08S01 and SQL_ATTR_CONNECTION_DEAD
+     * reports it, until SQLDriverConnect opens it again.
+     */
+    std::function<std::string()> execute_error;
+
+    /**
+     * @brief How long each SQLFetch takes (one rowset), sampled per call; empty = returns at once
+     *
+     * Stands in for streaming a large result from the warehouse.
+     */
+    std::function<std::chrono::microseconds()> fetch_latency;
+
+    /**
+     * @brief Whether connections opened meanwhile report SQLGetData on bound rows of a block cursor
+     *
+     * Sets SQL_GD_BLOCK | SQL_GD_BOUND and SQL_CA1_POS_POSITION in SQLGetInfo;
+     * when false, SQLSetPos fails as it would on a driver without them.
+     */
+    bool bound_rereads = true;
+};
+
+/**
+ * @brief Set the result returned by queries executed after this call
+ *
+ * Not synchronised with running queries; call it before starting a benchmark.
+ */
+void set_fake_result(const FakeResultShape& shape);
+
+/**
+ * @brief Name SQLDrivers reports, matching SQLConfig's default odbc_driver_name
+ */
+std::string fake_driver_name();
+
+} // namespace bench
+} // namespace databricks
@@ -0,0 +1,126 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "fake_workspace.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace databricks {
+namespace bench {
+namespace {
+std::mt19937_64& thread_generator() {
+    thread_local std::mt19937_64 gen{std::random_device{}()};
+    return gen;
+}
+
+const std::string JOB_BODY =
+    R"({"job_id":1,"name":"load-test","creator_user_name":"bench@example.com","created_time":1700000000000,)"
+    R"("settings":{"name":"load-test","max_concurrent_runs":1}})";
+
+const std::string RUN_OUTPUT_BODY =
+    R"({"metadata":{"run_id":1,"job_id":1,"state":{"life_cycle_state":"TERMINATED","result_state":"SUCCESS"}},)"
+    R"("notebook_output":{"result":"ok","truncated":false}})";
+
+std::string table_body(const std::string& full_name) {
+    std::vector<std::string> parts;
+    std::stringstream stream(full_name);
+    for (std::string part; std::getline(stream, part, '.');) {
+        parts.push_back(part);
+    }
+    parts.resize(3);
+    return R"({"name":")" + parts[2] + R"(","catalog_name":")" + parts[0] + R"(","schema_name":")" + parts[1] +
+           R"(","full_name":")" + full_name + R"(","table_type":"MANAGED","data_source_format":"DELTA",)"
+           R"("columns":[{"name":"id","type_name":"LONG","position":0},)"
+           R"({"name":"value","type_name":"STRING","position":1}]})";
+}
+} // namespace
+
+std::chrono::microseconds LatencyDistribution::sample(std::mt19937_64& gen) const {
+    double ms = a_ms;
+    switch (kind) {
+    case Kind::Fixed:
+        break;
+    case Kind::Uniform:
+        ms = std::uniform_real_distribution<double>(a_ms, std::max(a_ms, b_ms))(gen);
+        break;
+    case Kind::LogNormal:
+        ms = a_ms > 0.0 ? std::lognormal_distribution<double>(std::log(a_ms), b_ms)(gen) : 0.0;
+        break;
+    }
+    return std::chrono::microseconds(static_cast<int64_t>(std::max(ms, 0.0) * 1000.0));
+}
+
+LatencyDistribution LatencyDistribution::parse(const std::string& spec) {
+    std::vector<std::string> parts;
+    std::stringstream stream(spec);
+    for (std::string part; std::getline(stream, part, ':');) {
+        parts.push_back(part);
+    }
+    LatencyDistribution latency;
+    try {
+        if (parts.size() == 2 && parts[0] == "fixed") {
+            latency.a_ms = std::stod(parts[1]);
+            return latency;
+        }
+        if (parts.size() == 3 && (parts[0] == "uniform" || parts[0] == "lognormal")) {
+            latency.kind = parts[0] == "uniform" ? Kind::Uniform : Kind::LogNormal;
+            latency.a_ms = std::stod(parts[1]);
+            latency.b_ms = std::stod(parts[2]);
+            return latency;
+        }
+    } catch (const std::logic_error&) {
+    }
+    throw std::invalid_argument("Bad latency '" + spec + "'; use fixed:MS, uniform:MIN:MAX or lognormal:MEDIAN:SIGMA");
+}
+
+FakeWorkspace::FakeWorkspace(const FaultConfig& faults)
+    : faults_(faults)
+    , server_([this](const LocalHttpServer::Request& request) { return handle(request); }) {}
+
+FakeWorkspace::Counts FakeWorkspace::counts() const {
+    Counts counts;
+    counts.requests = requests_.load();
+    counts.throttled = throttled_.load();
+    counts.unavailable = unavailable_.load();
+    return counts;
+}
+
+LocalHttpServer::Reply FakeWorkspace::handle(const LocalHttpServer::Request& request) {
+    ++requests_;
+    auto& gen = thread_generator();
+    LocalHttpServer::Reply reply;
+    reply.delay = faults_.latency.sample(gen);
+
+    const double roll = std::uniform_real_distribution<double>(0.0, 1.0)(gen);
+    if (roll < faults_.throttle_rate + faults_.unavailable_rate) {
+        const bool throttled = roll < faults_.throttle_rate;
+        ++(throttled ? throttled_ : unavailable_);
+        reply.status = throttled ? 429 : 503;
+        reply.body = throttled ? R"({"error_code":"REQUEST_LIMIT_EXCEEDED","message":"Too many requests"})"
+                               : R"({"error_code":"TEMPORARILY_UNAVAILABLE","message":"Service unavailable"})";
+        if (faults_.retry_after_seconds > 0) {
+            reply.headers.emplace_back("Retry-After", std::to_string(faults_.retry_after_seconds));
+        }
+        return reply;
+    }
+
+    const std::string path = request.target.substr(0, request.target.find('?'));
+    const std::string tables = "/unity-catalog/tables/";
+    if (path.size() > 9 && path.compare(path.size() - 9, 9, "/jobs/get") == 0) {
+        reply.body = JOB_BODY;
+    } else if (path.find("/jobs/runs/get-output") != std::string::npos) {
+        reply.body = RUN_OUTPUT_BODY;
+    } else if (auto pos = path.find(tables); pos != std::string::npos) {
+        reply.body = table_body(path.substr(pos + tables.size()));
+    } else {
+        reply.status = 404;
+        reply.body = R"({"error_code":"ENDPOINT_NOT_FOUND","message":"Not served by the fake workspace"})";
+    }
+    return reply;
+}
+
+} // namespace bench
+} // namespace databricks
@@ -0,0 +1,83 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "local_http_server.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
+
+namespace databricks {
+namespace bench {
+/**
+ * @brief Random latency, for REST replies and fake SQL executions
+ */
+struct LatencyDistribution {
+    enum class Kind {
+        Fixed,    ///< Always a_ms
+        Uniform,  ///< Uniform in [a_ms, b_ms]
+        LogNormal ///< Median a_ms, log-space standard deviation b_ms (long right tail)
+    };
+
+    Kind kind = Kind::Fixed;
+    double a_ms = 0.0;
+    double b_ms = 0.0;
+
+    std::chrono::microseconds sample(std::mt19937_64& gen) const;
+
+    /**
+     * @brief Parse "fixed:MS", "uniform:MIN_MS:MAX_MS" or "lognormal:MEDIAN_MS:SIGMA"
+     * @throws std::invalid_argument if spec is malformed
+     */
+    static LatencyDistribution parse(const std::string& spec);
+};
+
+/**
+ * @brief How FakeWorkspace misbehaves
+ */
+struct FaultConfig {
+    LatencyDistribution latency;   ///< Added to every reply, including faults
+    double throttle_rate = 0.0;    ///< Fraction of requests answered 429
+    double unavailable_rate = 0.0; ///< Fraction of requests answered 503
+    int retry_after_seconds = 0;   ///< Retry-After sent with 429 and 503 (0 = header omitted)
+};
+
+/**
+ * @brief Local stand-in for a workspace's REST API, with injected latency and failures
+ *
+ * Serves the Jobs and Unity Catalog lookups the load test drives
+ * (jobs/get, jobs/runs/get-output, unity-catalog/tables/...) with small canned
+ * bodies; anything else gets 404. Point AuthConfig::host at url().
+ */
+class FakeWorkspace {
+public:
+    /**
+     * @brief Requests seen so far, by outcome
+     */
+    struct Counts {
+        uint64_t requests = 0;
+        uint64_t throttled = 0;   ///< Answered 429
+        uint64_t unavailable = 0; ///< Answered 503
+    };
+
+    explicit FakeWorkspace(const FaultConfig& faults);
+
+    std::string url() const { return server_.url(); }
+
+    Counts counts() const;
+
+private:
+    LocalHttpServer::Reply handle(const LocalHttpServer::Request& request);
+
+    const FaultConfig faults_;
+    std::atomic<uint64_t> requests_{0};
+    std::atomic<uint64_t> throttled_{0};
+    std::atomic<uint64_t> unavailable_{0};
+    LocalHttpServer server_; // Declared last: stopped before the state its handler reads
+};
+
+} // namespace bench
+} // namespace databricks
@@ -0,0 +1,479 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+//
+// End-to-end load test: drives the pool, query_async, Jobs and Unity Catalog
+// against the fake ODBC driver and a local fake workspace with injected
+// latency and failures, over a sweep of concurrency levels, and reports
+// throughput, latency percentiles, threads and memory for each step.
+//
+//   sdk_load_test --concurrency=1,16,64 --duration=10 --rest-latency=lognormal:20:0.6 --throttle-rate=0.02
+//
+// Run with --help for every option.
+#include "bench_config.h"
+#include "fake_workspace.h"
+
+#include <databricks/connection_pool.h>
+#include <databricks/core/client.h>
+#include <databricks/jobs/jobs.h>
+#include <databricks/unity_catalog/unity_catalog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace databricks;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+struct Options {
+    std::vector<std::string> scenarios = {"pool", "query_async", "jobs", "uc"};
+    std::vector<size_t> concurrency = {1, 8, 32};
+    double duration_s = 5.0;
+    double target_qps = 0.0; // Per step, across all workers; 0 = every worker back to back
+    bench::FaultConfig faults;
+    bench::LatencyDistribution sql_latency;
+    size_t rows = 100;
+    size_t columns = 4;
+    size_t async_workers = 8;
+    size_t max_attempts = 3;
+    std::string json_path;
+};
+
+const char* USAGE = R"(Usage: sdk_load_test [options]
+
+  --scenarios=LIST        pool,query_async,jobs,uc (default: all)
+  --concurrency=LIST      Concurrent callers per step (default: 1,8,32)
+  --duration=SECONDS      Length of each step (default: 5)
+  --target-qps=N          Open-loop rate across all callers, 0 = closed loop (default: 0)
+  --rest-latency=DIST     Fake REST latency (default: fixed:0)
+  --sql-latency=DIST      Fake SQL execution latency (default: fixed:0)
+  --throttle-rate=F       Fraction of REST requests answered 429 (default: 0)
+  --unavailable-rate=F    Fraction of REST requests answered 503 (default: 0)
+  --retry-after=SECONDS   Retry-After sent with 429/503, 0 = none (default: 0)
+  --max-attempts=N        REST attempts per call, including retries (default: 3)
+  --rows=N --columns=N    Shape of every fake query result (default: 100 x 4)
+  --async-workers=N       AsyncConfig::worker_threads for query_async (default: 8)
+  --json=FILE             Also write one JSON object per step to FILE
+
+DIST is fixed:MS, uniform:MIN_MS:MAX_MS or lognormal:MEDIAN_MS:SIGMA.
+)";
+
+std::vector<std::string> split(const std::string& text) {
+    std::vector<std::string> parts;
+    std::stringstream stream(text);
+    for (std::string part; std::getline(stream, part, ',');) {
+        if (!part.empty()) {
+            parts.push_back(part);
+        }
+    }
+    return parts;
+}
+
+Options parse_options(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            std::cout << USAGE;
+            std::exit(0);
+        }
+        const size_t eq = arg.find('=');
+        if (arg.compare(0, 2, "--") != 0 || eq == std::string::npos) {
+            throw std::invalid_argument("Unrecognized argument: " + arg);
+        }
+        const std::string name = arg.substr(2, eq - 2);
+        const std::string value = arg.substr(eq + 1);
+        if (name == "scenarios") {
+            options.scenarios = split(value);
+        } else if (name == "concurrency") {
+            options.concurrency.clear();
+            for (const auto& level : split(value)) {
+                options.concurrency.push_back(std::max<size_t>(std::stoul(level), 1));
+            }
+        } else if (name == "duration") {
+            options.duration_s = std::stod(value);
+        } else if (name == "target-qps") {
+            options.target_qps = std::stod(value);
+        } else if (name == "rest-latency") {
+            options.faults.latency = bench::LatencyDistribution::parse(value);
+        } else if (name == "sql-latency") {
+            options.sql_latency = bench::LatencyDistribution::parse(value);
+        } else if (name == "throttle-rate") {
+            options.faults.throttle_rate = std::stod(value);
+        } else if (name == "unavailable-rate") {
+            options.faults.unavailable_rate = std::stod(value);
+        } else if (name == "retry-after") {
+            options.faults.retry_after_seconds = std::stoi(value);
+        } else if (name == "max-attempts") {
+            options.max_attempts = std::max<size_t>(std::stoul(value), 1);
+        } else if (name == "rows") {
+            options.rows = std::stoul(value);
+        } else if (name == "columns") {
+            options.columns = std::max<size_t>(std::stoul(value), 1);
+        } else if (name == "async-workers") {
+            options.async_workers = std::max<size_t>(std::stoul(value), 1);
+        } else if (name == "json") {
+            options.json_path = value;
+        } else {
+            throw std::invalid_argument("Unrecognized option: --" + name);
+        }
+    }
+    return options;
+}
+
+// ========== Process statistics ==========
+
+// Current thread count, from /proc (0 where it is not available)
+size_t thread_count() {
+    std::ifstream status("/proc/self/status");
+    for (std::string line; std::getline(status, line);) {
+        if (line.compare(0, 8, "Threads:") == 0) {
+            return std::stoul(line.substr(8));
+        }
+    }
+    return 0;
+}
+
+// Resident set size in bytes, from /proc (0 where it is not available)
+uint64_t resident_bytes() {
+    std::ifstream statm("/proc/self/statm");
+    uint64_t pages = 0;
+    uint64_t resident = 0;
+    if (statm >> pages >> resident) {
+        return resident * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    }
+    return 0;
+}
+
+/**
+ * @brief Samples threads and RSS in the background, keeping the peaks
+ */
+class ProcessSampler {
+public:
+    ProcessSampler()
+        : thread_([this]() {
+            while (!stopping_) {
+                sample();
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            }
+        }) {}
+
+    ~ProcessSampler() { stop(); }
+
+    void stop() {
+        stopping_ = true;
+        if (thread_.joinable()) {
+            thread_.join();
+            sample();
+        }
+    }
+
+    size_t peak_threads() const { return peak_threads_; }
+    uint64_t peak_rss() const { return peak_rss_; }
+
+private:
+    void sample() {
+        peak_threads_ = std::max(peak_threads_.load(), thread_count());
+        peak_rss_ = std::max(peak_rss_.load(), resident_bytes());
+    }
+
+    std::atomic<bool> stopping_{false};
+    std::atomic<size_t> peak_threads_{0};
+    std::atomic<uint64_t> peak_rss_{0};
+    std::thread thread_;
+};
+
+// ========== Scenarios ==========
+
+/**
+ * @brief One step's SDK objects; op() runs a single call and throws on failure
+ */
+struct Scenario {
+    std::function<void()> op;
+    std::function<bench::FakeWorkspace::Counts()> server_counts; // Empty for SQL scenarios
+    std::vector<std::shared_ptr<void>> keep_alive;              // Objects op() uses
+};
+
+AuthConfig sql_auth() {
+    return bench::bench_auth();
+}
+
+HttpConfig rest_config(const Options& options, size_t concurrency) {
+    HttpConfig http;
+    http.max_concurrent_requests = concurrency;
+    http.retry.max_attempts = options.max_attempts;
+    return http;
+}
+
+Scenario make_scenario(const std::string& name, const Options& options, size_t concurrency) {
+    Scenario scenario;
+    const std::string sql = "SELECT * FROM load_test";
+
+    if (name == "pool") {
+        PoolingConfig pooling;
+        pooling.enabled = true;
+        pooling.min_connections = concurrency;
+        pooling.max_connections = concurrency;
+        pooling.connection_timeout_ms = 60000;
+        auto pool = std::make_shared<ConnectionPool>(sql_auth(), bench::bench_sql(), pooling);
+        pool->warm_up();
+        scenario.op = [pool, sql]() { pool->acquire()->query(sql); };
+        scenario.keep_alive.push_back(pool);
+    } else if (name == "query_async") {
+        PoolingConfig pooling;
+        pooling.enabled = true;
+        pooling.min_connections = options.async_workers;
+        pooling.max_connections = options.async_workers;
+        AsyncConfig async;
+        async.worker_threads = options.async_workers;
+        async.max_pending_tasks = std::max<size_t>(concurrency, 1);
+        auto client = std::make_shared<Client>(Client::Builder()
+                                                   .with_auth(sql_auth())
+                                                   .with_sql(bench::bench_sql())
+                                                   .with_pooling(pooling)
+                                                   .with_async(async)
+                                                   .build());
+        scenario.op = [client, sql]() { client->query_async(sql).get(); };
+        scenario.keep_alive.push_back(client);
+    } else if (name == "jobs" || name == "uc") {
+        auto workspace = std::make_shared<bench::FakeWorkspace>(options.faults);
+        const AuthConfig auth = bench::bench_auth(workspace->url());
+        if (name == "jobs") {
+            auto jobs = std::make_shared<Jobs>(auth, rest_config(options, concurrency));
+            scenario.op = [jobs]() { jobs->get_job(1); };
+            scenario.keep_alive.push_back(jobs);
+        } else {
+            auto uc = std::make_shared<UnityCatalog>(auth, rest_config(options, concurrency));
+            scenario.op = [uc]() { uc->get_table("main.sales.orders"); };
+            scenario.keep_alive.push_back(uc);
+        }
+        scenario.server_counts = [workspace]() { return workspace->counts(); };
+        // Destroyed last, after the clients that talk to it
+        scenario.keep_alive.insert(scenario.keep_alive.begin(), workspace);
+    } else {
+        throw std::invalid_argument("Unknown scenario: " + name);
+    }
+    return scenario;
+}
+
+// ========== Measurement ==========
+
+struct StepResult {
+    std::string scenario;
+    size_t concurrency = 0;
+    uint64_t ops = 0;
+    uint64_t errors = 0;
+    double seconds = 0.0;
+    double p50_ms = 0.0;
+    double p99_ms = 0.0;
+    double p999_ms = 0.0;
+    double max_ms = 0.0;
+    size_t peak_threads = 0;
+    uint64_t peak_rss = 0;
+    bench::FakeWorkspace::Counts server;
+    std::string first_error;
+};
+
+double percentile_ms(const std::vector<int64_t>& sorted_us, double quantile) {
+    if (sorted_us.empty()) {
+        return 0.0;
+    }
+    const size_t index = std::min(sorted_us.size() - 1, static_cast<size_t>(quantile * sorted_us.size()));
+    return static_cast<double>(sorted_us[index]) / 1000.0;
+}
+
+StepResult run_step(const std::string& name, const Options& options, size_t concurrency) {
+    Scenario scenario = make_scenario(name, options, concurrency);
+    StepResult result;
+    result.scenario = name;
+    result.concurrency = concurrency;
+
+    // Open loop: each caller starts its calls on a fixed schedule, and latency
+    // counts from the scheduled start, so a stall shows up in the tail instead
+    // of silently lowering the request rate
+    const auto interval = options.target_qps > 0
+                              ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(
+                                    static_cast<double>(concurrency) / options.target_qps))
+                              : Clock::duration::zero();
+
+    std::vector<std::vector<int64_t>> latencies(concurrency);
+    std::vector<uint64_t> errors(concurrency, 0);
+    std::vector<std::string> first_errors(concurrency);
+    std::atomic<bool> go{false};
+    ProcessSampler sampler;
+
+    const auto started = Clock::now();
+    const auto deadline = started + std::chrono::duration_cast<Clock::duration>(
+                                        std::chrono::duration<double>(options.duration_s));
+    std::vector<std::thread> callers;
+    for (size_t t = 0; t < concurrency; ++t) {
+        callers.emplace_back([&, t]() {
+            while (!go) {
+                std::this_thread::yield();
+            }
+            // Stagger open-loop callers across one interval
+            auto next = started + interval * static_cast<Clock::rep>(t) / static_cast<Clock::rep>(concurrency);
+            while (true) {
+                Clock::time_point begin = Clock::now();
+                if (interval > Clock::duration::zero()) {
+                    std::this_thread::sleep_until(next);
+                    begin = next;
+                    next += interval;
+                }
+                if (begin >= deadline) {
+                    break;
+                }
+                try {
+                    scenario.op();
+                } catch (const std::exception& e) {
+                    if (errors[t]++ == 0) {
+                        first_errors[t] = e.what();
+                    }
+                }
+                latencies[t].push_back(
+                    std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - begin).count());
+            }
+        });
+    }
+    go = true;
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    result.seconds = std::chrono::duration<double>(Clock::now() - started).count();
+    sampler.stop();
+
+    std::vector<int64_t> all;
+    for (size_t t = 0; t < concurrency; ++t) {
+        all.insert(all.end(), latencies[t].begin(), latencies[t].end());
+        result.errors += errors[t];
+        if (result.first_error.empty()) {
+            result.first_error = first_errors[t];
+        }
+    }
+    std::sort(all.begin(), all.end());
+    result.ops = all.size();
+    result.p50_ms = percentile_ms(all, 0.50);
+    result.p99_ms = percentile_ms(all, 0.99);
+    result.p999_ms = percentile_ms(all, 0.999);
+    result.max_ms = all.empty() ? 0.0 : static_cast<double>(all.back()) / 1000.0;
+    result.peak_threads = sampler.peak_threads();
+    result.peak_rss = sampler.peak_rss();
+    if (scenario.server_counts) {
+        result.server = scenario.server_counts();
+    }
+    return result;
+}
+
+// ========== Reporting ==========
+
+void print_header() {
+    std::printf("%-12s %5s %9s %7s %10s %9s %9s %9s %9s %7s %8s %9s %6s %6s\n", "scenario", "conc", "ops", "errors",
+                "ops/s", "p50 ms", "p99 ms", "p999 ms", "max ms", "threads", "rss MB", "srv reqs", "429", "503");
+}
+
+void print_row(const StepResult& r) {
+    std::printf("%-12s %5zu %9llu %7llu %10.1f %9.3f %9.3f %9.3f %9.3f %7zu %8.1f %9llu %6llu %6llu\n",
+                r.scenario.c_str(), r.concurrency, static_cast<unsigned long long>(r.ops),
+                static_cast<unsigned long long>(r.errors), static_cast<double>(r.ops) / r.seconds, r.p50_ms,
+                r.p99_ms, r.p999_ms, r.max_ms, r.peak_threads, static_cast<double>(r.peak_rss) / (1024.0 * 1024.0),
+                static_cast<unsigned long long>(r.server.requests),
+                static_cast<unsigned long long>(r.server.throttled),
+                static_cast<unsigned long long>(r.server.unavailable));
+    if (!r.first_error.empty()) {
+        std::printf("    first error: %s\n", r.first_error.c_str());
+    }
+    std::fflush(stdout);
+}
+
+std::string json_escape(const std::string& text) {
+    std::string out;
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out += ' ';
+        } else {
+            out += c;
+        }
+    }
+    return out;
+}
+
+void write_json(std::ostream& out, const StepResult& r) {
+    out << "{\"scenario\":\"" << r.scenario << "\",\"concurrency\":" << r.concurrency << ",\"ops\":" << r.ops
+        << ",\"errors\":" << r.errors << ",\"seconds\":" << r.seconds
+        << ",\"throughput\":" << static_cast<double>(r.ops) / r.seconds << ",\"p50_ms\":" << r.p50_ms
+        << ",\"p99_ms\":" << r.p99_ms << ",\"p999_ms\":" << r.p999_ms << ",\"max_ms\":" << r.max_ms
+        << ",\"peak_threads\":" << r.peak_threads << ",\"peak_rss_bytes\":" << r.peak_rss
+        << ",\"server_requests\":" << r.server.requests << ",\"server_429\":" << r.server.throttled
+        << ",\"server_503\":" << r.server.unavailable << ",\"first_error\":\"" << json_escape(r.first_error)
+        << "\"}\n";
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    // Per-call INFO logs would dominate the measurement
+    setenv("DATABRICKS_LOG_LEVEL", "error", 0);
+
+    Options options;
+    try {
+        options = parse_options(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n\n" << USAGE;
+        return 2;
+    }
+
+    bench::FakeResultShape shape;
+    shape.rows = options.rows;
+    shape.columns = options.columns;
+    if (options.sql_latency.kind != bench::LatencyDistribution::Kind::Fixed || options.sql_latency.a_ms > 0.0) {
+        shape.execute_latency = [latency = options.sql_latency]() {
+            thread_local std::mt19937_64 gen{std::random_device{}()};
+            return latency.sample(gen);
+        };
+    }
+    bench::set_fake_result(shape);
+
+    std::ofstream json;
+    if (!options.json_path.empty()) {
+        json.open(options.json_path);
+        if (!json) {
+            std::cerr << "Cannot write " << options.json_path << "\n";
+            return 2;
+        }
+    }
+
+    print_header();
+    int status = 0;
+    for (const auto& scenario : options.scenarios) {
+        for (size_t concurrency : options.concurrency) {
+            try {
+                StepResult result = run_step(scenario, options, concurrency);
+                print_row(result);
+                if (json) {
+                    write_json(json, result);
+                }
+            } catch (const std::exception& e) {
+                std::fprintf(stderr, "%s at concurrency %zu failed to start: %s\n", scenario.c_str(), concurrency,
+                             e.what());
+                status = 1;
+            }
+        }
+    }
+    return status;
+}
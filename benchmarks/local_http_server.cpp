@@ -0,0 +1,227 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "local_http_server.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace databricks {
+namespace bench {
+namespace {
+/**
+ * @brief Value of Content-Length in a request head, 0 when absent
+ */
+size_t content_length(const std::string& head) {
+    std::string lower(head);
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return std::tolower(c); });
+    const std::string name = "\r\ncontent-length:";
+    const size_t pos = lower.find(name);
+    if (pos == std::string::npos) {
+        return 0;
+    }
+    return std::strtoul(lower.c_str() + pos + name.size(), nullptr, 10);
+}
+
+const char* reason_phrase(int status) {
+    switch (status) {
+    case 200:
+        return "OK";
+    case 204:
+        return "No Content";
+    case 404:
+        return "Not Found";
+    case 429:
+        return "Too Many Requests";
+    case 500:
+        return "Internal Server Error";
+    case 503:
+        return "Service Unavailable";
+    default:
+        return "Status";
+    }
+}
+
+std::string format_reply(const LocalHttpServer::Reply& reply) {
+    std::string out = "HTTP/1.1 " + std::to_string(reply.status) + " " + reason_phrase(reply.status) +
+                      "\r\n"
+                      "Content-Type: application/json\r\n"
+                      "Content-Length: " +
+                      std::to_string(reply.body.size()) + "\r\n";
+    for (const auto& [name, value] : reply.headers) {
+        out += name + ": " + value + "\r\n";
+    }
+    out += "\r\n";
+    out += reply.body;
+    return out;
+}
+
+// "GET /path?query HTTP/1.1" at the start of a request head
+LocalHttpServer::Request parse_request_line(const std::string& head) {
+    LocalHttpServer::Request request;
+    const size_t method_end = head.find(' ');
+    if (method_end == std::string::npos) {
+        return request;
+    }
+    request.method = head.substr(0, method_end);
+    const size_t target_end = head.find(' ', method_end + 1);
+    request.target = head.substr(method_end + 1, target_end == std::string::npos ? target_end
+                                                                                 : target_end - method_end - 1);
+    return request;
+}
+
+bool send_all(int fd, const std::string& data) {
+    size_t sent = 0;
+    while (sent < data.size()) {
+        ssize_t n = ::send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (n <= 0) {
+            return false;
+        }
+        sent += static_cast<size_t>(n);
+    }
+    return true;
+}
+} // namespace
+
+LocalHttpServer::LocalHttpServer(std::string body) {
+    response_ = "HTTP/1.1 200 OK\r\n"
+                "Content-Type: application/json\r\n"
+                "Content-Length: " +
+                std::to_string(body.size()) + "\r\n\r\n" + body;
+    listen();
+}
+
+LocalHttpServer::LocalHttpServer(Handler handler)
+    : handler_(std::move(handler)) {
+    listen();
+}
+
+void LocalHttpServer::listen() {
+    listen_fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (listen_fd_ < 0) {
+        throw std::runtime_error("Failed to create benchmark server socket");
+    }
+    int reuse = 1;
+    ::setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0; // Any free port
+    socklen_t addr_len = sizeof(addr);
+    if (::bind(listen_fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        ::listen(listen_fd_, SOMAXCONN) != 0 ||
+        ::getsockname(listen_fd_, reinterpret_cast<sockaddr*>(&addr), &addr_len) != 0) {
+        ::close(listen_fd_);
+        throw std::runtime_error("Failed to listen on 127.0.0.1: " + std::string(std::strerror(errno)));
+    }
+    port_ = ntohs(addr.sin_port);
+
+    acceptor_ = std::thread([this]() { accept_loop(); });
+}
+
+LocalHttpServer::~LocalHttpServer() {
+    stopping_ = true;
+    // Wakes the blocked accept() and recv() calls
+    ::shutdown(listen_fd_, SHUT_RDWR);
+    acceptor_.join();
+    ::close(listen_fd_);
+
+    std::vector<std::thread> workers;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (int fd : connections_) {
+            ::shutdown(fd, SHUT_RDWR);
+        }
+        workers.swap(workers_);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+std::string LocalHttpServer::url() const {
+    return "http://127.0.0.1:" + std::to_string(port_);
+}
+
+void LocalHttpServer::accept_loop() {
+    while (!stopping_) {
+        int fd = ::accept(listen_fd_, nullptr, nullptr);
+        if (fd < 0) {
+            if (stopping_) {
+                break;
+            }
+            continue;
+        }
+        int nodelay = 1;
+        ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_) {
+            ::close(fd);
+            break;
+        }
+        connections_.push_back(fd);
+        workers_.emplace_back([this, fd]() { serve(fd); });
+    }
+}
+
+void LocalHttpServer::serve(int fd) {
+    std::string pending;
+    char buffer[16384];
+    auto receive = [&]() {
+        ssize_t n = ::recv(fd, buffer, sizeof(buffer), 0);
+        if (n <= 0) {
+            return false;
+        }
+        pending.append(buffer, static_cast<size_t>(n));
+        return true;
+    };
+
+    bool open = true;
+    while (open && !stopping_) {
+        // Read one request head, then skip its body
+        size_t head_end = std::string::npos;
+        while (open && (head_end = pending.find("\r\n\r\n")) == std::string::npos) {
+            open = receive();
+        }
+        if (!open) {
+            break;
+        }
+
+        const size_t request_end = head_end + 4 + content_length(pending.substr(0, head_end + 2));
+        while (open && pending.size() < request_end) {
+            open = receive();
+        }
+        if (!open) {
+            break;
+        }
+        if (!handler_) {
+            pending.erase(0, request_end);
+            open = send_all(fd, response_);
+            continue;
+        }
+        Reply reply = handler_(parse_request_line(pending.substr(0, head_end)));
+        pending.erase(0, request_end);
+        if (reply.delay.count() > 0) {
+            std::this_thread::sleep_for(reply.delay);
+        }
+        open = send_all(fd, format_reply(reply));
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    connections_.erase(std::remove(connections_.begin(), connections_.end(), fd), connections_.end());
+    ::close(fd);
+}
+
+} // namespace bench
+} // namespace databricks
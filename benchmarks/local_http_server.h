@@ -0,0 +1,95 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace databricks {
+namespace bench {
+/**
+ * @brief Minimal HTTP/1.1 server on 127.0.0.1 for measuring client overhead
+ *
+ * By default answers every request with the same 200 response and keeps
+ * connections alive, so a benchmark sees the SDK's per-request cost (headers,
+ * retry and rate-limit bookkeeping, response handling) plus one loopback
+ * round trip. With a Handler each request gets the reply the handler builds,
+ * which lets the load test vary status, headers and latency per request.
+ * Each connection is served on its own thread. Request bodies are skipped
+ * using Content-Length; chunked uploads are not supported.
+ */
+class LocalHttpServer {
+public:
+    /**
+     * @brief Request line of a received request
+     */
+    struct Request {
+        std::string method; ///< e.g. "GET"
+        std::string target; ///< Path and query string, e.g. "/api/2.2/jobs/get?job_id=1"
+    };
+
+    /**
+     * @brief Response a Handler returns
+     */
+    struct Reply {
+        int status = 200;
+        std::string body;
+        std::vector<std::pair<std::string, std::string>> headers; ///< Sent besides Content-Type and Content-Length
+        std::chrono::microseconds delay{0};                       ///< Held on the connection before replying
+    };
+
+    /**
+     * @brief Builds the reply to a request; called on the connection's thread, concurrently across connections
+     */
+    using Handler = std::function<Reply(const Request&)>;
+
+    /**
+     * @param body Response body returned for every request
+     * @throws std::runtime_error if the listening socket cannot be created
+     */
+    explicit LocalHttpServer(std::string body);
+
+    /**
+     * @param handler Builds the reply to every request
+     * @throws std::runtime_error if the listening socket cannot be created
+     */
+    explicit LocalHttpServer(Handler handler);
+
+    /**
+     * @brief Stop accepting, close open connections and join their threads
+     */
+    ~LocalHttpServer();
+
+    LocalHttpServer(const LocalHttpServer&) = delete;
+    LocalHttpServer& operator=(const LocalHttpServer&) = delete;
+
+    /**
+     * @brief Base URL to use as AuthConfig::host, e.g. "http://127.0.0.1:40123"
+     */
+    std::string url() const;
+
+private:
+    void listen();
+    void accept_loop();
+    void serve(int fd);
+
+    std::string response_; // Fixed response, when there is no handler_
+    Handler handler_;
+    int listen_fd_ = -1;
+    int port_ = 0;
+    std::atomic<bool> stopping_{false};
+    std::thread acceptor_;
+
+    std::mutex mutex_;
+    std::vector<int> connections_;     // Guarded by mutex_
+    std::vector<std::thread> workers_; // Guarded by mutex_
+};
+
+} // namespace bench
+} // namespace databricks
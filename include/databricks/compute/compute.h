@@ -4,11 +4,16 @@
 
 #include "databricks/compute/compute_types.h"
 #include "databricks/core/config.h"
+#include "databricks/core/paginator.h"
 
+#include <chrono>
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include <nlohmann/json_fwd.hpp>
+
 namespace databricks {
 // Forward declaration for dependency injection
 namespace internal {
@@ -34,6 +39,9 @@ class IHttpClient;
  *
  * // Start a terminated compute cluster
  * compute.start_compute("1234-567890-abcde123");
+ *
+ * // Wait until it is ready
+ * compute.wait_for_state("1234-567890-abcde123", databricks::ClusterStateEnum::RUNNING).get();
  * @endcode
  */
 class Compute {
@@ -68,6 +76,29 @@ public:
      */
     std::vector<Cluster> list_compute();
 
+    /**
+     * @brief List the compute clusters matching a filter
+     *
+     * Follows every page of the listing. Clusters the server filters out are
+     * never downloaded or parsed, which keeps frequent polling of a large
+     * workspace cheap.
+     *
+     * @param filter States, sources, policy and creator to match
+     * @return Vector of matching Cluster objects
+     * @throws std::runtime_error if a page request fails
+     * @see clusters()
+     */
+    std::vector<Cluster> list_compute(const ClusterListFilter& filter);
+
+    /**
+     * @brief Iterate over the compute clusters matching a filter, a page at a time
+     *
+     * @param filter States, sources, policy and creator to match
+     * @return Paginator yielding Cluster objects
+     * @throws std::runtime_error during iteration if a page request fails
+     */
+    Paginator<Cluster> clusters(const ClusterListFilter& filter = ClusterListFilter{});
+
     /**
      * @brief Create a new Spark Cluster
      *
@@ -117,13 +148,68 @@ public:
      */
     bool restart_compute(const std::string& cluster_id);
 
+    /**
+     * @brief Start several clusters, sending up to max_concurrent requests at once
+     *
+     * A failure for one cluster does not stop the others; each outcome is
+     * reported in the result for that cluster.
+     *
+     * @param cluster_ids Clusters to start
+     * @param max_concurrent Requests in flight at once
+     * @return One result per cluster, in the order of cluster_ids
+     * @throws std::invalid_argument if max_concurrent is 0
+     */
+    std::vector<ClusterOperationResult> start_compute_batch(const std::vector<std::string>& cluster_ids,
+                                                            size_t max_concurrent = 16);
+
+    /**
+     * @brief Terminate several clusters, sending up to max_concurrent requests at once
+     * @see start_compute_batch()
+     */
+    std::vector<ClusterOperationResult> terminate_compute_batch(const std::vector<std::string>& cluster_ids,
+                                                                size_t max_concurrent = 16);
+
+    /**
+     * @brief Restart several clusters, sending up to max_concurrent requests at once
+     * @see start_compute_batch()
+     */
+    std::vector<ClusterOperationResult> restart_compute_batch(const std::vector<std::string>& cluster_ids,
+                                                              size_t max_concurrent = 16);
+
+    /**
+     * @brief Wait for a compute cluster to reach a lifecycle state
+     *
+     * The cluster is watched by the SDK's shared status poller, which checks
+     * all outstanding waits in one batch per tick and backs off while the
+     * state is unchanged (see PollConfig). The returned future does not depend
+     * on this Compute object.
+     *
+     * @param cluster_id The unique identifier of the cluster
+     * @param state State to wait for
+     * @param timeout How long to wait before failing the future
+     * @param poll Polling schedule
+     * @return Future holding the cluster once it reports the state
+     * @throws std::invalid_argument if poll is invalid
+     *
+     * @note The future throws std::runtime_error on timeout, if a status request
+     *       fails, or if the cluster settles in TERMINATED or ERROR instead. The
+     *       first check may still see the state from before a start or restart.
+     */
+    std::future<Cluster> wait_for_state(const std::string& cluster_id, ClusterStateEnum state,
+                                        std::chrono::milliseconds timeout = std::chrono::minutes(30),
+                                        const PollConfig& poll = PollConfig{});
+
 private:
     class Impl;
     std::unique_ptr<Impl> pimpl_;
 
     bool compute_operation(const std::string& cluster_id, const std::string& endpoint,
                            const std::string& operation_name);
+    std::vector<ClusterOperationResult> batch_operation(const std::vector<std::string>& cluster_ids,
+                                                        const std::string& endpoint, const std::string& operation_name,
+                                                        size_t max_concurrent);
     static std::vector<Cluster> parse_compute_list(const std::string& json_str);
     static Cluster parse_compute(const std::string& json_str);
+    static Cluster parse_compute(const nlohmann::json& j);
 };
 } // namespace databricks
\ No newline at end of file
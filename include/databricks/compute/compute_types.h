@@ -4,7 +4,9 @@
 
 #include <cstdint>
 #include <map>
+#include <optional>
 #include <string>
+#include <vector>
 
 namespace databricks {
 
@@ -77,4 +79,30 @@ struct ClusterState {
     static ClusterState from_json(const std::string& json_str);
 };
 
+/**
+ * @brief Filter for Compute::list_compute() and Compute::clusters()
+ *
+ * Everything but creator_user_name is applied by the server, so clusters that
+ * don't match are never sent. The API has no creator filter; that one is
+ * applied to each page as it arrives.
+ */
+struct ClusterListFilter {
+    std::vector<ClusterStateEnum> states;     ///< Only clusters in one of these states (default: any)
+    std::vector<std::string> cluster_sources; ///< Only clusters created by these sources, e.g. "JOB" or "UI"
+    std::optional<bool> is_pinned;            ///< Only pinned or only unpinned clusters (default: either)
+    std::string policy_id;                    ///< Only clusters using this policy (default: any)
+    std::string creator_user_name;            ///< Only clusters created by this user (default: any)
+    int page_size = 0;                        ///< Clusters per page, 0 for the server default
+};
+
+/**
+ * @brief Outcome for one cluster of a batch start, terminate or restart
+ */
+struct ClusterOperationResult {
+    std::string cluster_id; ///< Cluster the operation was sent for
+    bool success = false;   ///< Whether the API accepted the operation
+    int status_code = 0;    ///< HTTP status of the response (0 if no response was received)
+    std::string error;      ///< Failure message when success is false
+};
+
 } // namespace databricks
\ No newline at end of file
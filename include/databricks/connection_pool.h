@@ -4,11 +4,15 @@
 
 #include "databricks/core/config.h"
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <future>
 #include <memory>
 #include <mutex>
-#include <queue>
+#include <optional>
+#include <thread>
 #include <vector>
 
 // Forward declare Client to avoid circular dependency
@@ -28,6 +32,13 @@ namespace databricks {
  *
  * The ConnectionPool manages a pool of reusable ODBC connections to improve
  * performance by eliminating connection overhead for repeated operations.
+ *
+ * Idle connections are spread over PoolingConfig::shards lists, each with its
+ * own lock. A thread returns to and takes from its home list, and only visits
+ * the others when that one is empty, so threads rarely contend on a lock.
+ * The reuse policy orders each list; across lists it is approximate. A thread
+ * returning a connection while others wait hands it straight to the oldest
+ * waiter instead of going through an idle list.
  */
 class ConnectionPool {
 public:
@@ -71,9 +82,24 @@ public:
          */
         const Client* operator->() const;
 
+        /**
+         * @brief Close the connection when this wrapper lets go of it, instead of returning it to the pool
+         *
+         * For a connection the driver reported lost (08xxx): pooled again, it
+         * would fail its next borrower the same way. Its slot is freed for a
+         * new connection.
+         */
+        void invalidate() { broken_ = true; }
+
     private:
+        void release();
+
         std::unique_ptr<Client> client_;
         ConnectionPool* pool_;
+        std::chrono::steady_clock::time_point created_at_; // When the pool opened the connection
+        bool broken_ = false;                              // Set by invalidate()
+
+        friend class ConnectionPool;
     };
 
     /**
@@ -86,6 +112,22 @@ public:
     ConnectionPool(const AuthConfig& auth, const SQLConfig& sql, size_t min_connections = 1,
                    size_t max_connections = 10);
 
+    /**
+     * @brief Construct a ConnectionPool from a PoolingConfig
+     *
+     * Every pool setting (size, acquire timeout, reuse policy, idle timeout, max
+     * lifetime, validation) comes from pooling. The maintenance thread starts unless
+     * maintenance_interval_ms is 0. Pooled connections use retry for their own
+     * connect and query retries.
+     *
+     * @param auth Authentication configuration
+     * @param sql SQL configuration
+     * @param pooling Pooling configuration
+     * @param retry Retry configuration for pooled connections
+     */
+    ConnectionPool(const AuthConfig& auth, const SQLConfig& sql, const PoolingConfig& pooling,
+                   const RetryConfig& retry = RetryConfig{});
+
     /**
      * @brief Destructor - closes all connections
      */
@@ -106,16 +148,48 @@ public:
      * a new connection is created. Otherwise, waits for a connection to
      * become available (up to connection_timeout_ms).
      *
+     * A new connection's slot is reserved up front, but the connect handshake
+     * runs without holding any pool lock, so other threads can acquire and
+     * return connections meanwhile. If the connect fails the slot is released.
+     *
+     * Idle connections past max_lifetime_ms are closed instead of reused. With
+     * validate_on_borrow, an idle connection is checked first and replaced if
+     * the driver reports it dead (or SELECT 1 fails after validation_idle_ms).
+     *
      * @return PooledConnection RAII wrapper
      * @throws std::runtime_error if timeout occurs or connection fails
      */
     PooledConnection acquire();
 
+    /**
+     * @brief Acquire a connection, giving up at a deadline instead of throwing
+     *
+     * Behaves like acquire() but waits only until deadline, which lets
+     * latency-sensitive callers fail fast or fall back. A deadline in the past
+     * still returns an idle connection (or opens one) if the pool has capacity.
+     *
+     * @code
+     * auto conn = pool.try_acquire(std::chrono::steady_clock::now() + std::chrono::milliseconds(50));
+     * if (!conn) {
+     *     return serve_from_cache();
+     * }
+     * auto rows = (*conn)->query("SELECT 1");
+     * @endcode
+     *
+     * @param deadline Latest time to wait for a connection to be returned
+     * @return The connection, or std::nullopt if none became available in time
+     * @throws std::runtime_error if the pool is shut down or opening a connection fails
+     */
+    std::optional<PooledConnection> try_acquire(std::chrono::steady_clock::time_point deadline);
+
     /**
      * @brief Pre-warm the pool by creating minimum connections
      *
-     * Creates min_connections in the pool without blocking. Useful for
+     * Opens the connections missing up to min_connections in parallel and
+     * waits for them. The pool stays usable while they connect. Useful for
      * reducing initial latency.
+     *
+     * @throws std::runtime_error if any connection fails (the others are kept)
      */
     void warm_up();
 
@@ -135,43 +209,159 @@ public:
         size_t total_connections;     ///< Total connections created
         size_t available_connections; ///< Connections currently available
         size_t active_connections;    ///< Connections currently in use
+        size_t pending_connections;   ///< Connections currently being opened (counted in total)
     };
 
     /**
      * @brief Get current pool statistics
+     *
+     * Reads the counters without locking; under load they may be momentarily
+     * out of step with each other.
+     *
      * @return Stats structure with current pool state
      */
     Stats get_stats() const;
 
     /**
      * @brief Shutdown the pool and close all connections
+     *
+     * Also stops the maintenance thread.
      */
     void shutdown();
 
+    /**
+     * @brief Run one maintenance pass now
+     *
+     * Closes idle connections past idle_timeout_ms (keeping min_connections) or
+     * max_lifetime_ms, closes connections the driver reports dead, and tops the
+     * pool back up to min_connections once it has been used. The maintenance
+     * thread calls this every maintenance_interval_ms.
+     */
+    void run_maintenance();
+
 private:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief A connection waiting in the pool
+     */
+    struct IdleConnection {
+        std::unique_ptr<Client> client;
+        Clock::time_point created_at;
+        Clock::time_point idle_since;
+    };
+
+    /**
+     * @brief One idle list and its lock, on its own cache line
+     */
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        std::deque<IdleConnection> idle; // Ordered oldest-returned first
+        std::atomic<size_t> size{0};     // idle.size(), readable without the lock to skip empty shards
+    };
+
+    /**
+     * @brief A thread blocked in try_acquire (lives on its stack; guarded by mutex_)
+     */
+    struct Waiter {
+        std::condition_variable cv;
+        std::optional<IdleConnection> handoff; // Set by the thread that hands it a connection
+        bool woken = false;                    // Set when a slot frees up or the pool shuts down
+    };
+
     AuthConfig auth_;
     SQLConfig sql_;
+    PoolingConfig pooling_;
+    RetryConfig retry_;
     size_t min_connections_;
     size_t max_connections_;
     int connection_timeout_ms_;
 
-    std::queue<std::unique_ptr<Client>> available_connections_;
-    size_t total_connections_;
-    size_t active_connections_;
-    bool shutdown_;
+    std::unique_ptr<Shard[]> shards_;
+    size_t shard_count_;
+    std::atomic<size_t> total_connections_;
+    std::atomic<size_t> active_connections_;
+    std::atomic<size_t> pending_connections_;
+    std::atomic<size_t> waiting_; // waiters_.size(), readable without mutex_
+    std::atomic<bool> used_;      // Set once warmed up or acquired from; maintenance only tops up used pools
+    std::atomic<bool> shutdown_;
 
-    mutable std::mutex mutex_;
-    std::condition_variable cv_;
+    std::mutex mutex_; // Guards waiters_; taken before any shard lock, never while holding one
+    std::deque<Waiter*> waiters_;
+    std::condition_variable maintenance_cv_;
+    std::thread maintenance_thread_;
 
     /**
-     * @brief Create a new connection (must be called with mutex held)
+     * @brief Create a new connection (must be called without any lock held)
+     *
+     * The caller reserves the slot with reserve_slot() beforehand.
      */
     std::unique_ptr<Client> create_connection();
 
+    /**
+     * @brief Reserve a slot for a new connection if the pool is below max_connections
+     */
+    bool reserve_slot();
+
+    /**
+     * @brief Give back a slot acquire() reserved for a connection that failed to open
+     */
+    void release_reserved_slot();
+
+    /**
+     * @brief Close a pooled connection and free its slot (must be called without mutex held)
+     */
+    void discard_connection(std::unique_ptr<Client> client, bool was_active);
+
+    /**
+     * @brief Check whether a connection outlived max_lifetime_ms
+     */
+    bool is_expired(Clock::time_point created_at, Clock::time_point now) const;
+
+    /**
+     * @brief Index of the calling thread's home shard
+     */
+    size_t home_shard() const;
+
+    /**
+     * @brief Take an idle connection, trying the home shard first and then stealing from the others
+     */
+    std::optional<IdleConnection> take_idle(size_t home);
+
+    /**
+     * @brief Add an idle connection to a shard
+     */
+    void put_idle(size_t shard, IdleConnection idle);
+
+    /**
+     * @brief Give idle connections to waiting threads until either runs out (must be called with mutex held)
+     */
+    void hand_off_idle();
+
+    /**
+     * @brief Wake the oldest waiter so it retries, e.g. after a slot frees up (must be called with mutex held)
+     */
+    void wake_waiter();
+
+    /**
+     * @brief Remove every idle connection after shutdown, freeing their slots
+     */
+    std::vector<IdleConnection> drain_idle();
+
+    /**
+     * @brief Check out an idle connection, validating it first; discards it and returns nothing if it is bad
+     */
+    std::optional<PooledConnection> lend_idle(IdleConnection idle);
+
+    /**
+     * @brief Maintenance thread body
+     */
+    void maintenance_loop();
+
     /**
      * @brief Return a connection to the pool
      */
-    void return_connection(std::unique_ptr<Client> client);
+    void return_connection(std::unique_ptr<Client> client, Clock::time_point created_at);
 
     friend class PooledConnection;
 };
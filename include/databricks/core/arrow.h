@@ -0,0 +1,53 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#ifndef DATABRICKS_ENABLE_ARROW
+#    error "databricks/core/arrow.h requires the SDK to be built with -DENABLE_ARROW=ON"
+#endif
+
+#include "databricks/core/result_set.h"
+
+#include <memory>
+#include <vector>
+
+#include <arrow/type_fwd.h>
+
+namespace databricks {
+/**
+ * @brief Arrow schema for a result set, mapped from its SQLDescribeCol types
+ *
+ * | SQL type                         | Arrow type                       |
+ * |----------------------------------|----------------------------------|
+ * | BIT                              | boolean                          |
+ * | TINYINT / SMALLINT / INTEGER     | int8 / int16 / int32             |
+ * | BIGINT                           | int64                            |
+ * | REAL                             | float32                          |
+ * | FLOAT / DOUBLE                   | float64                          |
+ * | DECIMAL / NUMERIC (precision<=38)| decimal128(precision, scale)     |
+ * | TYPE_DATE                        | date32                           |
+ * | TYPE_TIMESTAMP                   | timestamp[us] (no time zone)     |
+ * | everything else                  | utf8                             |
+ *
+ * Column nullability is taken from the driver.
+ *
+ * @param schema Column descriptions
+ * @param types Native type each column is fetched as (see TypedBatch)
+ */
+std::shared_ptr<arrow::Schema> to_arrow_schema(const std::vector<ColumnMetadata>& schema,
+                                               const std::vector<ValueType>& types);
+
+/**
+ * @brief Copy a typed batch into an Arrow record batch
+ *
+ * Values are copied from the native buffers; only DECIMAL text is parsed.
+ *
+ * @param batch Batch to convert
+ * @param schema Schema from to_arrow_schema() for the batch's result set, so
+ *        consecutive batches share one; computed from batch if null
+ * @throws std::runtime_error if Arrow fails to build a column (e.g. a malformed DECIMAL)
+ */
+std::shared_ptr<arrow::RecordBatch> to_record_batch(const TypedBatch& batch,
+                                                    std::shared_ptr<arrow::Schema> schema = nullptr);
+
+} // namespace databricks
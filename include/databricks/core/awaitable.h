@@ -0,0 +1,136 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+// C++20 only: built with -DENABLE_COROUTINES=ON
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace databricks {
+/**
+ * @brief The pending result of an SDK operation, for co_await in a C++20 coroutine
+ *
+ * Returned by the co_* methods (Client::co_query(), Jobs::co_get_run_output(),
+ * UnityCatalog::co_get_table()). Nothing starts until the awaitable is awaited.
+ * The coroutine is then suspended, and no thread waits for the operation.
+ * REST calls go to the HTTP client's async engine. Queries run on the
+ * Client's async executor, because the ODBC driver blocks. co_await yields
+ * the result or rethrows the operation's exception.
+ *
+ * By default the coroutine resumes on the thread that completed the operation:
+ * the HTTP engine thread for REST calls, an executor worker for queries.
+ * Neither thread should be blocked, so a coroutine that does heavy or blocking
+ * work after the co_await should hop to its own scheduler, either with
+ * resume_on() or by awaiting the runtime's own executor. An operation that
+ * completes before the coroutine suspends resumes it at once, on its own thread.
+ *
+ * Works with any coroutine type (it needs no cooperation from the promise).
+ *
+ * Example usage:
+ * @code
+ * my_runtime::task<void> report(databricks::Client& client, databricks::UnityCatalog& uc) {
+ *     auto table = co_await uc.co_get_table("main.sales.orders");
+ *     auto rows = co_await client.co_query("SELECT count(*) FROM main.sales.orders")
+ *                     .resume_on([](std::coroutine_handle<> h) { my_runtime::post(h); });
+ * }
+ * @endcode
+ *
+ * Await each awaitable once.
+ */
+template <typename T> class Awaitable {
+    struct State {
+        std::atomic<bool> rendezvous{false}; // Set by whichever of completion and suspension comes first
+        std::optional<T> value;
+        std::exception_ptr error;
+        std::coroutine_handle<> waiter;
+        std::function<void(std::coroutine_handle<>)> resume; // Empty = resume inline
+    };
+
+public:
+    /**
+     * @brief Handed to the operation; call set_value() or set_error() exactly once
+     */
+    class Completion {
+    public:
+        void set_value(T value) {
+            state_->value.emplace(std::move(value));
+            finish();
+        }
+
+        void set_error(std::exception_ptr error) {
+            state_->error = std::move(error);
+            finish();
+        }
+
+    private:
+        explicit Completion(std::shared_ptr<State> state)
+            : state_(std::move(state)) {}
+
+        void finish() {
+            std::shared_ptr<State> state = std::move(state_);
+            if (!state->rendezvous.exchange(true, std::memory_order_acq_rel)) {
+                return; // Not suspended yet: await_suspend() sees the result and doesn't suspend
+            }
+            if (state->resume) {
+                state->resume(state->waiter);
+            } else {
+                state->waiter.resume();
+            }
+        }
+
+        std::shared_ptr<State> state_;
+
+        friend class Awaitable;
+    };
+
+    /**
+     * @param start Starts the operation; called once, by await_suspend(), with the completion to fire
+     */
+    explicit Awaitable(std::function<void(Completion)> start)
+        : start_(std::move(start))
+        , state_(std::make_shared<State>()) {}
+
+    /**
+     * @brief Resume the coroutine through resume instead of on the completing thread
+     *
+     * resume receives the suspended coroutine and must resume it exactly once,
+     * for example by posting it to the caller's event loop. Not used when the
+     * operation completes before the coroutine suspends.
+     */
+    Awaitable resume_on(std::function<void(std::coroutine_handle<>)> resume) && {
+        state_->resume = std::move(resume);
+        return std::move(*this);
+    }
+
+    bool await_ready() const noexcept { return false; }
+
+    bool await_suspend(std::coroutine_handle<> waiter) {
+        state_->waiter = waiter;
+        try {
+            start_(Completion(state_));
+        } catch (...) {
+            // The operation could not be started, so it will never complete
+            state_->error = std::current_exception();
+            return false;
+        }
+        return !state_->rendezvous.exchange(true, std::memory_order_acq_rel);
+    }
+
+    T await_resume() {
+        if (state_->error) {
+            std::rethrow_exception(state_->error);
+        }
+        return std::move(*state_->value);
+    }
+
+private:
+    std::function<void(Completion)> start_;
+    std::shared_ptr<State> state_;
+};
+
+} // namespace databricks
@@ -0,0 +1,62 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <optional>
+
+namespace databricks {
+namespace internal {
+class CancelScope;
+}
+
+/**
+ * @brief Lets one thread cancel queries that another thread is running
+ *
+ * Copies share one state: cancelling any copy cancels every query started
+ * with it, including queries that start after cancel(). Pass it to a query
+ * through QueryOptions::cancel.
+ *
+ * Example usage:
+ * @code
+ * databricks::CancellationToken token;
+ * auto rows = client.query_async(sql, {}, {std::chrono::seconds(30), token});
+ * // On another thread, e.g. when the user navigates away:
+ * token.cancel();
+ * @endcode
+ *
+ * Thread-safe.
+ */
+class CancellationToken {
+public:
+    CancellationToken();
+
+    /**
+     * @brief Cancel every query using this token; the queries fail with CancelledError
+     *
+     * Calls SQLCancel on statements that are executing or fetching. Idempotent.
+     */
+    void cancel();
+
+    /**
+     * @brief True once cancel() has been called on any copy
+     */
+    bool is_cancelled() const;
+
+private:
+    struct State;
+    std::shared_ptr<State> state_;
+
+    friend class internal::CancelScope;
+};
+
+/**
+ * @brief Per-call limits for Client::query(), query_async() and execute_cursor()
+ */
+struct QueryOptions {
+    std::chrono::milliseconds timeout{0};   ///< Cancel the query after this long (0 = no limit); includes pool waits
+    std::optional<CancellationToken> cancel; ///< Cancel the query when this token is cancelled
+};
+
+} // namespace databricks
@@ -2,14 +2,30 @@
 // SPDX-License-Identifier: MIT
 #pragma once
 
+#include "databricks/core/cancellation.h"
 #include "databricks/core/config.h"
+#include "databricks/core/cursor.h"
+#include "databricks/core/errors.h"
+#include "databricks/core/result_set.h"
+#include "databricks/core/spillable_result.h"
 
+#include <chrono>
 #include <cstdint>
+#include <functional>
 #include <future>
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <vector>
 
+#ifdef DATABRICKS_ENABLE_ARROW
+#    include <arrow/type_fwd.h>
+#endif
+
+#ifdef DATABRICKS_ENABLE_COROUTINES
+#    include "databricks/core/awaitable.h"
+#endif
+
 // Forward declare ODBC types to avoid including sql.h in header
 typedef short SQLSMALLINT;
 
@@ -29,6 +45,11 @@ namespace databricks {
  * This class provides a clean interface for executing SQL queries against Databricks.
  * It uses a modular configuration approach with AuthConfig, SQLConfig, and PoolingConfig.
  *
+ * Failures reported by the ODBC driver are thrown as SqlError (or one of its
+ * subclasses, such as AuthenticationError), which carries the SQLSTATE and
+ * native error of every diagnostic record. RetryConfig retries only the
+ * transient categories (timeouts, lost connections, throttling).
+ *
  * Example usage:
  * @code
  * // Simple usage with environment configuration
@@ -57,11 +78,53 @@ class Client {
 public:
     /**
      * @brief Parameter for parameterized queries
+     *
+     * The value is always given as text. When c_type is a native C type
+     * (SQL_C_SBIGINT, SQL_C_DOUBLE, SQL_C_BIT, SQL_C_TYPE_DATE, SQL_C_TYPE_TIMESTAMP, ...)
+     * the SDK converts the text to that type before binding, so the driver receives
+     * a typed value. The from_* factories set matching c_type/sql_type pairs, using
+     * the same type mapping as query_typed() uses for result columns.
+     *
+     * @code
+     * client.query("SELECT * FROM orders WHERE id = ? AND created_at > ?",
+     *              {databricks::Client::Parameter::from_int64(42),
+     *               databricks::Client::Parameter::from_timestamp({2025, 1, 1, 0, 0, 0, 0})});
+     * @endcode
      */
     struct Parameter {
-        std::string value;                  ///< Parameter value as string
+        std::string value;                  ///< Parameter value as text
         SQLSMALLINT c_type = SQL_C_CHAR;    ///< C data type (default: character)
         SQLSMALLINT sql_type = SQL_VARCHAR; ///< SQL data type (default: VARCHAR)
+
+        static Parameter from_int64(int64_t value);              ///< BIGINT parameter
+        static Parameter from_double(double value);              ///< DOUBLE parameter
+        static Parameter from_bool(bool value);                  ///< BOOLEAN parameter
+        static Parameter from_date(const Date& value);           ///< DATE parameter
+        static Parameter from_timestamp(const Timestamp& value); ///< TIMESTAMP parameter
+    };
+
+    /**
+     * @brief Outcome of an execute_batch() call
+     *
+     * row_status has one entry per input row, in input order. Rows in a chunk the
+     * driver rejected are reported as Error (or NotExecuted if the driver stopped
+     * before reaching them) and the driver's diagnostic is added to errors.
+     */
+    struct BatchResult {
+        enum class RowStatus {
+            Success,         ///< Row executed
+            SuccessWithInfo, ///< Row executed with a driver warning
+            Error,           ///< Row failed
+            NotExecuted      ///< Row was not reached
+        };
+
+        std::vector<RowStatus> row_status; ///< Status of each input row
+        int64_t rows_affected = 0;         ///< Rows affected as reported by the driver (summed over chunks)
+        std::vector<std::string> errors;   ///< Diagnostics of chunks that reported errors
+
+        size_t success_count() const; ///< Rows with Success or SuccessWithInfo
+        size_t error_count() const;   ///< Rows with Error or NotExecuted
+        bool all_succeeded() const { return error_count() == 0; }
     };
 
     /**
@@ -138,6 +201,27 @@ public:
          */
         Builder& with_retry(const RetryConfig& retry);
 
+        /**
+         * @brief Set asynchronous execution configuration (optional)
+         * @param async Worker count and queue limit for query_async()/connect_async()
+         * @return Builder reference for chaining
+         */
+        Builder& with_async(const AsyncConfig& async);
+
+        /**
+         * @brief Enable the client-side query result cache (optional)
+         * @param cache Cache size, default TTL and which calls use it (see QueryCacheConfig)
+         * @return Builder reference for chaining
+         */
+        Builder& with_query_cache(const QueryCacheConfig& cache);
+
+        /**
+         * @brief Enable hedged read-only queries (optional, requires pooling)
+         * @param hedge Hedge percentile and delays (see HedgeConfig)
+         * @return Builder reference for chaining
+         */
+        Builder& with_hedging(const HedgeConfig& hedge);
+
         /**
          * @brief Build the Client
          *
@@ -151,6 +235,9 @@ public:
         std::unique_ptr<SQLConfig> sql_;
         std::unique_ptr<PoolingConfig> pooling_;
         std::unique_ptr<RetryConfig> retry_;
+        std::unique_ptr<AsyncConfig> async_;
+        std::unique_ptr<QueryCacheConfig> query_cache_;
+        std::unique_ptr<HedgeConfig> hedge_;
         bool auto_connect_ = false;
     };
 
@@ -167,6 +254,20 @@ public:
     Client(Client&&) noexcept;
     Client& operator=(Client&&) noexcept;
 
+    /**
+     * @brief Do the process-wide setup the first connection would otherwise wait on
+     *
+     * Allocates the shared ODBC environment, lists the installed ODBC drivers
+     * and parses ~/.databrickscfg, caching each for every later client. Call it
+     * during cold start (for example in a serverless function's init phase) so
+     * the first request doesn't pay for it. Safe to call repeatedly and from
+     * several threads; failures are logged and left for the first client to report.
+     *
+     * @param odbc_driver_name Driver to look up (default: SQLConfig's default driver)
+     * @return true if the driver is installed
+     */
+    static bool preinitialize(const std::string& odbc_driver_name = SQLConfig{}.odbc_driver_name);
+
     /**
      * @brief Get the authentication configuration
      * @return const AuthConfig& Reference to auth configuration
@@ -185,6 +286,30 @@ public:
      */
     const PoolingConfig& get_pooling_config() const;
 
+    /**
+     * @brief Get the asynchronous execution configuration
+     * @return const AsyncConfig& Reference to async configuration
+     */
+    const AsyncConfig& get_async_config() const;
+
+    /**
+     * @brief Get the query result cache configuration
+     * @return const QueryCacheConfig& Reference to query cache configuration
+     */
+    const QueryCacheConfig& get_query_cache_config() const;
+
+    /**
+     * @brief Get the hedged query configuration
+     * @return const HedgeConfig& Reference to hedge configuration
+     */
+    const HedgeConfig& get_hedge_config() const;
+
+    /**
+     * @brief Current hedge delay: read-only queries running longer get a second copy
+     * @return The tracked latency percentile, or zero if hedging is disabled
+     */
+    std::chrono::milliseconds hedge_delay() const;
+
     /**
      * @brief Check if the client is configured with valid credentials
      * @return true if configured, false otherwise
@@ -216,9 +341,270 @@ public:
      *
      * @warning When using dynamic values (user input, variables), always use parameters
      *          to prevent SQL injection attacks. Never concatenate strings into SQL.
+     *
+     * @note With the query cache enabled (Builder::with_query_cache()), read-only
+     *       statements may be answered from the cache; see QueryCacheConfig.
+     * @note With hedging enabled (Builder::with_hedging()), slow read-only
+     *       statements are also sent on a second pooled connection; see HedgeConfig.
      */
     std::vector<std::vector<std::string>> query(const std::string& sql, const std::vector<Parameter>& params = {});
 
+    /**
+     * @brief Execute a SQL query that stops at a timeout or when a token is cancelled
+     *
+     * When options.timeout passes or options.cancel is cancelled, the statement
+     * is cancelled with SQLCancel from another thread and the call throws
+     * CancelledError. Only the statement is cancelled, so a pooled connection
+     * goes back to the pool reusable and slow queries can't hold every
+     * connection. The timeout covers waiting for a pooled connection, every
+     * retry, execution and fetching; cancellations are never retried.
+     *
+     * @code
+     * databricks::QueryOptions options;
+     * options.timeout = std::chrono::seconds(5);
+     * auto results = client.query("SELECT * FROM big_table", {}, options);
+     * @endcode
+     *
+     * @param sql The SQL query to execute (use ? for parameter placeholders)
+     * @param params Parameter values (empty = static query)
+     * @param options Timeout and cancellation token
+     * @return Results as a 2D vector of strings (rows and columns)
+     * @throws CancelledError if the timeout passed or the token was cancelled first
+     *
+     * @note Bypasses the query cache and hedging.
+     */
+    std::vector<std::vector<std::string>> query(const std::string& sql, const std::vector<Parameter>& params,
+                                                const QueryOptions& options);
+
+    /**
+     * @brief Execute a SQL query through the result cache with its own TTL
+     *
+     * Serves the result from the cache if the same normalized SQL ran with the
+     * same parameters within ttl, otherwise runs it and caches the result;
+     * concurrent identical calls share one execution. Unlike query(), the
+     * statement is cached whatever it starts with, so only pass statements
+     * without side effects. Errors are not cached. Without an enabled cache this
+     * is the same as query().
+     *
+     * @code
+     * auto flags = client.query_cached("SELECT name, enabled FROM ref.feature_flags", {}, std::chrono::seconds(5));
+     * @endcode
+     *
+     * @param sql The SQL query to execute (use ? for parameter placeholders)
+     * @param params Parameter values (empty = static query)
+     * @param ttl How long to keep a result loaded by this call; zero uses QueryCacheConfig::ttl_ms
+     * @return Results as a 2D vector of strings (rows and columns)
+     * @throws std::runtime_error if execution or fetching fails
+     */
+    std::vector<std::vector<std::string>> query_cached(const std::string& sql,
+                                                       const std::vector<Parameter>& params = {},
+                                                       std::chrono::milliseconds ttl = std::chrono::milliseconds(0));
+
+    /**
+     * @brief Drop every cached query result so the next queries run on the warehouse
+     */
+    void invalidate_query_cache();
+
+    /**
+     * @brief Hit, miss, coalescing and eviction counters of the query cache (all zero when disabled)
+     */
+    CacheStats query_cache_stats() const;
+
+    /**
+     * @brief Execute a SQL query and receive results one columnar block at a time
+     *
+     * Columns are bound once and rows are fetched in blocks of SQLConfig::fetch_batch_rows
+     * per driver call, so large result sets avoid per-cell round trips and per-value
+     * allocations. Each block is delivered to on_batch as a ColumnarBatch; the batch
+     * buffers are reused for the next block, so copy out anything you need to keep.
+     *
+     * Result sets with columns wider than SQLConfig::max_column_buffer_bytes (or of
+     * unknown size) are read row by row but still delivered in blocks.
+     *
+     * @code
+     * size_t total = 0;
+     * client.query_columnar("SELECT id, name FROM users WHERE region = ?", {{"EU"}},
+     *                       [&](const databricks::ColumnarBatch& batch) { total += batch.num_rows(); });
+     * @endcode
+     *
+     * @param sql The SQL query to execute (use ? for parameter placeholders)
+     * @param params Parameter values (empty = static query)
+     * @param on_batch Callback invoked once per fetched block
+     * @throws std::runtime_error if execution or fetching fails
+     *
+     * @note Connection and execution failures are retried per RetryConfig. Failures
+     *       after the first block has been delivered are thrown to the caller.
+     * @note With SQLConfig::prefetch_blocks set, the next blocks are fetched on a
+     *       background thread while on_batch runs. on_batch is still called on this thread.
+     */
+    void query_columnar(const std::string& sql, const std::vector<Parameter>& params,
+                        const std::function<void(const ColumnarBatch&)>& on_batch);
+
+    /**
+     * @brief Execute a SQL query and receive results decoded into native types
+     *
+     * Columns are bound by their SQLDescribeCol type: integers as SQL_C_SBIGINT,
+     * floating point as SQL_C_DOUBLE, booleans as SQL_C_BIT, dates and timestamps as
+     * their ODBC structs, and everything else (including DECIMAL) as text. This avoids
+     * the driver formatting every value as a string and the caller parsing it back.
+     * Blocks are fetched the same way as query_columnar().
+     *
+     * @code
+     * client.query_typed("SELECT id, amount FROM payments", {}, [&](const databricks::TypedBatch& batch) {
+     *     for (size_t row = 0; row < batch.num_rows(); ++row) {
+     *         total += batch.get_double(row, 1);
+     *     }
+     * });
+     * @endcode
+     *
+     * @param sql The SQL query to execute (use ? for parameter placeholders)
+     * @param params Parameter values (empty = static query)
+     * @param on_batch Callback invoked once per fetched block
+     * @throws std::runtime_error if execution or fetching fails
+     */
+    void query_typed(const std::string& sql, const std::vector<Parameter>& params,
+                     const std::function<void(const TypedBatch&)>& on_batch);
+
+#ifdef DATABRICKS_ENABLE_ARROW
+    /**
+     * @brief Execute a SQL query and receive results as Arrow record batches
+     *
+     * Rows are fetched into native buffers as in query_typed() and copied into
+     * one arrow::RecordBatch per block, with column types mapped from
+     * SQLDescribeCol (see to_arrow_schema() in databricks/core/arrow.h). No value
+     * goes through text except DECIMALs and strings. Every batch shares one schema.
+     *
+     * Only available when the SDK is built with -DENABLE_ARROW=ON.
+     *
+     * @param sql The SQL query to execute (use ? for parameter placeholders)
+     * @param params Parameter values (empty = static query)
+     * @param on_batch Callback invoked once per fetched block; the batch may be kept
+     * @throws std::runtime_error if execution, fetching or conversion fails
+     */
+    void query_arrow(const std::string& sql, const std::vector<Parameter>& params,
+                     const std::function<void(const std::shared_ptr<arrow::RecordBatch>&)>& on_batch);
+
+    /**
+     * @brief Execute a SQL query and return every block as an Arrow record batch
+     *
+     * Collects the batches query_arrow() with a callback would deliver; empty if
+     * the query returned no rows.
+     */
+    std::vector<std::shared_ptr<arrow::RecordBatch>> query_arrow(const std::string& sql,
+                                                                 const std::vector<Parameter>& params = {});
+#endif
+
+    /**
+     * @brief Execute a SQL query and return the whole result in one ResultSet
+     *
+     * Same values as query() (NULL reads as an empty view, with is_null() to tell
+     * them apart), but every cell's bytes go into the ResultSet's buffer instead
+     * of a std::string of its own, so a large result costs a few allocations
+     * rather than one per cell and one per row. Rows are fetched in blocks like
+     * query_columnar().
+     *
+     * @code
+     * std::pmr::monotonic_buffer_resource arena;
+     * auto result = client.query_result("SELECT id, name FROM users", {}, &arena);
+     * @endcode
+     *
+     * @param sql The SQL query to execute (use ? for parameter placeholders)
+     * @param params Parameter values (empty = static query)
+     * @param resource Memory resource for the result's buffers; must outlive the result
+     * @return The complete result
+     * @throws std::runtime_error if execution or fetching fails
+     */
+    ResultSet query_result(const std::string& sql, const std::vector<Parameter>& params = {},
+                           std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Execute a SQL query whose result may not fit in memory, spilling it to a temp file
+     *
+     * Blocks are fetched like query_result() and kept in memory until they pass
+     * SpillConfig::memory_limit_bytes; from then on they are written to a
+     * memory-mapped temp file (see SpillableResult). Use it for results too
+     * large for query() or query_result() that still need random access or
+     * several passes; a single pass is cheaper with query_columnar() or a Cursor.
+     *
+     * @code
+     * databricks::SpillConfig spill;
+     * spill.memory_limit_bytes = 512 * 1024 * 1024;
+     * auto result = client.query_spillable("SELECT * FROM main.logs.events", {}, spill);
+     * @endcode
+     *
+     * @param sql The SQL query to execute (use ? for parameter placeholders)
+     * @param params Parameter values (empty = static query)
+     * @param spill Memory limit and spill directory
+     * @return The complete result, sealed for reading
+     * @throws std::runtime_error if execution or fetching fails, or the spill file cannot be written
+     */
+    SpillableResult query_spillable(const std::string& sql, const std::vector<Parameter>& params = {},
+                                    const SpillConfig& spill = SpillConfig{});
+
+    /**
+     * @brief Execute a SQL query and return a cursor that fetches rows incrementally
+     *
+     * Unlike query(), the result set is never fully materialized: rows are pulled
+     * from the driver one block at a time as the cursor is consumed.
+     *
+     * @code
+     * auto cursor = client.execute_cursor("SELECT * FROM events WHERE day = ?", {{"2025-01-01"}});
+     * for (const auto& row : cursor) {
+     *     process(row[0], row[1]);
+     * }
+     * @endcode
+     *
+     * @param sql The SQL query to execute (use ? for parameter placeholders)
+     * @param params Optional vector of parameter values (default: empty = static query)
+     * @return Cursor positioned before the first row
+     * @throws std::runtime_error if execution fails
+     *
+     * @note For pooled clients the cursor holds a pooled connection until destroyed.
+     *       For non-pooled clients the Client must outlive the cursor.
+     */
+    Cursor execute_cursor(const std::string& sql, const std::vector<Parameter>& params = {});
+
+    /**
+     * @brief Execute a SQL query for incremental fetching, stopping at a timeout or cancellation
+     *
+     * The options apply for the cursor's whole life: once they fire, the
+     * executing or fetching statement is cancelled and the cursor's next fetch
+     * throws CancelledError. See query(const std::string&, const std::vector<Parameter>&, const QueryOptions&).
+     */
+    Cursor execute_cursor(const std::string& sql, const std::vector<Parameter>& params, const QueryOptions& options);
+
+    /**
+     * @brief Execute a DML statement once per parameter row using ODBC parameter arrays
+     *
+     * Rows are bound column-wise and sent SQLConfig::batch_chunk_rows at a time, so a
+     * bulk INSERT or MERGE costs one round trip per chunk instead of one per row. The
+     * statement is prepared once and cached like any parameterized query.
+     *
+     * Every row must have the same number of parameters, and each parameter position
+     * must use the same c_type/sql_type in every row.
+     *
+     * @code
+     * std::vector<std::vector<databricks::Client::Parameter>> rows;
+     * for (const auto& user : users) {
+     *     rows.push_back({databricks::Client::Parameter::from_int64(user.id), {user.name}});
+     * }
+     * auto result = client.execute_batch("INSERT INTO users (id, name) VALUES (?, ?)", rows);
+     * if (!result.all_succeeded()) { ... }
+     * @endcode
+     *
+     * @param sql The statement to execute (use ? for parameter placeholders)
+     * @param rows One parameter vector per execution
+     * @return Per-row status and affected row count
+     * @throws std::invalid_argument if rows are empty, ragged or inconsistently typed
+     * @throws std::runtime_error if preparing fails or a chunk fails with a
+     *         connection-level error after retries
+     *
+     * @note Each chunk is retried independently per RetryConfig. A chunk that failed
+     *       mid-flight may have been partially applied, so prefer idempotent
+     *       statements (e.g. MERGE) when retries are enabled.
+     */
+    BatchResult execute_batch(const std::string& sql, const std::vector<std::vector<Parameter>>& rows);
+
     /**
      * @brief Explicitly establish connection to Databricks
      *
@@ -234,7 +620,8 @@ public:
      *
      * Non-blocking connection useful for reducing perceived latency.
      * Call wait() on returned future before executing queries, or
-     * query() will automatically wait.
+     * query() will automatically wait. Runs on the client's async executor
+     * (see AsyncConfig).
      *
      * @return std::future<void> Future that completes when connected
      */
@@ -243,21 +630,104 @@ public:
     /**
      * @brief Asynchronously execute a SQL query
      *
+     * The query runs on the client's bounded executor (AsyncConfig::worker_threads
+     * threads, started on first use), so fanning out many queries does not create a
+     * thread per call. If AsyncConfig::max_pending_tasks queries are already waiting,
+     * this call blocks until one starts.
+     *
+     * @code
+     * std::vector<std::future<std::vector<std::vector<std::string>>>> futures;
+     * for (const auto& sql : dashboard_queries) {
+     *     futures.push_back(client.query_async(sql));
+     * }
+     * @endcode
+     *
      * @param sql The SQL query to execute
      * @param params Optional vector of parameter values
      * @return std::future with query results
+     *
+     * @note Queued queries run against this Client, so don't move it while any are
+     *       pending. Destroying the Client waits for them to finish.
      */
     std::future<std::vector<std::vector<std::string>>> query_async(const std::string& sql,
                                                                    const std::vector<Parameter>& params = {});
 
+    /**
+     * @brief Asynchronously execute a SQL query with a timeout or cancellation token
+     *
+     * The timeout starts when this is called, so time spent queued on the
+     * executor counts against it; a token cancelled while the query is queued
+     * stops it before it runs.
+     */
+    std::future<std::vector<std::vector<std::string>>> query_async(const std::string& sql,
+                                                                   const std::vector<Parameter>& params,
+                                                                   const QueryOptions& options);
+
+#ifdef DATABRICKS_ENABLE_COROUTINES
+    /**
+     * @brief Execute a SQL query from a C++20 coroutine without blocking its thread
+     *
+     * The query runs on the same executor as query_async(); the awaiting
+     * coroutine is suspended meanwhile and resumed on the executor worker that
+     * ran it (see Awaitable::resume_on()). Starting the query blocks only if
+     * AsyncConfig::max_pending_tasks queries are already queued.
+     *
+     * Only available when the SDK is built with -DENABLE_COROUTINES=ON.
+     *
+     * @code
+     * auto rows = co_await client.co_query("SELECT * FROM orders WHERE id = ?", {{"42"}});
+     * @endcode
+     *
+     * @note The Client must outlive the awaited query.
+     */
+    Awaitable<std::vector<std::vector<std::string>>> co_query(const std::string& sql,
+                                                              const std::vector<Parameter>& params = {});
+
+    /**
+     * @brief Execute a SQL query from a coroutine with a timeout or cancellation token
+     *
+     * As with query_async(), the timeout starts when the coroutine suspends, so
+     * time spent queued counts against it.
+     */
+    Awaitable<std::vector<std::vector<std::string>>> co_query(const std::string& sql,
+                                                              const std::vector<Parameter>& params,
+                                                              const QueryOptions& options);
+#endif
+
     /**
      * @brief Disconnect from Databricks
      */
     void disconnect();
 
+    /**
+     * @brief Check whether the connection is still usable
+     *
+     * Asks the driver whether the connection is dead (SQL_ATTR_CONNECTION_DEAD), which
+     * needs no server round trip. With round_trip set, also runs SELECT 1. For pooled
+     * clients this checks a connection acquired from the pool.
+     *
+     * @param round_trip Also run a trivial query against the warehouse
+     * @return true if connected and alive, false otherwise (never throws)
+     */
+    bool is_healthy(bool round_trip = false);
+
+    /**
+     * @brief Cancel the statement this client is executing, from another thread
+     *
+     * Calls SQLCancel on the statement inside SQLExecDirect/SQLExecute on this
+     * client's dedicated connection; the query then fails with SQLSTATE HY008.
+     * Fetching is not interrupted. Pooled clients run their statements on
+     * pooled connections and have nothing to cancel; use a CancellationToken
+     * (QueryOptions::cancel) to cancel a particular query on any client.
+     *
+     * @return true if a statement was executing and the driver accepted the cancel
+     */
+    bool cancel();
+
 private:
     // Private constructor for Builder
     Client(const AuthConfig& auth, const SQLConfig& sql, const PoolingConfig& pooling, const RetryConfig& retry,
+           const AsyncConfig& async, const QueryCacheConfig& query_cache, const HedgeConfig& hedge,
            bool auto_connect);
 
     class Impl;
@@ -5,6 +5,7 @@
 #include "databricks/internal/secure_string.h"
 
 #include <cstddef>
+#include <map>
 #include <string>
 
 namespace databricks {
@@ -102,6 +103,11 @@ public:
 struct SQLConfig {
     std::string http_path; ///< HTTP path for SQL warehouse/cluster (e.g., "/sql/1.0/warehouses/abc123")
     std::string odbc_driver_name = "Simba Spark ODBC Driver"; ///< ODBC driver name (default: Simba Spark ODBC Driver)
+    size_t fetch_batch_rows = 1024;         ///< Rows fetched per SQLFetch call in block mode (default: 1024)
+    size_t max_column_buffer_bytes = 65536; ///< Widest column bound for block fetching; wider columns use SQLGetData
+    size_t statement_cache_size = 32;       ///< Prepared statements cached per connection (0 disables caching)
+    size_t batch_chunk_rows = 1000;         ///< Rows bound per SQLExecute call in execute_batch (default: 1000)
+    size_t prefetch_blocks = 0;             ///< Blocks fetched ahead on a background thread (0 = fetch inline)
 
     /**
      * @brief Validate that all required fields are set
@@ -116,12 +122,34 @@ struct SQLConfig {
  * Enables connection pooling to improve performance for applications
  * that execute many queries. Pooling reduces connection overhead by
  * reusing existing connections.
+ *
+ * Idle connections are checked before reuse (a local liveness check, or
+ * SELECT 1 once they have idled for validation_idle_ms) so a connection
+ * dropped by the warehouse is replaced instead of failing the next query.
+ * A background thread evicts idle and expired connections and tops the
+ * pool back up to min_connections.
  */
 struct PoolingConfig {
-    bool enabled = false;             ///< Enable connection pooling (default: false)
-    size_t min_connections = 1;       ///< Minimum connections to maintain in pool (default: 1)
-    size_t max_connections = 10;      ///< Maximum connections allowed in pool (default: 10)
-    int connection_timeout_ms = 5000; ///< Timeout for acquiring connection from pool in milliseconds (default: 5000)
+    /**
+     * @brief Order in which idle connections are reused
+     */
+    enum class ReusePolicy {
+        FIFO, ///< Longest-idle connection first, spreading use across connections
+        LIFO  ///< Most recently returned first, keeping a hot set warm and letting the rest idle out
+    };
+
+    bool enabled = false;                ///< Enable connection pooling (default: false)
+    size_t min_connections = 1;          ///< Minimum connections to maintain in pool (default: 1)
+    size_t max_connections = 10;         ///< Maximum connections allowed in pool (default: 10)
+    int connection_timeout_ms = 5000;    ///< Timeout for acquiring connection from pool in milliseconds (default: 5000)
+    int idle_timeout_ms = 600000;        ///< Close connections idle this long, down to min_connections (0 = never)
+    int max_lifetime_ms = 1800000;       ///< Replace connections older than this (0 = never; default: 30 min)
+    bool validate_on_borrow = true;      ///< Check that a connection is alive before handing it out (default: true)
+    int validation_idle_ms = 30000;      ///< Idle time after which borrow validation runs SELECT 1 (default: 30s)
+    int maintenance_interval_ms = 30000; ///< Background eviction and top-up interval (0 = no thread; default: 30s)
+    size_t shards = 0;                   ///< Idle lists threads take from (0 = one per hardware thread, up to max)
+
+    ReusePolicy reuse_policy = ReusePolicy::FIFO; ///< Idle connection reuse order (default: FIFO)
 
     /**
      * @brief Validate configuration values
@@ -137,6 +165,15 @@ struct PoolingConfig {
  * connection timeouts, network errors, and rate limits. Uses exponential
  * backoff to avoid overwhelming the server during retries.
  *
+ * Every Client of one warehouse (same host and HTTP path) also shares a
+ * circuit breaker and a retry budget. After circuit_failure_threshold
+ * consecutive transient failures the circuit opens, and calls fail at once
+ * with CircuitOpenError instead of queueing on a warehouse known to be down;
+ * after circuit_open_ms one probe call is let through, and its success closes
+ * the circuit again. Retries are capped at retry_budget_ratio of recent calls
+ * (plus retry_budget_min_per_second), so a bad spell doesn't multiply the
+ * load. The first Client created for a warehouse sets these values.
+ *
  * Example usage:
  * @code
  * databricks::RetryConfig retry;
@@ -158,6 +195,198 @@ struct RetryConfig {
     size_t max_backoff_ms = 10000;        ///< Maximum backoff cap (default: 10s)
     bool retry_on_timeout = true;         ///< Retry on connection timeout (default: true)
     bool retry_on_connection_lost = true; ///< Retry on connection errors (default: true)
+    /// Consecutive transient failures per warehouse that open its circuit (default: 5, 0 disables the breaker)
+    size_t circuit_failure_threshold = 5;
+    size_t circuit_open_ms = 5000;           ///< Time an open circuit rejects calls before a probe (default: 5s)
+    double retry_budget_ratio = 0.2;         ///< Retries per warehouse as a fraction of calls in the last 10s
+    size_t retry_budget_min_per_second = 10; ///< Retries per warehouse per second allowed regardless of traffic
+
+    /**
+     * @brief Validate configuration values
+     * @return true if valid, false otherwise
+     */
+    bool is_valid() const;
+};
+
+/**
+ * @brief Asynchronous execution configuration
+ *
+ * query_async() and connect_async() run on a bounded thread pool owned by the
+ * Client (started on first use) instead of a new thread per call. Once
+ * max_pending_tasks operations are queued, further async calls block until a
+ * worker frees a slot.
+ *
+ * Example usage:
+ * @code
+ * auto client = databricks::Client::Builder()
+ *     .with_environment_config()
+ *     .with_async({.worker_threads = 16, .max_pending_tasks = 1024})
+ *     .build();
+ * @endcode
+ */
+struct AsyncConfig {
+    size_t worker_threads = 4;      ///< Threads running async operations (default: 4)
+    size_t max_pending_tasks = 256; ///< Operations queued before async calls block (default: 256)
+
+    /**
+     * @brief Validate configuration values
+     * @return true if valid, false otherwise
+     */
+    bool is_valid() const;
+};
+
+/**
+ * @brief REST transport configuration
+ *
+ * Controls the asynchronous request engine behind the REST services' batch
+ * calls (e.g. UnityCatalog::get_tables()). Requests are multiplexed as HTTP/2
+ * streams over a shared connection where the server supports it; at most
+ * max_concurrent_requests are on the wire at once and the rest wait in order.
+ *
+ * Every REST request, sync or async, is retried per the embedded RetryConfig:
+ * exponential backoff with jitter, stretched to honor any Retry-After header.
+ * Retries are not started when the server asks for a longer wait than
+ * retry.max_backoff_ms; the 429/503 is returned instead. Requests to one
+ * workspace host also share a process-wide token bucket when
+ * requests_per_second is set, and a Retry-After pauses that bucket for every
+ * client of the host.
+ *
+ * Responses are requested with gzip/deflate encoding and decompressed
+ * transparently unless accept_compressed is off. POST bodies of at least
+ * gzip_request_min_bytes are sent gzip-compressed with Content-Encoding: gzip.
+ *
+ * Example usage:
+ * @code
+ * databricks::HttpConfig http;
+ * http.max_concurrent_requests = 32;
+ * http.requests_per_second = 20; // Stay under the workspace's API limit
+ *
+ * databricks::UnityCatalog uc(auth, http);
+ * auto tables = uc.get_tables({"main.default.a", "main.default.b"});
+ * @endcode
+ */
+struct HttpConfig {
+    size_t max_concurrent_requests = 16; ///< Requests in flight per client (default: 16)
+    bool http2 = true;                   ///< Negotiate HTTP/2 over TLS and multiplex requests (default: true)
+    RetryConfig retry;                   ///< Retry policy for REST requests (default: 3 attempts)
+    double requests_per_second = 0.0;    ///< Per-host request rate shared by the process, 0 for unlimited (default: 0)
+    size_t burst = 10;                   ///< Requests allowed back to back by the rate limiter (default: 10)
+    bool accept_compressed = true;       ///< Negotiate gzip/deflate responses (default: true)
+    size_t gzip_request_min_bytes = 0;   ///< Gzip POST bodies at least this large, 0 to disable (default: 0)
+
+    /**
+     * @brief Validate configuration values
+     * @return true if valid, false otherwise
+     */
+    bool is_valid() const;
+};
+
+/**
+ * @brief In-process metadata cache configuration
+ *
+ * Enables a read-through cache in front of UnityCatalog lookups (get_* and
+ * list_* calls). Entries expire after ttl_ms; "not found" answers are cached
+ * for negative_ttl_ms. Concurrent misses for one object share a single REST
+ * call, and create/update/delete calls made through the same client invalidate
+ * what they touch. Changes made elsewhere are seen once entries expire.
+ *
+ * Example usage:
+ * @code
+ * databricks::UnityCatalog uc(auth);
+ * uc.set_cache_config({.enabled = true, .ttl_ms = 300000});
+ * @endcode
+ */
+struct MetadataCacheConfig {
+    bool enabled = false;          ///< Cache lookups (default: false)
+    size_t ttl_ms = 60000;         ///< How long an object or listing is served (default: 60s)
+    size_t negative_ttl_ms = 5000; ///< How long a 404 is remembered, 0 to disable (default: 5s)
+    size_t max_entries = 10000;    ///< Entries kept per object kind before the oldest is evicted (default: 10000)
+    size_t shards = 16;            ///< Independently locked partitions (default: 16)
+
+    /**
+     * @brief Validate configuration values
+     * @return true if valid, false otherwise
+     */
+    bool is_valid() const;
+};
+
+/**
+ * @brief In-process secret value cache configuration
+ *
+ * Enables a read-through cache in front of Secrets::get_secret() and
+ * get_secrets(), so a process reading the same secrets at startup (or a
+ * pool of workers in one process) makes one REST call per secret per TTL.
+ * Values are held in locked memory (SecureAllocator, never swapped) and
+ * zeroed when they expire, are evicted or the cache is dropped. Writes
+ * and deletes made through the same client invalidate what they touch;
+ * rotations made elsewhere are seen once entries expire.
+ *
+ * Example usage:
+ * @code
+ * databricks::Secrets secrets(auth);
+ * secrets.set_cache_config({.enabled = true, .ttl_ms = 600000});
+ * @endcode
+ */
+struct SecretCacheConfig {
+    bool enabled = false;      ///< Cache secret values (default: false)
+    size_t ttl_ms = 300000;    ///< How long a value is served (default: 5 min)
+    size_t max_entries = 1000; ///< Values kept before the least recently used is evicted (default: 1000)
+    size_t shards = 4;         ///< Independently locked partitions (default: 4)
+
+    /**
+     * @brief Validate configuration values
+     * @return true if valid, false otherwise
+     */
+    bool is_valid() const;
+};
+
+/**
+ * @brief Counters reported by the SDK's in-process caches
+ */
+struct CacheStats {
+    size_t hits = 0;          ///< Lookups served from the cache
+    size_t negative_hits = 0; ///< Lookups answered by a cached "not found"
+    size_t misses = 0;        ///< Lookups that went to the server
+    size_t coalesced = 0;     ///< Misses that waited for another caller's request instead of issuing one
+    size_t evictions = 0;     ///< Entries dropped to make room
+    size_t entries = 0;       ///< Entries currently cached
+    size_t bytes = 0;         ///< Approximate memory held by the entries (0 for caches without a byte limit)
+};
+
+/**
+ * @brief Client-side query result cache configuration
+ *
+ * Serves repeated identical read-only queries from memory instead of the
+ * warehouse. Entries are keyed on the normalized SQL text (whitespace and
+ * comments collapsed) plus every Parameter's value and types, and expire
+ * after ttl_ms; Client::query_cached() can choose a TTL per query. The cache
+ * is bounded by max_bytes and max_entries, evicting the least recently used
+ * results. Concurrent misses for one key share a single execution.
+ *
+ * While enabled, query() serves statements that start with SELECT, WITH,
+ * VALUES, SHOW, DESCRIBE or EXPLAIN from the cache (unless cache_reads is
+ * false); other statements always run. Results are not invalidated by writes
+ * made elsewhere, so pick a TTL the data tolerates.
+ *
+ * Example usage:
+ * @code
+ * databricks::QueryCacheConfig cache;
+ * cache.enabled = true;
+ * cache.ttl_ms = 10000;
+ *
+ * auto client = databricks::Client::Builder()
+ *     .with_environment_config()
+ *     .with_query_cache(cache)
+ *     .build();
+ * @endcode
+ */
+struct QueryCacheConfig {
+    bool enabled = false;                ///< Cache query results (default: false)
+    size_t ttl_ms = 30000;               ///< How long a result is served (default: 30s)
+    size_t max_bytes = 64 * 1024 * 1024; ///< Memory held by cached results (default: 64 MiB)
+    size_t max_entries = 10000;          ///< Results kept (default: 10000)
+    size_t shards = 16;                  ///< Independently locked partitions (default: 16)
+    bool cache_reads = true;             ///< Let query() use the cache for read-only statements (default: true)
 
     /**
      * @brief Validate configuration values
@@ -166,4 +395,155 @@ struct RetryConfig {
     bool is_valid() const;
 };
 
+/**
+ * @brief Hedged query configuration
+ *
+ * Cuts tail latency of small read-only lookups. When a read-only query()
+ * (same test as QueryCacheConfig) has not answered within the given
+ * percentile of recent query latencies, a second copy is sent on another
+ * pooled connection; whichever answers first is returned and the other is
+ * canceled with SQLCancel. A hedge is only sent if the pool can lend a
+ * connection without waiting, so a busy pool is not loaded further.
+ *
+ * Requires pooling. The first copy runs on the calling thread; a second
+ * copy gets a thread of its own, so hedging never waits on the async
+ * workers (AsyncConfig) and works from query_async. The counters
+ * MetricCounter::HedgeableQueries, HedgedQueries and HedgeWins show the
+ * hedge rate and how often it paid off.
+ *
+ * Example usage:
+ * @code
+ * auto client = databricks::Client::Builder()
+ *     .with_environment_config()
+ *     .with_pooling({.enabled = true, .max_connections = 20})
+ *     .with_hedging({.enabled = true, .percentile = 95.0})
+ *     .build();
+ * @endcode
+ */
+struct HedgeConfig {
+    bool enabled = false;          ///< Hedge slow read-only queries (default: false)
+    double percentile = 95.0;      ///< Hedge queries slower than this percentile of recent ones (default: p95)
+    size_t initial_delay_ms = 100; ///< Hedge delay until min_samples latencies are known (default: 100ms)
+    size_t min_delay_ms = 5;       ///< Shortest hedge delay, whatever the percentile (default: 5ms)
+    size_t min_samples = 20;       ///< Latencies needed before the percentile is used (default: 20)
+
+    /**
+     * @brief Validate configuration values
+     * @return true if valid, false otherwise
+     */
+    bool is_valid() const;
+};
+
+/**
+ * @brief Routing policy of a WarehouseRouter
+ *
+ * Each route (warehouse) keeps an exponentially weighted moving average of
+ * its query latency and of its error rate. A query goes to the route with
+ * the lowest (outstanding + 1) x latency estimate, inflated by the error
+ * rate. A route whose error rate passes max_error_rate (after min_samples
+ * outcomes) or whose circuit is open is drained: it gets no queries for
+ * drain_ms unless every route is drained. A route that fails a health check
+ * stays drained until it passes one.
+ *
+ * Example usage:
+ * @code
+ * databricks::RouterConfig routing;
+ * routing.health_check_interval_ms = 15000;
+ * databricks::WarehouseRouter router(auth, {primary, overflow}, pooling, routing);
+ * @endcode
+ */
+struct RouterConfig {
+    double latency_smoothing = 0.2;      ///< Weight of each new latency in its average, in (0, 1] (default: 0.2)
+    double error_smoothing = 0.1;        ///< Weight of each query outcome in the error rate, in (0, 1] (default: 0.1)
+    double max_error_rate = 0.5;         ///< Error rate that drains a route, in (0, 1] (default: 0.5)
+    size_t min_samples = 10;             ///< Outcomes needed before the error rate can drain a route (default: 10)
+    size_t drain_ms = 30000;             ///< How long a drained route gets no queries (default: 30s)
+    size_t health_check_interval_ms = 0; ///< Period of background SELECT 1 checks on every route (0 = none)
+
+    /**
+     * @brief Validate configuration values
+     * @return true if valid, false otherwise
+     */
+    bool is_valid() const;
+};
+
+/**
+ * @brief Polling schedule for wait APIs such as Jobs::wait_for_run()
+ *
+ * Status is checked immediately, then at initial_interval_ms. While the
+ * observed state stays the same the interval grows by backoff_multiplier up to
+ * max_interval_ms; a state change resets it, so transitions are noticed quickly
+ * without hammering the API during long waits.
+ *
+ * Example usage:
+ * @code
+ * databricks::PollConfig poll;
+ * poll.max_interval_ms = 10000;
+ *
+ * auto run = jobs.wait_for_run(run_id, std::chrono::minutes(30), poll).get();
+ * @endcode
+ */
+struct PollConfig {
+    size_t initial_interval_ms = 1000; ///< First interval and the interval after a state change (default: 1s)
+    size_t max_interval_ms = 30000;    ///< Longest interval between checks (default: 30s)
+    double backoff_multiplier = 1.5;   ///< Interval growth while the state is unchanged (default: 1.5x)
+
+    /**
+     * @brief Validate configuration values
+     * @return true if valid, false otherwise
+     */
+    bool is_valid() const;
+};
+
+/**
+ * @brief Staging settings for BulkIngest, which loads rows through a volume with COPY INTO
+ *
+ * Rows are written as CSV part files of rows_per_file rows under a fresh
+ * directory in staging_path, uploaded up to max_concurrent_uploads at a time
+ * while later parts are still being written, and loaded with one COPY INTO.
+ * At most about 2 x max_concurrent_uploads parts are held in memory.
+ *
+ * Example usage:
+ * @code
+ * databricks::IngestConfig ingest;
+ * ingest.staging_path = "/Volumes/main/default/staging";
+ * ingest.copy_options["mergeSchema"] = "true";
+ * @endcode
+ */
+struct IngestConfig {
+    std::string staging_path;                        ///< Volume directory to stage parts under
+    size_t rows_per_file = 100000;                   ///< Rows per staged CSV part (default: 100000)
+    size_t max_concurrent_uploads = 8;               ///< Parts uploaded at once (default: 8)
+    bool keep_staged_files = false;                  ///< Leave the staged parts in place after the load
+    std::map<std::string, std::string> copy_options; ///< COPY_OPTIONS of the COPY INTO, e.g. {"mergeSchema", "true"}
+
+    /**
+     * @brief Validate configuration values
+     * @return true if valid, false otherwise
+     */
+    bool is_valid() const;
+};
+
+/**
+ * @brief When Client::query_spillable() moves a result from memory to a temp file
+ *
+ * A result is kept in memory until its blocks reach memory_limit_bytes; then
+ * every block fetched so far and every later one is written to an unlinked
+ * temp file in directory, which is memory-mapped for reading once the fetch
+ * ends. Resident memory then stays around the size of one fetch block plus a
+ * small per-block index, however large the result.
+ *
+ * Example usage:
+ * @code
+ * databricks::SpillConfig spill;
+ * spill.memory_limit_bytes = 64 * 1024 * 1024;
+ * spill.directory = "/mnt/scratch";
+ * auto result = client.query_spillable("SELECT * FROM main.logs.events", {}, spill);
+ * @endcode
+ */
+struct SpillConfig {
+    size_t memory_limit_bytes = 256 * 1024 * 1024; ///< Result bytes kept in memory before spilling (default: 256 MiB)
+    std::string directory;                         ///< Where the spill file goes (empty = the system temp directory)
+};
+
 } // namespace databricks
@@ -0,0 +1,158 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "databricks/core/result_set.h"
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace databricks {
+/**
+ * @brief Forward-only cursor over a query result that is fetched incrementally
+ *
+ * Returned by Client::execute_cursor(). The cursor owns the executed statement and
+ * pulls rows from the driver in blocks (SQLConfig::fetch_batch_rows), so memory
+ * use stays constant regardless of result size and the first rows are available
+ * as soon as the first block arrives.
+ *
+ * With SQLConfig::prefetch_blocks set, a background thread fetches up to that
+ * many blocks ahead while the caller processes the current one.
+ *
+ * For pooled clients the cursor keeps its pooled connection checked out until the
+ * cursor is destroyed. For non-pooled clients it uses the client's dedicated
+ * connection, so the Client must outlive the cursor.
+ *
+ * Move-only. Not thread-safe; use one cursor per thread.
+ *
+ * Example usage:
+ * @code
+ * auto cursor = client.execute_cursor("SELECT id, name FROM events");
+ *
+ * // Row-at-a-time, zero-copy
+ * for (const auto& row : cursor) {
+ *     std::string_view id = row[0];
+ * }
+ *
+ * // Or in batches
+ * while (true) {
+ *     auto rows = cursor.next_batch(10000);
+ *     if (rows.empty()) break;
+ * }
+ * @endcode
+ */
+class Cursor {
+public:
+    /**
+     * @brief Input iterator over the remaining rows of a cursor
+     *
+     * Dereferencing yields a RowView valid until the iterator is advanced.
+     */
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = RowView;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const RowView*;
+        using reference = RowView;
+
+        iterator() = default;
+
+        RowView operator*() const;
+        iterator& operator++();
+        void operator++(int) { ++*this; }
+
+        bool operator==(const iterator& other) const { return cursor_ == other.cursor_; }
+        bool operator!=(const iterator& other) const { return cursor_ != other.cursor_; }
+
+    private:
+        explicit iterator(Cursor* cursor)
+            : cursor_(cursor) {}
+
+        Cursor* cursor_ = nullptr; // nullptr marks the end
+
+        friend class Cursor;
+    };
+
+    ~Cursor();
+
+    // Disable copy
+    Cursor(const Cursor&) = delete;
+    Cursor& operator=(const Cursor&) = delete;
+
+    // Enable move
+    Cursor(Cursor&&) noexcept;
+    Cursor& operator=(Cursor&&) noexcept;
+
+    /**
+     * @brief Column descriptions for the result set
+     */
+    const std::vector<ColumnMetadata>& schema() const;
+
+    /**
+     * @brief Fetch up to max_rows of the remaining rows
+     *
+     * Values are copied out as strings (NULL as empty string), matching Client::query.
+     *
+     * @param max_rows Maximum number of rows to return
+     * @return The next rows; empty once the result set is exhausted
+     * @throws std::runtime_error if fetching fails
+     */
+    std::vector<std::vector<std::string>> next_batch(size_t max_rows);
+
+    /**
+     * @brief Fetch up to max_rows of the remaining rows into a ResultSet
+     *
+     * Replaces out's rows with the next ones. out keeps its buffers between
+     * calls, so a loop reusing one ResultSet stops allocating once it has held
+     * its largest batch.
+     *
+     * @code
+     * databricks::ResultSet rows;
+     * while (cursor.next_result(rows, 10000)) {
+     *     process(rows);
+     * }
+     * @endcode
+     *
+     * @param out Receives the rows; its schema is set to this cursor's
+     * @param max_rows Maximum number of rows to fetch
+     * @return true if any rows were fetched, false once the result set is exhausted
+     * @throws std::runtime_error if fetching fails
+     */
+    bool next_result(ResultSet& out, size_t max_rows);
+
+    /**
+     * @brief Check whether every row has been consumed
+     *
+     * May fetch the next block from the driver to find out.
+     */
+    bool done();
+
+    /**
+     * @brief Iterate over the remaining rows
+     */
+    iterator begin();
+    iterator end() { return iterator(); }
+
+private:
+    class Impl;
+    explicit Cursor(std::unique_ptr<Impl> impl);
+
+    // Make sure the current block has an unconsumed row, fetching if needed
+    bool ensure_row();
+
+    // Fetch the next block, inline or from the prefetch thread (SQLConfig::prefetch_blocks)
+    bool fetch_block();
+
+    // Fetch one block from the driver, reporting a fetch cut short by QueryOptions as CancelledError
+    static bool fetch_into(Impl& impl, ColumnarBatch& batch);
+
+    std::unique_ptr<Impl> pimpl_;
+
+    friend class Client;
+};
+
+} // namespace databricks
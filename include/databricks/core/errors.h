@@ -0,0 +1,188 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace databricks {
+/**
+ * @brief One ODBC diagnostic record, as returned by SQLGetDiagRec
+ */
+struct DiagnosticRecord {
+    std::string sqlstate;     ///< Five-character SQLSTATE (e.g., "08S01")
+    int32_t native_error = 0; ///< Driver-specific error code
+    std::string message;      ///< Driver message text
+};
+
+/**
+ * @brief What kind of failure a diagnostic describes, which decides whether it is retried
+ */
+enum class ErrorCategory {
+    Timeout,        ///< HYT00/HYT01: the query or login timed out (retried if RetryConfig::retry_on_timeout)
+    Connection,     ///< 08xxx: the connection failed or was lost (retried if RetryConfig::retry_on_connection_lost)
+    Unavailable,    ///< HY000 carrying HTTP 429, 502, 503 or 504: the server is throttling or restarting (retried)
+    Authentication, ///< 28xxx: invalid credentials
+    Query,          ///< 07/21/22/23/24/25/3D/3F/42xxx: the statement itself is wrong or not permitted
+    Resource,       ///< HY001/HY013/HY014: the driver ran out of memory or handles
+    Other           ///< Anything else, including general errors without a transient HTTP status
+};
+
+/**
+ * @brief Classify a diagnostic record by its SQLSTATE
+ *
+ * SQLSTATEs are looked up in a fixed table, first exactly and then by their
+ * two-character class. Only the general error HY000 reads the message, and
+ * only to find the HTTP status the driver reports for a failed request.
+ */
+ErrorCategory classify_diagnostic(const DiagnosticRecord& record);
+
+/**
+ * @brief Convert ErrorCategory to its string representation
+ */
+std::string error_category_to_string(ErrorCategory category);
+
+/**
+ * @brief An ODBC call failed
+ *
+ * Carries the driver's diagnostic records so callers can act on the SQLSTATE
+ * and native error instead of parsing what(). The category, sqlstate() and
+ * native_error() come from the first record with a known category (or the
+ * first record if none has one). Subclasses exist for the categories callers
+ * most often handle separately.
+ *
+ * Example usage:
+ * @code
+ * try {
+ *     client.query(sql);
+ * } catch (const databricks::AuthenticationError& e) {
+ *     refresh_token();
+ * } catch (const databricks::SqlError& e) {
+ *     log(e.sqlstate(), e.native_error(), e.what());
+ * }
+ * @endcode
+ */
+class SqlError : public std::runtime_error {
+public:
+    /**
+     * @brief Construct from a message and the diagnostic records behind it
+     */
+    SqlError(const std::string& message, std::vector<DiagnosticRecord> diagnostics);
+
+    /**
+     * @brief SQLSTATE of the deciding record (empty if the driver gave none)
+     */
+    const std::string& sqlstate() const { return primary().sqlstate; }
+
+    /**
+     * @brief Native error code of the deciding record
+     */
+    int32_t native_error() const { return primary().native_error; }
+
+    /**
+     * @brief Category of the deciding record
+     */
+    ErrorCategory category() const { return category_; }
+
+    /**
+     * @brief Every diagnostic record, in driver order
+     */
+    const std::vector<DiagnosticRecord>& diagnostics() const { return diagnostics_; }
+
+    /**
+     * @brief True for the categories that may succeed when retried (Timeout, Connection, Unavailable)
+     */
+    bool is_transient() const {
+        return category_ == ErrorCategory::Timeout || category_ == ErrorCategory::Connection ||
+               category_ == ErrorCategory::Unavailable;
+    }
+
+private:
+    const DiagnosticRecord& primary() const;
+
+    std::vector<DiagnosticRecord> diagnostics_;
+    size_t primary_ = 0;
+    ErrorCategory category_ = ErrorCategory::Other;
+};
+
+/**
+ * @brief The connection could not be opened or was lost (SQLSTATE class 08)
+ */
+class ConnectionError : public SqlError {
+public:
+    using SqlError::SqlError;
+};
+
+/**
+ * @brief The query or login timed out (HYT00, HYT01)
+ */
+class TimeoutError : public SqlError {
+public:
+    using SqlError::SqlError;
+};
+
+/**
+ * @brief The server rejected the credentials (SQLSTATE class 28)
+ */
+class AuthenticationError : public SqlError {
+public:
+    using SqlError::SqlError;
+};
+
+/**
+ * @brief The statement is invalid or not permitted (syntax, missing object, constraint, data errors)
+ */
+class QueryError : public SqlError {
+public:
+    using SqlError::SqlError;
+};
+
+/**
+ * @brief The query was stopped by its QueryOptions: the timeout passed or the token was cancelled
+ *
+ * The diagnostics are the driver's (usually HY008, operation canceled), or
+ * empty if the query was stopped before it reached the driver. Never retried.
+ */
+class CancelledError : public SqlError {
+public:
+    CancelledError(const std::string& message, std::vector<DiagnosticRecord> diagnostics, bool timed_out)
+        : SqlError(message, std::move(diagnostics))
+        , timed_out_(timed_out) {}
+
+    /**
+     * @brief True if QueryOptions::timeout passed, false if the token was cancelled
+     */
+    bool timed_out() const { return timed_out_; }
+
+private:
+    bool timed_out_;
+};
+
+/**
+ * @brief The warehouse's circuit is open, so the call was not attempted
+ *
+ * Thrown while recent calls to the warehouse kept failing with transient
+ * errors (see RetryConfig::circuit_failure_threshold). Not an SqlError: the
+ * driver was never called.
+ */
+class CircuitOpenError : public std::runtime_error {
+public:
+    CircuitOpenError(const std::string& message, std::chrono::milliseconds retry_after)
+        : std::runtime_error(message)
+        , retry_after_(retry_after) {}
+
+    /**
+     * @brief Time until the circuit lets a probe call through
+     */
+    std::chrono::milliseconds retry_after() const { return retry_after_; }
+
+private:
+    std::chrono::milliseconds retry_after_;
+};
+
+} // namespace databricks
@@ -0,0 +1,169 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace databricks {
+/**
+ * @brief Latencies the SDK measures
+ */
+enum class MetricTimer {
+    QueryPrepare,     ///< SQLPrepare of a parameterized query, or the statement cache lookup that replaced it
+    QueryExecute,     ///< SQLExecDirect/SQLExecute, including parameter binding
+    QueryFetch,       ///< Fetching every row of a result
+    PoolAcquireWait,  ///< ConnectionPool::acquire/try_acquire, from the call until a connection is handed out
+    ConnectionCreate, ///< Opening an ODBC connection (SQLDriverConnect)
+    HttpRequest       ///< One HTTP attempt, labelled with method and endpoint
+};
+
+/**
+ * @brief Counts the SDK keeps
+ */
+enum class MetricCounter {
+    RowsFetched,         ///< Result rows read from the driver
+    BytesFetched,        ///< Result bytes read from the driver (character data as text, fixed-size types natively)
+    PoolAcquireTimeouts, ///< Pool acquires that gave up waiting for a connection
+    Retries,             ///< Retried attempts, labelled with the operation
+    HttpResponses,       ///< HTTP attempts, labelled with method, endpoint and status code (0 for transport errors)
+    HedgeableQueries,    ///< Read-only queries run in hedged mode (HedgeConfig)
+    HedgedQueries,       ///< Hedged-mode queries that sent a second copy
+    HedgeWins            ///< Hedged-mode queries answered by the second copy
+};
+
+/**
+ * @brief Dimensions attached to a measurement; unused fields are left empty
+ *
+ * The views only need to stay valid for the duration of the sink call.
+ */
+struct MetricLabels {
+    std::string_view operation; ///< Operation being retried, e.g. "query" (Retries)
+    std::string_view method;    ///< HTTP method (HttpRequest, HttpResponses)
+    std::string_view endpoint;  ///< REST path without query string or object names, e.g. "/jobs/list"
+    int status_code = 0;        ///< HTTP status code (HttpResponses)
+};
+
+/**
+ * @brief Receiver for the SDK's measurements
+ *
+ * Install one with set_metrics_sink() to forward measurements to an existing
+ * metrics library, or use MetricsRegistry. Methods are called on the thread
+ * doing the work, concurrently from many threads, and must not throw or block.
+ */
+class MetricsSink {
+public:
+    virtual ~MetricsSink() = default;
+
+    /**
+     * @brief Record one latency sample
+     */
+    virtual void observe(MetricTimer timer, std::chrono::nanoseconds duration, const MetricLabels& labels) = 0;
+
+    /**
+     * @brief Add value to a counter
+     */
+    virtual void add(MetricCounter counter, uint64_t value, const MetricLabels& labels) = 0;
+};
+
+/**
+ * @brief Built-in MetricsSink with latency histograms and a Prometheus exporter
+ *
+ * Each recording thread writes to its own set of log-linear (HDR-style)
+ * histograms with 16 sub-buckets per power of two, so samples keep about 6%
+ * precision from nanoseconds to over an hour. Only the owning thread writes a
+ * histogram, so recording is a few relaxed atomic stores with no locks or
+ * read-modify-write contention; readers merge all threads' histograms when a
+ * snapshot or export is requested. Counts from threads that have exited are
+ * kept.
+ *
+ * Example usage:
+ * @code
+ * auto registry = std::make_shared<databricks::MetricsRegistry>();
+ * databricks::set_metrics_sink(registry);
+ *
+ * // ... run queries ...
+ * auto execute = registry->histogram(databricks::MetricTimer::QueryExecute);
+ * std::cout << "p99 execute: " << execute.percentile(0.99).count() << "ns\n";
+ * std::cout << registry->to_prometheus();
+ * @endcode
+ *
+ * Thread-safe.
+ */
+class MetricsRegistry : public MetricsSink {
+public:
+    /**
+     * @brief Merged view of one histogram
+     */
+    struct HistogramSnapshot {
+        uint64_t count = 0;              ///< Samples recorded
+        std::chrono::nanoseconds sum{0}; ///< Total of all samples
+        std::chrono::nanoseconds max{0}; ///< Largest sample
+
+        /// Non-empty buckets as (inclusive upper bound, samples), ascending
+        std::vector<std::pair<std::chrono::nanoseconds, uint64_t>> buckets;
+
+        /**
+         * @brief Latency at or below which the fraction q of samples fall
+         * @param q Quantile in [0, 1], e.g. 0.99
+         * @return Upper bound of the bucket holding that sample (capped at max), 0 with no samples
+         */
+        std::chrono::nanoseconds percentile(double q) const;
+    };
+
+    MetricsRegistry();
+    ~MetricsRegistry() override;
+
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    void observe(MetricTimer timer, std::chrono::nanoseconds duration, const MetricLabels& labels) override;
+    void add(MetricCounter counter, uint64_t value, const MetricLabels& labels) override;
+
+    /**
+     * @brief Histogram for one timer and label set, merged across threads
+     */
+    HistogramSnapshot histogram(MetricTimer timer, const MetricLabels& labels = {}) const;
+
+    /**
+     * @brief Counter value for one label set, summed across threads
+     */
+    uint64_t counter(MetricCounter counter, const MetricLabels& labels = {}) const;
+
+    /**
+     * @brief Every series in the Prometheus text exposition format (version 0.0.4)
+     *
+     * Timers are exported as histograms in seconds (databricks_*_seconds) with
+     * fixed buckets from 100us to 60s; counters as databricks_*_total.
+     */
+    std::string to_prometheus() const;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pimpl_;
+};
+
+/**
+ * @brief Install the sink that receives the SDK's measurements
+ *
+ * Recording is disabled until a sink is installed; while disabled, each
+ * instrumented call costs one atomic load. Replaced sinks are kept
+ * alive until the process exits, since other threads may still be recording
+ * into them.
+ *
+ * @param sink The sink, or nullptr to stop recording
+ */
+void set_metrics_sink(std::shared_ptr<MetricsSink> sink);
+
+/**
+ * @brief The installed sink, or nullptr when recording is disabled
+ */
+std::shared_ptr<MetricsSink> get_metrics_sink();
+
+} // namespace databricks
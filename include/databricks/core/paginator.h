@@ -0,0 +1,174 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace databricks {
+/**
+ * @brief Lazy, forward-only iteration over a paginated REST listing
+ *
+ * Returned by listing calls such as Jobs::jobs() and UnityCatalog::tables().
+ * Pages are requested on demand by following the API's next_page_token, and
+ * while one page is being consumed the next is fetched in the background, so
+ * walking a large listing costs one round trip up front and roughly constant
+ * memory (the current page plus the one in flight).
+ *
+ * Errors from a page request are thrown when iteration reaches that page.
+ * Move-only. Not thread-safe; use one paginator per thread.
+ *
+ * Example usage:
+ * @code
+ * for (const auto& table : uc.tables("main", "default", 100)) {
+ *     std::cout << table.full_name << std::endl;
+ * }
+ *
+ * // Or a page at a time
+ * auto jobs = jobs_api.jobs();
+ * while (true) {
+ *     auto page = jobs.next_page();
+ *     if (page.empty()) break;
+ * }
+ * @endcode
+ */
+template <typename T> class Paginator {
+public:
+    /**
+     * @brief One page of a listing
+     */
+    struct Page {
+        std::vector<T> items;        ///< Objects on this page
+        std::string next_page_token; ///< Token for the following page, empty on the last page
+    };
+
+    /// Fetches the page for a token (empty for the first page)
+    using FetchPage = std::function<Page(const std::string& page_token)>;
+
+    /**
+     * @brief Input iterator over the remaining objects
+     *
+     * References stay valid until the iterator moves past the end of their page.
+     */
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        iterator() = default;
+
+        reference operator*() const { return owner_->items_[owner_->index_]; }
+        pointer operator->() const { return &**this; }
+        iterator& operator++() {
+            ++owner_->index_;
+            if (!owner_->ensure_item()) {
+                owner_ = nullptr;
+            }
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+
+        bool operator==(const iterator& other) const { return owner_ == other.owner_; }
+        bool operator!=(const iterator& other) const { return owner_ != other.owner_; }
+
+    private:
+        explicit iterator(Paginator* owner)
+            : owner_(owner) {}
+
+        Paginator* owner_ = nullptr; // nullptr marks the end
+
+        friend class Paginator;
+    };
+
+    /**
+     * @param fetch Called once per page
+     * @param prefetch Request the next page in the background while the current one is consumed
+     */
+    explicit Paginator(FetchPage fetch, bool prefetch = true)
+        : fetch_(std::move(fetch))
+        , prefetch_(prefetch) {}
+
+    // Disable copy
+    Paginator(const Paginator&) = delete;
+    Paginator& operator=(const Paginator&) = delete;
+
+    // Enable move (before iteration starts; iterators point at their paginator)
+    Paginator(Paginator&&) = default;
+    Paginator& operator=(Paginator&&) = default;
+
+    /**
+     * @brief Take the unconsumed objects of the current page, fetching the next page if needed
+     * @return The objects; empty once the listing is exhausted
+     * @throws std::runtime_error if a page request fails
+     */
+    std::vector<T> next_page() {
+        if (!ensure_item()) {
+            return {};
+        }
+        std::vector<T> page;
+        page.reserve(items_.size() - index_);
+        for (; index_ < items_.size(); ++index_) {
+            page.push_back(std::move(items_[index_]));
+        }
+        return page;
+    }
+
+    /**
+     * @brief Iterate over the remaining objects
+     */
+    iterator begin() { return ensure_item() ? iterator(this) : iterator(); }
+    iterator end() { return iterator(); }
+
+    /**
+     * @brief Number of pages received so far
+     */
+    size_t pages_fetched() const { return pages_fetched_; }
+
+private:
+    // Make sure the current page has an unconsumed object, fetching pages if needed
+    bool ensure_item() {
+        while (index_ >= items_.size()) {
+            if (!pending_.valid()) {
+                if (last_page_) {
+                    return false;
+                }
+                request(next_token_);
+            }
+
+            Page page = pending_.get();
+            pages_fetched_++;
+            items_ = std::move(page.items);
+            index_ = 0;
+            next_token_ = std::move(page.next_page_token);
+            last_page_ = next_token_.empty();
+
+            if (!last_page_ && prefetch_) {
+                request(next_token_);
+            }
+        }
+        return true;
+    }
+
+    void request(const std::string& token) {
+        pending_ = std::async(prefetch_ ? std::launch::async : std::launch::deferred, fetch_, token);
+    }
+
+    FetchPage fetch_;
+    bool prefetch_;
+    std::vector<T> items_;
+    size_t index_ = 0;
+    std::string next_token_;
+    bool last_page_ = false;
+    size_t pages_fetched_ = 0;
+    std::future<Page> pending_;
+};
+
+} // namespace databricks
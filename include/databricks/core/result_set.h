@@ -0,0 +1,465 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Forward declare ODBC types to avoid including sql.h in header
+typedef short SQLSMALLINT;
+
+namespace databricks {
+/**
+ * @brief Description of a result column as reported by the ODBC driver
+ *
+ * Populated from SQLDescribeCol once per result set.
+ */
+struct ColumnMetadata {
+    std::string name;               ///< Column label
+    SQLSMALLINT sql_type = 0;       ///< ODBC SQL data type (e.g., SQL_VARCHAR, SQL_BIGINT)
+    uint64_t column_size = 0;       ///< Declared column size (characters or precision, 0 if unknown)
+    SQLSMALLINT decimal_digits = 0; ///< Scale for numeric types
+    bool nullable = true;           ///< Whether the column may contain NULL values
+};
+
+/**
+ * @brief A block of query results stored column by column
+ *
+ * Each column keeps all of its values for the block in one contiguous byte buffer,
+ * with an offsets array (num_rows + 1 entries) marking where each value starts and
+ * a null array marking SQL NULLs. Values are exposed as std::string_view into the
+ * column buffer, so reading a cell never allocates.
+ *
+ * A ColumnarBatch handed to a callback is only valid for the duration of that
+ * callback; the SDK reuses the same buffers for the next block. Copy out any
+ * values you need to keep.
+ *
+ * Example usage:
+ * @code
+ * client.query_columnar("SELECT id, name FROM users", {}, [](const databricks::ColumnarBatch& batch) {
+ *     for (size_t row = 0; row < batch.num_rows(); ++row) {
+ *         if (!batch.is_null(row, 1)) {
+ *             std::string_view name = batch.value(row, 1);
+ *         }
+ *     }
+ * });
+ * @endcode
+ */
+class ColumnarBatch {
+public:
+    /**
+     * @brief Values of a single column within a batch
+     */
+    struct Column {
+        std::vector<char> data;        ///< Concatenated value bytes for every row
+        std::vector<uint64_t> offsets; ///< Start offset of each row in data (num_rows + 1 entries)
+        std::vector<uint8_t> nulls;    ///< 1 if the row's value is NULL, 0 otherwise
+
+        /**
+         * @brief Get the value at a row (empty view for NULL)
+         */
+        std::string_view value(size_t row) const {
+            return std::string_view(data.data() + offsets[row], offsets[row + 1] - offsets[row]);
+        }
+
+        /**
+         * @brief Check whether the value at a row is NULL
+         */
+        bool is_null(size_t row) const { return nulls[row] != 0; }
+    };
+
+    /**
+     * @brief Get the number of rows in this batch
+     */
+    size_t num_rows() const { return num_rows_; }
+
+    /**
+     * @brief Get the number of columns in this batch
+     */
+    size_t num_columns() const { return columns_.size(); }
+
+    /**
+     * @brief Get the column descriptions for this result set
+     */
+    const std::vector<ColumnMetadata>& schema() const { return schema_; }
+
+    /**
+     * @brief Access a column by zero-based index
+     */
+    const Column& column(size_t index) const { return columns_.at(index); }
+
+    /**
+     * @brief Get the value of a cell (empty view for NULL)
+     * @param row Zero-based row index within the batch
+     * @param col Zero-based column index
+     */
+    std::string_view value(size_t row, size_t col) const { return columns_[col].value(row); }
+
+    /**
+     * @brief Check whether a cell is NULL
+     * @param row Zero-based row index within the batch
+     * @param col Zero-based column index
+     */
+    bool is_null(size_t row, size_t col) const { return columns_[col].is_null(row); }
+
+    // ========== Building (used by the SDK fetch path) ==========
+
+    /**
+     * @brief Set the schema and drop all rows, allocating one Column per schema entry
+     */
+    void reset(const std::vector<ColumnMetadata>& schema);
+
+    /**
+     * @brief Drop all rows while keeping the schema and buffer capacity for reuse
+     */
+    void clear();
+
+    /**
+     * @brief Reserve space for a number of rows in every column
+     */
+    void reserve_rows(size_t rows);
+
+    /**
+     * @brief Append a value to a column
+     *
+     * Rows are complete once every column has received a value; call commit_row()
+     * after appending the last column of a row.
+     */
+    void append_value(size_t col, const char* data, size_t length);
+
+    /**
+     * @brief Append a NULL to a column
+     */
+    void append_null(size_t col);
+
+    /**
+     * @brief Mark the current row as complete
+     */
+    void commit_row() { ++num_rows_; }
+
+    /**
+     * @brief Mark several rows as complete after appending them column by column
+     */
+    void commit_rows(size_t count) { num_rows_ += count; }
+
+    /**
+     * @brief Mutable access to a column for bulk appends
+     *
+     * Callers writing into data directly must keep offsets and nulls consistent.
+     */
+    Column& mutable_column(size_t index) { return columns_.at(index); }
+
+private:
+    std::vector<ColumnMetadata> schema_;
+    std::vector<Column> columns_;
+    size_t num_rows_ = 0;
+};
+
+/**
+ * @brief A complete query result whose cell bytes share one buffer
+ *
+ * Unlike Client::query(), which allocates a std::string per cell and a vector per
+ * row, a ResultSet keeps every cell's bytes back to back in one buffer, with an
+ * offsets array (num_rows * num_columns + 1 entries, row-major) and a null
+ * array beside it. Cells are std::string_view into that buffer. A result
+ * therefore costs a handful of allocations however many cells it has, all of
+ * them freed together when it is destroyed.
+ *
+ * All three buffers are allocated from the std::pmr::memory_resource given at
+ * construction (the default resource if none). A caller can use it to put
+ * results in its own arena, e.g. a std::pmr::monotonic_buffer_resource that
+ * is released after each request. clear() keeps the capacity, so a ResultSet
+ * reused with Cursor::next_result() stops allocating once it has held its
+ * largest batch.
+ *
+ * Views returned by value() stay valid until the ResultSet is modified or destroyed.
+ *
+ * Example usage:
+ * @code
+ * std::pmr::monotonic_buffer_resource arena;
+ * databricks::ResultSet result = client.query_result("SELECT id, name FROM users", {}, &arena);
+ * for (size_t row = 0; row < result.num_rows(); ++row) {
+ *     std::string_view name = result.value(row, 1);
+ * }
+ * @endcode
+ */
+class ResultSet {
+public:
+    /**
+     * @param resource Where cell bytes, offsets and nulls are allocated; must outlive the ResultSet
+     */
+    explicit ResultSet(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Get the number of rows
+     */
+    size_t num_rows() const { return num_rows_; }
+
+    /**
+     * @brief Get the number of columns
+     */
+    size_t num_columns() const { return schema_.size(); }
+
+    /**
+     * @brief Get the column descriptions for this result set
+     */
+    const std::vector<ColumnMetadata>& schema() const { return schema_; }
+
+    /**
+     * @brief Get the value of a cell (empty view for NULL)
+     * @param row Zero-based row index
+     * @param col Zero-based column index
+     */
+    std::string_view value(size_t row, size_t col) const {
+        const size_t cell = row * schema_.size() + col;
+        return std::string_view(bytes_.data() + offsets_[cell], offsets_[cell + 1] - offsets_[cell]);
+    }
+
+    /**
+     * @brief Check whether a cell is NULL
+     * @param row Zero-based row index
+     * @param col Zero-based column index
+     */
+    bool is_null(size_t row, size_t col) const { return nulls_[row * schema_.size() + col] != 0; }
+
+    /**
+     * @brief Total bytes of cell data held
+     */
+    size_t data_bytes() const { return bytes_.size(); }
+
+    /**
+     * @brief The resource the result allocates from
+     */
+    std::pmr::memory_resource* resource() const { return bytes_.get_allocator().resource(); }
+
+    // ========== Building (used by the SDK fetch path) ==========
+
+    /**
+     * @brief Set the schema and drop all rows, keeping buffer capacity
+     */
+    void reset(const std::vector<ColumnMetadata>& schema);
+
+    /**
+     * @brief Drop all rows while keeping the schema and buffer capacity for reuse
+     */
+    void clear();
+
+    /**
+     * @brief Append count rows of batch, starting at first_row
+     *
+     * The batch must have this result's number of columns.
+     */
+    void append(const ColumnarBatch& batch, size_t first_row, size_t count);
+
+    /**
+     * @brief Append every row of batch
+     */
+    void append(const ColumnarBatch& batch) { append(batch, 0, batch.num_rows()); }
+
+private:
+    std::vector<ColumnMetadata> schema_;
+    std::pmr::vector<char> bytes_;       // Cell bytes, row-major
+    std::pmr::vector<uint64_t> offsets_; // Start of each cell in bytes_ (cells + 1 entries)
+    std::pmr::vector<uint8_t> nulls_;    // 1 if the cell is NULL, 0 otherwise
+    size_t num_rows_ = 0;
+};
+
+/**
+ * @brief Calendar date (layout-compatible with ODBC SQL_DATE_STRUCT)
+ */
+struct Date {
+    int16_t year = 0;   ///< Year (e.g., 2025)
+    uint16_t month = 0; ///< Month (1-12)
+    uint16_t day = 0;   ///< Day of month (1-31)
+};
+
+/**
+ * @brief Date and time of day (layout-compatible with ODBC SQL_TIMESTAMP_STRUCT)
+ */
+struct Timestamp {
+    int16_t year = 0;      ///< Year (e.g., 2025)
+    uint16_t month = 0;    ///< Month (1-12)
+    uint16_t day = 0;      ///< Day of month (1-31)
+    uint16_t hour = 0;     ///< Hour (0-23)
+    uint16_t minute = 0;   ///< Minute (0-59)
+    uint16_t second = 0;   ///< Second (0-59)
+    uint32_t fraction = 0; ///< Fractional seconds in nanoseconds
+};
+
+/**
+ * @brief Native value type a result column is decoded into
+ */
+enum class ValueType {
+    Boolean,   ///< SQL_BIT, fetched as SQL_C_BIT
+    Int64,     ///< TINYINT/SMALLINT/INTEGER/BIGINT, fetched as SQL_C_SBIGINT
+    Double,    ///< REAL/FLOAT/DOUBLE, fetched as SQL_C_DOUBLE
+    Date,      ///< SQL_TYPE_DATE, fetched as SQL_C_TYPE_DATE
+    Timestamp, ///< SQL_TYPE_TIMESTAMP, fetched as SQL_C_TYPE_TIMESTAMP
+    String     ///< Everything else (including DECIMAL, to keep full precision), fetched as SQL_C_CHAR
+};
+
+/**
+ * @brief Convert a ValueType to its name (e.g., "INT64")
+ */
+const char* to_string(ValueType type);
+
+/**
+ * @brief A block of query results decoded into native C++ types
+ *
+ * Each column stores its values in the vector matching its ValueType (int64s for
+ * Int64, doubles for Double, ...), with one entry per row. NULL rows hold a
+ * zero value and are flagged in nulls. String columns use the same contiguous
+ * data + offsets layout as ColumnarBatch.
+ *
+ * Like ColumnarBatch, a batch handed to a callback is only valid for the duration
+ * of that callback.
+ *
+ * Example usage:
+ * @code
+ * client.query_typed("SELECT id, price, created_at FROM orders", {}, [](const databricks::TypedBatch& batch) {
+ *     for (size_t row = 0; row < batch.num_rows(); ++row) {
+ *         int64_t id = batch.get_int64(row, 0);
+ *         double price = batch.get_double(row, 1);
+ *         databricks::Timestamp created = batch.get_timestamp(row, 2);
+ *     }
+ * });
+ * @endcode
+ */
+class TypedBatch {
+public:
+    /**
+     * @brief Values of a single column within a typed batch
+     *
+     * Only the vector matching type is populated.
+     */
+    struct Column {
+        ValueType type = ValueType::String; ///< Native type of the column
+        std::vector<uint8_t> nulls;         ///< 1 if the row's value is NULL, 0 otherwise
+        std::vector<uint8_t> bools;         ///< Boolean values (0 or 1)
+        std::vector<int64_t> int64s;        ///< Integer values
+        std::vector<double> doubles;        ///< Floating point values
+        std::vector<Date> dates;            ///< Date values
+        std::vector<Timestamp> timestamps;  ///< Timestamp values
+        std::vector<char> text;             ///< Concatenated string bytes
+        std::vector<uint64_t> text_offsets; ///< Start offset of each string (num_rows + 1 entries)
+    };
+
+    /**
+     * @brief Get the number of rows in this batch
+     */
+    size_t num_rows() const { return num_rows_; }
+
+    /**
+     * @brief Get the number of columns in this batch
+     */
+    size_t num_columns() const { return columns_.size(); }
+
+    /**
+     * @brief Get the column descriptions for this result set
+     */
+    const std::vector<ColumnMetadata>& schema() const { return schema_; }
+
+    /**
+     * @brief Access a column by zero-based index
+     */
+    const Column& column(size_t index) const { return columns_.at(index); }
+
+    /**
+     * @brief Check whether a cell is NULL
+     */
+    bool is_null(size_t row, size_t col) const { return columns_[col].nulls[row] != 0; }
+
+    /**
+     * @name Typed cell accessors
+     * @throws std::runtime_error if the column is not of the requested type
+     * @{
+     */
+    bool get_bool(size_t row, size_t col) const { return typed(col, ValueType::Boolean).bools[row] != 0; }
+    int64_t get_int64(size_t row, size_t col) const { return typed(col, ValueType::Int64).int64s[row]; }
+    double get_double(size_t row, size_t col) const { return typed(col, ValueType::Double).doubles[row]; }
+    Date get_date(size_t row, size_t col) const { return typed(col, ValueType::Date).dates[row]; }
+    Timestamp get_timestamp(size_t row, size_t col) const { return typed(col, ValueType::Timestamp).timestamps[row]; }
+    std::string_view get_string(size_t row, size_t col) const {
+        const auto& c = typed(col, ValueType::String);
+        return std::string_view(c.text.data() + c.text_offsets[row], c.text_offsets[row + 1] - c.text_offsets[row]);
+    }
+    /** @} */
+
+    // ========== Building (used by the SDK fetch path) ==========
+
+    /**
+     * @brief Set the schema and column types and drop all rows
+     */
+    void reset(const std::vector<ColumnMetadata>& schema, const std::vector<ValueType>& types);
+
+    /**
+     * @brief Drop all rows while keeping the schema and buffer capacity for reuse
+     */
+    void clear();
+
+    /**
+     * @brief Mark rows as complete after appending them column by column
+     */
+    void commit_rows(size_t count) { num_rows_ += count; }
+
+    /**
+     * @brief Mutable access to a column for bulk appends
+     */
+    Column& mutable_column(size_t index) { return columns_.at(index); }
+
+private:
+    const Column& typed(size_t col, ValueType expected) const;
+
+    std::vector<ColumnMetadata> schema_;
+    std::vector<Column> columns_;
+    size_t num_rows_ = 0;
+};
+
+/**
+ * @brief Lightweight view of one row inside a ColumnarBatch
+ *
+ * Cheap to copy; values are views into the batch and share its lifetime.
+ */
+class RowView {
+public:
+    RowView(const ColumnarBatch& batch, size_t row)
+        : batch_(&batch)
+        , row_(row) {}
+
+    /**
+     * @brief Get the number of columns in the row
+     */
+    size_t size() const { return batch_->num_columns(); }
+
+    /**
+     * @brief Get a column value (empty view for NULL)
+     */
+    std::string_view operator[](size_t col) const { return batch_->value(row_, col); }
+
+    /**
+     * @brief Check whether a column value is NULL
+     */
+    bool is_null(size_t col) const { return batch_->is_null(row_, col); }
+
+    /**
+     * @brief Copy the row into strings, with NULL as an empty string (same as Client::query)
+     */
+    std::vector<std::string> to_strings() const {
+        std::vector<std::string> values;
+        values.reserve(size());
+        for (size_t col = 0; col < size(); ++col) {
+            values.emplace_back(batch_->value(row_, col));
+        }
+        return values;
+    }
+
+private:
+    const ColumnarBatch* batch_;
+    size_t row_;
+};
+
+} // namespace databricks
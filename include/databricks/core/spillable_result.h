@@ -0,0 +1,114 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "databricks/core/config.h"
+#include "databricks/core/result_set.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace databricks {
+/**
+ * @brief A complete query result that moves to a memory-mapped temp file once it outgrows a memory limit
+ *
+ * Returned by Client::query_spillable() for results that may not fit in RAM.
+ * Small results stay in memory as the fetched blocks. Past
+ * SpillConfig::memory_limit_bytes the blocks are written to a temp file in the
+ * fetch layout (per column: value bytes, row offsets and a null bitmap) and
+ * only an index of where each block starts stays in memory. The file is
+ * mapped for reading, so any cell can be read at random and a rescan is
+ * served from the page cache; the kernel pages the file in and out as memory
+ * allows. The file is unlinked from the start and disappears with the result.
+ *
+ * Views returned by value() stay valid until the result is destroyed.
+ * Reading from several threads at once is safe.
+ *
+ * Example usage:
+ * @code
+ * auto result = client.query_spillable("SELECT user_id, url FROM main.logs.clicks");
+ * for (size_t row = 0; row < result.num_rows(); ++row) {
+ *     std::string_view url = result.value(row, 1);
+ * }
+ * @endcode
+ */
+class SpillableResult {
+public:
+    /**
+     * @param schema Result columns
+     * @param config Memory limit and spill directory
+     */
+    SpillableResult(std::vector<ColumnMetadata> schema, const SpillConfig& config = SpillConfig{});
+    ~SpillableResult();
+
+    SpillableResult(SpillableResult&&) noexcept;
+    SpillableResult& operator=(SpillableResult&&) noexcept;
+    SpillableResult(const SpillableResult&) = delete;
+    SpillableResult& operator=(const SpillableResult&) = delete;
+
+    /**
+     * @brief Get the number of rows
+     */
+    size_t num_rows() const;
+
+    /**
+     * @brief Get the number of columns
+     */
+    size_t num_columns() const;
+
+    /**
+     * @brief Get the column descriptions for this result
+     */
+    const std::vector<ColumnMetadata>& schema() const;
+
+    /**
+     * @brief Get the value of a cell (empty view for NULL)
+     * @throws std::out_of_range if row or col is past the end
+     */
+    std::string_view value(size_t row, size_t col) const;
+
+    /**
+     * @brief Check whether a cell is NULL
+     * @throws std::out_of_range if row or col is past the end
+     */
+    bool is_null(size_t row, size_t col) const;
+
+    /**
+     * @brief Whether the result moved to disk
+     */
+    bool spilled() const;
+
+    /**
+     * @brief Bytes of the result held in memory (blocks, or the block index once spilled)
+     */
+    uint64_t resident_bytes() const;
+
+    /**
+     * @brief Size of the spill file (0 if the result did not spill)
+     */
+    uint64_t spilled_bytes() const;
+
+    // ========== Building (used by the SDK fetch path) ==========
+
+    /**
+     * @brief Append every row of batch, spilling once the memory limit is passed
+     * @throws std::invalid_argument if the batch does not have this result's number of columns
+     * @throws std::runtime_error if the spill file cannot be written, or after seal()
+     */
+    void append(const ColumnarBatch& batch);
+
+    /**
+     * @brief End the result and map the spill file; required before reading a spilled result
+     * @throws std::runtime_error if the spill file cannot be mapped
+     */
+    void seal();
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pimpl_;
+};
+
+} // namespace databricks
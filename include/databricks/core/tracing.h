@@ -0,0 +1,145 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace databricks {
+/**
+ * @brief W3C trace context identifying one span of a trace
+ */
+struct SpanContext {
+    std::array<uint8_t, 16> trace_id{}; ///< All zero when there is no trace
+    std::array<uint8_t, 8> span_id{};   ///< All zero when there is no span
+    uint8_t trace_flags = 0;            ///< Bit 0 set when the trace is sampled
+
+    /**
+     * @brief True when both ids are non-zero
+     */
+    bool is_valid() const {
+        auto non_zero = [](const auto& id) {
+            for (uint8_t byte : id) {
+                if (byte != 0) {
+                    return true;
+                }
+            }
+            return false;
+        };
+        return non_zero(trace_id) && non_zero(span_id);
+    }
+
+    /**
+     * @brief True when the sampled flag is set
+     */
+    bool is_sampled() const { return (trace_flags & 0x01) != 0; }
+
+    /**
+     * @brief Value for a W3C traceparent header, e.g. "00-<trace id>-<span id>-01"
+     */
+    std::string to_traceparent() const;
+
+    /**
+     * @brief Parse a W3C traceparent header value
+     * @return The context, or an invalid (all zero) context if the value is malformed
+     */
+    static SpanContext from_traceparent(std::string_view value);
+
+    std::string trace_id_hex() const; ///< 32 lowercase hex digits
+    std::string span_id_hex() const;  ///< 16 lowercase hex digits
+};
+
+/**
+ * @brief A finished span, handed to the SpanExporter
+ */
+struct SpanData {
+    std::string name;                                            ///< e.g. "Client::query"
+    SpanContext context;                                         ///< This span's ids
+    std::array<uint8_t, 8> parent_span_id{};                     ///< All zero for a root span
+    std::chrono::system_clock::time_point start_time;            ///< Wall-clock start
+    std::chrono::nanoseconds duration{0};                        ///< Measured on the steady clock
+    bool error = false;                                          ///< The operation failed
+    std::string status_message;                                  ///< Error description when error is set
+    std::vector<std::pair<std::string, std::string>> attributes; ///< e.g. ("http.method", "GET")
+};
+
+/**
+ * @brief Receiver for finished spans
+ *
+ * Install one with set_span_exporter() to forward spans to OpenTelemetry or
+ * another tracing backend. on_end() is called on the thread that finished the
+ * span, concurrently from many threads, and must not throw or block.
+ */
+class SpanExporter {
+public:
+    virtual ~SpanExporter() = default;
+
+    /**
+     * @brief Called once for every finished, sampled span
+     */
+    virtual void on_end(const SpanData& span) = 0;
+};
+
+/**
+ * @brief Whether span instrumentation was compiled in (CMake option ENABLE_TRACING)
+ *
+ * When it was not, the functions below still work but the SDK never creates
+ * spans or sends traceparent headers.
+ */
+bool tracing_compiled_in();
+
+/**
+ * @brief Install the exporter that receives the SDK's spans
+ *
+ * Spans are only recorded while an exporter is installed; until then each
+ * instrumented call costs one atomic load. Replaced exporters are kept alive
+ * until the process exits, since other threads may still be ending spans.
+ *
+ * @param exporter The exporter, or nullptr to stop recording
+ */
+void set_span_exporter(std::shared_ptr<SpanExporter> exporter);
+
+/**
+ * @brief The installed exporter, or nullptr when spans are not recorded
+ */
+std::shared_ptr<SpanExporter> get_span_exporter();
+
+/**
+ * @brief Context of the innermost active span on this thread, invalid if none
+ */
+SpanContext current_span_context();
+
+/**
+ * @brief Makes an existing trace context the parent of SDK spans on this thread
+ *
+ * Use it to continue a trace started elsewhere, e.g. from the traceparent
+ * header of an incoming request. SDK spans created inside the scope become
+ * children of the context, and REST calls propagate it even when no exporter
+ * is installed. Async SDK calls started inside the scope carry it to their
+ * worker threads.
+ *
+ * Example usage:
+ * @code
+ * databricks::TraceContextScope scope(databricks::SpanContext::from_traceparent(header));
+ * auto rows = client.query("SELECT 1");
+ * @endcode
+ */
+class TraceContextScope {
+public:
+    explicit TraceContextScope(const SpanContext& parent);
+    ~TraceContextScope();
+
+    TraceContextScope(const TraceContextScope&) = delete;
+    TraceContextScope& operator=(const TraceContextScope&) = delete;
+
+private:
+    SpanContext previous_;
+};
+
+} // namespace databricks
@@ -0,0 +1,141 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "databricks/core/config.h"
+#include "databricks/files/files_types.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace databricks {
+namespace internal {
+class IHttpClient;
+}
+
+/**
+ * @brief Client for the Databricks Files API, which stores files in Unity Catalog volumes
+ *
+ * Paths are absolute volume paths such as /Volumes/<catalog>/<schema>/<volume>/dir/file.
+ * Each file goes up in a single PUT (the API accepts files up to 5 GiB). A
+ * local file is streamed from disk as it is sent, so it is never loaded
+ * into memory, and a failed attempt is retried from the start of the file.
+ * upload_files() sends many files in parallel. This implementation uses
+ * Files API 2.0.
+ *
+ * Example usage:
+ * @code
+ * databricks::AuthConfig auth = databricks::AuthConfig::from_environment();
+ * databricks::Files files(auth);
+ *
+ * files.create_directory("/Volumes/main/default/landing/2025-01-01");
+ * files.upload_file("orders.csv", "/Volumes/main/default/landing/2025-01-01/orders.csv");
+ *
+ * // Many files at once, eight in flight
+ * std::vector<databricks::FileUpload> uploads;
+ * for (const auto& name : local_names) {
+ *     uploads.push_back(databricks::FileUpload::from_file(name, "/Volumes/main/default/landing/" + name));
+ * }
+ * for (const auto& result : files.upload_files(uploads)) {
+ *     if (!result.success) {
+ *         std::cerr << result.path << ": " << result.error << std::endl;
+ *     }
+ * }
+ * @endcode
+ *
+ * Thread-safe: one Files object may be used from several threads at once.
+ */
+class Files {
+public:
+    /**
+     * @brief Construct a Files API client
+     * @param auth Authentication configuration with host and token
+     * @param api_version Files API version to use (default: "2.0")
+     */
+    explicit Files(const AuthConfig& auth, const std::string& api_version = "2.0");
+
+    /**
+     * @brief Construct a Files API client with custom transport settings
+     * @param auth Authentication configuration with host and token
+     * @param http Retry and rate limit settings for the uploads
+     */
+    Files(const AuthConfig& auth, const HttpConfig& http);
+
+    /**
+     * @brief Construct a Files API client with dependency injection (for testing)
+     * @param http_client Injected HTTP client (use MockHttpClient for unit tests)
+     * @note This constructor is primarily for testing with mock HTTP clients
+     */
+    explicit Files(std::shared_ptr<internal::IHttpClient> http_client);
+
+    /**
+     * @brief Destructor
+     */
+    ~Files();
+
+    Files(const Files&) = delete;
+    Files& operator=(const Files&) = delete;
+
+    /**
+     * @brief Store an in-memory buffer as a file
+     *
+     * Missing parent directories are created.
+     *
+     * @param path Absolute volume path of the file
+     * @param contents File contents
+     * @param overwrite Replace an existing file instead of failing
+     * @throws std::invalid_argument if path is not absolute
+     * @throws std::runtime_error if the API request fails
+     */
+    void upload(const std::string& path, const std::string& contents, bool overwrite = false);
+
+    /**
+     * @brief Store a local file, streamed from disk
+     *
+     * @param local_path File to read
+     * @param path Absolute volume path of the file
+     * @param overwrite Replace an existing file instead of failing
+     * @return Bytes sent
+     * @throws std::invalid_argument if path is not absolute
+     * @throws std::runtime_error if local_path cannot be read or the API request fails
+     */
+    uint64_t upload_file(const std::string& local_path, const std::string& path, bool overwrite = false);
+
+    /**
+     * @brief Upload many files in parallel
+     *
+     * Up to max_concurrent uploads run at once, each on its own connection.
+     * A failed file does not stop the others.
+     *
+     * @param uploads Files to store
+     * @param max_concurrent Uploads in flight at once
+     * @return One result per upload, in the order of uploads
+     * @throws std::invalid_argument if max_concurrent is 0
+     */
+    std::vector<UploadResult> upload_files(const std::vector<FileUpload>& uploads, size_t max_concurrent = 8);
+
+    /**
+     * @brief Delete a file
+     * @throws std::runtime_error if the API request fails (including when the file does not exist)
+     */
+    void delete_file(const std::string& path);
+
+    /**
+     * @brief Create a directory and any missing parents; succeeds if it already exists
+     * @throws std::runtime_error if the API request fails
+     */
+    void create_directory(const std::string& path);
+
+    /**
+     * @brief Delete an empty directory
+     * @throws std::runtime_error if the API request fails (including when the directory is not empty)
+     */
+    void delete_directory(const std::string& path);
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pimpl_;
+};
+
+} // namespace databricks
@@ -0,0 +1,54 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+namespace databricks {
+
+/**
+ * @brief One file for Files::upload_files(), read from disk or from memory
+ */
+struct FileUpload {
+    std::string path;       ///< Destination, e.g. /Volumes/main/default/landing/orders.csv
+    std::string local_path; ///< Local file streamed from disk; empty to send contents instead
+    std::string contents;   ///< In-memory body, used when local_path is empty
+    bool overwrite = false; ///< Replace an existing file at path
+
+    /**
+     * @brief Upload a local file, streamed from disk
+     */
+    static FileUpload from_file(std::string local_path, std::string path, bool overwrite = false) {
+        FileUpload upload;
+        upload.path = std::move(path);
+        upload.local_path = std::move(local_path);
+        upload.overwrite = overwrite;
+        return upload;
+    }
+
+    /**
+     * @brief Upload an in-memory buffer
+     */
+    static FileUpload from_buffer(std::string contents, std::string path, bool overwrite = false) {
+        FileUpload upload;
+        upload.path = std::move(path);
+        upload.contents = std::move(contents);
+        upload.overwrite = overwrite;
+        return upload;
+    }
+};
+
+/**
+ * @brief Outcome of one file in Files::upload_files()
+ */
+struct UploadResult {
+    std::string path;     ///< Destination of the upload
+    uint64_t bytes = 0;   ///< Size of the file sent
+    bool success = false; ///< Whether the file was stored
+    int status_code = 0;  ///< HTTP status of the response (0 if no response was received)
+    std::string error;    ///< Failure message when success is false
+};
+
+} // namespace databricks
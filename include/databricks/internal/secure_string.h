@@ -4,8 +4,10 @@
 #define DATABRICKS_INTERNAL_SECURE_STRING_H
 
 #include <cstring>
+#include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <sys/mman.h>
 
 namespace databricks {
@@ -191,4 +193,13 @@ inline std::string from_secure_string(const SecureString& secure_str) {
 } // namespace internal
 } // namespace databricks
 
+// Hash a SecureString by content, the same as an equal std::string
+namespace std {
+template <> struct hash<databricks::internal::SecureString> {
+    size_t operator()(const databricks::internal::SecureString& str) const noexcept {
+        return hash<string_view>()(string_view(str.data(), str.size()));
+    }
+};
+} // namespace std
+
 #endif // DATABRICKS_INTERNAL_SECURE_STRING_H
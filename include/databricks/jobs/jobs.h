@@ -3,14 +3,21 @@
 #pragma once
 
 #include "databricks/core/config.h"
+#include "databricks/core/paginator.h"
 #include "databricks/jobs/jobs_types.h"
 
+#include <chrono>
 #include <cstdint>
+#include <future>
 #include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
+#ifdef DATABRICKS_ENABLE_COROUTINES
+#    include "databricks/core/awaitable.h"
+#endif
+
 namespace databricks {
 // Forward declaration for dependency injection
 namespace internal {
@@ -37,6 +44,9 @@ class IHttpClient;
  * // Trigger a job run
  * std::map<std::string, std::string> params = {{"key", "value"}};
  * uint64_t run_id = jobs.run_now(123456789, params);
+ *
+ * // Wait for it to finish
+ * auto run = jobs.wait_for_run(run_id, std::chrono::minutes(30)).get();
  * @endcode
  */
 class Jobs {
@@ -47,6 +57,13 @@ public:
      */
     explicit Jobs(const AuthConfig& auth);
 
+    /**
+     * @brief Construct a Jobs API client with custom transport settings
+     * @param auth Authentication configuration with host and token
+     * @param http Concurrency settings for batch calls such as get_jobs()
+     */
+    Jobs(const AuthConfig& auth, const HttpConfig& http);
+
     /**
      * @brief Construct a Jobs API client with dependency injection (for testing)
      * @param http_client Injected HTTP client (use MockHttpClient for unit tests)
@@ -75,6 +92,18 @@ public:
      */
     std::vector<Job> list_jobs(int limit = 25, int offset = 0);
 
+    /**
+     * @brief Iterate over every job in the workspace
+     *
+     * Follows next_page_token lazily and fetches the next page in the background
+     * while the current one is consumed.
+     *
+     * @param max_results Jobs per page (default: 25, max: 100)
+     * @return Paginator yielding Job objects
+     * @throws std::runtime_error during iteration if a page request fails
+     */
+    Paginator<Job> jobs(int max_results = 25);
+
     /**
      * @brief Get detailed information about a specific job
      *
@@ -84,6 +113,18 @@ public:
      */
     Job get_job(uint64_t job_id);
 
+    /**
+     * @brief Get details for several jobs concurrently
+     *
+     * Issues every request up front (up to HttpConfig::max_concurrent_requests
+     * in flight, multiplexed over HTTP/2) instead of one round trip at a time.
+     *
+     * @param job_ids Jobs to fetch
+     * @return Job objects in the same order as job_ids
+     * @throws std::runtime_error if any job is not found or a request fails
+     */
+    std::vector<Job> get_jobs(const std::vector<uint64_t>& job_ids);
+
     /**
      * @brief Trigger an immediate run of a job
      *
@@ -97,6 +138,39 @@ public:
      */
     uint64_t run_now(uint64_t job_id, const std::map<std::string, std::string>& notebook_params = {});
 
+    /**
+     * @brief Trigger many job runs, pipelining the requests
+     *
+     * Up to max_in_flight triggers are outstanding at once on the client's
+     * concurrent transport. HttpConfig::requests_per_second paces them and an
+     * HTTP 429 pauses the whole batch for the server's Retry-After. A failed
+     * trigger does not stop the others; give each request an idempotency_token
+     * so that a retried trigger cannot start a second run.
+     *
+     * @param requests Jobs to run with their parameters
+     * @param max_in_flight Triggers outstanding at once
+     * @return One result per request, in the order of requests
+     * @throws std::invalid_argument if max_in_flight is 0
+     */
+    std::vector<RunNowResult> run_now_batch(const std::vector<RunNowRequest>& requests, size_t max_in_flight = 32);
+
+    /**
+     * @brief Iterate over job runs, newest first, a page at a time
+     *
+     * Pages are fetched lazily from /jobs/runs/list, so all active runs in a
+     * workspace can be tracked with one request per page instead of one per
+     * run.
+     *
+     * @param job_id Only runs of this job (0 = runs of every job)
+     * @param active_only Only runs that are pending, running or terminating
+     * @param since Only runs started at or after this Unix time in milliseconds (0 = no limit)
+     * @param max_results Runs per page (default: 25, max: 25)
+     * @return Paginator yielding JobRun objects
+     * @throws std::runtime_error during iteration if a page request fails
+     */
+    Paginator<JobRun> list_runs(uint64_t job_id = 0, bool active_only = false, uint64_t since = 0,
+                                int max_results = 25);
+
     /**
      * @brief Cancel a running or pending job run
      *
@@ -106,6 +180,26 @@ public:
      */
     bool cancel_run(uint64_t run_id);
 
+    /**
+     * @brief Wait for a job run to finish
+     *
+     * The run is watched by the SDK's shared status poller, which checks all
+     * outstanding waits in one batch per tick and backs off while a run's state
+     * is unchanged (see PollConfig), so many runs can be awaited without a
+     * thread each. The returned future does not depend on this Jobs object.
+     *
+     * @param run_id The unique identifier of the job run
+     * @param timeout How long to wait before failing the future
+     * @param poll Polling schedule
+     * @return Future holding the run once its lifecycle state is TERMINATED,
+     *         SKIPPED or INTERNAL_ERROR; check result_state for the outcome
+     * @throws std::invalid_argument if poll is invalid
+     *
+     * @note The future throws std::runtime_error on timeout or if a status request fails
+     */
+    std::future<JobRun> wait_for_run(uint64_t run_id, std::chrono::milliseconds timeout = std::chrono::hours(1),
+                                     const PollConfig& poll = PollConfig{});
+
     /**
      * @brief Get the output of a completed job run
      *
@@ -117,12 +211,28 @@ public:
      */
     RunOutput get_run_output(uint64_t run_id);
 
+#ifdef DATABRICKS_ENABLE_COROUTINES
+    /**
+     * @brief Get the output of a completed job run from a C++20 coroutine without blocking its thread
+     *
+     * The request runs on the HTTP client's async engine, and the coroutine
+     * resumes on the engine thread (see Awaitable::resume_on()). Otherwise the
+     * same as get_run_output(). Only available when the SDK is built with
+     * -DENABLE_COROUTINES=ON.
+     *
+     * @note The Jobs object must outlive the awaited request.
+     */
+    Awaitable<RunOutput> co_get_run_output(uint64_t run_id);
+#endif
+
 private:
     class Impl;
     std::unique_ptr<Impl> pimpl_;
 
     static std::vector<Job> parse_jobs_list(const std::string& json);
+    static std::vector<Job> parse_jobs_list(const nlohmann::json& j);
     static std::vector<JobRun> parse_runs_list(const std::string& json);
+    static std::vector<JobRun> parse_runs_list(const nlohmann::json& j);
 };
 
 } // namespace databricks
\ No newline at end of file
@@ -7,6 +7,8 @@
 #include <string>
 #include <vector>
 
+#include <nlohmann/json_fwd.hpp>
+
 namespace databricks {
 
 /**
@@ -29,6 +31,15 @@ struct Job {
      * @throws std::runtime_error if parsing fails
      */
     static Job from_json(const std::string& json_str);
+
+    /**
+     * @brief Parse a Job from an already-parsed JSON object (no re-serialization)
+     * @throws std::runtime_error if a field has an unexpected type
+     */
+    static Job from_json(const nlohmann::json& j);
+
+    /// Literal JSON text is parsed as a string
+    static Job from_json(const char* json_str) { return from_json(std::string(json_str)); }
 };
 
 /**
@@ -52,6 +63,15 @@ struct JobRun {
      * @throws std::runtime_error if parsing fails
      */
     static JobRun from_json(const std::string& json_str);
+
+    /**
+     * @brief Parse a JobRun from an already-parsed JSON object (no re-serialization)
+     * @throws std::runtime_error if a field has an unexpected type
+     */
+    static JobRun from_json(const nlohmann::json& j);
+
+    /// Literal JSON text is parsed as a string
+    static JobRun from_json(const char* json_str) { return from_json(std::string(json_str)); }
 };
 
 /**
@@ -71,6 +91,35 @@ struct RunOutput {
      * @brief Parse RunOutput from JSON string
      */
     static RunOutput from_json(const std::string& json_str);
+
+    /**
+     * @brief Parse a RunOutput from an already-parsed JSON object (no re-serialization)
+     * @throws std::runtime_error if a field has an unexpected type
+     */
+    static RunOutput from_json(const nlohmann::json& j);
+
+    /// Literal JSON text is parsed as a string
+    static RunOutput from_json(const char* json_str) { return from_json(std::string(json_str)); }
+};
+
+/**
+ * @brief One trigger for Jobs::run_now_batch()
+ */
+struct RunNowRequest {
+    uint64_t job_id = 0;                                ///< Job to run (required)
+    std::map<std::string, std::string> notebook_params; ///< Parameters passed to notebook tasks
+    std::string idempotency_token; ///< Makes a retried trigger start at most one run (recommended for batches)
+};
+
+/**
+ * @brief Outcome of one trigger in Jobs::run_now_batch()
+ */
+struct RunNowResult {
+    uint64_t job_id = 0;  ///< Job the trigger was sent for
+    uint64_t run_id = 0;  ///< Run started by the trigger (0 if it failed)
+    bool success = false; ///< Whether a run was started
+    int status_code = 0;  ///< HTTP status of the response (0 if no response was received)
+    std::string error;    ///< Failure message when success is false
 };
 
 } // namespace databricks
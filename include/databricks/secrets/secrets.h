@@ -38,6 +38,10 @@ class IHttpClient;
  * // List secrets in a scope
  * auto secret_list = secrets.list_secrets("my_scope");
  *
+ * // Read secret values, several at once
+ * auto api_key = secrets.get_secret("my_scope", "api_key");
+ * auto values = secrets.get_secrets("my_scope", {"db_user", "db_password"});
+ *
  * // Delete a secret
  * secrets.delete_secret("my_scope", "api_key");
  * @endcode
@@ -51,6 +55,13 @@ public:
      */
     explicit Secrets(const AuthConfig& auth, const std::string& api_version = "2.0");
 
+    /**
+     * @brief Construct a Secrets API client with custom transport settings
+     * @param auth Authentication configuration with host and token
+     * @param http Concurrency settings for batch calls such as get_secrets()
+     */
+    Secrets(const AuthConfig& auth, const HttpConfig& http);
+
     /**
      * @brief Construct a Secrets API client with dependency injection (for testing)
      * @param http_client Injected HTTP client (use MockHttpClient for unit tests)
@@ -66,6 +77,29 @@ public:
     Secrets(const Secrets&) = delete;
     Secrets& operator=(const Secrets&) = delete;
 
+    // Secret value cache
+
+    /**
+     * @brief Enable, reconfigure or disable the secret value cache
+     *
+     * get_secret() and get_secrets() are served from the cache while enabled.
+     * Changing the configuration drops (and zeroes) every cached value.
+     *
+     * @param config Cache settings; config.enabled = false turns caching off
+     * @throws std::invalid_argument if config is invalid
+     */
+    void set_cache_config(const SecretCacheConfig& config);
+
+    /**
+     * @brief Hit, miss and eviction counters for the secret cache (all zero when disabled)
+     */
+    CacheStats cache_stats() const;
+
+    /**
+     * @brief Drop (and zero) every cached value so the next reads go to the server
+     */
+    void invalidate_cache();
+
     // Scope operations
     /**
      * @brief List all secret scopes in the workspace
@@ -147,6 +181,34 @@ public:
      */
     std::vector<Secret> list_secrets(const std::string& scope);
 
+    /**
+     * @brief Read a secret's value
+     *
+     * The API returns the value base64-encoded; it is decoded straight into
+     * locked memory, and the response buffers holding it are zeroed.
+     *
+     * @param scope The name of the secret scope
+     * @param key The name of the secret
+     * @return The decoded value
+     * @throws std::runtime_error if the secret is not found, the caller lacks READ permission,
+     *         or the API request fails
+     */
+    SecretValue get_secret(const std::string& scope, const std::string& key);
+
+    /**
+     * @brief Read several secrets of one scope concurrently
+     *
+     * Cached values are served from memory; the rest are requested up front
+     * (up to HttpConfig::max_concurrent_requests in flight) instead of one
+     * round trip at a time.
+     *
+     * @param scope The name of the secret scope
+     * @param keys The secrets to read
+     * @return Values in the same order as keys
+     * @throws std::runtime_error if any secret is not found or a request fails
+     */
+    std::vector<SecretValue> get_secrets(const std::string& scope, const std::vector<std::string>& keys);
+
 private:
     class Impl;
     std::unique_ptr<Impl> pimpl_;
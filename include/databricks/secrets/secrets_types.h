@@ -2,9 +2,13 @@
 // SPDX-License-Identifier: MIT
 #pragma once
 
+#include "databricks/internal/secure_string.h"
+
 #include <cstdint>
 #include <string>
 
+#include <nlohmann/json_fwd.hpp>
+
 namespace databricks {
 
 /**
@@ -42,8 +46,22 @@ struct SecretScope {
      * @throws std::runtime_error if parsing fails
      */
     static SecretScope from_json(const std::string& json_str);
+
+    /**
+     * @brief Parse a SecretScope from an already-parsed JSON object (no re-serialization)
+     * @throws std::runtime_error if a field has an unexpected type
+     */
+    static SecretScope from_json(const nlohmann::json& j);
+
+    /// Literal JSON text is parsed as a string
+    static SecretScope from_json(const char* json_str) { return from_json(std::string(json_str)); }
 };
 
+/**
+ * @brief A secret's value, kept in memory that is locked against swapping and zeroed when freed
+ */
+using SecretValue = internal::SecureString;
+
 /**
  * @brief Represents secret metadata (not the secret value)
  */
@@ -58,6 +76,15 @@ struct Secret {
      * @throws std::runtime_error if parsing fails
      */
     static Secret from_json(const std::string& json_str);
+
+    /**
+     * @brief Parse a Secret from an already-parsed JSON object (no re-serialization)
+     * @throws std::runtime_error if a field has an unexpected type
+     */
+    static Secret from_json(const nlohmann::json& j);
+
+    /// Literal JSON text is parsed as a string
+    static Secret from_json(const char* json_str) { return from_json(std::string(json_str)); }
 };
 
 /**
@@ -74,6 +101,15 @@ struct SecretACL {
      * @throws std::runtime_error if parsing fails
      */
     static SecretACL from_json(const std::string& json_str);
+
+    /**
+     * @brief Parse a SecretACL from an already-parsed JSON object (no re-serialization)
+     * @throws std::runtime_error if a field has an unexpected type
+     */
+    static SecretACL from_json(const nlohmann::json& j);
+
+    /// Literal JSON text is parsed as a string
+    static SecretACL from_json(const char* json_str) { return from_json(std::string(json_str)); }
 };
 
 } // namespace databricks
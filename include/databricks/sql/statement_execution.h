@@ -0,0 +1,251 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "databricks/core/config.h"
+#include "databricks/sql/statement_execution_types.h"
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <string>
+
+namespace databricks {
+namespace internal {
+class IHttpClient;
+}
+
+/**
+ * @brief Streams the chunks of a statement result, downloading several at once
+ *
+ * Returned by StatementExecution::execute() and fetch_chunks(). Chunks are
+ * delivered in order, while up to max_parallel_downloads of the following
+ * chunks are downloaded in the background from their presigned links, so
+ * throughput is bound by the storage bandwidth rather than one round trip per
+ * chunk. Memory use is roughly the chunks in flight plus the one being read.
+ * A link that has expired (HTTP 403) is refreshed and retried once.
+ *
+ * Errors from a download are thrown when iteration reaches that chunk.
+ * Move-only. Not thread-safe; use one stream per thread.
+ *
+ * Example usage:
+ * @code
+ * for (auto& chunk : statements.execute(request)) {
+ *     consume(chunk.data); // Arrow IPC stream by default
+ * }
+ * @endcode
+ */
+class ResultChunkStream {
+public:
+    /**
+     * @brief Input iterator over the remaining chunks
+     *
+     * The referenced chunk stays valid until the iterator is advanced; its data may be moved out.
+     */
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = ResultChunk;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ResultChunk*;
+        using reference = ResultChunk&;
+
+        iterator() = default;
+
+        reference operator*() const { return owner_->current_; }
+        pointer operator->() const { return &owner_->current_; }
+        iterator& operator++() {
+            if (!owner_->next(owner_->current_)) {
+                owner_ = nullptr;
+            }
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+
+        bool operator==(const iterator& other) const { return owner_ == other.owner_; }
+        bool operator!=(const iterator& other) const { return owner_ != other.owner_; }
+
+    private:
+        explicit iterator(ResultChunkStream* owner)
+            : owner_(owner) {}
+
+        ResultChunkStream* owner_ = nullptr; // nullptr marks the end
+
+        friend class ResultChunkStream;
+    };
+
+    ~ResultChunkStream();
+
+    // Disable copy
+    ResultChunkStream(const ResultChunkStream&) = delete;
+    ResultChunkStream& operator=(const ResultChunkStream&) = delete;
+
+    // Enable move (before iteration starts; iterators point at their stream)
+    ResultChunkStream(ResultChunkStream&&) noexcept;
+    ResultChunkStream& operator=(ResultChunkStream&&) noexcept;
+
+    /**
+     * @brief Wait for the next chunk
+     * @param chunk Receives the chunk
+     * @return false once every chunk has been delivered
+     * @throws std::runtime_error if the download or a link refresh fails
+     */
+    bool next(ResultChunk& chunk);
+
+    /**
+     * @brief Iterate over the remaining chunks
+     */
+    iterator begin() { return next(current_) ? iterator(this) : iterator(); }
+    iterator end() { return iterator(); }
+
+    /**
+     * @brief Number of chunks in the result
+     */
+    uint64_t total_chunks() const;
+
+    /**
+     * @brief Number of chunks delivered so far
+     */
+    uint64_t chunks_delivered() const;
+
+private:
+    class Impl;
+    explicit ResultChunkStream(std::unique_ptr<Impl> impl);
+
+    std::unique_ptr<Impl> impl_;
+    ResultChunk current_; // Chunk the iterator points at
+
+    friend class StatementExecution;
+};
+
+/**
+ * @brief Client for the Databricks SQL Statement Execution API
+ *
+ * Runs SQL on a SQL warehouse over REST, without an ODBC driver on the host.
+ * Results use the EXTERNAL_LINKS disposition: the warehouse writes them to
+ * cloud storage in chunks, and ResultChunkStream downloads the chunks in
+ * parallel straight from storage (CloudFetch). For large extracts this is much
+ * faster than pulling rows serially over one ODBC connection.
+ *
+ * This implementation uses the Statement Execution API 2.0.
+ *
+ * Example usage:
+ * @code
+ * databricks::AuthConfig auth = databricks::AuthConfig::from_environment();
+ * databricks::StatementExecution statements(auth);
+ *
+ * databricks::StatementRequest request;
+ * request.statement = "SELECT * FROM main.sales.orders WHERE day = :day";
+ * request.warehouse_id = "abcdef0123456789";
+ * request.parameters = {{"day", "2025-01-01", "DATE"}};
+ *
+ * for (auto& chunk : statements.execute(request)) {
+ *     // chunk.data holds one Arrow IPC stream
+ * }
+ * @endcode
+ */
+class StatementExecution {
+public:
+    /**
+     * @brief Construct a Statement Execution API client
+     * @param auth Authentication configuration with host and token
+     */
+    explicit StatementExecution(const AuthConfig& auth);
+
+    /**
+     * @brief Construct a Statement Execution API client with custom transport settings
+     * @param auth Authentication configuration with host and token
+     * @param http Transport settings; max_concurrent_requests also caps parallel chunk downloads
+     */
+    StatementExecution(const AuthConfig& auth, const HttpConfig& http);
+
+    /**
+     * @brief Construct a Statement Execution API client with dependency injection (for testing)
+     * @param http_client Injected HTTP client (use MockHttpClient for unit tests)
+     * @note This constructor is primarily for testing with mock HTTP clients
+     */
+    explicit StatementExecution(std::shared_ptr<internal::IHttpClient> http_client);
+
+    /**
+     * @brief Destructor
+     */
+    ~StatementExecution();
+
+    // Disable copy
+    StatementExecution(const StatementExecution&) = delete;
+    StatementExecution& operator=(const StatementExecution&) = delete;
+
+    /**
+     * @brief Submit a statement
+     *
+     * Waits up to request.wait_timeout_seconds for the result; a statement
+     * still running after that continues in the background (see wait_for_statement()).
+     *
+     * @return The statement's state, and its manifest and first links if it already finished
+     * @throws std::invalid_argument if the statement or warehouse_id is empty, or wait_timeout_seconds is invalid
+     * @throws std::runtime_error if the API request fails
+     */
+    StatementResponse submit(const StatementRequest& request);
+
+    /**
+     * @brief Get the current state of a statement
+     * @throws std::runtime_error if the API request fails
+     */
+    StatementResponse get_statement(const std::string& statement_id);
+
+    /**
+     * @brief Wait for a statement to finish
+     *
+     * The statement is watched by the SDK's shared status poller, like Jobs::wait_for_run().
+     *
+     * @param statement_id Statement returned by submit()
+     * @param timeout Give up after this long
+     * @param poll Interval schedule for the status checks
+     * @return Future for the final response; holds std::runtime_error on timeout or a failed request
+     * @throws std::invalid_argument if the poll configuration is invalid
+     */
+    std::future<StatementResponse> wait_for_statement(const std::string& statement_id,
+                                                      std::chrono::milliseconds timeout,
+                                                      const PollConfig& poll = PollConfig{});
+
+    /**
+     * @brief Cancel a running statement
+     * @throws std::runtime_error if the API request fails
+     */
+    void cancel_statement(const std::string& statement_id);
+
+    /**
+     * @brief Get a fresh presigned link for one result chunk
+     * @throws std::runtime_error if the API request fails or the response has no link for the chunk
+     */
+    ExternalLink get_chunk_link(const std::string& statement_id, uint64_t chunk_index);
+
+    /**
+     * @brief Stream the chunks of a finished statement
+     *
+     * @param response A SUCCEEDED response; its links are used before requesting more
+     * @param max_parallel_downloads Chunks downloaded ahead of the reader (at least 1)
+     * @throws std::invalid_argument if the statement has not succeeded or max_parallel_downloads is 0
+     */
+    ResultChunkStream fetch_chunks(const StatementResponse& response, size_t max_parallel_downloads = 4);
+
+    /**
+     * @brief Submit a statement, wait for it and stream its result
+     *
+     * @param request Statement to run
+     * @param timeout Longest wait for the statement to finish; it is canceled on timeout
+     * @param max_parallel_downloads Chunks downloaded ahead of the reader (at least 1)
+     * @throws std::runtime_error if the statement fails, is canceled or times out
+     */
+    ResultChunkStream execute(const StatementRequest& request,
+                              std::chrono::milliseconds timeout = std::chrono::minutes(15),
+                              size_t max_parallel_downloads = 4);
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pimpl_;
+};
+
+} // namespace databricks
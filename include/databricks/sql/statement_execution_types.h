@@ -0,0 +1,169 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json_fwd.hpp>
+
+namespace databricks {
+
+/**
+ * @brief Enumeration of statement lifecycle states
+ */
+enum class StatementState {
+    PENDING,   ///< Waiting for the warehouse
+    RUNNING,   ///< Executing
+    SUCCEEDED, ///< Finished; the result is available
+    FAILED,    ///< Finished with an error
+    CANCELED,  ///< Canceled by the user
+    CLOSED,    ///< Finished and the result was released
+    UNKNOWN    ///< Unknown or unrecognized state
+};
+
+/**
+ * @brief Parse a statement state string into StatementState
+ * @param state_str String representation of the state (e.g., "SUCCEEDED")
+ * @return StatementState corresponding to the string, UNKNOWN if unrecognized
+ */
+StatementState parse_statement_state(const std::string& state_str);
+
+/**
+ * @brief Convert StatementState to its string representation
+ */
+std::string statement_state_to_string(StatementState state);
+
+/**
+ * @brief Encoding of downloaded result chunks
+ */
+enum class StatementFormat {
+    ARROW_STREAM, ///< Apache Arrow IPC stream, one per chunk
+    JSON_ARRAY,   ///< JSON array of rows, each an array of strings
+    CSV           ///< Comma-separated values with a header row in the first chunk
+};
+
+/**
+ * @brief Convert StatementFormat to the API's string representation
+ */
+std::string statement_format_to_string(StatementFormat format);
+
+/**
+ * @brief A named statement parameter, referenced as :name in the SQL text
+ */
+struct StatementParameter {
+    std::string name;                 ///< Parameter name, without the colon
+    std::optional<std::string> value; ///< Value as text; nullopt binds NULL
+    std::string type;                 ///< SQL type (e.g., "INT", "DATE"); empty means STRING
+};
+
+/**
+ * @brief A statement to run on a SQL warehouse
+ */
+struct StatementRequest {
+    std::string statement;                      ///< SQL text
+    std::string warehouse_id;                   ///< SQL warehouse to run on
+    std::string catalog;                        ///< Default catalog (optional)
+    std::string schema;                         ///< Default schema (optional)
+    std::vector<StatementParameter> parameters; ///< Named parameters
+    /// Seconds the submit call waits for the result (0, or 5 to 50); longer statements continue
+    /// asynchronously and are polled
+    int wait_timeout_seconds = 10;
+    uint64_t row_limit = 0;  ///< Stop after this many rows (0 for no limit)
+    uint64_t byte_limit = 0; ///< Stop after this many result bytes (0 for no limit)
+    /// Encoding of the result chunks
+    StatementFormat format = StatementFormat::ARROW_STREAM;
+
+    /**
+     * @brief Build the request body for POST /sql/statements
+     */
+    std::string to_json() const;
+};
+
+/**
+ * @brief A column of a statement result
+ */
+struct StatementColumn {
+    std::string name;      ///< Column name
+    std::string type_name; ///< Type family (e.g., "INT", "DECIMAL")
+    std::string type_text; ///< Full type (e.g., "DECIMAL(10,2)")
+    int position = 0;      ///< Zero-based column position
+};
+
+/**
+ * @brief Presigned download link for one result chunk
+ *
+ * Links expire (typically after 15 minutes); a fresh one can be requested with
+ * StatementExecution::get_chunk_link().
+ */
+struct ExternalLink {
+    uint64_t chunk_index = 0;                        ///< Position of the chunk in the result
+    uint64_t row_offset = 0;                         ///< Row number of the chunk's first row
+    uint64_t row_count = 0;                          ///< Rows in the chunk
+    uint64_t byte_count = 0;                         ///< Size of the chunk
+    std::string external_link;                       ///< Presigned URL (a credential; do not log it)
+    std::string expiration;                          ///< When the link expires (ISO 8601)
+    std::map<std::string, std::string> http_headers; ///< Headers the download must send
+    std::optional<uint64_t> next_chunk_index;        ///< Following chunk, if any
+
+    /**
+     * @brief Parse an ExternalLink from an already-parsed JSON object
+     * @throws std::runtime_error if a field has an unexpected type
+     */
+    static ExternalLink from_json(const nlohmann::json& j);
+};
+
+/**
+ * @brief Status, manifest and first links of a statement
+ */
+struct StatementResponse {
+    std::string statement_id;                       ///< Identifier for polling, fetching and canceling
+    StatementState state = StatementState::UNKNOWN; ///< Lifecycle state
+    std::string error_code;                         ///< Error code when FAILED
+    std::string error_message;                      ///< Error message when FAILED
+    std::string format;                             ///< Result encoding (e.g., "ARROW_STREAM")
+    std::vector<StatementColumn> columns;           ///< Result schema, set once SUCCEEDED
+    uint64_t total_chunk_count = 0;                 ///< Chunks in the result
+    uint64_t total_row_count = 0;                   ///< Rows in the result
+    uint64_t total_byte_count = 0;                  ///< Bytes in the result
+    bool truncated = false;                         ///< The result was cut by a row or byte limit
+    std::vector<ExternalLink> external_links;       ///< Links included with the response (usually the first)
+
+    /**
+     * @brief True once the statement can no longer change state
+     */
+    bool is_terminal() const {
+        return state == StatementState::SUCCEEDED || state == StatementState::FAILED ||
+               state == StatementState::CANCELED || state == StatementState::CLOSED;
+    }
+
+    /**
+     * @brief Parse a StatementResponse from JSON string
+     * @throws std::runtime_error if parsing fails
+     */
+    static StatementResponse from_json(const std::string& json_str);
+
+    /**
+     * @brief Parse a StatementResponse from an already-parsed JSON object
+     * @throws std::runtime_error if a field has an unexpected type
+     */
+    static StatementResponse from_json(const nlohmann::json& j);
+
+    /// Literal JSON text is parsed as a string
+    static StatementResponse from_json(const char* json_str) { return from_json(std::string(json_str)); }
+};
+
+/**
+ * @brief One downloaded result chunk
+ */
+struct ResultChunk {
+    uint64_t chunk_index = 0; ///< Position of the chunk in the result
+    uint64_t row_offset = 0;  ///< Row number of the chunk's first row
+    uint64_t row_count = 0;   ///< Rows in the chunk
+    std::string data;         ///< Chunk bytes, encoded as the statement's format
+};
+
+} // namespace databricks
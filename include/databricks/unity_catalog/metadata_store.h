@@ -0,0 +1,136 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "databricks/unity_catalog/unity_catalog_types.h"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace databricks {
+/**
+ * @brief Memory use of a MetadataStore
+ */
+struct MetadataStoreStats {
+    size_t catalogs = 0;         ///< Catalogs held
+    size_t schemas = 0;          ///< Schemas held
+    size_t tables = 0;           ///< Tables held
+    size_t columns = 0;          ///< Columns across all tables
+    size_t distinct_strings = 0; ///< Interned strings shared by the records
+    size_t bytes = 0;            ///< Approximate heap bytes held
+};
+
+/**
+ * @brief Compact in-memory store for a large number of catalog, schema and table records
+ *
+ * Holds metadata at a fraction of the size of the equivalent TableInfo,
+ * SchemaInfo and CatalogInfo objects, for services that keep a whole
+ * metastore (for example a UnityCatalog::snapshot()) in memory:
+ * - Fields that repeat across records (catalog and schema names, owners,
+ *   metastore ids, formats, column types, property keys and values) are
+ *   interned once and referenced by a 32-bit id.
+ * - Table and catalog types are kept as TableTypeEnum / CatalogTypeEnum.
+ * - Columns and properties live in flat shared arrays instead of one
+ *   allocation per vector or map node; properties are sorted by key.
+ * - Text unique to one record (names, comments, view definitions) is packed
+ *   into large blocks rather than allocated one string at a time.
+ *
+ * Records are looked up by full name and returned as ordinary info structs.
+ * Adding a record with a full name already present replaces it; the space
+ * of replaced records is reclaimed by compact(), which also runs on its own
+ * once more than half of the column and property slots are dead.
+ *
+ * Example usage:
+ * @code
+ * databricks::MetadataStore store;
+ * uc.snapshot([&](const databricks::TableInfo& table) { store.add(table); });
+ * auto orders = store.find_table("main.sales.orders");
+ * @endcode
+ *
+ * @note Thread-safe: lookups run concurrently, writes are exclusive.
+ */
+class MetadataStore {
+public:
+    MetadataStore();
+    ~MetadataStore();
+
+    MetadataStore(const MetadataStore&) = delete;
+    MetadataStore& operator=(const MetadataStore&) = delete;
+    MetadataStore(MetadataStore&&) noexcept;
+    MetadataStore& operator=(MetadataStore&&) noexcept;
+
+    /**
+     * @brief Insert or replace a catalog, keyed by its name
+     */
+    void add(const CatalogInfo& catalog);
+
+    /**
+     * @brief Insert or replace a schema, keyed by catalog_name.name
+     *
+     * catalog_name is taken from full_name when it is empty.
+     */
+    void add(const SchemaInfo& schema);
+
+    /**
+     * @brief Insert or replace a table with its columns, keyed by catalog_name.schema_name.name
+     *
+     * catalog_name and schema_name are taken from full_name when they are empty.
+     */
+    void add(const TableInfo& table);
+
+    /**
+     * @brief Look up a catalog by name
+     * @return The catalog, or std::nullopt if it is not held
+     */
+    std::optional<CatalogInfo> find_catalog(const std::string& name) const;
+
+    /**
+     * @brief Look up a schema by full name (catalog.schema)
+     * @return The schema, or std::nullopt if it is not held
+     */
+    std::optional<SchemaInfo> find_schema(const std::string& full_name) const;
+
+    /**
+     * @brief Look up a table by full name (catalog.schema.table)
+     * @return The table with its columns, or std::nullopt if it is not held
+     */
+    std::optional<TableInfo> find_table(const std::string& full_name) const;
+
+    /**
+     * @brief Remove a table
+     * @return true if the table was held
+     */
+    bool erase_table(const std::string& full_name);
+
+    /**
+     * @brief Call visit with every table held, in no particular order
+     *
+     * Each table is materialized as a TableInfo for the duration of the call.
+     * visit must not modify the store.
+     */
+    void for_each_table(const std::function<void(const TableInfo&)>& visit) const;
+
+    /**
+     * @brief Number of tables held
+     */
+    size_t table_count() const;
+
+    /**
+     * @brief Reclaim the column and property slots of replaced or erased tables
+     */
+    void compact();
+
+    /**
+     * @brief Record counts and approximate memory use
+     */
+    MetadataStoreStats stats() const;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pimpl_;
+};
+
+} // namespace databricks
@@ -3,12 +3,20 @@
 #pragma once
 
 #include "databricks/core/config.h"
+#include "databricks/core/paginator.h"
 #include "databricks/unity_catalog/unity_catalog_types.h"
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include <nlohmann/json_fwd.hpp>
+
+#ifdef DATABRICKS_ENABLE_COROUTINES
+#    include "databricks/core/awaitable.h"
+#endif
+
 namespace databricks {
 // Forward declaration for dependency injection
 namespace internal {
@@ -54,6 +62,14 @@ public:
      */
     explicit UnityCatalog(const AuthConfig& auth, const std::string& api_version = "2.1");
 
+    /**
+     * @brief Construct a Unity Catalog API client with custom transport settings
+     * @param auth Authentication configuration with host and token
+     * @param http Concurrency settings for batch calls such as get_tables()
+     * @param api_version Unity Catalog API version to use (default: "2.1")
+     */
+    UnityCatalog(const AuthConfig& auth, const HttpConfig& http, const std::string& api_version = "2.1");
+
     /**
      * @brief Construct a Unity Catalog API client with dependency injection (for testing)
      * @param http_client Injected HTTP client (use MockHttpClient for unit tests)
@@ -70,6 +86,30 @@ public:
     UnityCatalog(const UnityCatalog&) = delete;
     UnityCatalog& operator=(const UnityCatalog&) = delete;
 
+    // ==================== METADATA CACHE ====================
+
+    /**
+     * @brief Enable, reconfigure or disable the read-through metadata cache
+     *
+     * get_catalog/get_schema/get_table and list_catalogs/list_schemas/list_tables
+     * are served from the cache while enabled. Changing the configuration starts
+     * with an empty cache.
+     *
+     * @param config Cache settings; config.enabled = false turns caching off
+     * @throws std::invalid_argument if config is invalid
+     */
+    void set_cache_config(const MetadataCacheConfig& config);
+
+    /**
+     * @brief Hit, miss and eviction counters for the metadata cache (all zero when disabled)
+     */
+    CacheStats cache_stats() const;
+
+    /**
+     * @brief Drop every cached object so the next lookups go to the server
+     */
+    void invalidate_cache();
+
     // ==================== CATALOG OPERATIONS ====================
 
     /**
@@ -80,6 +120,18 @@ public:
      */
     std::vector<CatalogInfo> list_catalogs();
 
+    /**
+     * @brief Iterate over every catalog in the metastore
+     *
+     * Follows next_page_token lazily and fetches the next page in the background
+     * while the current one is consumed.
+     *
+     * @param max_results Catalogs per page (0 = server default)
+     * @return Paginator yielding CatalogInfo objects
+     * @throws std::runtime_error during iteration if a page request fails
+     */
+    Paginator<CatalogInfo> catalogs(int max_results = 0);
+
     /**
      * @brief Get detailed information about a specific catalog
      *
@@ -131,6 +183,17 @@ public:
      */
     std::vector<SchemaInfo> list_schemas(const std::string& catalog_name);
 
+    /**
+     * @brief Iterate over every schema in a catalog
+     *
+     * @param catalog_name The catalog to list schemas from
+     * @param max_results Schemas per page (0 = server default)
+     * @return Paginator yielding SchemaInfo objects
+     * @throws std::runtime_error during iteration if a page request fails
+     * @see catalogs()
+     */
+    Paginator<SchemaInfo> schemas(const std::string& catalog_name, int max_results = 0);
+
     /**
      * @brief Get detailed information about a specific schema
      *
@@ -181,6 +244,21 @@ public:
      */
     std::vector<TableInfo> list_tables(const std::string& catalog_name, const std::string& schema_name);
 
+    /**
+     * @brief Iterate over every table in a schema
+     *
+     * Unlike list_tables(), follows next_page_token so large schemas are listed
+     * completely, holding only about two pages in memory at a time.
+     *
+     * @param catalog_name The catalog containing the schema
+     * @param schema_name The schema to list tables from
+     * @param max_results Tables per page (0 = server default)
+     * @return Paginator yielding TableInfo objects
+     * @throws std::runtime_error during iteration if a page request fails
+     * @see catalogs()
+     */
+    Paginator<TableInfo> tables(const std::string& catalog_name, const std::string& schema_name, int max_results = 0);
+
     /**
      * @brief Get detailed information about a specific table
      *
@@ -190,6 +268,33 @@ public:
      */
     TableInfo get_table(const std::string& full_name);
 
+#ifdef DATABRICKS_ENABLE_COROUTINES
+    /**
+     * @brief Get a table from a C++20 coroutine without blocking its thread
+     *
+     * A table held by the metadata cache is returned without suspending.
+     * Otherwise the request runs on the HTTP client's async engine, the
+     * result is cached, and the coroutine resumes on the engine thread (see
+     * Awaitable::resume_on()). Only available when the SDK is built with
+     * -DENABLE_COROUTINES=ON.
+     *
+     * @note The UnityCatalog object must outlive the awaited request.
+     */
+    Awaitable<TableInfo> co_get_table(const std::string& full_name);
+#endif
+
+    /**
+     * @brief Get details for several tables concurrently
+     *
+     * Issues every request up front (up to HttpConfig::max_concurrent_requests
+     * in flight, multiplexed over HTTP/2) instead of one round trip at a time.
+     *
+     * @param full_names Full table names (catalog.schema.table)
+     * @return TableInfo objects in the same order as full_names
+     * @throws std::runtime_error if any table is not found or a request fails
+     */
+    std::vector<TableInfo> get_tables(const std::vector<std::string>& full_names);
+
     /**
      * @brief Delete a table
      *
@@ -202,18 +307,51 @@ public:
      */
     bool delete_table(const std::string& full_name);
 
+    // ==================== METASTORE SNAPSHOT ====================
+
+    /**
+     * @brief Walk catalogs, schemas and tables, streaming every table to a callback
+     *
+     * Issues up to options.max_concurrent_requests listing requests at once
+     * and follows next_page_token on every listing, so the whole metastore is
+     * covered without holding more than a few pages in memory. Requests go
+     * through this client's transport, so HttpConfig::requests_per_second and
+     * the retry policy for HTTP 429 apply to the crawl.
+     *
+     * on_table is called on the calling thread, one call at a time, with
+     * each TableInfo (including its columns) as its page arrives.
+     *
+     * @param on_table Called once per table in a crawled schema
+     * @param options Concurrency, paging, catalog filter and previous versions for an incremental snapshot
+     * @return Catalogs, schemas and the schema versions to pass to the next snapshot
+     * @throws std::invalid_argument if max_concurrent_requests is 0 or page_size is negative
+     * @throws std::runtime_error if a request fails; tables already streamed stay delivered
+     *
+     * @note updated_at reflects changes to a schema itself. Where table changes
+     *       do not bump it, an occasional full snapshot picks them up.
+     */
+    MetastoreSnapshot snapshot(const std::function<void(const TableInfo&)>& on_table,
+                               const SnapshotOptions& options = {});
+
 private:
     class Impl;
     std::unique_ptr<Impl> pimpl_;
 
-    // Parsing methods
+    // Parsing methods; the json overloads read already-parsed documents without re-serializing
     static CatalogInfo parse_catalog(const std::string& json_str);
+    static CatalogInfo parse_catalog(const nlohmann::json& j);
     static std::vector<CatalogInfo> parse_catalog_list(const std::string& json_str);
+    static std::vector<CatalogInfo> parse_catalog_list(const nlohmann::json& j);
     static SchemaInfo parse_schema(const std::string& json_str);
+    static SchemaInfo parse_schema(const nlohmann::json& j);
     static std::vector<SchemaInfo> parse_schema_list(const std::string& json_str);
+    static std::vector<SchemaInfo> parse_schema_list(const nlohmann::json& j);
     static TableInfo parse_table(const std::string& json_str);
+    static TableInfo parse_table(const nlohmann::json& j);
     static std::vector<TableInfo> parse_table_list(const std::string& json_str);
+    static std::vector<TableInfo> parse_table_list(const nlohmann::json& j);
     static ColumnInfo parse_column(const std::string& json_str);
+    static ColumnInfo parse_column(const nlohmann::json& j);
 };
 
 } // namespace databricks
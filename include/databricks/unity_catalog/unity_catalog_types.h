@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: MIT
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <optional>
@@ -180,6 +181,32 @@ struct UpdateSchemaRequest {
     std::map<std::string, std::string> properties; ///< Updated properties
 };
 
+/**
+ * @brief Options for UnityCatalog::snapshot()
+ *
+ * For an incremental snapshot, pass the previous snapshot's schema_versions as
+ * previous_schema_versions: schemas whose updated_at is unchanged are not
+ * re-listed and their tables are not reported again.
+ */
+struct SnapshotOptions {
+    size_t max_concurrent_requests = 8;                       ///< Listing requests in flight at once (default: 8)
+    int page_size = 0;                                        ///< Results per page, 0 for the server default
+    std::vector<std::string> catalogs;                        ///< Catalogs to crawl, empty for all (default: all)
+    std::map<std::string, uint64_t> previous_schema_versions; ///< Schema full_name to updated_at from a prior snapshot
+};
+
+/**
+ * @brief What UnityCatalog::snapshot() found, apart from the tables it streamed
+ */
+struct MetastoreSnapshot {
+    std::vector<CatalogInfo> catalogs;               ///< Catalogs crawled
+    std::vector<SchemaInfo> schemas;                 ///< Every schema in those catalogs, changed or not
+    std::map<std::string, uint64_t> schema_versions; ///< Schema full_name to updated_at, for the next snapshot
+    std::vector<std::string> unchanged_schemas;      ///< Schemas skipped because updated_at matched
+    std::vector<std::string> removed_schemas;        ///< Previously seen schemas in crawled catalogs that are gone
+    size_t tables = 0;                               ///< Tables streamed to the callback
+};
+
 // ==================== JSON SERIALIZATION ====================
 
 /**
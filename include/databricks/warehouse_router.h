@@ -0,0 +1,136 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "databricks/core/cancellation.h"
+#include "databricks/core/client.h"
+#include "databricks/core/config.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace databricks {
+/**
+ * @brief Counters and routing estimates of one WarehouseRouter route
+ */
+struct RouteStats {
+    std::string http_path;  ///< Warehouse the route sends queries to
+    size_t outstanding = 0; ///< Calls running on the route now
+    uint64_t queries = 0;   ///< Calls routed here so far
+    uint64_t failures = 0;  ///< Calls that failed with a transient error
+    double latency_ms = 0;  ///< Moving average of successful call latency (0 until known)
+    double error_rate = 0;  ///< Moving average of the failure rate, in [0, 1]
+    bool draining = false;  ///< The route is getting no queries for now
+    bool healthy = true;    ///< The last health check passed (true before the first)
+};
+
+/**
+ * @brief Spreads queries over several SQL warehouses, one connection pool each
+ *
+ * Each SQLConfig is a route with its own pooled Client (pooling is forced on),
+ * so the routes share the process-wide pools and circuit breakers of any other
+ * pooled Client for the same warehouse. Every call goes to the route with the
+ * fewest outstanding calls weighted by its recent latency and error rate (see
+ * RouterConfig), so a slow or overloaded warehouse gets less work and an idle
+ * one gets more.
+ *
+ * Failures that point at the warehouse (timeouts, lost connections, throttling,
+ * an exhausted pool) raise the route's error rate until it is drained; query
+ * errors, authentication errors and cancellations do not. A call rejected by
+ * an open circuit never reached the warehouse, so it is retried on the next
+ * best route and the rejecting route is drained until its circuit lets a probe
+ * through. Other errors are rethrown unchanged.
+ *
+ * Example usage:
+ * @code
+ * databricks::SQLConfig primary;
+ * primary.http_path = "/sql/1.0/warehouses/abc123";
+ * databricks::SQLConfig overflow;
+ * overflow.http_path = "/sql/1.0/warehouses/def456";
+ *
+ * databricks::WarehouseRouter router(auth, {primary, overflow}, {.enabled = true, .max_connections = 20});
+ * auto rows = router.query("SELECT * FROM sales.orders WHERE id = ?", {{"42"}});
+ * for (const auto& route : router.stats()) {
+ *     log(route.http_path, route.outstanding, route.latency_ms, route.error_rate);
+ * }
+ * @endcode
+ *
+ * @note Health checks (RouterConfig::health_check_interval_ms) run SELECT 1 on
+ * every route, which keeps auto-stopping warehouses running.
+ * @note Thread-safe.
+ */
+class WarehouseRouter {
+public:
+    /**
+     * @param auth Credentials shared by every route
+     * @param routes One SQLConfig per warehouse
+     * @param pooling Pool settings for each route's pool
+     * @param routing Routing, draining and health check policy
+     * @param retry Retry and circuit breaker settings for each route
+     * @throws std::invalid_argument if routes is empty or a configuration is invalid
+     */
+    WarehouseRouter(const AuthConfig& auth, const std::vector<SQLConfig>& routes,
+                    const PoolingConfig& pooling = PoolingConfig{}, const RouterConfig& routing = RouterConfig{},
+                    const RetryConfig& retry = RetryConfig{});
+
+    /**
+     * @brief Stops the health check thread; the pools stay with the PoolManager
+     */
+    ~WarehouseRouter();
+
+    WarehouseRouter(const WarehouseRouter&) = delete;
+    WarehouseRouter& operator=(const WarehouseRouter&) = delete;
+
+    /**
+     * @brief Run a query on the best route (see Client::query())
+     */
+    std::vector<std::vector<std::string>> query(const std::string& sql,
+                                                const std::vector<Client::Parameter>& params = {});
+
+    /**
+     * @brief Run a query with a timeout or cancellation token on the best route
+     */
+    std::vector<std::vector<std::string>> query(const std::string& sql, const std::vector<Client::Parameter>& params,
+                                                const QueryOptions& options);
+
+    /**
+     * @brief Run any work on the best route's Client, counted like a query
+     *
+     * For the Client calls query() does not cover (cursors, columnar and
+     * Arrow results, batches). work may be called a second time, on another
+     * route, if the first route's circuit was open.
+     *
+     * @code
+     * router.run([&](databricks::Client& client) {
+     *     client.query_typed("SELECT id, amount FROM payments", {}, on_batch);
+     * });
+     * @endcode
+     */
+    void run(const std::function<void(Client&)>& work);
+
+    /**
+     * @brief Run SELECT 1 on every route now, draining the routes that fail
+     *
+     * A failing route stays drained, however long RouterConfig::drain_ms is,
+     * until a later check passes; it is then put back in service at once. The health check thread calls this every
+     * RouterConfig::health_check_interval_ms.
+     *
+     * @return Number of routes that passed
+     */
+    size_t check_health();
+
+    /**
+     * @brief Per-route counters and estimates, in the order the routes were given
+     */
+    std::vector<RouteStats> stats() const;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pimpl_;
+};
+
+} // namespace databricks
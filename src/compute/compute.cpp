@@ -5,6 +5,13 @@
 #include "../internal/http_client.h"
 #include "../internal/http_client_interface.h"
 #include "../internal/logger.h"
+#include "../internal/status_poller.h"
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <stdexcept>
+#include <utility>
 
 #include <nlohmann/json.hpp>
 
@@ -24,6 +31,37 @@ public:
     std::shared_ptr<internal::IHttpClient> http_client_;
 };
 
+namespace {
+// Query string for one page of /clusters/list
+std::string list_query(const ClusterListFilter& filter, const std::string& page_token) {
+    std::vector<std::string> params;
+    for (ClusterStateEnum state : filter.states) {
+        params.push_back("filter_by.cluster_states=" + cluster_state_to_string(state));
+    }
+    for (const auto& source : filter.cluster_sources) {
+        params.push_back("filter_by.cluster_sources=" + internal::url_encode(source));
+    }
+    if (filter.is_pinned) {
+        params.push_back(std::string("filter_by.is_pinned=") + (*filter.is_pinned ? "true" : "false"));
+    }
+    if (!filter.policy_id.empty()) {
+        params.push_back("filter_by.policy_id=" + internal::url_encode(filter.policy_id));
+    }
+    if (filter.page_size > 0) {
+        params.push_back("page_size=" + std::to_string(filter.page_size));
+    }
+    if (!page_token.empty()) {
+        params.push_back("page_token=" + internal::url_encode(page_token));
+    }
+
+    std::string query;
+    for (const auto& param : params) {
+        query += (query.empty() ? "?" : "&") + param;
+    }
+    return query;
+}
+} // namespace
+
 Compute::Compute(const AuthConfig& auth)
     : pimpl_(std::make_unique<Impl>(auth)) {}
 
@@ -34,18 +72,56 @@ Compute::~Compute() = default;
 
 // Public Methods
 std::vector<Cluster> Compute::list_compute() {
-    internal::get_logger()->info("Listing compute clusters");
+    DATABRICKS_LOG_INFO("Listing compute clusters");
 
     // Make API request
     auto response = pimpl_->http_client_->get("/clusters/list");
     pimpl_->http_client_->check_response(response, "listCompute");
 
-    internal::get_logger()->debug("Compute clusters list response: " + response.body);
+    DATABRICKS_LOG_DEBUG("Compute clusters list response: " + response.body);
     return parse_compute_list(response.body);
 }
 
+std::vector<Cluster> Compute::list_compute(const ClusterListFilter& filter) {
+    std::vector<Cluster> clusters;
+    for (auto& cluster : this->clusters(filter)) {
+        clusters.push_back(cluster);
+    }
+    DATABRICKS_LOG_INFO("Listed " + std::to_string(clusters.size()) + " matching compute clusters");
+    return clusters;
+}
+
+Paginator<Cluster> Compute::clusters(const ClusterListFilter& filter) {
+    DATABRICKS_LOG_INFO("Iterating compute clusters");
+
+    // The fetcher holds the client, not this object, so the paginator may outlive it
+    std::shared_ptr<internal::IHttpClient> http_client = pimpl_->http_client_;
+    return Paginator<Cluster>([http_client, filter](const std::string& page_token) {
+        auto response = http_client->get("/clusters/list" + list_query(filter, page_token));
+        http_client->check_response(response, "listCompute");
+
+        Paginator<Cluster>::Page page;
+        try {
+            auto j = json::parse(response.body);
+            if (j.contains("clusters") && j["clusters"].is_array()) {
+                for (const auto& cluster_json : j["clusters"]) {
+                    Cluster cluster = parse_compute(cluster_json);
+                    if (filter.creator_user_name.empty() || cluster.creator_user_name == filter.creator_user_name) {
+                        page.items.push_back(std::move(cluster));
+                    }
+                }
+            }
+            page.next_page_token = j.value("next_page_token", "");
+        } catch (const json::exception& e) {
+            DATABRICKS_LOG_ERROR("Failed to parse compute clusters list: " + std::string(e.what()));
+            throw std::runtime_error("Failed to parse compute clusters list: " + std::string(e.what()));
+        }
+        return page;
+    });
+}
+
 bool Compute::create_compute(const Cluster& cluster_config) {
-    internal::get_logger()->info("Creating compute cluster" + cluster_config.cluster_name);
+    DATABRICKS_LOG_INFO("Creating compute cluster" + cluster_config.cluster_name);
 
     // Build JSON Body
     json body_json;
@@ -60,45 +136,152 @@ bool Compute::create_compute(const Cluster& cluster_config) {
     }
 
     std::string body = body_json.dump();
-    internal::get_logger()->debug("Create compute request body" + body);
+    DATABRICKS_LOG_DEBUG("Create compute request body" + body);
 
     // API Request
     auto response = pimpl_->http_client_->post("/clusters/create", body);
     pimpl_->http_client_->check_response(response, "createCompute");
 
-    internal::get_logger()->info("Successfully created compute cluster: " + cluster_config.cluster_name);
+    DATABRICKS_LOG_INFO("Successfully created compute cluster: " + cluster_config.cluster_name);
     return true;
 }
 
 Cluster Compute::get_compute(const std::string& cluster_id) {
-    internal::get_logger()->info("Getting compute cluster details for cluster_id=" + cluster_id);
+    DATABRICKS_LOG_INFO("Getting compute cluster details for cluster_id=" + cluster_id);
 
     // Make API request with cluster_id as query parameter
     auto response = pimpl_->http_client_->get("/clusters/get?cluster_id=" + cluster_id);
     pimpl_->http_client_->check_response(response, "getCompute");
 
-    internal::get_logger()->debug("Compute cluster details response: " + response.body);
+    DATABRICKS_LOG_DEBUG("Compute cluster details response: " + response.body);
     return parse_compute(response.body);
 }
 
+std::future<Cluster> Compute::wait_for_state(const std::string& cluster_id, ClusterStateEnum state,
+                                             std::chrono::milliseconds timeout, const PollConfig& poll) {
+    if (!poll.is_valid()) {
+        throw std::invalid_argument("Invalid poll configuration");
+    }
+    const std::string target = cluster_state_to_string(state);
+    DATABRICKS_LOG_INFO("Waiting for cluster_id=" + cluster_id + " to reach " + target);
+
+    auto promise = std::make_shared<std::promise<Cluster>>();
+    std::future<Cluster> future = promise->get_future();
+
+    // The watch holds the client, not this object, so the wait may outlive it
+    std::shared_ptr<internal::IHttpClient> http_client = pimpl_->http_client_;
+    std::string path = "/clusters/get?cluster_id=" + cluster_id;
+    auto first_check = std::make_shared<bool>(true); // Only touched on the poller thread
+
+    internal::StatusPoller::Watch watch;
+    watch.description = "cluster_id=" + cluster_id + " to reach " + target;
+    watch.check = [http_client, path]() { return http_client->get_async(path); };
+    watch.on_status = [http_client, promise, state, target, first_check](const internal::HttpResponse& response,
+                                                                         std::string& observed) {
+        http_client->check_response(response, "getCompute");
+        Cluster cluster = parse_compute(response.body);
+        observed = cluster.state;
+        ClusterStateEnum current = parse_cluster_state(cluster.state);
+        if (current == state) {
+            promise->set_value(std::move(cluster));
+            return true;
+        }
+
+        // A cluster that has settled elsewhere won't get there on its own; the first
+        // check is exempt because a start or restart may not have registered yet
+        bool settled = current == ClusterStateEnum::TERMINATED || current == ClusterStateEnum::ERROR;
+        bool first = *first_check;
+        *first_check = false;
+        if (settled && !first) {
+            throw std::runtime_error("Cluster " + cluster.cluster_id + " reached " + cluster.state +
+                                     " while waiting for " + target);
+        }
+        return false;
+    };
+    watch.on_error = [promise](std::exception_ptr error) { promise->set_exception(error); };
+    watch.deadline = internal::StatusPoller::Clock::now() + timeout;
+    watch.poll = poll;
+
+    internal::StatusPoller::shared().add(std::move(watch));
+    return future;
+}
+
 bool Compute::compute_operation(const std::string& cluster_id, const std::string& endpoint,
                                 const std::string& operation_name) {
-    internal::get_logger()->info(operation_name + " compute cluster id=" + cluster_id);
+    DATABRICKS_LOG_INFO(operation_name + " compute cluster id=" + cluster_id);
 
     json body_json;
     body_json["cluster_id"] = cluster_id;
     std::string body = body_json.dump();
 
-    internal::get_logger()->debug(operation_name + " request body: " + body);
+    DATABRICKS_LOG_DEBUG(operation_name + " request body: " + body);
 
     // API Request
     auto response = pimpl_->http_client_->post(endpoint, body);
     pimpl_->http_client_->check_response(response, operation_name);
 
-    internal::get_logger()->info("Successfully " + operation_name + " compute cluster id=" + cluster_id);
+    DATABRICKS_LOG_INFO("Successfully " + operation_name + " compute cluster id=" + cluster_id);
     return true;
 }
 
+std::vector<ClusterOperationResult> Compute::batch_operation(const std::vector<std::string>& cluster_ids,
+                                                             const std::string& endpoint,
+                                                             const std::string& operation_name, size_t max_concurrent) {
+    if (max_concurrent == 0) {
+        throw std::invalid_argument("max_concurrent must be positive");
+    }
+    DATABRICKS_LOG_INFO(operation_name + " " + std::to_string(cluster_ids.size()) + " compute clusters");
+
+    std::vector<ClusterOperationResult> results(cluster_ids.size());
+    std::deque<std::pair<size_t, std::future<internal::HttpResponse>>> in_flight;
+    size_t next = 0;
+    while (next < cluster_ids.size() || !in_flight.empty()) {
+        // Keep the window full, then settle the oldest request
+        while (in_flight.size() < max_concurrent && next < cluster_ids.size()) {
+            json body_json;
+            body_json["cluster_id"] = cluster_ids[next];
+            in_flight.emplace_back(next, pimpl_->http_client_->post_async(endpoint, body_json.dump()));
+            ++next;
+        }
+
+        auto [index, pending] = std::move(in_flight.front());
+        in_flight.pop_front();
+        ClusterOperationResult& result = results[index];
+        result.cluster_id = cluster_ids[index];
+        try {
+            auto response = pending.get();
+            result.status_code = response.status_code;
+            pimpl_->http_client_->check_response(response, operation_name);
+            result.success = true;
+        } catch (const std::exception& e) {
+            result.error = e.what();
+        }
+    }
+
+    size_t failed = std::count_if(results.begin(), results.end(),
+                                  [](const ClusterOperationResult& result) { return !result.success; });
+    if (failed > 0) {
+        DATABRICKS_LOG_WARN(operation_name + " failed for " + std::to_string(failed) + " of " +
+                            std::to_string(results.size()) + " compute clusters");
+    }
+    return results;
+}
+
+std::vector<ClusterOperationResult> Compute::start_compute_batch(const std::vector<std::string>& cluster_ids,
+                                                                 size_t max_concurrent) {
+    return batch_operation(cluster_ids, "/clusters/start", "startCompute", max_concurrent);
+}
+
+std::vector<ClusterOperationResult> Compute::terminate_compute_batch(const std::vector<std::string>& cluster_ids,
+                                                                     size_t max_concurrent) {
+    return batch_operation(cluster_ids, "/clusters/delete", "terminateCompute", max_concurrent);
+}
+
+std::vector<ClusterOperationResult> Compute::restart_compute_batch(const std::vector<std::string>& cluster_ids,
+                                                                   size_t max_concurrent) {
+    return batch_operation(cluster_ids, "/clusters/restart", "restartCompute", max_concurrent);
+}
+
 bool Compute::start_compute(const std::string& cluster_id) {
     return compute_operation(cluster_id, "/clusters/start", "startCompute");
 }
@@ -119,26 +302,25 @@ std::vector<Cluster> Compute::parse_compute_list(const std::string& json_str) {
         auto j = json::parse(json_str);
 
         if (!j.contains("clusters") || !j["clusters"].is_array()) {
-            internal::get_logger()->warn("No clusters array found in response");
+            DATABRICKS_LOG_WARN("No clusters array found in response");
             return clusters;
         }
 
         for (const auto& cluster_json : j["clusters"]) {
-            clusters.push_back(parse_compute(cluster_json.dump()));
+            clusters.push_back(parse_compute(cluster_json));
         }
 
-        internal::get_logger()->info("Parsed " + std::to_string(clusters.size()) + " compute clusters");
+        DATABRICKS_LOG_INFO("Parsed " + std::to_string(clusters.size()) + " compute clusters");
     } catch (const json::exception& e) {
-        internal::get_logger()->error("Failed to parse compute clusters list: " + std::string(e.what()));
+        DATABRICKS_LOG_ERROR("Failed to parse compute clusters list: " + std::string(e.what()));
         throw std::runtime_error("Failed to parse compute clusters list: " + std::string(e.what()));
     }
 
     return clusters;
 }
 
-Cluster Compute::parse_compute(const std::string& json_str) {
+Cluster Compute::parse_compute(const json& j) {
     try {
-        auto j = json::parse(json_str);
         Cluster cluster;
 
         cluster.cluster_id = j.value("cluster_id", "");
@@ -166,4 +348,12 @@ Cluster Compute::parse_compute(const std::string& json_str) {
     }
 }
 
+Cluster Compute::parse_compute(const std::string& json_str) {
+    try {
+        return parse_compute(json::parse(json_str));
+    } catch (const json::exception& e) {
+        throw std::runtime_error("Failed to parse Compute Cluster JSON: " + std::string(e.what()));
+    }
+}
+
 } // namespace databricks
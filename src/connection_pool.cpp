@@ -5,8 +5,12 @@
 #include "databricks/core/client.h"
 
 #include "internal/logger.h"
+#include "internal/metrics.h"
+#include "internal/tracing.h"
 
+#include <algorithm>
 #include <chrono>
+#include <exception>
 #include <stdexcept>
 
 namespace databricks {
@@ -15,34 +19,45 @@ namespace databricks {
 
 ConnectionPool::PooledConnection::PooledConnection(std::unique_ptr<Client> client, ConnectionPool* pool)
     : client_(std::move(client))
-    , pool_(pool) {}
+    , pool_(pool)
+    , created_at_(std::chrono::steady_clock::now()) {}
 
-ConnectionPool::PooledConnection::~PooledConnection() {
-    if (client_ && pool_) {
-        pool_->return_connection(std::move(client_));
-    }
-}
+ConnectionPool::PooledConnection::~PooledConnection() { release(); }
 
 ConnectionPool::PooledConnection::PooledConnection(PooledConnection&& other) noexcept
     : client_(std::move(other.client_))
-    , pool_(other.pool_) {
+    , pool_(other.pool_)
+    , created_at_(other.created_at_)
+    , broken_(other.broken_) {
     other.pool_ = nullptr;
 }
 
 ConnectionPool::PooledConnection& ConnectionPool::PooledConnection::operator=(PooledConnection&& other) noexcept {
     if (this != &other) {
         // Return current client to pool before taking ownership of new one
-        if (client_ && pool_) {
-            pool_->return_connection(std::move(client_));
-        }
+        release();
 
         client_ = std::move(other.client_);
         pool_ = other.pool_;
+        created_at_ = other.created_at_;
+        broken_ = other.broken_;
         other.pool_ = nullptr;
     }
     return *this;
 }
 
+void ConnectionPool::PooledConnection::release() {
+    if (!client_ || !pool_) {
+        return;
+    }
+    if (broken_) {
+        DATABRICKS_LOG_INFO("Discarding pooled connection lost during use");
+        pool_->discard_connection(std::move(client_), true);
+    } else {
+        pool_->return_connection(std::move(client_), created_at_);
+    }
+}
+
 Client& ConnectionPool::PooledConnection::get() {
     if (!client_) {
         throw std::runtime_error("PooledConnection: client is null");
@@ -67,22 +82,64 @@ const Client* ConnectionPool::PooledConnection::operator->() const {
 
 // ========== ConnectionPool Implementation ==========
 
+namespace {
+PoolingConfig sized_pooling(size_t min_connections, size_t max_connections) {
+    PoolingConfig pooling;
+    pooling.enabled = true;
+    pooling.min_connections = min_connections;
+    pooling.max_connections = max_connections;
+    return pooling;
+}
+
+size_t shard_count(const PoolingConfig& pooling) {
+    size_t shards = pooling.shards;
+    if (shards == 0) {
+        shards = std::max(1u, std::thread::hardware_concurrency());
+    }
+    // Shards beyond max_connections could never all hold a connection
+    return std::max<size_t>(1, std::min(shards, pooling.max_connections));
+}
+
+// Threads are numbered in the order they first use a pool so they spread evenly over the shards
+size_t thread_number() {
+    static std::atomic<size_t> next{0};
+    thread_local const size_t number = next.fetch_add(1, std::memory_order_relaxed);
+    return number;
+}
+} // namespace
+
 ConnectionPool::ConnectionPool(const AuthConfig& auth, const SQLConfig& sql, size_t min_connections,
                                size_t max_connections)
+    : ConnectionPool(auth, sql, sized_pooling(min_connections, max_connections)) {}
+
+ConnectionPool::ConnectionPool(const AuthConfig& auth, const SQLConfig& sql, const PoolingConfig& pooling,
+                               const RetryConfig& retry)
     : auth_(auth)
     , sql_(sql)
-    , min_connections_(min_connections)
-    , max_connections_(max_connections)
-    , connection_timeout_ms_(5000)
+    , pooling_(pooling)
+    , retry_(retry)
+    , min_connections_(pooling.min_connections)
+    , max_connections_(pooling.max_connections)
+    , connection_timeout_ms_(pooling.connection_timeout_ms)
+    , shards_(std::make_unique<Shard[]>(shard_count(pooling)))
+    , shard_count_(shard_count(pooling))
     , total_connections_(0)
     , active_connections_(0)
+    , pending_connections_(0)
+    , waiting_(0)
+    , used_(false)
     , shutdown_(false) {
     if (min_connections_ > max_connections_) {
-        internal::get_logger()->error("Invalid pool config: min_connections ({}) > max_connections ({})",
-                                      min_connections_, max_connections_);
+        DATABRICKS_LOG_ERROR("Invalid pool config: min_connections ({}) > max_connections ({})", min_connections_,
+                             max_connections_);
         throw std::invalid_argument("min_connections cannot exceed max_connections");
     }
-    internal::get_logger()->info("Connection pool created (min: {}, max: {})", min_connections_, max_connections_);
+    DATABRICKS_LOG_INFO("Connection pool created (min: {}, max: {}, shards: {})", min_connections_, max_connections_,
+                        shard_count_);
+
+    if (pooling_.maintenance_interval_ms > 0) {
+        maintenance_thread_ = std::thread([this]() { maintenance_loop(); });
+    }
 }
 
 ConnectionPool::~ConnectionPool() {
@@ -90,95 +147,356 @@ ConnectionPool::~ConnectionPool() {
 }
 
 std::unique_ptr<Client> ConnectionPool::create_connection() {
-    // This should be called with mutex held
-    internal::get_logger()->debug("Creating new pooled connection (total will be: {})", total_connections_ + 1);
-    auto client = Client::Builder().with_auth(auth_).with_sql(sql_).with_auto_connect(true).build();
-    total_connections_++;
+    // Called without any lock held: the connect handshake can take seconds
+    DATABRICKS_LOG_DEBUG("Creating new pooled connection");
+    auto client =
+        Client::Builder().with_auth(auth_).with_sql(sql_).with_retry(retry_).with_auto_connect(true).build();
     return std::make_unique<Client>(std::move(client));
 }
 
+bool ConnectionPool::reserve_slot() {
+    size_t total = total_connections_.load();
+    while (total < max_connections_) {
+        if (total_connections_.compare_exchange_weak(total, total + 1)) {
+            pending_connections_++;
+            active_connections_++;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ConnectionPool::release_reserved_slot() {
+    total_connections_--;
+    pending_connections_--;
+    active_connections_--;
+    // The freed slot lets a waiter create its own connection
+    if (waiting_.load() > 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        wake_waiter();
+    }
+}
+
+size_t ConnectionPool::home_shard() const {
+    return thread_number() % shard_count_;
+}
+
+std::optional<ConnectionPool::IdleConnection> ConnectionPool::take_idle(size_t home) {
+    for (size_t i = 0; i < shard_count_; i++) {
+        Shard& shard = shards_[(home + i) % shard_count_];
+        if (shard.size.load() == 0) {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (shard.idle.empty()) {
+            continue;
+        }
+        IdleConnection idle;
+        if (pooling_.reuse_policy == PoolingConfig::ReusePolicy::LIFO) {
+            idle = std::move(shard.idle.back());
+            shard.idle.pop_back();
+        } else {
+            idle = std::move(shard.idle.front());
+            shard.idle.pop_front();
+        }
+        shard.size.store(shard.idle.size());
+        return idle;
+    }
+    return std::nullopt;
+}
+
+void ConnectionPool::put_idle(size_t shard, IdleConnection idle) {
+    Shard& target = shards_[shard];
+    std::lock_guard<std::mutex> lock(target.mutex);
+    target.idle.push_back(std::move(idle));
+    target.size.store(target.idle.size());
+}
+
+void ConnectionPool::hand_off_idle() {
+    while (!waiters_.empty()) {
+        auto idle = take_idle(home_shard());
+        if (!idle) {
+            return;
+        }
+        Waiter* waiter = waiters_.front();
+        waiters_.pop_front();
+        waiting_--;
+        active_connections_++;
+        waiter->handoff = std::move(*idle);
+        waiter->cv.notify_one();
+    }
+}
+
+void ConnectionPool::wake_waiter() {
+    if (waiters_.empty()) {
+        return;
+    }
+    Waiter* waiter = waiters_.front();
+    waiters_.pop_front();
+    waiting_--;
+    waiter->woken = true;
+    waiter->cv.notify_one();
+}
+
+std::vector<ConnectionPool::IdleConnection> ConnectionPool::drain_idle() {
+    std::vector<IdleConnection> drained;
+    for (size_t i = 0; i < shard_count_; i++) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        for (auto& idle : shards_[i].idle) {
+            drained.push_back(std::move(idle));
+        }
+        shards_[i].idle.clear();
+        shards_[i].size.store(0);
+    }
+    total_connections_ -= drained.size();
+    return drained;
+}
+
+std::optional<ConnectionPool::PooledConnection> ConnectionPool::lend_idle(IdleConnection idle) {
+    auto now = Clock::now();
+    bool expired = is_expired(idle.created_at, now);
+    bool round_trip = now - idle.idle_since >= std::chrono::milliseconds(pooling_.validation_idle_ms);
+
+    // Validate without holding any lock; a SELECT 1 is a server round trip
+    if (!expired && (!pooling_.validate_on_borrow || idle.client->is_healthy(round_trip))) {
+        DATABRICKS_LOG_DEBUG("Reusing pooled connection");
+        PooledConnection connection(std::move(idle.client), this);
+        connection.created_at_ = idle.created_at;
+        return connection;
+    }
+
+    DATABRICKS_LOG_INFO("Discarding {} pooled connection", expired ? "expired" : "broken");
+    discard_connection(std::move(idle.client), true);
+    return std::nullopt;
+}
+
 ConnectionPool::PooledConnection ConnectionPool::acquire() {
-    std::unique_lock<std::mutex> lock(mutex_);
+    auto connection = try_acquire(Clock::now() + std::chrono::milliseconds(connection_timeout_ms_));
+    if (!connection) {
+        DATABRICKS_LOG_ERROR("Timeout waiting for connection from pool after {}ms", connection_timeout_ms_);
+        throw std::runtime_error("Timeout waiting for connection from pool");
+    }
+    return std::move(*connection);
+}
 
-    internal::get_logger()->debug("Acquiring connection from pool (available: {}, active: {}, total: {})",
-                                  available_connections_.size(), active_connections_, total_connections_);
+std::optional<ConnectionPool::PooledConnection>
+ConnectionPool::try_acquire(std::chrono::steady_clock::time_point deadline) {
+    internal::Span span("ConnectionPool::acquire");
+    internal::ScopedTimer wait_timer(MetricTimer::PoolAcquireWait);
+    used_.store(true, std::memory_order_relaxed);
+    const size_t home = home_shard();
 
-    // Wait for available connection or ability to create new one
-    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(connection_timeout_ms_);
+    DATABRICKS_LOG_DEBUG("Acquiring connection from pool (active: {}, total: {})", active_connections_.load(),
+                         total_connections_.load());
 
+    // Wait for available connection or ability to create new one
     while (true) {
         if (shutdown_) {
-            internal::get_logger()->error("Cannot acquire connection: pool is shut down");
+            DATABRICKS_LOG_ERROR("Cannot acquire connection: pool is shut down");
             throw std::runtime_error("ConnectionPool has been shut down");
         }
 
         // Try to get an available connection
-        if (!available_connections_.empty()) {
-            auto client = std::move(available_connections_.front());
-            available_connections_.pop();
+        if (auto idle = take_idle(home)) {
             active_connections_++;
-            internal::get_logger()->debug("Reusing pooled connection (active: {}, available: {})", active_connections_,
-                                          available_connections_.size());
-            return PooledConnection(std::move(client), this);
+            if (auto connection = lend_idle(std::move(*idle))) {
+                span.set_attribute("pool.connection", "reused");
+                return connection;
+            }
+            continue;
         }
 
-        // Create a new connection if under max limit
-        if (total_connections_ < max_connections_) {
-            auto client = create_connection();
-            active_connections_++;
+        // Create a new connection if under max limit: the slot is reserved first,
+        // then the connect runs without any lock so other threads keep using the pool
+        if (reserve_slot()) {
+            std::unique_ptr<Client> client;
+            try {
+                client = create_connection();
+            } catch (...) {
+                release_reserved_slot();
+                throw;
+            }
+
+            pending_connections_--;
+            span.set_attribute("pool.connection", "created");
             return PooledConnection(std::move(client), this);
         }
 
-        // Wait for a connection to become available
-        internal::get_logger()->warn("Pool exhausted (max: {}), waiting for available connection", max_connections_);
-        if (cv_.wait_until(lock, deadline) == std::cv_status::timeout) {
-            internal::get_logger()->error("Timeout waiting for connection from pool after {}ms",
-                                          connection_timeout_ms_);
-            throw std::runtime_error("Timeout waiting for connection from pool");
+        // Queue up; returning threads hand their connections to the oldest waiter
+        Waiter waiter;
+        std::unique_lock<std::mutex> lock(mutex_);
+        waiters_.push_back(&waiter);
+        waiting_++;
+
+        // Threads that returned a connection or freed a slot before this one queued
+        // did not see it, so look again now that they will
+        if (shutdown_) {
+            waiters_.erase(std::find(waiters_.begin(), waiters_.end(), &waiter));
+            waiting_--;
+            continue;
+        }
+        hand_off_idle();
+        if (total_connections_.load() < max_connections_) {
+            wake_waiter();
+        }
+
+        if (!waiter.handoff && !waiter.woken) {
+            DATABRICKS_LOG_WARN("Pool exhausted (max: {}), waiting for available connection", max_connections_);
+        }
+        if (!waiter.cv.wait_until(lock, deadline, [&waiter]() { return waiter.handoff || waiter.woken; })) {
+            waiters_.erase(std::find(waiters_.begin(), waiters_.end(), &waiter));
+            waiting_--;
+            wait_timer.cancel();
+            internal::add_metric(MetricCounter::PoolAcquireTimeouts, 1);
+            span.set_error("Timeout waiting for connection from pool");
+            return std::nullopt;
+        }
+        lock.unlock();
+
+        if (waiter.handoff) {
+            if (auto connection = lend_idle(std::move(*waiter.handoff))) {
+                span.set_attribute("pool.connection", "reused");
+                return connection;
+            }
         }
+        // Woken because a slot freed up or the pool shut down (or the handed connection was bad): retry
     }
 }
 
-void ConnectionPool::return_connection(std::unique_ptr<Client> client) {
+void ConnectionPool::return_connection(std::unique_ptr<Client> client, Clock::time_point created_at) {
     if (!client) {
         return;
     }
 
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    if (shutdown_) {
-        // Don't return connections if shutting down
-        total_connections_--;
-        internal::get_logger()->debug("Connection discarded during shutdown (total: {})", total_connections_);
+    auto now = Clock::now();
+    if (shutdown_ || is_expired(created_at, now)) {
+        // Don't keep connections when shutting down or past their lifetime
+        discard_connection(std::move(client), true);
         return;
     }
 
+    IdleConnection idle{std::move(client), created_at, now};
+
+    // Hand the connection straight to a waiter; it stays active throughout
+    if (waiting_.load() > 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!waiters_.empty()) {
+            Waiter* waiter = waiters_.front();
+            waiters_.pop_front();
+            waiting_--;
+            waiter->handoff = std::move(idle);
+            waiter->cv.notify_one();
+            DATABRICKS_LOG_DEBUG("Connection handed to a waiting thread");
+            return;
+        }
+    }
+
     active_connections_--;
-    available_connections_.push(std::move(client));
-    internal::get_logger()->debug("Connection returned to pool (active: {}, available: {})", active_connections_,
-                                  available_connections_.size());
+    put_idle(home_shard(), std::move(idle));
+    DATABRICKS_LOG_DEBUG("Connection returned to pool (active: {})", active_connections_.load());
+
+    // A thread may have started waiting after the check above; it would have seen
+    // the connection in the shard, but hand it over in case it looked first
+    if (waiting_.load() > 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        hand_off_idle();
+    }
+    if (shutdown_) {
+        // Lost a race with shutdown(), which may already have emptied the shards
+        drain_idle();
+    }
+}
+
+void ConnectionPool::discard_connection(std::unique_ptr<Client> client, bool was_active) {
+    total_connections_--;
+    if (was_active) {
+        active_connections_--;
+    }
+    DATABRICKS_LOG_DEBUG("Pooled connection closed (total: {})", total_connections_.load());
+    if (waiting_.load() > 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        wake_waiter();
+    }
 
-    // Notify one waiting thread
-    cv_.notify_one();
+    // Disconnecting may be a server round trip, so close outside the lock
+    client.reset();
 }
 
-void ConnectionPool::warm_up() {
-    std::lock_guard<std::mutex> lock(mutex_);
+bool ConnectionPool::is_expired(Clock::time_point created_at, Clock::time_point now) const {
+    if (pooling_.max_lifetime_ms <= 0) {
+        return false;
+    }
+    return now - created_at >= std::chrono::milliseconds(pooling_.max_lifetime_ms);
+}
 
+void ConnectionPool::warm_up() {
     if (shutdown_) {
-        internal::get_logger()->error("Cannot warm up pool: pool is shut down");
+        DATABRICKS_LOG_ERROR("Cannot warm up pool: pool is shut down");
         throw std::runtime_error("Cannot warm up: pool is shut down");
     }
 
-    internal::get_logger()->info("Warming up connection pool to {} connections", min_connections_);
+    used_.store(true, std::memory_order_relaxed);
+
+    // Reserve every missing slot up front so concurrent acquires don't overshoot max
+    size_t total = total_connections_.load();
+    while (total < min_connections_ && !total_connections_.compare_exchange_weak(total, min_connections_)) {
+    }
+    if (total >= min_connections_) {
+        return;
+    }
+    size_t needed = min_connections_ - total;
+    pending_connections_ += needed;
 
-    // Create connections up to min_connections
-    while (total_connections_ < min_connections_) {
-        auto client = create_connection();
-        available_connections_.push(std::move(client));
+    DATABRICKS_LOG_INFO("Warming up connection pool to {} connections", min_connections_);
+
+    // Open the connections in parallel; each handshake is independent
+    std::vector<std::future<std::unique_ptr<Client>>> pending;
+    pending.reserve(needed);
+    for (size_t i = 0; i < needed; i++) {
+        pending.push_back(std::async(std::launch::async, [this]() { return create_connection(); }));
+    }
+
+    std::vector<std::unique_ptr<Client>> created;
+    std::exception_ptr first_error;
+    for (auto& future : pending) {
+        try {
+            created.push_back(future.get());
+        } catch (...) {
+            if (!first_error) {
+                first_error = std::current_exception();
+            }
+        }
     }
 
-    internal::get_logger()->info("Pool warm-up complete ({} connections ready)", min_connections_);
+    size_t ready = created.size();
+    pending_connections_ -= needed;
+    total_connections_ -= needed - ready;
+
+    // Spread the new connections over the shards
+    auto now = Clock::now();
+    size_t shard = home_shard();
+    for (auto& client : created) {
+        put_idle(shard++ % shard_count_, {std::move(client), now, now});
+    }
+    if (waiting_.load() > 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        hand_off_idle();
+        if (total_connections_.load() < max_connections_) {
+            wake_waiter();
+        }
+    }
+    // Connections drained because of a concurrent shutdown are closed here
+    if (shutdown_) {
+        drain_idle();
+    }
+
+    if (first_error) {
+        DATABRICKS_LOG_ERROR("Pool warm-up opened {} of {} connections", ready, needed);
+        std::rethrow_exception(first_error);
+    }
+
+    DATABRICKS_LOG_INFO("Pool warm-up complete ({} connections ready)", min_connections_);
 }
 
 std::future<void> ConnectionPool::warm_up_async() {
@@ -186,32 +504,126 @@ std::future<void> ConnectionPool::warm_up_async() {
 }
 
 ConnectionPool::Stats ConnectionPool::get_stats() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    return Stats{total_connections_, available_connections_.size(), active_connections_};
+    size_t available = 0;
+    for (size_t i = 0; i < shard_count_; i++) {
+        available += shards_[i].size.load();
+    }
+    return Stats{total_connections_.load(), available, active_connections_.load(), pending_connections_.load()};
 }
 
 void ConnectionPool::shutdown() {
-    std::lock_guard<std::mutex> lock(mutex_);
+    if (shutdown_.exchange(true)) {
+        return;
+    }
 
+    DATABRICKS_LOG_INFO("Shutting down connection pool");
+
+    // Wake up all waiting threads so they can throw
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (Waiter* waiter : waiters_) {
+            waiter->woken = true;
+            waiter->cv.notify_one();
+        }
+        waiters_.clear();
+        waiting_.store(0);
+    }
+
+    // Clear all available connections; they close when this goes out of scope
+    std::vector<IdleConnection> closing = drain_idle();
+    DATABRICKS_LOG_INFO("Connection pool shutdown complete (active connections: {})", active_connections_.load());
+
+    maintenance_cv_.notify_all();
+    if (maintenance_thread_.joinable() && maintenance_thread_.get_id() != std::this_thread::get_id()) {
+        maintenance_thread_.join();
+    }
+}
+
+void ConnectionPool::run_maintenance() {
     if (shutdown_) {
         return;
     }
 
-    internal::get_logger()->info("Shutting down connection pool");
+    // Close expired connections, and idle ones while above min_connections; take
+    // the rest out so their liveness can be checked without the shard locks
+    std::vector<std::unique_ptr<Client>> evicted;
+    std::vector<std::pair<size_t, IdleConnection>> checking;
+    auto now = Clock::now();
+    auto idle_limit = std::chrono::milliseconds(pooling_.idle_timeout_ms);
+    for (size_t i = 0; i < shard_count_; i++) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        for (auto& idle : shards_[i].idle) {
+            bool idle_too_long = pooling_.idle_timeout_ms > 0 && now - idle.idle_since >= idle_limit &&
+                                 total_connections_.load() - evicted.size() > min_connections_;
+            if (is_expired(idle.created_at, now) || idle_too_long) {
+                evicted.push_back(std::move(idle.client));
+            } else {
+                checking.emplace_back(i, std::move(idle));
+            }
+        }
+        shards_[i].idle.clear();
+        shards_[i].size.store(0);
+    }
+    total_connections_ -= evicted.size();
+
+    // Checked connections go back ahead of any returned meanwhile; they have been idle longer
+    for (auto it = checking.rbegin(); it != checking.rend(); ++it) {
+        if (!it->second.client->is_healthy(false)) {
+            total_connections_--;
+            evicted.push_back(std::move(it->second.client));
+            continue;
+        }
+        Shard& shard = shards_[it->first];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.idle.push_front(std::move(it->second));
+        shard.size.store(shard.idle.size());
+    }
+
+    if (waiting_.load() > 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        hand_off_idle();
+        if (total_connections_.load() < max_connections_) {
+            wake_waiter();
+        }
+    }
+    if (shutdown_) {
+        for (auto& idle : drain_idle()) {
+            evicted.push_back(std::move(idle.client));
+        }
+    }
+    bool top_up = used_ && !shutdown_ && total_connections_.load() < min_connections_;
 
-    shutdown_ = true;
+    if (!evicted.empty()) {
+        DATABRICKS_LOG_INFO("Pool maintenance closed {} stale connection(s)", evicted.size());
+    }
+    evicted.clear();
 
-    // Clear all available connections
-    while (!available_connections_.empty()) {
-        available_connections_.pop();
-        total_connections_--;
+    if (top_up) {
+        try {
+            warm_up();
+        } catch (const std::exception& e) {
+            DATABRICKS_LOG_WARN("Pool maintenance could not restore min_connections: {}", e.what());
+        }
     }
+}
 
-    internal::get_logger()->info("Connection pool shutdown complete (active connections: {})", active_connections_);
+void ConnectionPool::maintenance_loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!shutdown_) {
+        maintenance_cv_.wait_for(lock, std::chrono::milliseconds(pooling_.maintenance_interval_ms),
+                                 [this]() { return shutdown_.load(); });
+        if (shutdown_) {
+            break;
+        }
 
-    // Wake up all waiting threads so they can throw
-    cv_.notify_all();
+        lock.unlock();
+        try {
+            run_maintenance();
+        } catch (const std::exception& e) {
+            DATABRICKS_LOG_ERROR("Pool maintenance failed: {}", e.what());
+        }
+        lock.lock();
+    }
 }
 
 } // namespace databricks
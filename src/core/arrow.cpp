@@ -0,0 +1,212 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "databricks/core/arrow.h"
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include <arrow/api.h>
+#include <arrow/util/decimal.h>
+#include <sql.h>
+
+namespace databricks {
+namespace {
+constexpr int MAX_DECIMAL128_PRECISION = 38;
+
+void check(const arrow::Status& status) {
+    if (!status.ok()) {
+        throw std::runtime_error("Arrow conversion failed: " + status.ToString());
+    }
+}
+
+// Days from 1970-01-01 to a proleptic Gregorian date
+int64_t days_since_epoch(int64_t year, unsigned month, unsigned day) {
+    year -= month <= 2;
+    const int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const unsigned year_of_era = static_cast<unsigned>(year - era * 400);
+    const unsigned day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const unsigned day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return era * 146097 + static_cast<int64_t>(day_of_era) - 719468;
+}
+
+int64_t epoch_micros(const Timestamp& ts) {
+    const int64_t days = days_since_epoch(ts.year, ts.month, ts.day);
+    const int64_t seconds = days * 86400 + ts.hour * 3600 + ts.minute * 60 + ts.second;
+    return seconds * 1000000 + ts.fraction / 1000;
+}
+
+std::shared_ptr<arrow::DataType> arrow_type(const ColumnMetadata& column, ValueType type) {
+    switch (type) {
+    case ValueType::Boolean:
+        return arrow::boolean();
+    case ValueType::Int64:
+        switch (column.sql_type) {
+        case SQL_TINYINT:
+            return arrow::int8();
+        case SQL_SMALLINT:
+            return arrow::int16();
+        case SQL_INTEGER:
+            return arrow::int32();
+        default:
+            return arrow::int64();
+        }
+    case ValueType::Double:
+        return column.sql_type == SQL_REAL ? arrow::float32() : arrow::float64();
+    case ValueType::Date:
+        return arrow::date32();
+    case ValueType::Timestamp:
+        return arrow::timestamp(arrow::TimeUnit::MICRO);
+    case ValueType::String:
+        if ((column.sql_type == SQL_DECIMAL || column.sql_type == SQL_NUMERIC) && column.column_size > 0 &&
+            column.column_size <= MAX_DECIMAL128_PRECISION) {
+            return arrow::decimal128(static_cast<int32_t>(column.column_size), column.decimal_digits);
+        }
+        return arrow::utf8();
+    }
+    return arrow::utf8();
+}
+
+/**
+ * @brief Build an array of fixed-width values, value(row) giving each non-NULL one
+ */
+template <typename Builder, typename Value>
+std::shared_ptr<arrow::Array> build_fixed(Builder& builder, const TypedBatch::Column& column, size_t rows,
+                                          Value value) {
+    check(builder.Reserve(static_cast<int64_t>(rows)));
+    for (size_t r = 0; r < rows; r++) {
+        if (column.nulls[r]) {
+            builder.UnsafeAppendNull();
+        } else {
+            builder.UnsafeAppend(value(r));
+        }
+    }
+    std::shared_ptr<arrow::Array> array;
+    check(builder.Finish(&array));
+    return array;
+}
+
+template <typename ArrowType, typename Source>
+std::shared_ptr<arrow::Array> build_numeric(const std::vector<Source>& values, const TypedBatch::Column& column,
+                                            size_t rows) {
+    using CType = typename ArrowType::c_type;
+    arrow::NumericBuilder<ArrowType> builder;
+    return build_fixed(builder, column, rows, [&](size_t r) { return static_cast<CType>(values[r]); });
+}
+
+std::string_view text_at(const TypedBatch::Column& column, size_t row) {
+    return std::string_view(column.text.data() + column.text_offsets[row],
+                            column.text_offsets[row + 1] - column.text_offsets[row]);
+}
+
+std::shared_ptr<arrow::Array> build_decimal(const std::shared_ptr<arrow::DataType>& type,
+                                            const TypedBatch::Column& column, size_t rows) {
+    const int32_t scale = static_cast<const arrow::Decimal128Type&>(*type).scale();
+    arrow::Decimal128Builder builder(type);
+    return build_fixed(builder, column, rows, [&](size_t r) {
+        arrow::Decimal128 value;
+        int32_t precision = 0;
+        int32_t text_scale = 0;
+        check(arrow::Decimal128::FromString(text_at(column, r), &value, &precision, &text_scale));
+        if (text_scale != scale) {
+            auto rescaled = value.Rescale(text_scale, scale);
+            check(rescaled.status());
+            value = *rescaled;
+        }
+        return value;
+    });
+}
+
+std::shared_ptr<arrow::Array> build_string(const TypedBatch::Column& column, size_t rows) {
+    arrow::StringBuilder builder;
+    check(builder.Reserve(static_cast<int64_t>(rows)));
+    check(builder.ReserveData(static_cast<int64_t>(column.text_offsets[rows] - column.text_offsets[0])));
+    for (size_t r = 0; r < rows; r++) {
+        if (column.nulls[r]) {
+            builder.UnsafeAppendNull();
+        } else {
+            std::string_view value = text_at(column, r);
+            builder.UnsafeAppend(value.data(), static_cast<int32_t>(value.size()));
+        }
+    }
+    std::shared_ptr<arrow::Array> array;
+    check(builder.Finish(&array));
+    return array;
+}
+
+std::shared_ptr<arrow::Array> build_column(const std::shared_ptr<arrow::DataType>& type,
+                                           const TypedBatch::Column& column, size_t rows) {
+    switch (type->id()) {
+    case arrow::Type::BOOL: {
+        arrow::BooleanBuilder builder;
+        return build_fixed(builder, column, rows, [&](size_t r) { return column.bools[r] != 0; });
+    }
+    case arrow::Type::INT8:
+        return build_numeric<arrow::Int8Type>(column.int64s, column, rows);
+    case arrow::Type::INT16:
+        return build_numeric<arrow::Int16Type>(column.int64s, column, rows);
+    case arrow::Type::INT32:
+        return build_numeric<arrow::Int32Type>(column.int64s, column, rows);
+    case arrow::Type::INT64:
+        return build_numeric<arrow::Int64Type>(column.int64s, column, rows);
+    case arrow::Type::FLOAT:
+        return build_numeric<arrow::FloatType>(column.doubles, column, rows);
+    case arrow::Type::DOUBLE:
+        return build_numeric<arrow::DoubleType>(column.doubles, column, rows);
+    case arrow::Type::DATE32: {
+        arrow::Date32Builder builder;
+        return build_fixed(builder, column, rows, [&](size_t r) {
+            const Date& d = column.dates[r];
+            return static_cast<int32_t>(days_since_epoch(d.year, d.month, d.day));
+        });
+    }
+    case arrow::Type::TIMESTAMP: {
+        arrow::TimestampBuilder builder(type, arrow::default_memory_pool());
+        return build_fixed(builder, column, rows, [&](size_t r) { return epoch_micros(column.timestamps[r]); });
+    }
+    case arrow::Type::DECIMAL128:
+        return build_decimal(type, column, rows);
+    default:
+        return build_string(column, rows);
+    }
+}
+} // namespace
+
+std::shared_ptr<arrow::Schema> to_arrow_schema(const std::vector<ColumnMetadata>& schema,
+                                               const std::vector<ValueType>& types) {
+    if (schema.size() != types.size()) {
+        throw std::invalid_argument("to_arrow_schema: schema and types must have the same length");
+    }
+
+    arrow::FieldVector fields;
+    fields.reserve(schema.size());
+    for (size_t c = 0; c < schema.size(); c++) {
+        fields.push_back(arrow::field(schema[c].name, arrow_type(schema[c], types[c]), schema[c].nullable));
+    }
+    return arrow::schema(std::move(fields));
+}
+
+std::shared_ptr<arrow::RecordBatch> to_record_batch(const TypedBatch& batch, std::shared_ptr<arrow::Schema> schema) {
+    if (!schema) {
+        std::vector<ValueType> types;
+        types.reserve(batch.num_columns());
+        for (size_t c = 0; c < batch.num_columns(); c++) {
+            types.push_back(batch.column(c).type);
+        }
+        schema = to_arrow_schema(batch.schema(), types);
+    }
+    if (static_cast<size_t>(schema->num_fields()) != batch.num_columns()) {
+        throw std::invalid_argument("to_record_batch: schema has " + std::to_string(schema->num_fields()) +
+                                    " fields, batch has " + std::to_string(batch.num_columns()) + " columns");
+    }
+
+    const size_t rows = batch.num_rows();
+    arrow::ArrayVector arrays;
+    arrays.reserve(batch.num_columns());
+    for (size_t c = 0; c < batch.num_columns(); c++) {
+        arrays.push_back(build_column(schema->field(static_cast<int>(c))->type(), batch.column(c), rows));
+    }
+    return arrow::RecordBatch::Make(std::move(schema), static_cast<int64_t>(rows), std::move(arrays));
+}
+
+} // namespace databricks
@@ -0,0 +1,31 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "databricks/core/cancellation.h"
+
+#include "../internal/cancel_scope.h"
+
+namespace databricks {
+// ========== CancellationToken Implementation ==========
+
+CancellationToken::CancellationToken()
+    : state_(std::make_shared<State>()) {}
+
+void CancellationToken::cancel() {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    if (state_->cancelled) {
+        return;
+    }
+    state_->cancelled = true;
+    // Scopes unsubscribe under the mutex, so none of them can be destroyed mid-callback
+    for (auto& entry : state_->callbacks) {
+        entry.second();
+    }
+    state_->callbacks.clear();
+}
+
+bool CancellationToken::is_cancelled() const {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->cancelled;
+}
+
+} // namespace databricks
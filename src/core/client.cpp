@@ -4,12 +4,32 @@
 
 #include "databricks/connection_pool.h"
 
+#include "../internal/block_prefetcher.h"
+#include "../internal/cancel_scope.h"
+#include "../internal/cursor_impl.h"
+#include "../internal/executor.h"
+#include "../internal/latency_tracker.h"
 #include "../internal/logger.h"
+#include "../internal/metrics.h"
+#include "../internal/odbc_environment.h"
+#include "../internal/odbc_statement.h"
+#include "../internal/odbc_types.h"
 #include "../internal/pool_manager.h"
-
+#include "../internal/profile_file.h"
+#include "../internal/query_cache.h"
+#include "../internal/statement_cache.h"
+#include "../internal/timer_queue.h"
+#include "../internal/tracing.h"
+#include "../internal/ttl_cache.h"
+
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <condition_variable>
+#include <cstdio>
 #include <cstdlib>
-#include <fstream>
+#include <cstring>
+#include <exception>
 #include <functional>
 #include <future>
 #include <iostream>
@@ -17,11 +37,18 @@
 #include <random>
 #include <sstream>
 #include <stdexcept>
+#include <system_error>
 #include <thread>
 
 #include <sql.h>
 #include <sqlext.h>
 
+#ifdef DATABRICKS_ENABLE_ARROW
+#    include "databricks/core/arrow.h"
+
+#    include <arrow/api.h>
+#endif
+
 namespace databricks {
 // ========== Client::Impl ==========
 
@@ -34,70 +61,99 @@ public:
     SQLConfig sql;
     PoolingConfig pooling;
     RetryConfig retry;
-    SQLHENV henv; // Environment handle
+    AsyncConfig async;
+    QueryCacheConfig query_cache;
+    SQLHENV henv; // Shared environment handle (not owned)
     SQLHDBC hdbc; // Connection handle
     bool connected;
-    std::mutex connection_mutex;            // Thread safety for connection operations
-    std::future<void> async_connect_future; // Track async connection
-    std::shared_ptr<ConnectionPool> pool;   // Shared pool (if pooling enabled)
+    bool bound_rereads = false; // internal::supports_bound_rereads() of the connection, checked on connect
+    std::mutex connection_mutex;                  // Thread safety for connection operations
+    std::shared_ptr<ConnectionPool> pool;         // Shared pool (if pooling enabled)
+    internal::StatementCache statement_cache;     // Prepared statements on this connection (non-pooled only)
+    std::mutex executor_mutex;                    // Guards lazy creation of executor
+    std::unique_ptr<internal::Executor> executor; // Runs query_async/connect_async (created on first use)
+    std::future<void> pool_warm_up;               // Background pool warm-up started by auto_connect
+    std::unique_ptr<internal::TtlCache<std::vector<std::vector<std::string>>>> results; // Null unless enabled
+    std::shared_ptr<internal::CircuitBreaker> breaker; // Shared by every client of the warehouse
+    HedgeConfig hedge;
+    std::unique_ptr<internal::LatencyTracker> hedge_latency; // Null unless hedging is enabled
+    std::mutex active_mutex;                                 // Guards active_stmt
+    SQLHSTMT active_stmt = SQL_NULL_HSTMT;                   // Statement inside SQLExecDirect/SQLExecute
 
     explicit Impl(const AuthConfig& auth_cfg, const SQLConfig& sql_cfg, const PoolingConfig& pool_cfg,
-                  const RetryConfig& retry_cfg, bool auto_connect)
+                  const RetryConfig& retry_cfg, const AsyncConfig& async_cfg, const QueryCacheConfig& cache_cfg,
+                  const HedgeConfig& hedge_cfg, bool auto_connect)
         : auth(auth_cfg)
         , sql(sql_cfg)
         , pooling(pool_cfg)
         , retry(retry_cfg)
+        , async(async_cfg)
+        , query_cache(cache_cfg)
         , henv(SQL_NULL_HENV)
         , hdbc(SQL_NULL_HDBC)
         , connected(false)
-        , pool(nullptr) {
-        internal::get_logger()->debug("Initializing Databricks client");
+        , pool(nullptr)
+        , statement_cache(sql_cfg.statement_cache_size)
+        , hedge(hedge_cfg) {
+        DATABRICKS_LOG_DEBUG("Initializing Databricks client");
 
         // Validate configurations
         if (!auth.is_valid()) {
-            internal::get_logger()->error("Invalid AuthConfig: missing required fields");
+            DATABRICKS_LOG_ERROR("Invalid AuthConfig: missing required fields");
             throw std::runtime_error("Invalid AuthConfig: host, token, and timeout_seconds are required");
         }
         if (!sql.is_valid()) {
-            internal::get_logger()->error("Invalid SQLConfig: missing required fields");
+            DATABRICKS_LOG_ERROR("Invalid SQLConfig: missing required fields");
             throw std::runtime_error("Invalid SQLConfig: http_path and odbc_driver_name are required");
         }
+        if (!async.is_valid()) {
+            DATABRICKS_LOG_ERROR("Invalid AsyncConfig: worker_threads and max_pending_tasks must be positive");
+            throw std::runtime_error("Invalid AsyncConfig: worker_threads and max_pending_tasks must be positive");
+        }
+        breaker = internal::PoolManager::instance().circuit_breaker(auth, sql, retry);
+        if (query_cache.enabled) {
+            if (!query_cache.is_valid()) {
+                DATABRICKS_LOG_ERROR("Invalid QueryCacheConfig: sizes and TTL must be positive");
+                throw std::runtime_error("Invalid QueryCacheConfig: ttl_ms, max_bytes, max_entries and shards must be "
+                                         "positive");
+            }
+            results = std::make_unique<internal::TtlCache<std::vector<std::vector<std::string>>>>(
+                query_cache.max_entries, std::chrono::milliseconds(query_cache.ttl_ms), std::chrono::milliseconds(0),
+                query_cache.shards, query_cache.max_bytes, internal::result_bytes);
+        }
+
+        if (hedge.enabled) {
+            if (!hedge.is_valid() || !pooling.enabled) {
+                DATABRICKS_LOG_ERROR("Invalid HedgeConfig: needs pooling and a percentile in (0, 100)");
+                throw std::runtime_error("Invalid HedgeConfig: hedged queries need pooling, a percentile in (0, 100), "
+                                         "and positive initial_delay_ms and min_samples");
+            }
+            hedge_latency = std::make_unique<internal::LatencyTracker>(
+                hedge.percentile, std::chrono::milliseconds(hedge.initial_delay_ms),
+                std::chrono::milliseconds(hedge.min_delay_ms), hedge.min_samples);
+        }
 
         // If pooling is enabled, get/create shared pool and return early
         if (pooling.enabled) {
-            internal::get_logger()->info("Connection pooling enabled (min: {}, max: {})", pooling.min_connections,
-                                         pooling.max_connections);
-            pool = internal::PoolManager::instance().get_pool(auth, sql, pooling);
+            DATABRICKS_LOG_INFO("Connection pooling enabled (min: {}, max: {})", pooling.min_connections,
+                                pooling.max_connections);
+            pool = internal::PoolManager::instance().get_pool(auth, sql, pooling, retry);
 
             if (auto_connect) {
-                internal::get_logger()->debug("Starting async pool warm-up");
-                pool->warm_up_async();
+                DATABRICKS_LOG_DEBUG("Starting async pool warm-up");
+                pool_warm_up = pool->warm_up_async();
             }
             return; // Don't allocate ODBC handles for pooled clients
         }
 
-        // Non-pooled client: allocate dedicated ODBC connection
-        internal::get_logger()->debug("Allocating dedicated ODBC connection (non-pooled)");
-        // Allocate environment handle
-        SQLRETURN ret = SQLAllocHandle(SQL_HANDLE_ENV, SQL_NULL_HANDLE, &henv);
-        if (!SQL_SUCCEEDED(ret)) {
-            internal::get_logger()->error("Failed to allocate ODBC environment handle");
-            throw std::runtime_error("Failed to allocate ODBC environment handle");
-        }
-
-        // Set ODBC version
-        ret = SQLSetEnvAttr(henv, SQL_ATTR_ODBC_VERSION, (SQLPOINTER)SQL_OV_ODBC3, 0);
-        if (!SQL_SUCCEEDED(ret)) {
-            internal::get_logger()->error("Failed to set ODBC version");
-            SQLFreeHandle(SQL_HANDLE_ENV, henv);
-            throw std::runtime_error("Failed to set ODBC version");
-        }
+        // Non-pooled client: allocate dedicated ODBC connection from the shared environment
+        DATABRICKS_LOG_DEBUG("Allocating dedicated ODBC connection (non-pooled)");
+        henv = internal::shared_odbc_environment();
 
         // Allocate connection handle
-        ret = SQLAllocHandle(SQL_HANDLE_DBC, henv, &hdbc);
+        SQLRETURN ret = SQLAllocHandle(SQL_HANDLE_DBC, henv, &hdbc);
         if (!SQL_SUCCEEDED(ret)) {
-            internal::get_logger()->error("Failed to allocate ODBC connection handle");
-            SQLFreeHandle(SQL_HANDLE_ENV, henv);
+            DATABRICKS_LOG_ERROR("Failed to allocate ODBC connection handle");
             throw std::runtime_error("Failed to allocate ODBC connection handle");
         }
 
@@ -111,6 +167,9 @@ public:
     }
 
     ~Impl() {
+        // Finish queued async work while the connection is still usable
+        shutdown_executor();
+
         // Pooled clients don't own ODBC handles
         if (pool) {
             return;
@@ -121,9 +180,44 @@ public:
         if (hdbc != SQL_NULL_HDBC) {
             SQLFreeHandle(SQL_HANDLE_DBC, hdbc);
         }
-        if (henv != SQL_NULL_HENV) {
-            SQLFreeHandle(SQL_HANDLE_ENV, henv);
+        // henv is the shared environment, which outlives every client
+    }
+
+    /**
+     * @brief Get the async executor, starting its workers on first use
+     */
+    internal::Executor& get_executor() {
+        std::lock_guard<std::mutex> lock(executor_mutex);
+        if (!executor) {
+            executor = std::make_unique<internal::Executor>(async.worker_threads, async.max_pending_tasks);
         }
+        return *executor;
+    }
+
+    // Run a query on the warehouse, bypassing the result cache; a scope stops it at its timeout or token
+    std::vector<std::vector<std::string>> run_query(const std::string& sql, const std::vector<Parameter>& params,
+                                                    internal::CancelScope* scope = nullptr);
+
+    // Run a read-only query on primary, sending a second copy if it is slower than the hedge threshold
+    std::vector<std::vector<std::string>> hedged_query(ConnectionPool::PooledConnection primary, const std::string& sql,
+                                                       const std::vector<Parameter>& params);
+
+    // Serve a query from the result cache, running it on a miss
+    std::vector<std::vector<std::string>> cached_query(const std::string& sql, const std::string& normalized_sql,
+                                                       const std::vector<Parameter>& params,
+                                                       std::chrono::milliseconds ttl) {
+        return results->get_or_load(internal::query_cache_key(normalized_sql, params),
+                                    [&]() { return run_query(sql, params); }, ttl);
+    }
+
+    void shutdown_executor() {
+        std::unique_ptr<internal::Executor> stopping;
+        {
+            std::lock_guard<std::mutex> lock(executor_mutex);
+            stopping = std::move(executor);
+        }
+        // Destroying the executor runs the remaining tasks and joins its workers
+        stopping.reset();
     }
 
     std::string build_connection_string() {
@@ -196,24 +290,7 @@ public:
         return sanitized;
     }
 
-    bool validate_driver_exists() {
-        // Enumerate ODBC drivers using the environment handle (no connection needed)
-        SQLCHAR driver[256];
-        SQLCHAR attributes[256];
-        SQLSMALLINT driver_len, attr_len;
-        SQLUSMALLINT direction = SQL_FETCH_FIRST;
-
-        while (SQL_SUCCEEDED(SQLDrivers(henv, direction, driver, sizeof(driver), &driver_len, attributes,
-                                        sizeof(attributes), &attr_len))) {
-            std::string driver_name(reinterpret_cast<char*>(driver));
-            if (driver_name == sql.odbc_driver_name) {
-                return true;
-            }
-            direction = SQL_FETCH_NEXT;
-        }
-
-        return false;
-    }
+    bool validate_driver_exists() { return internal::odbc_driver_installed(sql.odbc_driver_name); }
 
     void connect() {
         std::lock_guard<std::mutex> lock(connection_mutex);
@@ -221,11 +298,13 @@ public:
         if (connected)
             return;
 
-        internal::get_logger()->info("Connecting to Databricks at {}", auth.host);
+        internal::Span span("Client::connect");
+        span.set_attribute("server.address", auth.host);
+        DATABRICKS_LOG_INFO("Connecting to Databricks at {}", auth.host);
 
         // Validate driver exists before attempting connection
         if (!validate_driver_exists()) {
-            internal::get_logger()->error("ODBC driver '{}' not found", sql.odbc_driver_name);
+            DATABRICKS_LOG_ERROR("ODBC driver '{}' not found", sql.odbc_driver_name);
             throw std::runtime_error("ODBC driver '" + sql.odbc_driver_name +
                                      "' not found.\n\n"
                                      "To fix this issue:\n"
@@ -242,8 +321,10 @@ public:
         // Build connection string on-demand (not cached)
         std::string conn_str = build_connection_string();
 
+        internal::ScopedTimer connect_timer(MetricTimer::ConnectionCreate);
         SQLRETURN ret = SQLDriverConnect(hdbc, NULL, (SQLCHAR*)conn_str.c_str(), SQL_NTS, outConnStr,
                                          sizeof(outConnStr), &outConnStrLen, SQL_DRIVER_NOPROMPT);
+        connect_timer.stop();
 
         // Securely zero connection string immediately after use
         internal::secure_zero_string(conn_str);
@@ -255,22 +336,28 @@ public:
         }
 
         if (!SQL_SUCCEEDED(ret)) {
-            std::string error = get_odbc_error(SQL_HANDLE_DBC, hdbc);
-            internal::get_logger()->error("Connection failed: {}", sanitize_error_message(error));
-            throw std::runtime_error("Failed to connect to Databricks: " + sanitize_error_message(error));
+            std::vector<DiagnosticRecord> diagnostics = internal::get_odbc_diagnostics(SQL_HANDLE_DBC, hdbc);
+            for (DiagnosticRecord& record : diagnostics) {
+                record.message = sanitize_error_message(record.message);
+            }
+            std::string error = internal::format_diagnostics(diagnostics);
+            span.set_error(error);
+            DATABRICKS_LOG_ERROR("Connection failed: {}", error);
+            internal::throw_sql_error("Failed to connect to Databricks: " + error, std::move(diagnostics));
         }
 
         connected = true;
-        internal::get_logger()->info("Successfully connected to {}", auth.host);
+        bound_rereads = internal::supports_bound_rereads(hdbc);
+        if (!bound_rereads) {
+            DATABRICKS_LOG_DEBUG("Driver can't reread bound values; results with strings are fetched row by row");
+        }
+        DATABRICKS_LOG_INFO("Successfully connected to {}", auth.host);
     }
 
     void ensure_connected() {
-        // Wait for async connection if in progress
-        if (async_connect_future.valid()) {
-            async_connect_future.wait();
-        }
-
-        // Connect if not already connected
+        // Connect if not already connected. An in-flight connect_async() holds
+        // connection_mutex, so connect() waits for it rather than reconnecting. Waiting
+        // on its future instead could deadlock when both run on a saturated executor.
         if (!connected) {
             connect();
         }
@@ -278,109 +365,422 @@ public:
 
     void disconnect() {
         if (connected && hdbc != SQL_NULL_HDBC) {
-            internal::get_logger()->info("Disconnecting from Databricks");
+            DATABRICKS_LOG_INFO("Disconnecting from Databricks");
+            // Prepared statements belong to this connection
+            statement_cache.clear();
             SQLDisconnect(hdbc);
             connected = false;
-            internal::get_logger()->debug("Disconnected successfully");
+            DATABRICKS_LOG_DEBUG("Disconnected successfully");
         }
     }
 
-    std::string get_odbc_error(SQLSMALLINT handleType, SQLHANDLE handle) {
-        SQLCHAR sqlState[6];
-        SQLCHAR message[SQL_MAX_MESSAGE_LENGTH];
-        SQLINTEGER nativeError;
-        SQLSMALLINT msgLen;
+    /**
+     * @brief Close a connection the driver reported lost (08xxx), so the next attempt opens a new one
+     *
+     * The handle would fail every later call the same way; reconnecting on
+     * the same SQLHDBC is what gives a retry a chance.
+     */
+    void drop_lost_connection() {
+        std::lock_guard<std::mutex> lock(connection_mutex);
+        if (connected) {
+            DATABRICKS_LOG_WARN("Connection to {} lost, reconnecting on next use", auth.host);
+        }
+        disconnect();
+    }
 
-        std::ostringstream error;
-        SQLSMALLINT i = 1;
+    /**
+     * @brief Run work on a checked-out pooled connection, closing it rather than pooling it again if it was lost
+     */
+    template <typename Func>
+    static auto use_pooled(ConnectionPool::PooledConnection& conn, Func&& work) -> decltype(work(conn.get())) {
+        try {
+            return work(conn.get());
+        } catch (const SqlError& e) {
+            if (e.category() == ErrorCategory::Connection) {
+                conn.invalidate();
+            }
+            throw;
+        }
+    }
+
+    bool is_healthy(bool round_trip) {
+        if (!connected || hdbc == SQL_NULL_HDBC) {
+            return false;
+        }
 
-        while (SQLGetDiagRec(handleType, handle, i, sqlState, &nativeError, message, sizeof(message), &msgLen) ==
-               SQL_SUCCESS) {
-            error << "[" << sqlState << "] " << message << "; ";
-            i++;
+        SQLUINTEGER dead = SQL_CD_FALSE;
+        SQLRETURN ret = SQLGetConnectAttr(hdbc, SQL_ATTR_CONNECTION_DEAD, &dead, 0, nullptr);
+        if (SQL_SUCCEEDED(ret) && dead == SQL_CD_TRUE) {
+            return false;
+        }
+        if (!round_trip) {
+            return true;
         }
 
-        return error.str();
+        try {
+            internal::StatementHandle stmt = allocate_statement();
+            ret = SQLExecDirect(stmt.get(), (SQLCHAR*)"SELECT 1", SQL_NTS);
+            return SQL_SUCCEEDED(ret);
+        } catch (const std::exception&) {
+            return false;
+        }
     }
 
     /**
-     * @brief Check if an error message indicates a retryable error
+     * @brief Marks a statement as executing so cancel() can reach it from another thread
      *
-     * Determines if the error is transient and can be retried based on:
-     * - ODBC error codes (HY000, 08S01, etc.)
-     * - Error message patterns (timeout, connection refused, etc.)
-     * - Retry configuration settings
+     * Only spans the execute call: the handle is guaranteed alive for that long,
+     * and is freed or returned to the statement cache after fetching.
+     */
+    struct ActiveStatement {
+        ActiveStatement(Impl& impl, SQLHSTMT hstmt)
+            : impl(impl) {
+            std::lock_guard<std::mutex> lock(impl.active_mutex);
+            impl.active_stmt = hstmt;
+        }
+        ~ActiveStatement() {
+            std::lock_guard<std::mutex> lock(impl.active_mutex);
+            impl.active_stmt = SQL_NULL_HSTMT;
+        }
+        Impl& impl;
+    };
+
+    /**
+     * @brief Allocate a statement and execute a query on the dedicated connection
      *
-     * This function implements comprehensive error classification for ODBC errors:
-     * - Connection errors (08xxx family)
-     * - Timeout errors (HYTxx family)
-     * - Transient network errors
-     * - Server unavailability errors
+     * Static queries go through SQLExecDirect; parameterized queries are prepared
+     * and bound first. The caller must have ensured the connection is open.
      *
-     * Non-retryable errors include:
-     * - Authentication failures
-     * - SQL syntax errors
-     * - Permission denied errors
-     * - Resource exhaustion (out of memory)
+     * With a scope, the statement is attached to it while executing, so the
+     * scope's timeout or token cancels it.
      *
-     * @param error The error message to check
-     * @return true if the error is retryable, false otherwise
+     * @return Executed statement, ready for fetching
+     * @throws std::runtime_error if allocation, preparation, binding or execution fails
      */
-    bool is_error_retryable(const std::string& error) const {
-        // Connection timeout errors (respects retry_on_timeout config)
-        if (retry.retry_on_timeout) {
-            if (error.find("timeout") != std::string::npos || error.find("Timeout") != std::string::npos ||
-                error.find("TIMEOUT") != std::string::npos ||
-                error.find("HYT00") != std::string::npos || // Timeout expired
-                error.find("HYT01") != std::string::npos)   // Connection timeout
+    internal::StatementHandle execute_statement(const std::string& sql, const std::vector<Parameter>& params,
+                                                internal::CancelScope* scope = nullptr) {
+        internal::Span span("Client::execute_statement");
+        span.set_attribute("db.parameter_count", static_cast<int64_t>(params.size()));
+        SQLRETURN ret;
+
+        // Choose execution path based on whether parameters are provided
+        if (params.empty()) {
+            internal::StatementHandle stmt = allocate_statement();
+
+            // Static query - use direct execution for better performance
+            internal::ScopedTimer execute_timer(MetricTimer::QueryExecute);
             {
-                return true;
+                ActiveStatement active(*this, stmt.get());
+                internal::CancelScope::Attachment cancel_on(scope, stmt.get());
+                ret = SQLExecDirect(stmt.get(), (SQLCHAR*)sql.c_str(), SQL_NTS);
+            }
+            if (!SQL_SUCCEEDED(ret)) {
+                internal::throw_odbc_error("Query execution failed", SQL_HANDLE_STMT, stmt.get());
             }
+            return stmt;
         }
 
-        // Connection lost / network errors (respects retry_on_connection_lost config)
-        if (retry.retry_on_connection_lost) {
-            if (error.find("Connection refused") != std::string::npos ||
-                error.find("Connection reset") != std::string::npos ||
-                error.find("Connection lost") != std::string::npos ||
-                error.find("Connection closed") != std::string::npos ||
-                error.find("Broken pipe") != std::string::npos || error.find("No route to host") != std::string::npos ||
-                error.find("Network is unreachable") != std::string::npos ||
-                error.find("08S01") != std::string::npos || // Communication link failure
-                error.find("08003") != std::string::npos || // Connection does not exist
-                error.find("08006") != std::string::npos || // Connection failure
-                error.find("08007") != std::string::npos || // Connection failure during transaction
-                error.find("08004") != std::string::npos)   // Server rejected connection
-            {
-                return true;
+        // Parameterized query - reuse a cached prepared statement when there is one
+        internal::ScopedTimer prepare_timer(MetricTimer::QueryPrepare);
+        internal::StatementHandle stmt = prepare_statement(sql);
+        prepare_timer.stop();
+
+        internal::ScopedTimer execute_timer(MetricTimer::QueryExecute);
+
+        // Encode parameters - storage must outlive SQLExecute
+        std::vector<internal::EncodedParameter> param_storage;
+        param_storage.reserve(params.size());
+
+        for (size_t i = 0; i < params.size(); i++) {
+            param_storage.push_back(internal::encode_parameter(params[i].value, params[i].c_type));
+            auto& encoded = param_storage.back();
+
+            ret = SQLBindParameter(stmt.get(),
+                                   static_cast<SQLUSMALLINT>(i + 1),  // Parameter number (1-based)
+                                   SQL_PARAM_INPUT,                   // Input parameter
+                                   params[i].c_type,                  // C data type
+                                   params[i].sql_type,                // SQL data type
+                                   encoded.column_size,               // Column size
+                                   encoded.decimal_digits,            // Decimal digits
+                                   (SQLPOINTER)encoded.buffer.data(), // Parameter value pointer
+                                   encoded.length,                    // Buffer length
+                                   &encoded.length                    // Length/indicator
+            );
+
+            if (!SQL_SUCCEEDED(ret)) {
+                internal::throw_odbc_error("Failed to bind parameter " + std::to_string(i + 1), SQL_HANDLE_STMT,
+                                           stmt.get());
             }
         }
 
-        // Server temporarily unavailable / transient errors (always retryable)
-        if (error.find("Service Unavailable") != std::string::npos ||
-            error.find("Too Many Requests") != std::string::npos ||
-            error.find("503") != std::string::npos || // HTTP 503 Service Unavailable
-            error.find("429") != std::string::npos || // HTTP 429 Too Many Requests
-            error.find("502") != std::string::npos || // HTTP 502 Bad Gateway
-            error.find("504") != std::string::npos || // HTTP 504 Gateway Timeout
-            error.find("HY000") != std::string::npos) // General error (may be transient)
+        // Execute the prepared statement
         {
-            return true;
+            ActiveStatement active(*this, stmt.get());
+            internal::CancelScope::Attachment cancel_on(scope, stmt.get());
+            ret = SQLExecute(stmt.get());
+        }
+        if (!SQL_SUCCEEDED(ret)) {
+            // Failed statements are freed rather than cached
+            internal::throw_odbc_error("Query execution failed", SQL_HANDLE_STMT, stmt.get());
         }
+        execute_timer.stop();
 
-        // Non-retryable errors - return false immediately
-        if (error.find("28000") != std::string::npos || // Invalid authorization
-            error.find("42000") != std::string::npos || // Syntax error or access violation
-            error.find("42S02") != std::string::npos || // Table not found
-            error.find("42S22") != std::string::npos || // Column not found
-            error.find("23000") != std::string::npos || // Integrity constraint violation
-            error.find("HY013") != std::string::npos || // Memory allocation error
-            error.find("Authentication") != std::string::npos || error.find("Permission denied") != std::string::npos ||
-            error.find("Access denied") != std::string::npos) {
-            return false;
+        // Hand the statement back to the cache once the caller has finished fetching
+        if (statement_cache.capacity() > 0) {
+            stmt.recycle_into(&statement_cache, sql);
         }
+        return stmt;
+    }
 
-        return false;
+    /**
+     * @brief Check out the cached prepared statement for sql, or prepare a new one
+     */
+    internal::StatementHandle prepare_statement(const std::string& sql) {
+        internal::StatementHandle stmt(statement_cache.take(sql));
+        if (stmt) {
+            DATABRICKS_LOG_DEBUG("Reusing cached prepared statement");
+            return stmt;
+        }
+
+        stmt = allocate_statement();
+        SQLRETURN ret = SQLPrepare(stmt.get(), (SQLCHAR*)sql.c_str(), SQL_NTS);
+        if (!SQL_SUCCEEDED(ret)) {
+            internal::throw_odbc_error("Failed to prepare statement", SQL_HANDLE_STMT, stmt.get());
+        }
+        return stmt;
+    }
+
+    /**
+     * @brief Execute rows [begin, begin + count) of a batch as one parameter array
+     *
+     * Parameters are bound column-wise: one contiguous buffer per parameter position,
+     * with a fixed stride so the driver can walk it. Statement-level failures that
+     * look transient are thrown so execute_with_retry() can replay the chunk; any
+     * other failure is recorded in result against the chunk's rows.
+     *
+     * @throws std::runtime_error on retryable execution errors
+     */
+    void execute_batch_chunk(const std::string& sql, const std::vector<std::vector<Parameter>>& rows, size_t begin,
+                             size_t count, BatchResult& result) {
+        const size_t num_params = rows[begin].size();
+        internal::StatementHandle stmt = prepare_statement(sql);
+
+        // Encode every value once into a staging area, then copy at a fixed stride
+        struct BoundColumn {
+            std::vector<char> data;
+            std::vector<SQLLEN> lengths;
+            SQLLEN width = 0;
+            SQLULEN column_size = 0;
+            SQLSMALLINT decimal_digits = 0;
+        };
+        std::vector<BoundColumn> columns(num_params);
+        internal::EncodedParameter encoded;
+        std::vector<char> staging;
+        std::vector<size_t> offsets(count);
+
+        for (size_t col = 0; col < num_params; col++) {
+            BoundColumn& bound = columns[col];
+            bound.lengths.resize(count);
+            staging.clear();
+
+            for (size_t i = 0; i < count; i++) {
+                const Parameter& param = rows[begin + i][col];
+                internal::encode_parameter(param.value, param.c_type, encoded);
+                offsets[i] = staging.size();
+                staging.insert(staging.end(), encoded.buffer.begin(), encoded.buffer.end());
+                bound.lengths[i] = encoded.length;
+                bound.width = std::max(bound.width, static_cast<SQLLEN>(encoded.buffer.size()));
+                bound.column_size = std::max(bound.column_size, encoded.column_size);
+                bound.decimal_digits = std::max(bound.decimal_digits, encoded.decimal_digits);
+            }
+
+            bound.data.assign(count * static_cast<size_t>(bound.width), '\0');
+            for (size_t i = 0; i < count; i++) {
+                size_t size = (i + 1 < count ? offsets[i + 1] : staging.size()) - offsets[i];
+                std::memcpy(bound.data.data() + i * bound.width, staging.data() + offsets[i], size);
+            }
+        }
+
+        std::vector<SQLUSMALLINT> status(count, SQL_PARAM_UNUSED);
+        SQLULEN processed = 0;
+        SQLHSTMT hstmt = stmt.get();
+
+        SQLSetStmtAttr(hstmt, SQL_ATTR_PARAM_BIND_TYPE, (SQLPOINTER)SQL_PARAM_BIND_BY_COLUMN, 0);
+        SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)static_cast<SQLULEN>(count), 0);
+        SQLSetStmtAttr(hstmt, SQL_ATTR_PARAM_STATUS_PTR, status.data(), 0);
+        SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMS_PROCESSED_PTR, &processed, 0);
+
+        for (size_t col = 0; col < num_params; col++) {
+            const Parameter& param = rows[begin][col];
+            BoundColumn& bound = columns[col];
+            SQLRETURN ret =
+                SQLBindParameter(hstmt, static_cast<SQLUSMALLINT>(col + 1), SQL_PARAM_INPUT, param.c_type,
+                                 param.sql_type, bound.column_size, bound.decimal_digits,
+                                 (SQLPOINTER)bound.data.data(), bound.width, bound.lengths.data());
+            if (!SQL_SUCCEEDED(ret)) {
+                internal::throw_odbc_error("Failed to bind parameter " + std::to_string(col + 1), SQL_HANDLE_STMT,
+                                           hstmt);
+            }
+        }
+
+        SQLRETURN ret = SQLExecute(hstmt);
+        bool failed = ret == SQL_ERROR || ret == SQL_INVALID_HANDLE;
+        if (failed) {
+            std::vector<DiagnosticRecord> diagnostics = internal::get_odbc_diagnostics(SQL_HANDLE_STMT, hstmt);
+            std::string error = internal::format_diagnostics(diagnostics);
+            if (is_error_retryable(SqlError(error, diagnostics).category())) {
+                // Failed statements are freed rather than cached
+                internal::throw_sql_error("Batch execution failed: " + error, std::move(diagnostics));
+            }
+            result.errors.push_back("Rows " + std::to_string(begin) + "-" + std::to_string(begin + count - 1) +
+                                    ": " + error);
+        } else {
+            SQLLEN affected = 0;
+            if (SQL_SUCCEEDED(SQLRowCount(hstmt, &affected)) && affected > 0) {
+                result.rows_affected += affected;
+            }
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            BatchResult::RowStatus& row = result.row_status[begin + i];
+            switch (status[i]) {
+            case SQL_PARAM_SUCCESS:
+                row = BatchResult::RowStatus::Success;
+                break;
+            case SQL_PARAM_SUCCESS_WITH_INFO:
+                row = BatchResult::RowStatus::SuccessWithInfo;
+                break;
+            case SQL_PARAM_ERROR:
+                row = BatchResult::RowStatus::Error;
+                break;
+            case SQL_PARAM_DIAG_UNAVAILABLE:
+                // The driver only reports for the whole array
+                row = failed ? BatchResult::RowStatus::Error : BatchResult::RowStatus::Success;
+                break;
+            default:
+                // Drivers that don't fill the status array still report how many sets they processed
+                if (processed > 0 && i >= processed) {
+                    row = BatchResult::RowStatus::NotExecuted;
+                } else {
+                    row = failed ? BatchResult::RowStatus::Error : BatchResult::RowStatus::Success;
+                }
+                break;
+            }
+        }
+
+        if (failed) {
+            return;
+        }
+
+        // Restore single-row binding before another query reuses the cached statement
+        SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)static_cast<SQLULEN>(1), 0);
+        SQLSetStmtAttr(hstmt, SQL_ATTR_PARAM_STATUS_PTR, nullptr, 0);
+        SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMS_PROCESSED_PTR, nullptr, 0);
+        if (statement_cache.capacity() > 0) {
+            stmt.recycle_into(&statement_cache, sql);
+        }
+    }
+
+    internal::StatementHandle allocate_statement() {
+        SQLHSTMT raw = SQL_NULL_HSTMT;
+        SQLRETURN ret = SQLAllocHandle(SQL_HANDLE_STMT, hdbc, &raw);
+        if (!SQL_SUCCEEDED(ret)) {
+            throw std::runtime_error("Failed to allocate statement handle");
+        }
+        return internal::StatementHandle(raw);
+    }
+
+    /**
+     * @brief Connect (if needed) and execute a query for incremental fetching
+     *
+     * Only connecting and executing are retried; once rows have been handed to
+     * the caller, a failure can't be replayed transparently.
+     */
+    internal::StatementHandle open_statement(const std::string& sql, const std::vector<Parameter>& params,
+                                             internal::CancelScope* scope = nullptr) {
+        return execute_with_retry(
+            [&]() {
+                return cancellable(scope, [&]() {
+                    ensure_connected();
+                    return execute_statement(sql, params, scope);
+                });
+            },
+            "query");
+    }
+
+    /**
+     * @brief Run one attempt under a scope, reporting failures caused by the scope as CancelledError
+     *
+     * Without a scope the attempt just runs. An attempt that starts after the
+     * scope fired fails without calling the driver.
+     */
+    template <typename Func> auto cancellable(internal::CancelScope* scope, Func&& attempt) -> decltype(attempt()) {
+        if (!scope) {
+            return attempt();
+        }
+        scope->throw_if_fired();
+        try {
+            return attempt();
+        } catch (const CancelledError&) {
+            throw;
+        } catch (const std::runtime_error& e) {
+            if (!scope->fired()) {
+                throw;
+            }
+            const auto* sql_error = dynamic_cast<const SqlError*>(&e);
+            throw scope->cancelled_error(sql_error ? sql_error->diagnostics() : std::vector<DiagnosticRecord>{});
+        }
+    }
+
+    /**
+     * @brief Check out a pooled connection, giving up when the scope fires or its deadline passes
+     *
+     * Waits in short steps so a cancelled token also ends the wait.
+     */
+    ConnectionPool::PooledConnection acquire_within(internal::CancelScope& scope) {
+        constexpr auto ACQUIRE_STEP = std::chrono::milliseconds(50);
+        return execute_with_retry(
+            [&]() -> ConnectionPool::PooledConnection {
+                while (true) {
+                    scope.throw_if_fired();
+                    auto now = std::chrono::steady_clock::now();
+                    if (scope.deadline() && now >= *scope.deadline()) {
+                        throw scope.cancelled_error();
+                    }
+                    auto step = now + ACQUIRE_STEP;
+                    if (scope.deadline()) {
+                        step = std::min(step, *scope.deadline());
+                    }
+                    if (auto conn = pool->try_acquire(step)) {
+                        return std::move(*conn);
+                    }
+                }
+            },
+            "acquire");
+    }
+
+    /**
+     * @brief Check if an error category is retryable under the retry configuration
+     *
+     * Categories come from the SQLSTATE table lookup in classify_diagnostic():
+     * - Timeout (HYT00/HYT01) when retry_on_timeout is set
+     * - Connection (08xxx) when retry_on_connection_lost is set
+     * - Unavailable (HY000 with HTTP 429/502/503/504) always
+     *
+     * Everything else (authentication, query, resource and unclassified
+     * errors) fails fast without spending the backoff budget.
+     */
+    bool is_error_retryable(ErrorCategory category) const {
+        switch (category) {
+        case ErrorCategory::Timeout:
+            return retry.retry_on_timeout;
+        case ErrorCategory::Connection:
+            return retry.retry_on_connection_lost;
+        case ErrorCategory::Unavailable:
+            return true;
+        default:
+            return false;
+        }
     }
 
     /**
@@ -393,76 +793,180 @@ public:
      * - Exponential backoff with configurable multiplier
      * - Jitter added to backoff to avoid thundering herd
      * - Respects max backoff cap to prevent excessive delays
-     * - Intelligent error classification (retryable vs non-retryable)
+     * - SQLSTATE-based error classification (retryable vs non-retryable)
+     * - Per-warehouse circuit breaker and retry budget, shared through PoolManager
      * - Detailed error messages on final failure
      *
      * @tparam Func Callable type that returns a value
      * @param operation The operation to execute (lambda, function, etc.)
      * @param operation_name Name of the operation for error messages
      * @return The result of the operation
-     * @throws std::runtime_error if max retries exceeded or non-retryable error
+     * @throws SqlError if max retries exceeded or the retry budget is spent, keeping the last attempt's diagnostics
+     * @throws CircuitOpenError if the warehouse's circuit is open
+     * @throws std::runtime_error rethrown unchanged for non-retryable errors
      */
     template <typename Func>
     auto execute_with_retry(Func&& operation, const std::string& operation_name) -> decltype(operation()) {
-        // If retries are disabled, execute directly
+        // If retries are disabled, execute directly (the circuit breaker still applies)
         if (!retry.enabled) {
-            return operation();
+            internal::Span attempt_span("Client::attempt");
+            attempt_span.set_attribute("operation", operation_name);
+            return call_through_breaker(operation, operation_name);
         }
 
         size_t attempt = 0;
         size_t backoff_ms = retry.initial_backoff_ms;
 
         while (true) {
+            internal::Span attempt_span("Client::attempt");
+            attempt_span.set_attribute("operation", operation_name);
+            attempt_span.set_attribute("attempt", static_cast<int64_t>(attempt + 1));
             try {
                 if (attempt > 0) {
-                    internal::get_logger()->debug("Retry attempt {}/{} for {}", attempt + 1, retry.max_attempts,
-                                                  operation_name);
+                    DATABRICKS_LOG_DEBUG("Retry attempt {}/{} for {}", attempt + 1, retry.max_attempts, operation_name);
                 }
-                return operation();
+                return call_through_breaker(operation, operation_name);
+            } catch (const CircuitOpenError&) {
+                throw; // The warehouse is known to be down; retrying would only wait
+            } catch (const CancelledError&) {
+                throw; // The caller asked for the query to stop
             } catch (const std::runtime_error& e) {
                 attempt++;
                 std::string error_msg = e.what();
+                attempt_span.set_error(sanitize_error_message(error_msg));
+                attempt_span.end();
 
-                // Check if error is retryable
-                bool is_retryable = is_error_retryable(error_msg);
-
-                // If not retryable or max attempts reached, re-throw
-                if (!is_retryable || attempt >= retry.max_attempts) {
-                    if (attempt >= retry.max_attempts) {
-                        std::string sanitized_error = sanitize_error_message(error_msg);
-                        internal::get_logger()->error("{} failed after {} attempts: {}", operation_name,
-                                                      retry.max_attempts, sanitized_error);
-                        throw std::runtime_error("Operation '" + operation_name + "' failed after " +
-                                                 std::to_string(attempt) + " attempts: " + sanitized_error);
-                    }
+                // Only ODBC failures carry a category; anything else is not retried
+                const auto* sql_error = dynamic_cast<const SqlError*>(&e);
+                if (sql_error && sql_error->category() == ErrorCategory::Connection) {
+                    drop_lost_connection();
+                }
+                bool is_retryable = sql_error && is_error_retryable(sql_error->category());
+                bool out_of_attempts = attempt >= retry.max_attempts;
+                bool budget_spent = is_retryable && !out_of_attempts && !breaker->try_acquire_retry();
+
+                if (!is_retryable) {
                     std::string sanitized_error = sanitize_error_message(error_msg);
-                    internal::get_logger()->error("{} failed with non-retryable error: {}", operation_name,
-                                                  sanitized_error);
+                    DATABRICKS_LOG_ERROR("{} failed with non-retryable error: {}", operation_name, sanitized_error);
                     throw; // Re-throw non-retryable errors immediately
                 }
+                if (out_of_attempts || budget_spent) {
+                    std::string sanitized_error = sanitize_error_message(error_msg);
+                    std::string reason = budget_spent ? " attempts (retry budget spent): " : " attempts: ";
+                    DATABRICKS_LOG_ERROR("{} failed after {}{}{}", operation_name, attempt, reason, sanitized_error);
+                    // Keep the diagnostics so callers can still act on the SQLSTATE
+                    internal::throw_sql_error("Operation '" + operation_name + "' failed after " +
+                                                  std::to_string(attempt) + reason + sanitized_error,
+                                              sql_error->diagnostics());
+                }
 
                 // Add jitter (±25%) to prevent thundering herd problem
                 // when multiple clients retry simultaneously
-                std::random_device rd;
-                std::mt19937 gen(rd());
+                thread_local std::mt19937 gen(std::random_device{}());
                 std::uniform_real_distribution<> jitter_dist(0.75, 1.25);
                 double jitter = jitter_dist(gen);
 
                 size_t jittered_backoff = static_cast<size_t>(backoff_ms * jitter);
 
-                internal::get_logger()->warn("{} attempt {}/{} failed: {} - retrying in {}ms", operation_name, attempt,
-                                             retry.max_attempts, error_msg, jittered_backoff);
+                DATABRICKS_LOG_WARN("{} attempt {}/{} failed: {} - retrying in {}ms", operation_name, attempt,
+                                    retry.max_attempts, error_msg, jittered_backoff);
+                MetricLabels labels;
+                labels.operation = operation_name;
+                internal::add_metric(MetricCounter::Retries, 1, labels);
 
-                // Sleep with exponential backoff + jitter
+                // Sleep with exponential backoff + jitter, unless the failures so far opened the circuit
+                throw_if_circuit_open(operation_name);
+                internal::Span backoff_span("Client::backoff");
+                backoff_span.set_attribute("backoff_ms", static_cast<int64_t>(jittered_backoff));
                 std::this_thread::sleep_for(std::chrono::milliseconds(jittered_backoff));
+                backoff_span.end();
 
                 // Calculate next backoff with cap (before jitter is applied next time)
                 backoff_ms = std::min(static_cast<size_t>(backoff_ms * retry.backoff_multiplier), retry.max_backoff_ms);
             }
         }
     }
+
+    /**
+     * @brief Run one attempt if the warehouse's circuit allows it, and report the outcome
+     *
+     * Transient SqlErrors count as failures; any other outcome (including a
+     * CancelledError) counts as success.
+     *
+     * @throws CircuitOpenError if the circuit is open
+     */
+    template <typename Func>
+    auto call_through_breaker(Func& operation, const std::string& operation_name) -> decltype(operation()) {
+        if (!breaker->allow()) {
+            throw_if_circuit_open(operation_name);
+            throw CircuitOpenError("Circuit half-open for " + auth.host + sql.http_path + ": probe in flight, '" +
+                                       operation_name + "' not attempted",
+                                   std::chrono::milliseconds(0));
+        }
+
+        // Reports when the attempt returns or throws, so void operations need no special case
+        struct Outcome {
+            internal::CircuitBreaker& breaker;
+            bool failed = false;
+            ~Outcome() { failed ? breaker.record_failure() : breaker.record_success(); }
+        } outcome{*breaker};
+
+        try {
+            return operation();
+        } catch (const CancelledError&) {
+            throw; // Cut short by the caller; says nothing about the warehouse
+        } catch (const SqlError& e) {
+            outcome.failed = e.is_transient();
+            throw;
+        }
+    }
+
+    void throw_if_circuit_open(const std::string& operation_name) const {
+        if (breaker->state() == internal::CircuitBreaker::State::Open) {
+            throw CircuitOpenError("Circuit open for " + auth.host + sql.http_path + ": '" + operation_name +
+                                       "' not attempted",
+                                   breaker->retry_after());
+        }
+    }
 };
 
+// ========== Client::Parameter Implementation ==========
+
+Client::Parameter Client::Parameter::from_int64(int64_t value) {
+    return {std::to_string(value), SQL_C_SBIGINT, SQL_BIGINT};
+}
+
+Client::Parameter Client::Parameter::from_double(double value) {
+    // %.17g round-trips every double exactly
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.17g", value);
+    return {buf, SQL_C_DOUBLE, SQL_DOUBLE};
+}
+
+Client::Parameter Client::Parameter::from_bool(bool value) {
+    return {value ? "1" : "0", SQL_C_BIT, SQL_BIT};
+}
+
+Client::Parameter Client::Parameter::from_date(const Date& value) {
+    return {internal::format_date(value), SQL_C_TYPE_DATE, SQL_TYPE_DATE};
+}
+
+Client::Parameter Client::Parameter::from_timestamp(const Timestamp& value) {
+    return {internal::format_timestamp(value), SQL_C_TYPE_TIMESTAMP, SQL_TYPE_TIMESTAMP};
+}
+
+// ========== Client::BatchResult Implementation ==========
+
+size_t Client::BatchResult::success_count() const {
+    return static_cast<size_t>(std::count_if(row_status.begin(), row_status.end(), [](RowStatus status) {
+        return status == RowStatus::Success || status == RowStatus::SuccessWithInfo;
+    }));
+}
+
+size_t Client::BatchResult::error_count() const {
+    return row_status.size() - success_count();
+}
+
 // ========== Builder Implementation ==========
 
 Client::Builder::Builder() {}
@@ -498,49 +1002,15 @@ Client::Builder& Client::Builder::with_environment_config(const std::string& pro
         http_path_env = std::getenv("DATABRICKS_SQL_HTTP_PATH");
 
     if (!http_path_env) {
-        // Try to load from profile file
+        // Try to load from profile file (parsed once and cached)
         const char* home = std::getenv("HOME");
         if (home) {
-            std::ifstream file(std::string(home) + "/.databrickscfg");
-            if (file.is_open()) {
-                std::string line;
-                bool in_profile_section = false;
-
-                while (std::getline(file, line)) {
-                    auto start = line.find_first_not_of(" \t");
-                    if (start == std::string::npos)
-                        continue;
-                    auto end = line.find_last_not_of(" \t");
-                    line = line.substr(start, end - start + 1);
-
-                    if (line.empty() || line[0] == '#')
-                        continue;
-
-                    if (line.front() == '[' && line.back() == ']') {
-                        in_profile_section = (line.substr(1, line.size() - 2) == profile);
-                        continue;
-                    }
-
-                    if (!in_profile_section)
-                        continue;
-
-                    auto pos = line.find('=');
-                    if (pos == std::string::npos)
-                        continue;
-
-                    std::string key = line.substr(0, pos);
-                    std::string value = line.substr(pos + 1);
-
-                    key.erase(0, key.find_first_not_of(" \t"));
-                    key.erase(key.find_last_not_of(" \t") + 1);
-                    value.erase(0, value.find_first_not_of(" \t"));
-                    value.erase(value.find_last_not_of(" \t") + 1);
-
-                    if (key == "http_path" || key == "sql_http_path") {
-                        sql.http_path = value;
-                        break;
-                    }
+            if (auto file = internal::load_profile_file(internal::default_profile_path())) {
+                auto http_path = file->value(profile, "http_path");
+                if (!http_path) {
+                    http_path = file->value(profile, "sql_http_path");
                 }
+                sql.http_path = http_path.value_or("");
             }
         }
     } else {
@@ -556,6 +1026,21 @@ Client::Builder& Client::Builder::with_environment_config(const std::string& pro
     return *this;
 }
 
+Client::Builder& Client::Builder::with_async(const AsyncConfig& async) {
+    async_ = std::make_unique<AsyncConfig>(async);
+    return *this;
+}
+
+Client::Builder& Client::Builder::with_hedging(const HedgeConfig& hedge) {
+    hedge_ = std::make_unique<HedgeConfig>(hedge);
+    return *this;
+}
+
+Client::Builder& Client::Builder::with_query_cache(const QueryCacheConfig& cache) {
+    query_cache_ = std::make_unique<QueryCacheConfig>(cache);
+    return *this;
+}
+
 Client::Builder& Client::Builder::with_auto_connect(bool enable) {
     auto_connect_ = enable;
     return *this;
@@ -571,19 +1056,56 @@ Client Client::Builder::build() {
 
     PoolingConfig pooling = pooling_ ? *pooling_ : PoolingConfig{};
     RetryConfig retry = retry_ ? *retry_ : RetryConfig{};
-    return Client(*auth_, *sql_, pooling, retry, auto_connect_);
+    AsyncConfig async = async_ ? *async_ : AsyncConfig{};
+    QueryCacheConfig query_cache = query_cache_ ? *query_cache_ : QueryCacheConfig{};
+    HedgeConfig hedge = hedge_ ? *hedge_ : HedgeConfig{};
+    return Client(*auth_, *sql_, pooling, retry, async, query_cache, hedge, auto_connect_);
 }
 
 // ========== Client Implementation ==========
 
 Client::Client(const AuthConfig& auth, const SQLConfig& sql, const PoolingConfig& pooling, const RetryConfig& retry,
+               const AsyncConfig& async, const QueryCacheConfig& query_cache, const HedgeConfig& hedge,
                bool auto_connect)
-    : pimpl_(std::make_unique<Impl>(auth, sql, pooling, retry, auto_connect)) {}
+    : pimpl_(std::make_unique<Impl>(auth, sql, pooling, retry, async, query_cache, hedge, auto_connect)) {}
 
-Client::~Client() = default;
+Client::~Client() {
+    // Queued async queries call back into this Client, so drain them while it is intact
+    if (pimpl_) {
+        pimpl_->shutdown_executor();
+    }
+}
 
 Client::Client(Client&&) noexcept = default;
-Client& Client::operator=(Client&&) noexcept = default;
+
+Client& Client::operator=(Client&& other) noexcept {
+    if (this != &other) {
+        if (pimpl_) {
+            pimpl_->shutdown_executor();
+        }
+        pimpl_ = std::move(other.pimpl_);
+    }
+    return *this;
+}
+
+bool Client::preinitialize(const std::string& odbc_driver_name) {
+    internal::Span span("Client::preinitialize");
+    bool installed = false;
+    try {
+        installed = internal::odbc_driver_installed(odbc_driver_name);
+        if (!installed) {
+            DATABRICKS_LOG_WARN("ODBC driver '{}' not found during preinitialization", odbc_driver_name);
+        }
+    } catch (const std::exception& e) {
+        DATABRICKS_LOG_WARN("ODBC preinitialization failed: {}", e.what());
+    }
+    try {
+        internal::load_profile_file(internal::default_profile_path());
+    } catch (const std::exception& e) {
+        DATABRICKS_LOG_DEBUG("Skipping configuration file preload: {}", e.what());
+    }
+    return installed;
+}
 
 const AuthConfig& Client::get_auth_config() const {
     return pimpl_->auth;
@@ -597,6 +1119,25 @@ const PoolingConfig& Client::get_pooling_config() const {
     return pimpl_->pooling;
 }
 
+const AsyncConfig& Client::get_async_config() const {
+    return pimpl_->async;
+}
+
+const QueryCacheConfig& Client::get_query_cache_config() const {
+    return pimpl_->query_cache;
+}
+
+const HedgeConfig& Client::get_hedge_config() const {
+    return pimpl_->hedge;
+}
+
+std::chrono::milliseconds Client::hedge_delay() const {
+    if (!pimpl_->hedge_latency) {
+        return std::chrono::milliseconds(0);
+    }
+    return std::chrono::duration_cast<std::chrono::milliseconds>(pimpl_->hedge_latency->threshold());
+}
+
 bool Client::is_configured() const {
     // Pooled clients are configured if they have a valid pool
     if (pimpl_->pool) {
@@ -623,21 +1164,98 @@ std::future<void> Client::connect_async() {
         return pimpl_->pool->warm_up_async();
     }
 
-    // Non-pooled clients: async connect
+    // Non-pooled clients: connect on the executor; queries that start first
+    // connect themselves and this task then finds the connection open
     auto impl_ptr = pimpl_.get();
+    return impl_ptr->get_executor().submit([impl_ptr, context = internal::capture_context()]() {
+        internal::ResumeContext resume(context);
+        impl_ptr->connect();
+    });
+}
 
-    pimpl_->async_connect_future = std::async(std::launch::async, [impl_ptr]() { impl_ptr->connect(); });
+std::future<std::vector<std::vector<std::string>>> Client::query_async(const std::string& sql,
+                                                                       const std::vector<Parameter>& params) {
+    return pimpl_->get_executor().submit([this, sql, params, context = internal::capture_context()]() {
+        internal::ResumeContext resume(context);
+        return this->query(sql, params);
+    });
+}
 
-    return std::async(std::launch::deferred, [impl_ptr]() {
-        if (impl_ptr->async_connect_future.valid()) {
-            impl_ptr->async_connect_future.wait();
+namespace {
+// The options left for a query that waited on the executor since submitted: queued time counts against the timeout
+QueryOptions remaining_after_queue(const QueryOptions& options, std::chrono::steady_clock::time_point submitted) {
+    QueryOptions remaining = options;
+    if (options.timeout.count() > 0) {
+        auto queued =
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - submitted);
+        if (queued >= options.timeout) {
+            throw CancelledError("Query timed out after " + std::to_string(options.timeout.count()) +
+                                     "ms waiting for an async worker",
+                                 {}, true);
         }
+        remaining.timeout -= queued;
+    }
+    return remaining;
+}
+} // namespace
+
+std::future<std::vector<std::vector<std::string>>>
+Client::query_async(const std::string& sql, const std::vector<Parameter>& params, const QueryOptions& options) {
+    const auto submitted = std::chrono::steady_clock::now();
+    return pimpl_->get_executor().submit([this, sql, params, options, submitted,
+                                          context = internal::capture_context()]() {
+        internal::ResumeContext resume(context);
+        return this->query(sql, params, remaining_after_queue(options, submitted));
     });
 }
 
-std::future<std::vector<std::vector<std::string>>> Client::query_async(const std::string& sql,
-                                                                       const std::vector<Parameter>& params) {
-    return std::async(std::launch::async, [this, sql, params]() { return this->query(sql, params); });
+#ifdef DATABRICKS_ENABLE_COROUTINES
+Awaitable<std::vector<std::vector<std::string>>> Client::co_query(const std::string& sql,
+                                                                  const std::vector<Parameter>& params) {
+    using Rows = std::vector<std::vector<std::string>>;
+    return Awaitable<Rows>([this, sql, params](Awaitable<Rows>::Completion done) {
+        pimpl_->get_executor().post([this, sql, params, done, context = internal::capture_context()]() mutable {
+            internal::ResumeContext resume(context);
+            Rows rows;
+            try {
+                rows = query(sql, params);
+            } catch (...) {
+                done.set_error(std::current_exception());
+                return;
+            }
+            done.set_value(std::move(rows));
+        });
+    });
+}
+
+Awaitable<std::vector<std::vector<std::string>>>
+Client::co_query(const std::string& sql, const std::vector<Parameter>& params, const QueryOptions& options) {
+    using Rows = std::vector<std::vector<std::string>>;
+    return Awaitable<Rows>([this, sql, params, options](Awaitable<Rows>::Completion done) {
+        const auto submitted = std::chrono::steady_clock::now();
+        pimpl_->get_executor().post(
+            [this, sql, params, options, submitted, done, context = internal::capture_context()]() mutable {
+                internal::ResumeContext resume(context);
+                Rows rows;
+                try {
+                    rows = query(sql, params, remaining_after_queue(options, submitted));
+                } catch (...) {
+                    done.set_error(std::current_exception());
+                    return;
+                }
+                done.set_value(std::move(rows));
+            });
+    });
+}
+#endif
+
+bool Client::cancel() {
+    std::lock_guard<std::mutex> lock(pimpl_->active_mutex);
+    if (pimpl_->active_stmt == SQL_NULL_HSTMT) {
+        return false;
+    }
+    DATABRICKS_LOG_DEBUG("Canceling the executing statement");
+    return SQL_SUCCEEDED(SQLCancel(pimpl_->active_stmt));
 }
 
 void Client::disconnect() {
@@ -649,134 +1267,469 @@ void Client::disconnect() {
     pimpl_->disconnect();
 }
 
+bool Client::is_healthy(bool round_trip) {
+    if (pimpl_->pool) {
+        try {
+            auto pooled_conn = pimpl_->pool->acquire();
+            return pooled_conn->is_healthy(round_trip);
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+
+    return pimpl_->is_healthy(round_trip);
+}
+
 std::vector<std::vector<std::string>> Client::query(const std::string& sql, const std::vector<Parameter>& params) {
+    internal::Span span("Client::query");
     // Log query execution
-    if (internal::get_logger()->should_log(spdlog::level::debug)) {
-        std::string query_preview = sql.length() > 100 ? sql.substr(0, 100) + "..." : sql;
-        internal::get_logger()->debug("Executing query: {} (params: {})", query_preview, params.size());
+    DATABRICKS_LOG_DEBUG("Executing query: {:.100}{} (params: {})", sql, sql.size() > 100 ? "..." : "", params.size());
+
+    if (pimpl_->results && pimpl_->query_cache.cache_reads) {
+        const std::string normalized = internal::normalize_sql(sql);
+        if (internal::is_read_only_sql(normalized)) {
+            return pimpl_->cached_query(sql, normalized, params, std::chrono::milliseconds(pimpl_->query_cache.ttl_ms));
+        }
+    }
+    return pimpl_->run_query(sql, params);
+}
+
+std::vector<std::vector<std::string>> Client::query(const std::string& sql, const std::vector<Parameter>& params,
+                                                    const QueryOptions& options) {
+    internal::Span span("Client::query");
+    DATABRICKS_LOG_DEBUG("Executing query: {:.100}{} (params: {}, timeout: {}ms)", sql, sql.size() > 100 ? "..." : "",
+                         params.size(), options.timeout.count());
+    internal::CancelScope scope(options);
+    return pimpl_->run_query(sql, params, &scope);
+}
+
+std::vector<std::vector<std::string>> Client::query_cached(const std::string& sql,
+                                                           const std::vector<Parameter>& params,
+                                                           std::chrono::milliseconds ttl) {
+    internal::Span span("Client::query_cached");
+    if (!pimpl_->results) {
+        return pimpl_->run_query(sql, params);
+    }
+    if (ttl.count() <= 0) {
+        ttl = std::chrono::milliseconds(pimpl_->query_cache.ttl_ms);
+    }
+    return pimpl_->cached_query(sql, internal::normalize_sql(sql), params, ttl);
+}
+
+void Client::invalidate_query_cache() {
+    if (pimpl_->results) {
+        pimpl_->results->clear();
     }
+}
 
+CacheStats Client::query_cache_stats() const {
+    return pimpl_->results ? pimpl_->results->stats() : CacheStats{};
+}
+
+std::vector<std::vector<std::string>> Client::Impl::run_query(const std::string& sql,
+                                                              const std::vector<Parameter>& params,
+                                                              internal::CancelScope* scope) {
     // If pooling is enabled, acquire connection from pool and execute
-    if (pimpl_->pool) {
-        internal::get_logger()->debug("Using connection pool for query");
-        // Wrap pooled query with retry logic
-        return pimpl_->execute_with_retry(
-            [&]() {
-                auto pooled_conn = pimpl_->pool->acquire();
-                return pooled_conn->query(sql, params);
-                // Connection automatically returns to pool when pooled_conn goes out of scope
-            },
-            "query");
+    if (pool) {
+        DATABRICKS_LOG_DEBUG("Using connection pool for query");
+        if (scope) {
+            // The pooled connection enforces what is left of the timeout on its own statement
+            auto pooled_conn = acquire_within(*scope);
+            return use_pooled(pooled_conn, [&](Client& conn) { return conn.query(sql, params, scope->remaining()); });
+        }
+        // Pooled connections carry this client's RetryConfig, so only acquiring is retried here
+        auto pooled_conn = execute_with_retry([&]() { return pool->acquire(); }, "acquire");
+        if (hedge_latency && internal::is_read_only_sql(internal::normalize_sql(sql))) {
+            return hedged_query(std::move(pooled_conn), sql, params);
+        }
+        return use_pooled(pooled_conn, [&](Client& conn) { return conn.query(sql, params); });
+        // Connection automatically returns to pool (or is closed, if lost) when pooled_conn goes out of scope
     }
 
     // Non-pooled path: use dedicated connection with retry logic
-    return pimpl_->execute_with_retry(
-        [&]() -> std::vector<std::vector<std::string>> {
-            // Ensure connected (lazy connection or wait for async)
-            pimpl_->ensure_connected();
+    return execute_with_retry(
+        [&]() {
+            return cancellable(scope, [&]() -> std::vector<std::vector<std::string>> {
+                // Ensure connected (lazy connection or wait for async)
+                ensure_connected();
+
+                internal::StatementHandle stmt = execute_statement(sql, params, scope);
+                internal::CancelScope::Attachment cancel_on(scope, stmt.get());
+                internal::Span fetch_span("Client::fetch");
+                internal::ScopedTimer fetch_timer(MetricTimer::QueryFetch);
+                auto rows = internal::fetch_all_strings(stmt.get(), this->sql.fetch_batch_rows,
+                                                        this->sql.max_column_buffer_bytes, bound_rereads, scope);
+                fetch_timer.stop();
+                fetch_span.set_attribute("db.rows", static_cast<int64_t>(rows.size()));
+                fetch_span.end();
+
+                DATABRICKS_LOG_DEBUG("Query completed successfully, {} rows returned", rows.size());
+                return rows;
+            });
+        },
+        "query");
+}
 
-            SQLHSTMT hstmt = SQL_NULL_HSTMT;
-            SQLRETURN ret;
+namespace {
+/**
+ * @brief State shared by the two copies of a hedged query and the caller waiting on them
+ */
+struct HedgeRace {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool done = false;                          // The caller may return
+    bool answered = false;                      // A copy succeeded; rows and winner are set
+    size_t running = 0;                         // Copies started and not yet finished
+    size_t winner = 0;                          // Copy whose rows were kept (0 = primary, 1 = hedge)
+    std::vector<std::vector<std::string>> rows; // Result of the winning copy
+    std::exception_ptr error;                   // First failure, reported if no copy succeeds
+    std::array<CancellationToken, 2> cancel;    // Stops each copy while executing or fetching, once it has lost
+    std::thread hedge;                          // Runs the second copy, once sent; joined by the caller
+};
 
-            // Allocate statement handle
-            ret = SQLAllocHandle(SQL_HANDLE_STMT, pimpl_->hdbc, &hstmt);
-            if (!SQL_SUCCEEDED(ret)) {
-                throw std::runtime_error("Failed to allocate statement handle");
-            }
+/**
+ * @brief Run one copy of a hedged query and settle the race if it is the first to answer
+ *
+ * The copy runs under its own cancellation token, so the winner stops it
+ * whether it is still executing or already fetching. A copy that loses its
+ * connection marks it for the pool to close rather than reuse.
+ */
+void run_hedge_copy(const std::shared_ptr<HedgeRace>& race, size_t copy, ConnectionPool::PooledConnection& connection,
+                    const std::string& sql, const std::vector<Client::Parameter>& params) {
+    {
+        std::lock_guard<std::mutex> lock(race->mutex);
+        if (race->done) {
+            // Answered before this copy started
+            race->running--;
+            return;
+        }
+    }
+
+    QueryOptions options;
+    options.cancel = race->cancel[copy];
+    std::vector<std::vector<std::string>> rows;
+    std::exception_ptr error;
+    try {
+        rows = connection->query(sql, params, options);
+    } catch (const SqlError& e) {
+        if (e.category() == ErrorCategory::Connection) {
+            connection.invalidate();
+        }
+        error = std::current_exception();
+    } catch (...) {
+        error = std::current_exception();
+    }
 
-            // Choose execution path based on whether parameters are provided
-            if (params.empty()) {
-                // Static query - use direct execution for better performance
-                ret = SQLExecDirect(hstmt, (SQLCHAR*)sql.c_str(), SQL_NTS);
-                if (!SQL_SUCCEEDED(ret)) {
-                    std::string error = pimpl_->get_odbc_error(SQL_HANDLE_STMT, hstmt);
-                    SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
-                    throw std::runtime_error("Query execution failed: " + error);
+    std::lock_guard<std::mutex> lock(race->mutex);
+    race->running--;
+    if (race->done) {
+        return; // Lost (and most likely canceled)
+    }
+    if (!error) {
+        race->done = true;
+        race->answered = true;
+        race->winner = copy;
+        race->rows = std::move(rows);
+        race->cancel[1 - copy].cancel();
+    } else {
+        if (!race->error) {
+            race->error = error;
+        }
+        race->done = race->running == 0;
+    }
+    race->cv.notify_all();
+}
+} // namespace
+
+std::vector<std::vector<std::string>> Client::Impl::hedged_query(ConnectionPool::PooledConnection primary,
+                                                                 const std::string& sql,
+                                                                 const std::vector<Parameter>& params) {
+    internal::add_metric(MetricCounter::HedgeableQueries, 1);
+    const auto started = std::chrono::steady_clock::now();
+    auto race = std::make_shared<HedgeRace>();
+    race->running = 1;
+
+    // The primary runs on this thread, which may be a query_async worker, so the hedge must not need one: if
+    // the primary is still running at the threshold, the timer starts a thread for the second copy, unless the
+    // pool would make it wait (a busy pool gains nothing)
+    auto send_hedge = [race, pool = pool, sql, params, context = internal::capture_context()]() {
+        std::lock_guard<std::mutex> lock(race->mutex);
+        if (race->done) {
+            return;
+        }
+        race->running++;
+        try {
+            race->hedge = std::thread([race, pool, sql, params, context]() {
+                internal::ResumeContext resume(context);
+                std::optional<ConnectionPool::PooledConnection> second;
+                try {
+                    second = pool->try_acquire(std::chrono::steady_clock::now());
+                } catch (const std::exception& e) {
+                    DATABRICKS_LOG_WARN("Not hedging query: {}", e.what());
                 }
-            } else {
-                // Parameterized query - use prepared statement for security
-                ret = SQLPrepare(hstmt, (SQLCHAR*)sql.c_str(), SQL_NTS);
-                if (!SQL_SUCCEEDED(ret)) {
-                    std::string error = pimpl_->get_odbc_error(SQL_HANDLE_STMT, hstmt);
-                    SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
-                    throw std::runtime_error("Failed to prepare statement: " + error);
+                if (!second) {
+                    std::lock_guard<std::mutex> lock(race->mutex);
+                    race->running--;
+                    race->done = race->done || race->running == 0;
+                    race->cv.notify_all();
+                    return;
                 }
+                internal::add_metric(MetricCounter::HedgedQueries, 1);
+                run_hedge_copy(race, 1, *second, sql, params);
+            });
+        } catch (const std::system_error& e) {
+            DATABRICKS_LOG_WARN("Not hedging query: {}", e.what());
+            race->running--;
+        }
+    };
+    internal::TimerQueue& timers = internal::TimerQueue::instance();
+    const uint64_t timer = timers.schedule(started + hedge_latency->threshold(), std::move(send_hedge));
+
+    run_hedge_copy(race, 0, primary, sql, params);
+    timers.cancel(timer);
+
+    std::unique_lock<std::mutex> lock(race->mutex);
+    race->cv.wait(lock, [&] { return race->done; });
+    std::thread hedge = std::move(race->hedge);
+    lock.unlock();
+    if (hedge.joinable()) {
+        // Already answered or failed; a losing copy was cancelled and stops by its next block at the latest
+        hedge.join();
+    }
 
-                // Bind parameters - store values to prevent dangling pointers
-                std::vector<std::string> param_storage;
-                std::vector<SQLLEN> param_indicators;
-                param_storage.reserve(params.size());
-                param_indicators.resize(params.size());
-
-                for (size_t i = 0; i < params.size(); i++) {
-                    param_storage.push_back(params[i].value);
-                    param_indicators[i] = param_storage[i].length();
-
-                    ret = SQLBindParameter(hstmt,
-                                           static_cast<SQLUSMALLINT>(i + 1),     // Parameter number (1-based)
-                                           SQL_PARAM_INPUT,                      // Input parameter
-                                           params[i].c_type,                     // C data type
-                                           params[i].sql_type,                   // SQL data type
-                                           param_storage[i].length(),            // Column size
-                                           0,                                    // Decimal digits
-                                           (SQLPOINTER)param_storage[i].c_str(), // Parameter value pointer
-                                           param_storage[i].length(),            // Buffer length
-                                           &param_indicators[i]                  // Length/indicator
-                    );
-
-                    if (!SQL_SUCCEEDED(ret)) {
-                        std::string error = pimpl_->get_odbc_error(SQL_HANDLE_STMT, hstmt);
-                        SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
-                        throw std::runtime_error("Failed to bind parameter " + std::to_string(i + 1) + ": " + error);
-                    }
-                }
+    if (!race->answered) {
+        std::rethrow_exception(race->error);
+    }
+    if (race->winner == 1) {
+        internal::add_metric(MetricCounter::HedgeWins, 1);
+    }
+    hedge_latency->record(std::chrono::steady_clock::now() - started);
+    return std::move(race->rows);
+}
 
-                // Execute the prepared statement
-                ret = SQLExecute(hstmt);
-                if (!SQL_SUCCEEDED(ret)) {
-                    std::string error = pimpl_->get_odbc_error(SQL_HANDLE_STMT, hstmt);
-                    SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
-                    throw std::runtime_error("Query execution failed: " + error);
-                }
-            }
+void Client::query_columnar(const std::string& sql, const std::vector<Parameter>& params,
+                            const std::function<void(const ColumnarBatch&)>& on_batch) {
+    DATABRICKS_LOG_DEBUG("Executing columnar query: {:.100}{} (params: {})", sql, sql.size() > 100 ? "..." : "",
+                         params.size());
 
-            // Get column count
-            SQLSMALLINT colCount = 0;
-            ret = SQLNumResultCols(hstmt, &colCount);
-            if (!SQL_SUCCEEDED(ret)) {
-                SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
-                throw std::runtime_error("Failed to get column count");
-            }
+    if (pimpl_->pool) {
+        DATABRICKS_LOG_DEBUG("Using connection pool for columnar query");
+        auto pooled_conn = pimpl_->execute_with_retry([&]() { return pimpl_->pool->acquire(); }, "acquire");
+        Impl::use_pooled(pooled_conn, [&](Client& conn) { conn.query_columnar(sql, params, on_batch); });
+        return;
+    }
 
-            // Fetch results
-            std::vector<std::vector<std::string>> results;
+    internal::StatementHandle stmt = pimpl_->open_statement(sql, params);
+    internal::BlockFetcher fetcher(stmt.get(), pimpl_->sql.fetch_batch_rows, pimpl_->sql.max_column_buffer_bytes,
+                                   pimpl_->bound_rereads);
+    ColumnarBatch batch;
+    size_t total_rows = 0;
+    internal::FetchTimer fetch_timer;
+
+    if (pimpl_->sql.prefetch_blocks > 0) {
+        // Destroyed (stopping its thread) before fetcher and stmt, also when on_batch throws
+        internal::BlockPrefetcher prefetcher([&fetcher](ColumnarBatch& block) { return fetcher.fetch_next(block); },
+                                             fetcher.schema(), pimpl_->sql.prefetch_blocks);
+        while (fetch_timer.measure([&]() { return prefetcher.next(batch); })) {
+            total_rows += batch.num_rows();
+            on_batch(batch);
+        }
+    } else {
+        while (fetch_timer.measure([&]() { return fetcher.fetch_next(batch); })) {
+            total_rows += batch.num_rows();
+            on_batch(batch);
+        }
+    }
 
-            while (SQLFetch(hstmt) == SQL_SUCCESS) {
-                std::vector<std::string> row;
+    DATABRICKS_LOG_DEBUG("Columnar query completed successfully, {} rows returned", total_rows);
+}
 
-                for (SQLSMALLINT i = 1; i <= colCount; i++) {
-                    SQLCHAR buffer[4096];
-                    SQLLEN indicator;
+void Client::query_typed(const std::string& sql, const std::vector<Parameter>& params,
+                         const std::function<void(const TypedBatch&)>& on_batch) {
+    DATABRICKS_LOG_DEBUG("Executing typed query: {:.100}{} (params: {})", sql, sql.size() > 100 ? "..." : "",
+                         params.size());
 
-                    ret = SQLGetData(hstmt, i, SQL_C_CHAR, buffer, sizeof(buffer), &indicator);
+    if (pimpl_->pool) {
+        DATABRICKS_LOG_DEBUG("Using connection pool for typed query");
+        auto pooled_conn = pimpl_->execute_with_retry([&]() { return pimpl_->pool->acquire(); }, "acquire");
+        Impl::use_pooled(pooled_conn, [&](Client& conn) { conn.query_typed(sql, params, on_batch); });
+        return;
+    }
 
-                    if (indicator == SQL_NULL_DATA) {
-                        row.push_back("");
-                    } else if (SQL_SUCCEEDED(ret)) {
-                        row.push_back(std::string((char*)buffer));
-                    } else {
-                        row.push_back("");
-                    }
-                }
+    internal::StatementHandle stmt = pimpl_->open_statement(sql, params);
+    internal::TypedFetcher fetcher(stmt.get(), pimpl_->sql.fetch_batch_rows, pimpl_->sql.max_column_buffer_bytes,
+                                   pimpl_->bound_rereads);
+    TypedBatch batch;
+    size_t total_rows = 0;
+    internal::FetchTimer fetch_timer;
+
+    while (fetch_timer.measure([&]() { return fetcher.fetch_next(batch); })) {
+        total_rows += batch.num_rows();
+        on_batch(batch);
+    }
+
+    DATABRICKS_LOG_DEBUG("Typed query completed successfully, {} rows returned", total_rows);
+}
+
+#ifdef DATABRICKS_ENABLE_ARROW
+void Client::query_arrow(const std::string& sql, const std::vector<Parameter>& params,
+                         const std::function<void(const std::shared_ptr<arrow::RecordBatch>&)>& on_batch) {
+    // Every block of a result has the same columns, so map them once
+    std::shared_ptr<arrow::Schema> schema;
+    query_typed(sql, params, [&](const TypedBatch& batch) {
+        std::shared_ptr<arrow::RecordBatch> record_batch = to_record_batch(batch, schema);
+        schema = record_batch->schema();
+        on_batch(record_batch);
+    });
+}
+
+std::vector<std::shared_ptr<arrow::RecordBatch>> Client::query_arrow(const std::string& sql,
+                                                                     const std::vector<Parameter>& params) {
+    std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+    query_arrow(sql, params, [&](const std::shared_ptr<arrow::RecordBatch>& batch) { batches.push_back(batch); });
+    return batches;
+}
+#endif
+
+ResultSet Client::query_result(const std::string& sql, const std::vector<Parameter>& params,
+                               std::pmr::memory_resource* resource) {
+    DATABRICKS_LOG_DEBUG("Executing query into result set: {:.100}{} (params: {})", sql, sql.size() > 100 ? "..." : "",
+                         params.size());
+
+    if (pimpl_->pool) {
+        DATABRICKS_LOG_DEBUG("Using connection pool for result set query");
+        auto pooled_conn = pimpl_->execute_with_retry([&]() { return pimpl_->pool->acquire(); }, "acquire");
+        return Impl::use_pooled(pooled_conn, [&](Client& conn) { return conn.query_result(sql, params, resource); });
+    }
+
+    internal::StatementHandle stmt = pimpl_->open_statement(sql, params);
+    internal::BlockFetcher fetcher(stmt.get(), pimpl_->sql.fetch_batch_rows, pimpl_->sql.max_column_buffer_bytes,
+                                   pimpl_->bound_rereads);
+    ResultSet result(resource);
+    result.reset(fetcher.schema());
+    ColumnarBatch batch;
+    internal::FetchTimer fetch_timer;
+
+    while (fetch_timer.measure([&]() { return fetcher.fetch_next(batch); })) {
+        result.append(batch);
+    }
+
+    DATABRICKS_LOG_DEBUG("Result set query completed successfully, {} rows returned", result.num_rows());
+    return result;
+}
+
+SpillableResult Client::query_spillable(const std::string& sql, const std::vector<Parameter>& params,
+                                        const SpillConfig& spill) {
+    DATABRICKS_LOG_DEBUG("Executing spillable query: {:.100}{} (params: {})", sql, sql.size() > 100 ? "..." : "",
+                         params.size());
+
+    if (pimpl_->pool) {
+        DATABRICKS_LOG_DEBUG("Using connection pool for spillable query");
+        auto pooled_conn = pimpl_->execute_with_retry([&]() { return pimpl_->pool->acquire(); }, "acquire");
+        return Impl::use_pooled(pooled_conn, [&](Client& conn) { return conn.query_spillable(sql, params, spill); });
+    }
+
+    internal::StatementHandle stmt = pimpl_->open_statement(sql, params);
+    internal::BlockFetcher fetcher(stmt.get(), pimpl_->sql.fetch_batch_rows, pimpl_->sql.max_column_buffer_bytes,
+                                   pimpl_->bound_rereads);
+    SpillableResult result(fetcher.schema(), spill);
+    ColumnarBatch batch;
+    internal::FetchTimer fetch_timer;
+
+    while (fetch_timer.measure([&]() { return fetcher.fetch_next(batch); })) {
+        result.append(batch);
+    }
+    result.seal();
+
+    DATABRICKS_LOG_DEBUG("Spillable query completed successfully, {} rows returned ({} bytes spilled)",
+                         result.num_rows(), result.spilled_bytes());
+    return result;
+}
+
+Cursor Client::execute_cursor(const std::string& sql, const std::vector<Parameter>& params) {
+    DATABRICKS_LOG_DEBUG("Opening cursor: {:.100}{} (params: {})", sql, sql.size() > 100 ? "..." : "", params.size());
+
+    if (pimpl_->pool) {
+        DATABRICKS_LOG_DEBUG("Using connection pool for cursor");
+        auto pooled_conn = pimpl_->execute_with_retry([&]() { return pimpl_->pool->acquire(); }, "acquire");
+        Cursor cursor = Impl::use_pooled(pooled_conn, [&](Client& conn) { return conn.execute_cursor(sql, params); });
+        // Keep the connection checked out for as long as the cursor is alive
+        cursor.pimpl_->connection = std::make_unique<ConnectionPool::PooledConnection>(std::move(pooled_conn));
+        return cursor;
+    }
 
-                results.push_back(row);
+    internal::StatementHandle stmt = pimpl_->open_statement(sql, params);
+    return Cursor(std::make_unique<Cursor::Impl>(std::move(stmt), pimpl_->sql.fetch_batch_rows,
+                                                 pimpl_->sql.max_column_buffer_bytes, pimpl_->bound_rereads,
+                                                 pimpl_->sql.prefetch_blocks));
+}
+
+Cursor Client::execute_cursor(const std::string& sql, const std::vector<Parameter>& params,
+                              const QueryOptions& options) {
+    DATABRICKS_LOG_DEBUG("Opening cursor: {:.100}{} (params: {}, timeout: {}ms)", sql, sql.size() > 100 ? "..." : "",
+                         params.size(), options.timeout.count());
+    auto scope = std::make_unique<internal::CancelScope>(options);
+
+    if (pimpl_->pool) {
+        auto pooled_conn = pimpl_->acquire_within(*scope);
+        Cursor cursor = Impl::use_pooled(
+            pooled_conn, [&](Client& conn) { return conn.execute_cursor(sql, params, scope->remaining()); });
+        cursor.pimpl_->connection = std::make_unique<ConnectionPool::PooledConnection>(std::move(pooled_conn));
+        return cursor;
+    }
+
+    internal::StatementHandle stmt = pimpl_->open_statement(sql, params, scope.get());
+    Cursor cursor(std::make_unique<Cursor::Impl>(std::move(stmt), pimpl_->sql.fetch_batch_rows,
+                                                 pimpl_->sql.max_column_buffer_bytes, pimpl_->bound_rereads,
+                                                 pimpl_->sql.prefetch_blocks));
+    // Stays attached while the caller fetches
+    cursor.pimpl_->scope = std::move(scope);
+    cursor.pimpl_->cancel_on.emplace(cursor.pimpl_->scope.get(), cursor.pimpl_->stmt.get());
+    return cursor;
+}
+
+Client::BatchResult Client::execute_batch(const std::string& sql, const std::vector<std::vector<Parameter>>& rows) {
+    if (rows.empty() || rows[0].empty()) {
+        throw std::invalid_argument("execute_batch requires at least one row with at least one parameter");
+    }
+    for (size_t i = 1; i < rows.size(); i++) {
+        if (rows[i].size() != rows[0].size()) {
+            throw std::invalid_argument("execute_batch row " + std::to_string(i) + " has " +
+                                        std::to_string(rows[i].size()) + " parameters, expected " +
+                                        std::to_string(rows[0].size()));
+        }
+        for (size_t col = 0; col < rows[0].size(); col++) {
+            if (rows[i][col].c_type != rows[0][col].c_type || rows[i][col].sql_type != rows[0][col].sql_type) {
+                throw std::invalid_argument("execute_batch parameter " + std::to_string(col + 1) + " in row " +
+                                            std::to_string(i) + " has a different type than in row 0");
             }
+        }
+    }
 
-            SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
-            internal::get_logger()->info("Query completed successfully, {} rows returned", results.size());
-            return results;
-        },
-        "query");
+    DATABRICKS_LOG_DEBUG("Executing batch: {:.100}{} (rows: {})", sql, sql.size() > 100 ? "..." : "", rows.size());
+
+    if (pimpl_->pool) {
+        DATABRICKS_LOG_DEBUG("Using connection pool for batch");
+        auto pooled_conn = pimpl_->execute_with_retry([&]() { return pimpl_->pool->acquire(); }, "acquire");
+        return Impl::use_pooled(pooled_conn, [&](Client& conn) { return conn.execute_batch(sql, rows); });
+    }
+
+    BatchResult result;
+    result.row_status.assign(rows.size(), BatchResult::RowStatus::NotExecuted);
+    const size_t chunk_rows = pimpl_->sql.batch_chunk_rows;
+
+    for (size_t begin = 0; begin < rows.size(); begin += chunk_rows) {
+        size_t count = std::min(chunk_rows, rows.size() - begin);
+        pimpl_->execute_with_retry(
+            [&]() {
+                pimpl_->ensure_connected();
+                pimpl_->execute_batch_chunk(sql, rows, begin, count, result);
+            },
+            "batch");
+    }
+
+    DATABRICKS_LOG_DEBUG("Batch completed, {} of {} rows succeeded", result.success_count(), rows.size());
+    return result;
 }
 
 } // namespace databricks
@@ -3,10 +3,9 @@
 #include "databricks/core/config.h"
 
 #include "../internal/logger.h"
+#include "../internal/profile_file.h"
 
 #include <cstdlib>
-#include <fstream>
-#include <sstream>
 #include <stdexcept>
 #include <vector>
 
@@ -14,66 +13,22 @@ namespace databricks {
 // ========== AuthConfig Implementation ==========
 
 AuthConfig AuthConfig::from_profile(const std::string& profile) {
-    const char* home = std::getenv("HOME");
-    if (!home) {
-        throw std::runtime_error("HOME environment variable not set");
-    }
-
-    std::ifstream file(std::string(home) + "/.databrickscfg");
-    if (!file.is_open()) {
+    // Parsed once per modification of the file and shared by every caller
+    auto file = internal::load_profile_file(internal::default_profile_path());
+    if (!file) {
         throw std::runtime_error("Could not open ~/.databrickscfg");
     }
 
-    AuthConfig config;
-    std::string line;
-    bool in_profile = false;
-    bool found_host = false, found_token = false;
-
-    while (std::getline(file, line)) {
-        // Trim whitespace
-        auto start = line.find_first_not_of(" \t");
-        if (start == std::string::npos)
-            continue;
-        auto end = line.find_last_not_of(" \t");
-        line = line.substr(start, end - start + 1);
-
-        if (line.empty() || line[0] == '#')
-            continue;
-
-        if (line.front() == '[' && line.back() == ']') {
-            in_profile = (line.substr(1, line.size() - 2) == profile);
-            continue;
-        }
-
-        if (!in_profile)
-            continue;
-
-        auto pos = line.find('=');
-        if (pos == std::string::npos)
-            continue;
-
-        std::string key = line.substr(0, pos);
-        std::string value = line.substr(pos + 1);
-
-        // Trim key/value
-        key.erase(0, key.find_first_not_of(" \t"));
-        key.erase(key.find_last_not_of(" \t") + 1);
-        value.erase(0, value.find_first_not_of(" \t"));
-        value.erase(value.find_last_not_of(" \t") + 1);
-
-        if (key == "host") {
-            config.host = value;
-            found_host = true;
-        } else if (key == "token") {
-            config.set_token(value);
-            found_token = true;
-        }
-    }
-
-    if (!found_host || !found_token) {
+    auto host = file->value(profile, "host");
+    auto token = file->value(profile, "token");
+    if (!host || !token) {
         throw std::runtime_error("Profile [" + profile + "] missing required fields (host, token)");
     }
 
+    AuthConfig config;
+    config.host = *host;
+    config.set_token(*token);
+    internal::secure_zero_string(*token);
     return config;
 }
 
@@ -115,12 +70,12 @@ AuthConfig AuthConfig::from_environment(const std::string& profile) {
         return from_profile(profile);
     } catch (const std::runtime_error& e) {
         std::string error_msg = std::string("Profile loading failed: ") + e.what();
-        internal::get_logger()->debug(error_msg);
+        DATABRICKS_LOG_DEBUG(error_msg);
         errors.push_back(error_msg);
         // Continue to fallback
     } catch (const std::exception& e) {
         std::string error_msg = std::string("Unexpected error loading profile: ") + e.what();
-        internal::get_logger()->warn(error_msg);
+        DATABRICKS_LOG_WARN(error_msg);
         errors.push_back(error_msg);
         // Continue to fallback
     }
@@ -130,11 +85,11 @@ AuthConfig AuthConfig::from_environment(const std::string& profile) {
         return from_env();
     } catch (const std::runtime_error& e) {
         std::string error_msg = std::string("Environment variable loading failed: ") + e.what();
-        internal::get_logger()->debug(error_msg);
+        DATABRICKS_LOG_DEBUG(error_msg);
         errors.push_back(error_msg);
     } catch (const std::exception& e) {
         std::string error_msg = std::string("Unexpected error loading environment: ") + e.what();
-        internal::get_logger()->warn(error_msg);
+        DATABRICKS_LOG_WARN(error_msg);
         errors.push_back(error_msg);
     }
 
@@ -151,7 +106,7 @@ AuthConfig AuthConfig::from_environment(const std::string& profile) {
         combined_error += "  " + std::to_string(i + 1) + ". " + errors[i] + "\n";
     }
 
-    internal::get_logger()->error(combined_error);
+    DATABRICKS_LOG_ERROR(combined_error);
     throw std::runtime_error(combined_error);
 }
 
@@ -162,20 +117,78 @@ bool AuthConfig::is_valid() const {
 // ========== SQLConfig Implementation ==========
 
 bool SQLConfig::is_valid() const {
-    return !http_path.empty() && !odbc_driver_name.empty();
+    return !http_path.empty() && !odbc_driver_name.empty() && fetch_batch_rows > 0 && max_column_buffer_bytes > 0 &&
+           batch_chunk_rows > 0;
 }
 
 // ========== PoolingConfig Implementation ==========
 
 bool PoolingConfig::is_valid() const {
-    return min_connections > 0 && max_connections >= min_connections && connection_timeout_ms > 0;
+    return min_connections > 0 && max_connections >= min_connections && connection_timeout_ms > 0 &&
+           idle_timeout_ms >= 0 && max_lifetime_ms >= 0 && validation_idle_ms >= 0 && maintenance_interval_ms >= 0;
 }
 
 // ========== RetryConfig Implementation ==========
 
 bool RetryConfig::is_valid() const {
     return max_attempts > 0 && initial_backoff_ms > 0 && backoff_multiplier > 0.0 &&
-           max_backoff_ms >= initial_backoff_ms;
+           max_backoff_ms >= initial_backoff_ms && (circuit_failure_threshold == 0 || circuit_open_ms > 0) &&
+           retry_budget_ratio >= 0.0;
+}
+
+// ========== AsyncConfig Implementation ==========
+
+bool AsyncConfig::is_valid() const {
+    return worker_threads > 0 && max_pending_tasks > 0;
+}
+
+// ========== HttpConfig Implementation ==========
+
+bool HttpConfig::is_valid() const {
+    return max_concurrent_requests > 0 && retry.is_valid() && requests_per_second >= 0.0 && burst > 0;
+}
+
+// ========== MetadataCacheConfig Implementation ==========
+
+bool MetadataCacheConfig::is_valid() const {
+    return ttl_ms > 0 && max_entries > 0 && shards > 0;
+}
+
+// ========== SecretCacheConfig Implementation ==========
+
+bool SecretCacheConfig::is_valid() const {
+    return ttl_ms > 0 && max_entries > 0 && shards > 0;
+}
+
+// ========== QueryCacheConfig Implementation ==========
+
+bool QueryCacheConfig::is_valid() const {
+    return ttl_ms > 0 && max_bytes > 0 && max_entries > 0 && shards > 0;
+}
+
+// ========== HedgeConfig Implementation ==========
+
+bool HedgeConfig::is_valid() const {
+    return percentile > 0.0 && percentile < 100.0 && initial_delay_ms > 0 && min_samples > 0;
+}
+
+// ========== RouterConfig Implementation ==========
+
+bool RouterConfig::is_valid() const {
+    return latency_smoothing > 0.0 && latency_smoothing <= 1.0 && error_smoothing > 0.0 && error_smoothing <= 1.0 &&
+           max_error_rate > 0.0 && max_error_rate <= 1.0 && drain_ms > 0;
+}
+
+// ========== PollConfig Implementation ==========
+
+bool PollConfig::is_valid() const {
+    return initial_interval_ms > 0 && max_interval_ms >= initial_interval_ms && backoff_multiplier >= 1.0;
+}
+
+// ========== IngestConfig Implementation ==========
+
+bool IngestConfig::is_valid() const {
+    return !staging_path.empty() && staging_path[0] == '/' && rows_per_file > 0 && max_concurrent_uploads > 0;
 }
 
 } // namespace databricks
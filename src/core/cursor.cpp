@@ -0,0 +1,120 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "databricks/core/cursor.h"
+
+#include "../internal/cursor_impl.h"
+
+#include <algorithm>
+
+namespace databricks {
+// ========== Cursor Implementation ==========
+
+Cursor::Cursor(std::unique_ptr<Impl> impl)
+    : pimpl_(std::move(impl)) {}
+
+Cursor::~Cursor() = default;
+
+Cursor::Cursor(Cursor&&) noexcept = default;
+Cursor& Cursor::operator=(Cursor&&) noexcept = default;
+
+const std::vector<ColumnMetadata>& Cursor::schema() const {
+    return pimpl_->fetcher->schema();
+}
+
+bool Cursor::ensure_row() {
+    while (pimpl_->position >= pimpl_->block.num_rows()) {
+        if (pimpl_->exhausted || !fetch_block()) {
+            pimpl_->exhausted = true;
+            return false;
+        }
+        pimpl_->position = 0;
+    }
+    return true;
+}
+
+bool Cursor::fetch_into(Impl& impl, ColumnarBatch& batch) {
+    internal::CancelScope* scope = impl.scope.get();
+    if (!scope) {
+        return impl.fetcher->fetch_next(batch);
+    }
+    scope->throw_if_fired();
+    try {
+        return impl.fetcher->fetch_next(batch);
+    } catch (const SqlError& e) {
+        if (scope->fired()) {
+            throw scope->cancelled_error(e.diagnostics());
+        }
+        throw;
+    }
+}
+
+bool Cursor::fetch_block() {
+    Impl& impl = *pimpl_;
+    if (impl.prefetch_blocks == 0) {
+        return fetch_into(impl, impl.block);
+    }
+    if (impl.scope) {
+        impl.scope->throw_if_fired();
+    }
+    if (!impl.prefetcher) {
+        // Started on first use, once the client has attached the connection and scope
+        impl.prefetcher = std::make_unique<internal::BlockPrefetcher>(
+            [&impl](ColumnarBatch& batch) { return fetch_into(impl, batch); }, impl.fetcher->schema(),
+            impl.prefetch_blocks);
+    }
+    return impl.prefetcher->next(impl.block);
+}
+
+bool Cursor::done() {
+    return !ensure_row();
+}
+
+std::vector<std::vector<std::string>> Cursor::next_batch(size_t max_rows) {
+    std::vector<std::vector<std::string>> rows;
+
+    while (rows.size() < max_rows && ensure_row()) {
+        const size_t available = pimpl_->block.num_rows() - pimpl_->position;
+        const size_t take = std::min(available, max_rows - rows.size());
+        rows.reserve(rows.size() + take);
+
+        for (size_t i = 0; i < take; ++i) {
+            rows.push_back(RowView(pimpl_->block, pimpl_->position + i).to_strings());
+        }
+        pimpl_->position += take;
+    }
+
+    return rows;
+}
+
+bool Cursor::next_result(ResultSet& out, size_t max_rows) {
+    out.reset(schema());
+
+    while (out.num_rows() < max_rows && ensure_row()) {
+        const size_t available = pimpl_->block.num_rows() - pimpl_->position;
+        const size_t take = std::min(available, max_rows - out.num_rows());
+        out.append(pimpl_->block, pimpl_->position, take);
+        pimpl_->position += take;
+    }
+
+    return out.num_rows() > 0;
+}
+
+Cursor::iterator Cursor::begin() {
+    return ensure_row() ? iterator(this) : iterator();
+}
+
+// ========== Cursor::iterator Implementation ==========
+
+RowView Cursor::iterator::operator*() const {
+    return RowView(cursor_->pimpl_->block, cursor_->pimpl_->position);
+}
+
+Cursor::iterator& Cursor::iterator::operator++() {
+    ++cursor_->pimpl_->position;
+    if (!cursor_->ensure_row()) {
+        cursor_ = nullptr;
+    }
+    return *this;
+}
+
+} // namespace databricks
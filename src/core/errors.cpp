@@ -0,0 +1,130 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "databricks/core/errors.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <string_view>
+#include <utility>
+
+namespace databricks {
+namespace {
+using StateEntry = std::pair<std::string_view, ErrorCategory>;
+
+// Exact SQLSTATEs whose class alone doesn't say enough; sorted for binary search
+constexpr std::array<StateEntry, 5> STATE_TABLE = {{
+    {"HY001", ErrorCategory::Resource}, // Memory allocation error
+    {"HY013", ErrorCategory::Resource}, // Memory management error
+    {"HY014", ErrorCategory::Resource}, // Limit on the number of handles exceeded
+    {"HYT00", ErrorCategory::Timeout},  // Timeout expired
+    {"HYT01", ErrorCategory::Timeout},  // Connection timeout expired
+}};
+
+// SQLSTATE classes (first two characters); sorted for binary search
+constexpr std::array<StateEntry, 11> CLASS_TABLE = {{
+    {"07", ErrorCategory::Query},          // Dynamic SQL error (parameter count, types)
+    {"08", ErrorCategory::Connection},     // Connection exception
+    {"21", ErrorCategory::Query},          // Cardinality violation
+    {"22", ErrorCategory::Query},          // Data exception
+    {"23", ErrorCategory::Query},          // Integrity constraint violation
+    {"24", ErrorCategory::Query},          // Invalid cursor state
+    {"25", ErrorCategory::Query},          // Invalid transaction state
+    {"28", ErrorCategory::Authentication}, // Invalid authorization specification
+    {"3D", ErrorCategory::Query},          // Invalid catalog name
+    {"3F", ErrorCategory::Query},          // Invalid schema name
+    {"42", ErrorCategory::Query},          // Syntax error, access violation, missing table or column
+}};
+
+template <size_t N> const StateEntry* lookup(const std::array<StateEntry, N>& table, std::string_view key) {
+    auto it = std::lower_bound(table.begin(), table.end(), key,
+                               [](const StateEntry& entry, std::string_view k) { return entry.first < k; });
+    return it != table.end() && it->first == key ? &*it : nullptr;
+}
+
+// HTTP status the driver reports for a failed request, 0 if the message names none. The
+// first three-digit number after "HTTP" counts, e.g. "HTTP Response code: 503".
+int http_status(std::string_view message) {
+    size_t pos = std::string_view::npos;
+    for (size_t i = 0; i + 4 <= message.size(); i++) {
+        if ((message[i] == 'H' || message[i] == 'h') && (message[i + 1] == 'T' || message[i + 1] == 't') &&
+            (message[i + 2] == 'T' || message[i + 2] == 't') && (message[i + 3] == 'P' || message[i + 3] == 'p')) {
+            pos = i + 4;
+            break;
+        }
+    }
+    if (pos == std::string_view::npos) {
+        return 0;
+    }
+
+    auto digit = [&](size_t i) { return i < message.size() && std::isdigit(static_cast<unsigned char>(message[i])); };
+    for (size_t i = pos; i < message.size(); i++) {
+        if (digit(i) && !digit(i - 1) && digit(i + 1) && digit(i + 2) && !digit(i + 3)) {
+            return (message[i] - '0') * 100 + (message[i + 1] - '0') * 10 + (message[i + 2] - '0');
+        }
+    }
+    return 0;
+}
+
+bool is_transient_http_status(int status) {
+    return status == 429 || status == 502 || status == 503 || status == 504;
+}
+
+const DiagnosticRecord EMPTY_RECORD{};
+} // namespace
+
+ErrorCategory classify_diagnostic(const DiagnosticRecord& record) {
+    std::string_view state = record.sqlstate;
+    if (state.size() != 5) {
+        return ErrorCategory::Other;
+    }
+    if (state == "HY000") {
+        return is_transient_http_status(http_status(record.message)) ? ErrorCategory::Unavailable
+                                                                     : ErrorCategory::Other;
+    }
+    if (const StateEntry* entry = lookup(STATE_TABLE, state)) {
+        return entry->second;
+    }
+    if (const StateEntry* entry = lookup(CLASS_TABLE, state.substr(0, 2))) {
+        return entry->second;
+    }
+    return ErrorCategory::Other;
+}
+
+std::string error_category_to_string(ErrorCategory category) {
+    switch (category) {
+    case ErrorCategory::Timeout:
+        return "TIMEOUT";
+    case ErrorCategory::Connection:
+        return "CONNECTION";
+    case ErrorCategory::Unavailable:
+        return "UNAVAILABLE";
+    case ErrorCategory::Authentication:
+        return "AUTHENTICATION";
+    case ErrorCategory::Query:
+        return "QUERY";
+    case ErrorCategory::Resource:
+        return "RESOURCE";
+    default:
+        return "OTHER";
+    }
+}
+
+SqlError::SqlError(const std::string& message, std::vector<DiagnosticRecord> diagnostics)
+    : std::runtime_error(message)
+    , diagnostics_(std::move(diagnostics)) {
+    for (size_t i = 0; i < diagnostics_.size(); i++) {
+        ErrorCategory category = classify_diagnostic(diagnostics_[i]);
+        if (category != ErrorCategory::Other) {
+            primary_ = i;
+            category_ = category;
+            break;
+        }
+    }
+}
+
+const DiagnosticRecord& SqlError::primary() const {
+    return diagnostics_.empty() ? EMPTY_RECORD : diagnostics_[primary_];
+}
+
+} // namespace databricks
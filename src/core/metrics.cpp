@@ -0,0 +1,508 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "databricks/core/metrics.h"
+
+#include "../internal/metrics.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+namespace databricks {
+namespace {
+// ========== Log-linear buckets ==========
+
+// 16 sub-buckets per power of two: values < 32ns are exact, larger ones within 1/16
+constexpr size_t SUB_BUCKET_BITS = 4;
+constexpr uint64_t SUB_BUCKETS = uint64_t(1) << SUB_BUCKET_BITS;
+// Highest power of two tracked (2^42 ns is about 73 minutes); longer samples share the last bucket
+constexpr size_t MAX_EXPONENT = 42;
+constexpr size_t BUCKET_COUNT = (MAX_EXPONENT - SUB_BUCKET_BITS + 2) * SUB_BUCKETS;
+
+constexpr size_t TIMER_COUNT = static_cast<size_t>(MetricTimer::HttpRequest) + 1;
+constexpr size_t COUNTER_COUNT = static_cast<size_t>(MetricCounter::HedgeWins) + 1;
+
+size_t bucket_index(uint64_t value) {
+    if (value < SUB_BUCKETS) {
+        return static_cast<size_t>(value);
+    }
+    const size_t exponent = 63 - static_cast<size_t>(__builtin_clzll(value));
+    if (exponent > MAX_EXPONENT) {
+        return BUCKET_COUNT - 1;
+    }
+    const size_t shift = exponent - SUB_BUCKET_BITS;
+    return shift * SUB_BUCKETS + static_cast<size_t>(value >> shift);
+}
+
+uint64_t bucket_upper_bound(size_t index) {
+    if (index < SUB_BUCKETS) {
+        return index;
+    }
+    const size_t shift = index / SUB_BUCKETS - 1;
+    const uint64_t mantissa = index - shift * SUB_BUCKETS;
+    return ((mantissa + 1) << shift) - 1;
+}
+
+// Only the owning thread writes a cell, so a plain load and store is enough and
+// avoids a locked read-modify-write on the recording path
+void bump(std::atomic<uint64_t>& value, uint64_t delta) {
+    value.store(value.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+}
+
+struct HistogramCell {
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> sum{0};
+    std::atomic<uint64_t> max{0};
+    std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets{};
+
+    void record(uint64_t value) {
+        bump(buckets[bucket_index(value)], 1);
+        bump(count, 1);
+        bump(sum, value);
+        if (value > max.load(std::memory_order_relaxed)) {
+            max.store(value, std::memory_order_relaxed);
+        }
+    }
+};
+
+/**
+ * @brief Histogram cells merged from every thread
+ */
+struct MergedHistogram {
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    uint64_t max = 0;
+    std::vector<uint64_t> buckets = std::vector<uint64_t>(BUCKET_COUNT);
+
+    void merge(const HistogramCell& cell) {
+        count += cell.count.load(std::memory_order_relaxed);
+        sum += cell.sum.load(std::memory_order_relaxed);
+        max = std::max(max, cell.max.load(std::memory_order_relaxed));
+        for (size_t i = 0; i < BUCKET_COUNT; i++) {
+            buckets[i] += cell.buckets[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    MetricsRegistry::HistogramSnapshot snapshot() const {
+        MetricsRegistry::HistogramSnapshot snapshot;
+        snapshot.count = count;
+        snapshot.sum = std::chrono::nanoseconds(sum);
+        snapshot.max = std::chrono::nanoseconds(max);
+        for (size_t i = 0; i < BUCKET_COUNT; i++) {
+            if (buckets[i] > 0) {
+                snapshot.buckets.emplace_back(std::chrono::nanoseconds(bucket_upper_bound(i)), buckets[i]);
+            }
+        }
+        return snapshot;
+    }
+};
+
+// ========== Series keys ==========
+
+// Separates the fields of a series key; never appears in a label value we produce
+constexpr char KEY_SEPARATOR = '\x1f';
+
+void encode_key(std::string& key, char metric, const MetricLabels& labels) {
+    key.clear();
+    key.push_back(metric);
+    key.append(labels.operation);
+    key.push_back(KEY_SEPARATOR);
+    key.append(labels.method);
+    key.push_back(KEY_SEPARATOR);
+    key.append(labels.endpoint);
+    key.push_back(KEY_SEPARATOR);
+    key.append(std::to_string(labels.status_code));
+}
+
+char timer_id(MetricTimer timer) {
+    return static_cast<char>(static_cast<size_t>(timer));
+}
+
+char counter_id(MetricCounter counter) {
+    return static_cast<char>(static_cast<size_t>(counter));
+}
+
+bool unlabelled(const MetricLabels& labels) {
+    return labels.operation.empty() && labels.method.empty() && labels.endpoint.empty() && labels.status_code == 0;
+}
+
+/**
+ * @brief Series recorded by one thread
+ */
+struct ThreadShard {
+    std::mutex mutex; // Taken by the owner only to add a series; readers hold it while merging
+    std::unordered_map<std::string, std::unique_ptr<HistogramCell>> histograms;
+    std::unordered_map<std::string, std::unique_ptr<std::atomic<uint64_t>>> counters;
+
+    // Unlabelled series, skipping the key lookup (also present in the maps)
+    std::array<HistogramCell*, TIMER_COUNT> plain_histograms{};
+    std::array<std::atomic<uint64_t>*, COUNTER_COUNT> plain_counters{};
+
+    std::string scratch; // Owner's key buffer, reused so lookups don't allocate
+
+    HistogramCell& histogram(MetricTimer timer, const MetricLabels& labels) {
+        const bool plain = unlabelled(labels);
+        if (plain && plain_histograms[static_cast<size_t>(timer)]) {
+            return *plain_histograms[static_cast<size_t>(timer)];
+        }
+
+        encode_key(scratch, timer_id(timer), labels);
+        // Only this thread inserts, so looking up without the lock is safe
+        auto it = histograms.find(scratch);
+        if (it == histograms.end()) {
+            std::lock_guard<std::mutex> lock(mutex);
+            it = histograms.emplace(scratch, std::make_unique<HistogramCell>()).first;
+        }
+        if (plain) {
+            plain_histograms[static_cast<size_t>(timer)] = it->second.get();
+        }
+        return *it->second;
+    }
+
+    std::atomic<uint64_t>& counter(MetricCounter counter, const MetricLabels& labels) {
+        const bool plain = unlabelled(labels);
+        if (plain && plain_counters[static_cast<size_t>(counter)]) {
+            return *plain_counters[static_cast<size_t>(counter)];
+        }
+
+        encode_key(scratch, counter_id(counter), labels);
+        auto it = counters.find(scratch);
+        if (it == counters.end()) {
+            std::lock_guard<std::mutex> lock(mutex);
+            it = counters.emplace(scratch, std::make_unique<std::atomic<uint64_t>>(0)).first;
+        }
+        if (plain) {
+            plain_counters[static_cast<size_t>(counter)] = it->second.get();
+        }
+        return *it->second;
+    }
+};
+
+// ========== Prometheus export ==========
+
+struct MetricInfo {
+    const char* name;
+    const char* help;
+};
+
+constexpr std::array<MetricInfo, TIMER_COUNT> TIMER_INFO = {{
+    {"databricks_query_prepare_seconds", "Time to prepare a parameterized statement"},
+    {"databricks_query_execute_seconds", "Time to bind parameters and execute a statement"},
+    {"databricks_query_fetch_seconds", "Time to fetch every row of a result"},
+    {"databricks_pool_acquire_wait_seconds", "Time from a pool acquire call until a connection is handed out"},
+    {"databricks_connection_create_seconds", "Time to open an ODBC connection"},
+    {"databricks_http_request_seconds", "Duration of one HTTP attempt"},
+}};
+
+constexpr std::array<MetricInfo, COUNTER_COUNT> COUNTER_INFO = {{
+    {"databricks_rows_fetched_total", "Result rows read from the driver"},
+    {"databricks_bytes_fetched_total", "Result bytes read from the driver"},
+    {"databricks_pool_acquire_timeouts_total", "Pool acquires that timed out waiting for a connection"},
+    {"databricks_retries_total", "Retried attempts by operation"},
+    {"databricks_http_responses_total", "HTTP attempts by endpoint and status code (0 for transport errors)"},
+    {"databricks_hedgeable_queries_total", "Read-only queries run in hedged mode"},
+    {"databricks_hedged_queries_total", "Hedged-mode queries that sent a second copy"},
+    {"databricks_hedge_wins_total", "Hedged-mode queries answered by the second copy"},
+}};
+
+// Exported histogram bucket bounds in seconds
+constexpr std::array<double, 18> EXPORT_BOUNDS = {0.0001, 0.00025, 0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05,
+                                                  0.1,    0.25,    0.5,    1,     2.5,    5,     10,   30,    60};
+
+std::string format_number(double value) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.9g", value);
+    return buffer;
+}
+
+void append_label(std::string& out, const char* name, const std::string& value) {
+    if (out.size() > 1) {
+        out.push_back(',');
+    }
+    out.append(name);
+    out.append("=\"");
+    for (char c : value) {
+        if (c == '\\' || c == '"') {
+            out.push_back('\\');
+            out.push_back(c);
+        } else if (c == '\n') {
+            out.append("\\n");
+        } else {
+            out.push_back(c);
+        }
+    }
+    out.push_back('"');
+}
+
+/**
+ * @brief Label block for a series key, e.g. {method="GET",endpoint="/jobs/list"
+ *
+ * Left open so callers can append le; close it with close_labels().
+ */
+std::string open_labels(const std::string& key, bool with_status) {
+    std::string fields[4];
+    size_t field = 0;
+    for (size_t i = 1; i < key.size() && field < 4; i++) {
+        if (key[i] == KEY_SEPARATOR) {
+            field++;
+        } else {
+            fields[field].push_back(key[i]);
+        }
+    }
+
+    std::string out = "{";
+    if (!fields[0].empty()) {
+        append_label(out, "operation", fields[0]);
+    }
+    if (!fields[1].empty()) {
+        append_label(out, "method", fields[1]);
+    }
+    if (!fields[2].empty()) {
+        append_label(out, "endpoint", fields[2]);
+    }
+    if (with_status) {
+        append_label(out, "status", fields[3]);
+    }
+    return out;
+}
+
+std::string close_labels(std::string labels) {
+    if (labels.size() == 1) {
+        return std::string();
+    }
+    labels.push_back('}');
+    return labels;
+}
+
+std::string with_le(const std::string& labels, const std::string& le) {
+    std::string out = labels;
+    append_label(out, "le", le);
+    out.push_back('}');
+    return out;
+}
+
+// ========== Installed sink ==========
+
+std::atomic<MetricsSink*> installed_sink{nullptr};
+
+struct SinkSlot {
+    std::mutex mutex;
+    std::shared_ptr<MetricsSink> current;
+    std::vector<std::shared_ptr<MetricsSink>> retained; // Every sink ever installed
+};
+
+SinkSlot& sink_slot() {
+    static SinkSlot slot;
+    return slot;
+}
+
+std::atomic<uint64_t> next_registry_id{1};
+} // namespace
+
+// ========== MetricsRegistry::HistogramSnapshot Implementation ==========
+
+std::chrono::nanoseconds MetricsRegistry::HistogramSnapshot::percentile(double q) const {
+    if (count == 0) {
+        return std::chrono::nanoseconds(0);
+    }
+    q = std::clamp(q, 0.0, 1.0);
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(q * static_cast<double>(count))));
+
+    uint64_t seen = 0;
+    for (const auto& [upper, samples] : buckets) {
+        seen += samples;
+        if (seen >= rank) {
+            return std::min(upper, max);
+        }
+    }
+    return max;
+}
+
+// ========== MetricsRegistry::Impl ==========
+
+class MetricsRegistry::Impl {
+public:
+    Impl()
+        : id_(next_registry_id++) {}
+
+    /**
+     * @brief This thread's shard, registering it on first use
+     */
+    ThreadShard& local_shard() {
+        // Keyed by registry id rather than address so a new registry never reuses a dead one's shard
+        thread_local std::vector<std::pair<uint64_t, std::shared_ptr<ThreadShard>>> local;
+        for (auto& [id, shard] : local) {
+            if (id == id_) {
+                return *shard;
+            }
+        }
+
+        auto shard = std::make_shared<ThreadShard>();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            shards_.push_back(shard);
+        }
+        local.emplace_back(id_, shard);
+        return *shard;
+    }
+
+    /**
+     * @brief Histograms merged across threads, optionally only the series for one key
+     */
+    std::map<std::string, MergedHistogram> merge_histograms(const std::string* only) const {
+        std::map<std::string, MergedHistogram> merged;
+        for (const auto& shard : shards()) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            for (const auto& [key, cell] : shard->histograms) {
+                if (!only || key == *only) {
+                    merged[key].merge(*cell);
+                }
+            }
+        }
+        return merged;
+    }
+
+    std::map<std::string, uint64_t> merge_counters(const std::string* only) const {
+        std::map<std::string, uint64_t> merged;
+        for (const auto& shard : shards()) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            for (const auto& [key, value] : shard->counters) {
+                if (!only || key == *only) {
+                    merged[key] += value->load(std::memory_order_relaxed);
+                }
+            }
+        }
+        return merged;
+    }
+
+private:
+    std::vector<std::shared_ptr<ThreadShard>> shards() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return shards_;
+    }
+
+    const uint64_t id_;
+    mutable std::mutex mutex_;
+    std::vector<std::shared_ptr<ThreadShard>> shards_; // Every thread that has recorded, including exited ones
+};
+
+// ========== MetricsRegistry Implementation ==========
+
+MetricsRegistry::MetricsRegistry()
+    : pimpl_(std::make_unique<Impl>()) {}
+
+MetricsRegistry::~MetricsRegistry() = default;
+
+void MetricsRegistry::observe(MetricTimer timer, std::chrono::nanoseconds duration, const MetricLabels& labels) {
+    const uint64_t value = duration.count() > 0 ? static_cast<uint64_t>(duration.count()) : 0;
+    pimpl_->local_shard().histogram(timer, labels).record(value);
+}
+
+void MetricsRegistry::add(MetricCounter counter, uint64_t value, const MetricLabels& labels) {
+    bump(pimpl_->local_shard().counter(counter, labels), value);
+}
+
+MetricsRegistry::HistogramSnapshot MetricsRegistry::histogram(MetricTimer timer, const MetricLabels& labels) const {
+    std::string key;
+    encode_key(key, timer_id(timer), labels);
+    auto merged = pimpl_->merge_histograms(&key);
+    return merged.empty() ? HistogramSnapshot{} : merged.begin()->second.snapshot();
+}
+
+uint64_t MetricsRegistry::counter(MetricCounter counter, const MetricLabels& labels) const {
+    std::string key;
+    encode_key(key, counter_id(counter), labels);
+    auto merged = pimpl_->merge_counters(&key);
+    return merged.empty() ? 0 : merged.begin()->second;
+}
+
+std::string MetricsRegistry::to_prometheus() const {
+    std::string out;
+    int family = -1;
+
+    // Keys start with the metric id, so each family's series are adjacent
+    for (const auto& [key, histogram] : pimpl_->merge_histograms(nullptr)) {
+        const auto& info = TIMER_INFO[static_cast<size_t>(key[0])];
+        if (key[0] != family) {
+            family = key[0];
+            out += std::string("# HELP ") + info.name + " " + info.help + "\n";
+            out += std::string("# TYPE ") + info.name + " histogram\n";
+        }
+
+        const std::string labels = open_labels(key, false);
+        size_t bucket = 0;
+        uint64_t cumulative = 0;
+        for (double bound : EXPORT_BOUNDS) {
+            const auto bound_ns = static_cast<uint64_t>(bound * 1e9);
+            while (bucket < BUCKET_COUNT && bucket_upper_bound(bucket) <= bound_ns) {
+                cumulative += histogram.buckets[bucket++];
+            }
+            out += std::string(info.name) + "_bucket" + with_le(labels, format_number(bound)) + " " +
+                   std::to_string(cumulative) + "\n";
+        }
+        out += std::string(info.name) + "_bucket" + with_le(labels, "+Inf") + " " + std::to_string(histogram.count) +
+               "\n";
+        out += std::string(info.name) + "_sum" + close_labels(labels) + " " +
+               format_number(static_cast<double>(histogram.sum) / 1e9) + "\n";
+        out += std::string(info.name) + "_count" + close_labels(labels) + " " + std::to_string(histogram.count) + "\n";
+    }
+
+    family = -1;
+    for (const auto& [key, value] : pimpl_->merge_counters(nullptr)) {
+        const auto& info = COUNTER_INFO[static_cast<size_t>(key[0])];
+        if (key[0] != family) {
+            family = key[0];
+            out += std::string("# HELP ") + info.name + " " + info.help + "\n";
+            out += std::string("# TYPE ") + info.name + " counter\n";
+        }
+        const bool with_status = key[0] == counter_id(MetricCounter::HttpResponses);
+        out += std::string(info.name) + close_labels(open_labels(key, with_status)) + " " + std::to_string(value) +
+               "\n";
+    }
+    return out;
+}
+
+// ========== Installed sink ==========
+
+void set_metrics_sink(std::shared_ptr<MetricsSink> sink) {
+    SinkSlot& slot = sink_slot();
+    std::lock_guard<std::mutex> lock(slot.mutex);
+    if (sink && std::find(slot.retained.begin(), slot.retained.end(), sink) == slot.retained.end()) {
+        slot.retained.push_back(sink);
+    }
+    installed_sink.store(sink.get(), std::memory_order_release);
+    slot.current = std::move(sink);
+}
+
+std::shared_ptr<MetricsSink> get_metrics_sink() {
+    SinkSlot& slot = sink_slot();
+    std::lock_guard<std::mutex> lock(slot.mutex);
+    return slot.current;
+}
+
+namespace internal {
+MetricsSink* metrics_sink() {
+    return installed_sink.load(std::memory_order_acquire);
+}
+
+std::string endpoint_label(std::string_view path) {
+    path = path.substr(0, path.find('?'));
+
+    // /unity-catalog/<kind>/<object name>: keep the kind, drop the name
+    constexpr std::string_view unity_catalog = "/unity-catalog/";
+    if (path.compare(0, unity_catalog.size(), unity_catalog) == 0) {
+        const size_t name_start = path.find('/', unity_catalog.size());
+        if (name_start != std::string_view::npos && name_start + 1 < path.size()) {
+            return std::string(path.substr(0, name_start)) + "/{name}";
+        }
+    }
+    return std::string(path);
+}
+} // namespace internal
+
+} // namespace databricks
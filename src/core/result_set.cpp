@@ -0,0 +1,196 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "databricks/core/result_set.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace databricks {
+// ========== ColumnarBatch Implementation ==========
+
+void ColumnarBatch::reset(const std::vector<ColumnMetadata>& schema) {
+    schema_ = schema;
+    columns_.clear();
+    columns_.resize(schema_.size());
+    num_rows_ = 0;
+    for (auto& column : columns_) {
+        column.offsets.push_back(0);
+    }
+}
+
+void ColumnarBatch::clear() {
+    for (auto& column : columns_) {
+        // clear() keeps the allocated capacity so the next block reuses it
+        column.data.clear();
+        column.offsets.clear();
+        column.offsets.push_back(0);
+        column.nulls.clear();
+    }
+    num_rows_ = 0;
+}
+
+void ColumnarBatch::reserve_rows(size_t rows) {
+    for (auto& column : columns_) {
+        column.offsets.reserve(rows + 1);
+        column.nulls.reserve(rows);
+    }
+}
+
+void ColumnarBatch::append_value(size_t col, const char* data, size_t length) {
+    auto& column = columns_[col];
+    column.data.insert(column.data.end(), data, data + length);
+    column.offsets.push_back(column.data.size());
+    column.nulls.push_back(0);
+}
+
+void ColumnarBatch::append_null(size_t col) {
+    auto& column = columns_[col];
+    column.offsets.push_back(column.data.size());
+    column.nulls.push_back(1);
+}
+
+// ========== ResultSet Implementation ==========
+
+namespace {
+// Reserve room for extra more elements, doubling so appending batch after batch stays linear
+template <typename T> void reserve_more(std::pmr::vector<T>& buffer, size_t extra) {
+    const size_t needed = buffer.size() + extra;
+    if (needed > buffer.capacity()) {
+        buffer.reserve(std::max(needed, buffer.capacity() * 2));
+    }
+}
+} // namespace
+
+ResultSet::ResultSet(std::pmr::memory_resource* resource)
+    : bytes_(resource)
+    , offsets_(resource)
+    , nulls_(resource) {
+    offsets_.push_back(0);
+}
+
+void ResultSet::reset(const std::vector<ColumnMetadata>& schema) {
+    if (&schema != &schema_) {
+        // Assigning over the old schema reuses its strings' storage
+        schema_ = schema;
+    }
+    clear();
+}
+
+void ResultSet::clear() {
+    bytes_.clear();
+    offsets_.clear();
+    offsets_.push_back(0);
+    nulls_.clear();
+    num_rows_ = 0;
+}
+
+void ResultSet::append(const ColumnarBatch& batch, size_t first_row, size_t count) {
+    const size_t columns = schema_.size();
+    if (batch.num_columns() != columns) {
+        throw std::invalid_argument("ResultSet::append: batch has " + std::to_string(batch.num_columns()) +
+                                    " columns, expected " + std::to_string(columns));
+    }
+    if (first_row + count > batch.num_rows()) {
+        throw std::out_of_range("ResultSet::append: rows past the end of the batch");
+    }
+    if (count == 0 || columns == 0) {
+        num_rows_ += count;
+        return;
+    }
+
+    // Size each buffer once for the whole range, then fill it in place
+    size_t range_bytes = 0;
+    for (size_t c = 0; c < columns; c++) {
+        const auto& column = batch.column(c);
+        range_bytes += column.offsets[first_row + count] - column.offsets[first_row];
+    }
+    const size_t cells = count * columns;
+    reserve_more(bytes_, range_bytes);
+    reserve_more(offsets_, cells);
+    reserve_more(nulls_, cells);
+
+    size_t end = bytes_.size();
+    bytes_.resize(end + range_bytes);
+    uint64_t* offset = offsets_.data() + offsets_.size();
+    offsets_.resize(offsets_.size() + cells);
+    uint8_t* null = nulls_.data() + nulls_.size();
+    nulls_.resize(nulls_.size() + cells);
+
+    for (size_t r = first_row; r < first_row + count; r++) {
+        for (size_t c = 0; c < columns; c++) {
+            const auto& column = batch.column(c);
+            const uint64_t start = column.offsets[r];
+            const size_t length = column.offsets[r + 1] - start;
+            if (length > 0) {
+                std::memcpy(bytes_.data() + end, column.data.data() + start, length);
+            }
+            end += length;
+            *offset++ = end;
+            *null++ = column.nulls[r];
+        }
+    }
+    num_rows_ += count;
+}
+
+// ========== TypedBatch Implementation ==========
+
+const char* to_string(ValueType type) {
+    switch (type) {
+    case ValueType::Boolean:
+        return "BOOLEAN";
+    case ValueType::Int64:
+        return "INT64";
+    case ValueType::Double:
+        return "DOUBLE";
+    case ValueType::Date:
+        return "DATE";
+    case ValueType::Timestamp:
+        return "TIMESTAMP";
+    case ValueType::String:
+        return "STRING";
+    }
+    return "UNKNOWN";
+}
+
+void TypedBatch::reset(const std::vector<ColumnMetadata>& schema, const std::vector<ValueType>& types) {
+    if (schema.size() != types.size()) {
+        throw std::invalid_argument("TypedBatch schema and types must have the same length");
+    }
+
+    schema_ = schema;
+    columns_.clear();
+    columns_.resize(schema_.size());
+    for (size_t i = 0; i < columns_.size(); i++) {
+        columns_[i].type = types[i];
+        columns_[i].text_offsets.push_back(0);
+    }
+    num_rows_ = 0;
+}
+
+void TypedBatch::clear() {
+    for (auto& column : columns_) {
+        column.nulls.clear();
+        column.bools.clear();
+        column.int64s.clear();
+        column.doubles.clear();
+        column.dates.clear();
+        column.timestamps.clear();
+        column.text.clear();
+        column.text_offsets.clear();
+        column.text_offsets.push_back(0);
+    }
+    num_rows_ = 0;
+}
+
+const TypedBatch::Column& TypedBatch::typed(size_t col, ValueType expected) const {
+    const auto& column = columns_.at(col);
+    if (column.type != expected) {
+        throw std::runtime_error("Column '" + schema_[col].name + "' is " + to_string(column.type) + ", not " +
+                                 to_string(expected));
+    }
+    return column;
+}
+
+} // namespace databricks
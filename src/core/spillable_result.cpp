@@ -0,0 +1,185 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "databricks/core/spillable_result.h"
+
+#include "../internal/logger.h"
+#include "../internal/spill_file.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace databricks {
+
+class SpillableResult::Impl {
+public:
+    // Where one block's column lives in the spill file
+    struct SpilledColumn {
+        uint64_t data;    // Value bytes
+        uint64_t offsets; // rows + 1 uint64_t offsets into the value bytes, 8-byte aligned
+        uint64_t nulls;   // Bitmap, bit (row % 8) of byte (row / 8) set for NULL
+    };
+
+    Impl(std::vector<ColumnMetadata> columns, const SpillConfig& spill)
+        : schema(std::move(columns))
+        , config(spill) {}
+
+    static uint64_t block_bytes(const ColumnarBatch& batch) {
+        uint64_t bytes = 0;
+        for (size_t c = 0; c < batch.num_columns(); ++c) {
+            const auto& column = batch.column(c);
+            bytes += column.data.size() + column.offsets.size() * sizeof(uint64_t) + column.nulls.size();
+        }
+        return bytes;
+    }
+
+    void spill() {
+        DATABRICKS_LOG_DEBUG("Result passed {} bytes after {} rows, spilling to disk", config.memory_limit_bytes,
+                             rows);
+        file = std::make_unique<internal::SpillFile>(config.directory);
+        for (const auto& block : memory_blocks) {
+            write_block(block);
+        }
+        memory_blocks.clear();
+        memory_blocks.shrink_to_fit();
+        memory_bytes = 0;
+    }
+
+    void write_block(const ColumnarBatch& batch) {
+        const size_t count = batch.num_rows();
+        for (size_t c = 0; c < schema.size(); ++c) {
+            const auto& column = batch.column(c);
+            SpilledColumn spilled;
+            const uint64_t first = column.offsets[0];
+            spilled.data = file->append(column.data.data() + first, column.offsets[count] - first);
+
+            file->align(sizeof(uint64_t));
+            offsets_scratch.resize(count + 1);
+            for (size_t row = 0; row <= count; ++row) {
+                offsets_scratch[row] = column.offsets[row] - first;
+            }
+            spilled.offsets = file->append(offsets_scratch.data(), offsets_scratch.size() * sizeof(uint64_t));
+
+            nulls_scratch.assign((count + 7) / 8, 0);
+            for (size_t row = 0; row < count; ++row) {
+                if (column.nulls[row]) {
+                    nulls_scratch[row / 8] |= static_cast<uint8_t>(1u << (row % 8));
+                }
+            }
+            spilled.nulls = file->append(nulls_scratch.data(), nulls_scratch.size());
+            spilled_columns.push_back(spilled);
+        }
+    }
+
+    // Block holding row, and the row's index within it
+    std::pair<size_t, size_t> locate(size_t row, size_t col) const {
+        if (row >= rows || col >= schema.size()) {
+            throw std::out_of_range("SpillableResult: cell (" + std::to_string(row) + ", " + std::to_string(col) +
+                                    ") is past the end");
+        }
+        if (file && !sealed) {
+            throw std::runtime_error("SpillableResult must be sealed before it is read");
+        }
+        size_t block = static_cast<size_t>(std::upper_bound(first_rows.begin(), first_rows.end(), row) -
+                                           first_rows.begin()) - 1;
+        return {block, row - first_rows[block]};
+    }
+
+    const SpilledColumn& spilled_column(size_t block, size_t col) const {
+        return spilled_columns[block * schema.size() + col];
+    }
+
+    std::vector<ColumnMetadata> schema;
+    SpillConfig config;
+    uint64_t rows = 0;
+    std::vector<uint64_t> first_rows;           // First row of each block, ascending
+    std::vector<ColumnarBatch> memory_blocks;   // Until the result spills
+    uint64_t memory_bytes = 0;                  // Held by memory_blocks
+    std::unique_ptr<internal::SpillFile> file;  // Set once the result spills
+    std::vector<SpilledColumn> spilled_columns; // block * num_columns + column
+    std::vector<uint64_t> offsets_scratch;
+    std::vector<uint8_t> nulls_scratch;
+    bool sealed = false;
+};
+
+SpillableResult::SpillableResult(std::vector<ColumnMetadata> schema, const SpillConfig& config)
+    : pimpl_(std::make_unique<Impl>(std::move(schema), config)) {}
+
+SpillableResult::~SpillableResult() = default;
+SpillableResult::SpillableResult(SpillableResult&&) noexcept = default;
+SpillableResult& SpillableResult::operator=(SpillableResult&&) noexcept = default;
+
+size_t SpillableResult::num_rows() const { return static_cast<size_t>(pimpl_->rows); }
+
+size_t SpillableResult::num_columns() const { return pimpl_->schema.size(); }
+
+const std::vector<ColumnMetadata>& SpillableResult::schema() const { return pimpl_->schema; }
+
+std::string_view SpillableResult::value(size_t row, size_t col) const {
+    auto [block, local] = pimpl_->locate(row, col);
+    if (!pimpl_->file) {
+        return pimpl_->memory_blocks[block].value(local, col);
+    }
+    const char* base = pimpl_->file->data();
+    const auto& column = pimpl_->spilled_column(block, col);
+    const auto* offsets = reinterpret_cast<const uint64_t*>(base + column.offsets);
+    return std::string_view(base + column.data + offsets[local], offsets[local + 1] - offsets[local]);
+}
+
+bool SpillableResult::is_null(size_t row, size_t col) const {
+    auto [block, local] = pimpl_->locate(row, col);
+    if (!pimpl_->file) {
+        return pimpl_->memory_blocks[block].is_null(local, col);
+    }
+    const auto& column = pimpl_->spilled_column(block, col);
+    const auto bits = static_cast<uint8_t>(pimpl_->file->data()[column.nulls + local / 8]);
+    return (bits >> (local % 8)) & 1u;
+}
+
+bool SpillableResult::spilled() const { return pimpl_->file != nullptr; }
+
+uint64_t SpillableResult::resident_bytes() const {
+    if (!pimpl_->file) {
+        return pimpl_->memory_bytes;
+    }
+    return pimpl_->first_rows.size() * sizeof(uint64_t) +
+           pimpl_->spilled_columns.size() * sizeof(Impl::SpilledColumn);
+}
+
+uint64_t SpillableResult::spilled_bytes() const { return pimpl_->file ? pimpl_->file->size() : 0; }
+
+void SpillableResult::append(const ColumnarBatch& batch) {
+    Impl& impl = *pimpl_;
+    if (impl.sealed) {
+        throw std::runtime_error("SpillableResult is sealed");
+    }
+    if (batch.num_columns() != impl.schema.size()) {
+        throw std::invalid_argument("SpillableResult::append: batch has " + std::to_string(batch.num_columns()) +
+                                    " columns, expected " + std::to_string(impl.schema.size()));
+    }
+    if (batch.num_rows() == 0) {
+        return;
+    }
+
+    impl.first_rows.push_back(impl.rows);
+    impl.rows += batch.num_rows();
+    if (impl.file) {
+        impl.write_block(batch);
+        return;
+    }
+    impl.memory_blocks.push_back(batch);
+    impl.memory_bytes += Impl::block_bytes(batch);
+    if (impl.memory_bytes > impl.config.memory_limit_bytes) {
+        impl.spill();
+    }
+}
+
+void SpillableResult::seal() {
+    if (pimpl_->file) {
+        pimpl_->file->map();
+    }
+    pimpl_->sealed = true;
+}
+
+} // namespace databricks
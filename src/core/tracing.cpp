@@ -0,0 +1,241 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "databricks/core/tracing.h"
+
+#include "../internal/tracing.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <random>
+
+namespace databricks {
+namespace {
+thread_local SpanContext thread_context;
+
+std::atomic<SpanExporter*> installed_exporter{nullptr};
+
+struct ExporterSlot {
+    std::mutex mutex;
+    std::shared_ptr<SpanExporter> current;
+    std::vector<std::shared_ptr<SpanExporter>> retained; // Every exporter ever installed
+};
+
+ExporterSlot& exporter_slot() {
+    static ExporterSlot slot;
+    return slot;
+}
+
+template <size_t N> std::string to_hex(const std::array<uint8_t, N>& bytes) {
+    static const char HEX[] = "0123456789abcdef";
+    std::string out(N * 2, '0');
+    for (size_t i = 0; i < N; ++i) {
+        out[2 * i] = HEX[bytes[i] >> 4];
+        out[2 * i + 1] = HEX[bytes[i] & 0x0F];
+    }
+    return out;
+}
+
+int hex_digit(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    return -1; // W3C trace context only allows lowercase
+}
+
+template <size_t N> bool from_hex(std::string_view text, std::array<uint8_t, N>& bytes) {
+    if (text.size() != N * 2) {
+        return false;
+    }
+    for (size_t i = 0; i < N; ++i) {
+        int high = hex_digit(text[2 * i]);
+        int low = hex_digit(text[2 * i + 1]);
+        if (high < 0 || low < 0) {
+            return false;
+        }
+        bytes[i] = static_cast<uint8_t>((high << 4) | low);
+    }
+    return true;
+}
+} // namespace
+
+// ========== SpanContext ==========
+
+std::string SpanContext::to_traceparent() const {
+    const std::array<uint8_t, 1> flags{trace_flags};
+    return "00-" + to_hex(trace_id) + "-" + to_hex(span_id) + "-" + to_hex(flags);
+}
+
+SpanContext SpanContext::from_traceparent(std::string_view value) {
+    // version "-" trace-id "-" parent-id "-" trace-flags; later versions may append fields
+    SpanContext context;
+    std::array<uint8_t, 1> version{};
+    std::array<uint8_t, 1> flags{};
+    if (value.size() < 55 || value[2] != '-' || value[35] != '-' || value[52] != '-' ||
+        !from_hex(value.substr(0, 2), version) || version[0] == 0xFF ||
+        (version[0] == 0 ? value.size() != 55 : value.size() > 55 && value[55] != '-') ||
+        !from_hex(value.substr(3, 32), context.trace_id) || !from_hex(value.substr(36, 16), context.span_id) ||
+        !from_hex(value.substr(53, 2), flags)) {
+        return SpanContext{};
+    }
+    context.trace_flags = flags[0];
+    return context.is_valid() ? context : SpanContext{};
+}
+
+std::string SpanContext::trace_id_hex() const {
+    return to_hex(trace_id);
+}
+
+std::string SpanContext::span_id_hex() const {
+    return to_hex(span_id);
+}
+
+// ========== Installed exporter and thread context ==========
+
+bool tracing_compiled_in() {
+#ifdef DATABRICKS_ENABLE_TRACING
+    return true;
+#else
+    return false;
+#endif
+}
+
+void set_span_exporter(std::shared_ptr<SpanExporter> exporter) {
+    ExporterSlot& slot = exporter_slot();
+    std::lock_guard<std::mutex> lock(slot.mutex);
+    if (exporter && std::find(slot.retained.begin(), slot.retained.end(), exporter) == slot.retained.end()) {
+        slot.retained.push_back(exporter);
+    }
+    installed_exporter.store(exporter.get(), std::memory_order_release);
+    slot.current = std::move(exporter);
+}
+
+std::shared_ptr<SpanExporter> get_span_exporter() {
+    ExporterSlot& slot = exporter_slot();
+    std::lock_guard<std::mutex> lock(slot.mutex);
+    return slot.current;
+}
+
+SpanContext current_span_context() {
+    return thread_context;
+}
+
+TraceContextScope::TraceContextScope(const SpanContext& parent)
+    : previous_(thread_context) {
+    thread_context = parent;
+}
+
+TraceContextScope::~TraceContextScope() {
+    thread_context = previous_;
+}
+
+// ========== Span ==========
+
+#ifdef DATABRICKS_ENABLE_TRACING
+namespace internal {
+namespace {
+template <size_t N> void random_id(std::array<uint8_t, N>& id) {
+    thread_local std::mt19937_64 gen{std::random_device{}()};
+    do {
+        for (size_t i = 0; i < N; i += 8) {
+            uint64_t bits = gen();
+            for (size_t j = i; j < std::min(N, i + 8); ++j, bits >>= 8) {
+                id[j] = static_cast<uint8_t>(bits);
+            }
+        }
+    } while (std::all_of(id.begin(), id.end(), [](uint8_t byte) { return byte == 0; }));
+}
+} // namespace
+
+Span::Span(std::string_view name)
+    : Span(name, thread_context) {
+    if (data_) {
+        previous_ = thread_context;
+        thread_context = context_;
+        active_ = true;
+    }
+}
+
+Span::Span(std::string_view name, const SpanContext& parent)
+    : context_(parent) {
+    // Unsampled parents keep their decision; everything else starts sampled
+    if (!installed_exporter.load(std::memory_order_acquire) || (parent.is_valid() && !parent.is_sampled())) {
+        return;
+    }
+
+    data_ = std::make_unique<SpanData>();
+    data_->name = name;
+    if (parent.is_valid()) {
+        data_->context.trace_id = parent.trace_id;
+        data_->parent_span_id = parent.span_id;
+    } else {
+        random_id(data_->context.trace_id);
+    }
+    random_id(data_->context.span_id);
+    data_->context.trace_flags = 0x01;
+    data_->start_time = std::chrono::system_clock::now();
+    context_ = data_->context;
+    uncaught_exceptions_ = std::uncaught_exceptions();
+    start_ = std::chrono::steady_clock::now();
+}
+
+Span Span::detached(std::string_view name) {
+    return Span(name, thread_context);
+}
+
+Span::Span(Span&& other) noexcept
+    : data_(std::move(other.data_))
+    , context_(other.context_)
+    , previous_(other.previous_)
+    , active_(other.active_)
+    , uncaught_exceptions_(other.uncaught_exceptions_)
+    , start_(other.start_) {
+    other.active_ = false;
+}
+
+void Span::set_attribute(const char* key, std::string_view value) {
+    if (data_) {
+        data_->attributes.emplace_back(key, std::string(value));
+    }
+}
+
+void Span::set_attribute(const char* key, int64_t value) {
+    if (data_) {
+        data_->attributes.emplace_back(key, std::to_string(value));
+    }
+}
+
+void Span::set_error(std::string_view message) {
+    if (data_ && !data_->error) {
+        data_->error = true;
+        data_->status_message = message;
+    }
+}
+
+void Span::end() {
+    if (!data_) {
+        return;
+    }
+    data_->duration = std::chrono::steady_clock::now() - start_;
+    if (std::uncaught_exceptions() > uncaught_exceptions_) {
+        set_error("exception");
+    }
+    if (active_) {
+        thread_context = previous_;
+        active_ = false;
+    }
+
+    // Whichever exporter is installed now gets the span, even if it changed since the start
+    if (SpanExporter* exporter = installed_exporter.load(std::memory_order_acquire)) {
+        exporter->on_end(*data_);
+    }
+    data_.reset();
+}
+} // namespace internal
+#endif
+
+} // namespace databricks
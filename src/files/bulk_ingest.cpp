@@ -0,0 +1,227 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "databricks/files/bulk_ingest.h"
+
+#include "../internal/csv_writer.h"
+#include "../internal/executor.h"
+#include "../internal/logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <exception>
+#include <future>
+#include <random>
+#include <stdexcept>
+
+namespace databricks {
+
+namespace {
+// A directory name no other ingest will pick
+std::string unique_directory(const std::string& staging_path) {
+    std::random_device device;
+    std::mt19937_64 gen(device() ^ static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()));
+    char id[17];
+    std::snprintf(id, sizeof(id), "%016llx", static_cast<unsigned long long>(gen()));
+    std::string base = staging_path;
+    while (base.size() > 1 && base.back() == '/') {
+        base.pop_back();
+    }
+    return base + "/ingest-" + id;
+}
+} // namespace
+
+class BulkIngest::Impl {
+public:
+    Impl(Client& client, Files& files, std::string table, std::vector<std::string> columns,
+         const IngestConfig& config)
+        : client_(client)
+        , files_(files)
+        , table_(std::move(table))
+        , config_(config)
+        , directory_(unique_directory(config.staging_path))
+        , writer_(std::move(columns))
+        , uploads_(config.max_concurrent_uploads, config.max_concurrent_uploads) {}
+
+    ~Impl() {
+        uploads_.shutdown();
+        if (!finished_) {
+            for (auto& pending : pending_) {
+                try {
+                    pending.get();
+                } catch (...) {
+                }
+            }
+            clean_up();
+        }
+    }
+
+    void check_open() const {
+        if (finished_) {
+            throw std::runtime_error("BulkIngest already finished");
+        }
+        if (failed_) {
+            std::rethrow_exception(failed_);
+        }
+    }
+
+    // Start uploading the part once it is full
+    void maybe_flush() {
+        if (writer_.rows() >= config_.rows_per_file) {
+            flush();
+        }
+    }
+
+    void flush() {
+        if (writer_.rows() == 0) {
+            return;
+        }
+        // Fail fast: surface an upload error on the next append, not at finish()
+        while (!pending_.empty() &&
+               pending_.front().wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            auto done = std::move(pending_.front());
+            pending_.pop_front();
+            try {
+                done.get();
+            } catch (...) {
+                failed_ = std::current_exception(); // The load can no longer be complete
+                throw;
+            }
+        }
+
+        char name[32];
+        std::snprintf(name, sizeof(name), "/part-%05zu.csv", staged_.size());
+        std::string path = directory_ + name;
+        rows_ += writer_.rows();
+        std::string part = writer_.take();
+        bytes_ += part.size();
+        staged_.push_back(path);
+
+        Files* files = &files_;
+        pending_.push_back(
+            uploads_.submit([files, path, part = std::move(part)]() { files->upload(path, part, true); }));
+    }
+
+    IngestResult finish() {
+        if (finished_) {
+            throw std::runtime_error("BulkIngest already finished");
+        }
+        finished_ = true;
+        try {
+            if (failed_) {
+                std::rethrow_exception(failed_);
+            }
+            flush();
+            for (auto& pending : pending_) {
+                pending.get();
+            }
+            pending_.clear();
+
+            IngestResult result;
+            result.rows = rows_;
+            result.files = staged_.size();
+            result.bytes = bytes_;
+            if (!staged_.empty()) {
+                DATABRICKS_LOG_INFO("Loading " + std::to_string(rows_) + " rows from " +
+                                    std::to_string(staged_.size()) + " staged files into " + table_);
+                auto rows = client_.query(internal::copy_into_statement(table_, directory_, config_.copy_options));
+                // COPY INTO reports num_affected_rows first
+                if (!rows.empty() && !rows[0].empty()) {
+                    try {
+                        result.rows_loaded = std::stoull(rows[0][0]);
+                    } catch (const std::exception&) {
+                        DATABRICKS_LOG_WARN("Unexpected COPY INTO result: " + rows[0][0]);
+                    }
+                }
+            }
+            clean_up();
+            return result;
+        } catch (...) {
+            // Let the uploads still running finish before deleting what they wrote
+            for (auto& pending : pending_) {
+                try {
+                    pending.get();
+                } catch (...) {
+                }
+            }
+            pending_.clear();
+            clean_up();
+            throw;
+        }
+    }
+
+    // Delete the staged parts and their directory, unless they are to be kept
+    void clean_up() {
+        if (config_.keep_staged_files || staged_.empty()) {
+            return;
+        }
+        for (const auto& path : staged_) {
+            try {
+                files_.delete_file(path);
+            } catch (const std::exception& e) {
+                DATABRICKS_LOG_WARN("Failed to delete staged file " + path + ": " + e.what());
+            }
+        }
+        try {
+            files_.delete_directory(directory_);
+        } catch (const std::exception& e) {
+            DATABRICKS_LOG_WARN("Failed to delete staging directory " + directory_ + ": " + e.what());
+        }
+        staged_.clear();
+    }
+
+    Client& client_;
+    Files& files_;
+    const std::string table_;
+    const IngestConfig config_;
+    const std::string directory_;
+    internal::CsvWriter writer_;
+    std::vector<std::string> staged_;       // Paths of the parts handed to uploads_
+    std::deque<std::future<void>> pending_; // Uploads not yet waited for, oldest first
+    uint64_t rows_ = 0;                     // Rows in staged parts
+    uint64_t bytes_ = 0;
+    bool finished_ = false;
+    std::exception_ptr failed_;             // A part failed to upload
+    internal::Executor uploads_;            // Declared last: shut down before the rest is destroyed
+};
+
+// ========== BulkIngest Implementation ==========
+
+BulkIngest::BulkIngest(Client& client, Files& files, std::string table, std::vector<std::string> columns,
+                       const IngestConfig& config) {
+    if (!config.is_valid()) {
+        throw std::invalid_argument("Invalid IngestConfig");
+    }
+    if (columns.empty()) {
+        throw std::invalid_argument("BulkIngest needs at least one column");
+    }
+    pimpl_ = std::make_unique<Impl>(client, files, std::move(table), std::move(columns), config);
+}
+
+BulkIngest::~BulkIngest() = default;
+
+void BulkIngest::append(const std::vector<std::string>& row) {
+    pimpl_->check_open();
+    pimpl_->writer_.add_row(row);
+    pimpl_->maybe_flush();
+}
+
+void BulkIngest::append(const ColumnarBatch& batch) {
+    pimpl_->check_open();
+    // Split the batch at part boundaries so every part holds rows_per_file rows
+    size_t row = 0;
+    while (row < batch.num_rows()) {
+        size_t room = pimpl_->config_.rows_per_file - pimpl_->writer_.rows();
+        size_t end = std::min(batch.num_rows(), row + room);
+        pimpl_->writer_.add_rows(batch, row, end);
+        row = end;
+        pimpl_->maybe_flush();
+    }
+}
+
+IngestResult BulkIngest::finish() { return pimpl_->finish(); }
+
+const std::string& BulkIngest::staging_directory() const { return pimpl_->directory_; }
+
+} // namespace databricks
@@ -0,0 +1,186 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "databricks/files/files.h"
+
+#include "../internal/executor.h"
+#include "../internal/http_client.h"
+#include "../internal/http_client_interface.h"
+#include "../internal/logger.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
+
+namespace databricks {
+
+namespace {
+// URL path for a volume path: each segment percent-encoded, the slashes kept
+std::string encode_path(const std::string& path) {
+    if (path.empty() || path[0] != '/') {
+        throw std::invalid_argument("Files API paths must be absolute, got: " + path);
+    }
+    std::string encoded;
+    encoded.reserve(path.size());
+    size_t start = 1;
+    while (true) {
+        encoded += '/';
+        size_t end = path.find('/', start);
+        encoded += internal::url_encode(path.substr(start, end == std::string::npos ? end : end - start));
+        if (end == std::string::npos) {
+            return encoded;
+        }
+        start = end + 1;
+    }
+}
+
+std::string file_path(const std::string& path, bool overwrite) {
+    return "/fs/files" + encode_path(path) + "?overwrite=" + (overwrite ? "true" : "false");
+}
+
+uint64_t local_file_size(const std::string& local_path) {
+    std::error_code error;
+    uintmax_t size = std::filesystem::file_size(local_path, error);
+    if (error) {
+        throw std::runtime_error("Failed to read " + local_path + ": " + error.message());
+    }
+    return size;
+}
+
+// Reopens the file for every attempt, so a retry sends it from the start
+std::function<internal::BodyReader()> file_body(const std::string& local_path) {
+    return [local_path]() -> internal::BodyReader {
+        auto file = std::make_shared<std::ifstream>(local_path, std::ios::binary);
+        if (!*file) {
+            throw std::runtime_error("Failed to open " + local_path);
+        }
+        return [file, local_path](char* buffer, size_t capacity) -> size_t {
+            file->read(buffer, static_cast<std::streamsize>(capacity));
+            if (file->bad()) {
+                throw std::runtime_error("Failed to read " + local_path);
+            }
+            return static_cast<size_t>(file->gcount());
+        };
+    };
+}
+} // namespace
+
+// ==================== PIMPL IMPLEMENTATION ====================
+
+class Files::Impl {
+public:
+    // Constructor for production use (creates real HttpClient)
+    explicit Impl(const AuthConfig& auth, const std::string& api_version = "2.0",
+                  const HttpConfig& http = HttpConfig{})
+        : http_client_(std::make_shared<internal::HttpClient>(auth, api_version, http)) {}
+
+    // Constructor for testing (accepts injected client)
+    explicit Impl(std::shared_ptr<internal::IHttpClient> client)
+        : http_client_(std::move(client)) {}
+
+    // The Files API answers 204 No Content on success
+    void check(const internal::HttpResponse& response, const std::string& operation) const {
+        if (response.status_code < 200 || response.status_code >= 300) {
+            http_client_->check_response(response, operation);
+        }
+    }
+
+    // Send one upload, recording its size and status in result; throws on failure
+    void send(const FileUpload& upload, UploadResult& result) {
+        result.path = upload.path;
+        const std::string path = file_path(upload.path, upload.overwrite);
+        internal::HttpResponse response;
+        if (upload.local_path.empty()) {
+            result.bytes = upload.contents.size();
+            response = http_client_->put(path, upload.contents);
+        } else {
+            result.bytes = local_file_size(upload.local_path);
+            response = http_client_->put_stream(path, result.bytes, file_body(upload.local_path));
+        }
+        result.status_code = response.status_code;
+        check(response, "uploadFile");
+        result.success = true;
+    }
+
+    std::shared_ptr<internal::IHttpClient> http_client_;
+};
+
+// ==================== CONSTRUCTORS & DESTRUCTOR ====================
+
+Files::Files(const AuthConfig& auth, const std::string& api_version)
+    : pimpl_(std::make_unique<Impl>(auth, api_version)) {}
+
+Files::Files(const AuthConfig& auth, const HttpConfig& http)
+    : pimpl_(std::make_unique<Impl>(auth, "2.0", http)) {}
+
+Files::Files(std::shared_ptr<internal::IHttpClient> http_client)
+    : pimpl_(std::make_unique<Impl>(std::move(http_client))) {}
+
+Files::~Files() = default;
+
+// ==================== FILE OPERATIONS ====================
+
+void Files::upload(const std::string& path, const std::string& contents, bool overwrite) {
+    DATABRICKS_LOG_INFO("Uploading " + std::to_string(contents.size()) + " bytes to " + path);
+    UploadResult result;
+    pimpl_->send(FileUpload::from_buffer(contents, path, overwrite), result);
+}
+
+uint64_t Files::upload_file(const std::string& local_path, const std::string& path, bool overwrite) {
+    DATABRICKS_LOG_INFO("Uploading " + local_path + " to " + path);
+    UploadResult result;
+    pimpl_->send(FileUpload::from_file(local_path, path, overwrite), result);
+    return result.bytes;
+}
+
+std::vector<UploadResult> Files::upload_files(const std::vector<FileUpload>& uploads, size_t max_concurrent) {
+    if (max_concurrent == 0) {
+        throw std::invalid_argument("max_concurrent must be positive");
+    }
+    DATABRICKS_LOG_INFO("Uploading " + std::to_string(uploads.size()) + " files");
+
+    std::vector<UploadResult> results(uploads.size());
+    if (uploads.empty()) {
+        return results;
+    }
+    {
+        internal::Executor workers(std::min(max_concurrent, uploads.size()), max_concurrent);
+        for (size_t i = 0; i < uploads.size(); ++i) {
+            workers.post([this, &uploads, &results, i]() {
+                try {
+                    pimpl_->send(uploads[i], results[i]);
+                } catch (const std::exception& e) {
+                    results[i].path = uploads[i].path;
+                    results[i].error = e.what();
+                }
+            });
+        }
+        workers.shutdown();
+    }
+
+    size_t stored = std::count_if(results.begin(), results.end(), [](const UploadResult& r) { return r.success; });
+    DATABRICKS_LOG_INFO("Uploaded " + std::to_string(stored) + " of " + std::to_string(results.size()) + " files");
+    return results;
+}
+
+void Files::delete_file(const std::string& path) {
+    DATABRICKS_LOG_INFO("Deleting file " + path);
+    auto response = pimpl_->http_client_->del("/fs/files" + encode_path(path));
+    pimpl_->check(response, "deleteFile");
+}
+
+void Files::create_directory(const std::string& path) {
+    DATABRICKS_LOG_INFO("Creating directory " + path);
+    auto response = pimpl_->http_client_->put("/fs/directories" + encode_path(path), "");
+    pimpl_->check(response, "createDirectory");
+}
+
+void Files::delete_directory(const std::string& path) {
+    DATABRICKS_LOG_INFO("Deleting directory " + path);
+    auto response = pimpl_->http_client_->del("/fs/directories" + encode_path(path));
+    pimpl_->check(response, "deleteDirectory");
+}
+
+} // namespace databricks
@@ -0,0 +1,86 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "block_prefetcher.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace databricks {
+namespace internal {
+BlockPrefetcher::BlockPrefetcher(std::function<bool(ColumnarBatch&)> fetch, std::vector<ColumnMetadata> schema,
+                                 size_t depth)
+    : fetch_(std::move(fetch))
+    , schema_(std::move(schema))
+    , depth_(std::max<size_t>(depth, 1)) {
+    filling_.reset(schema_);
+    thread_ = std::thread([this]() { run(); });
+}
+
+BlockPrefetcher::~BlockPrefetcher() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    space_cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void BlockPrefetcher::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        space_cv_.wait(lock, [this]() { return stopping_ || ready_.size() < depth_; });
+        if (stopping_) {
+            break;
+        }
+        lock.unlock();
+
+        bool fetched = false;
+        std::exception_ptr error;
+        try {
+            fetched = fetch_(filling_);
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+        if (!fetched) {
+            error_ = error;
+            break;
+        }
+        ready_.push_back(std::move(filling_));
+        if (!spare_.empty()) {
+            filling_ = std::move(spare_.back());
+            spare_.pop_back();
+        } else {
+            filling_ = ColumnarBatch();
+        }
+        if (filling_.num_columns() != schema_.size()) {
+            filling_.reset(schema_);
+        }
+        ready_cv_.notify_one();
+    }
+    finished_ = true;
+    ready_cv_.notify_one();
+}
+
+bool BlockPrefetcher::next(ColumnarBatch& batch) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    ready_cv_.wait(lock, [this]() { return !ready_.empty() || finished_; });
+    if (ready_.empty()) {
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+        return false;
+    }
+    spare_.push_back(std::move(batch));
+    batch = std::move(ready_.front());
+    ready_.pop_front();
+    lock.unlock();
+    space_cv_.notify_one();
+    return true;
+}
+
+} // namespace internal
+} // namespace databricks
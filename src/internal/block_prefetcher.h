@@ -0,0 +1,74 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "databricks/core/result_set.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace databricks {
+namespace internal {
+/**
+ * @brief Fetches result blocks on a background thread, up to depth blocks ahead of the consumer
+ *
+ * Overlaps the driver's network wait with the caller's processing: while the
+ * consumer works on the block next() gave it, the fetch thread fills the
+ * next ones. Blocks move between the two threads by swapping buffers, never
+ * by copying rows, and at most depth + 2 blocks exist (depth waiting, one
+ * being filled, one held by the consumer), so memory stays bounded.
+ *
+ * fetch always receives the same batch object, so a BlockFetcher keeps
+ * reusing its buffers instead of resetting them on every block.
+ *
+ * An exception thrown by fetch (including a CancelledError from a cancelled
+ * statement) is rethrown by next() once the blocks fetched before it are
+ * consumed. Destruction stops the thread; a fetch already in progress is
+ * waited for.
+ */
+class BlockPrefetcher {
+public:
+    /**
+     * @param fetch Fills the batch with the next block; false once the result set is exhausted
+     * @param schema Result schema, set on new buffers before their first fetch
+     * @param depth Most blocks fetched but not yet taken by next() (at least 1)
+     */
+    BlockPrefetcher(std::function<bool(ColumnarBatch&)> fetch, std::vector<ColumnMetadata> schema, size_t depth);
+    ~BlockPrefetcher();
+
+    BlockPrefetcher(const BlockPrefetcher&) = delete;
+    BlockPrefetcher& operator=(const BlockPrefetcher&) = delete;
+
+    /**
+     * @brief Replace batch with the next fetched block, handing batch's buffers back for reuse
+     * @return false once the result set is exhausted
+     */
+    bool next(ColumnarBatch& batch);
+
+private:
+    void run();
+
+    std::function<bool(ColumnarBatch&)> fetch_;
+    const std::vector<ColumnMetadata> schema_;
+    const size_t depth_;
+
+    std::mutex mutex_;
+    std::condition_variable ready_cv_; // Signals the consumer: a block is ready or fetching ended
+    std::condition_variable space_cv_; // Signals the fetch thread: a block was taken or stop was set
+    std::deque<ColumnarBatch> ready_;  // Fetched blocks, oldest first
+    std::vector<ColumnarBatch> spare_; // Buffers the consumer handed back
+    bool finished_ = false;            // The fetch thread is done (exhausted or failed)
+    bool stopping_ = false;
+    std::exception_ptr error_;
+    ColumnarBatch filling_; // Only touched by the fetch thread
+    std::thread thread_;
+};
+
+} // namespace internal
+} // namespace databricks
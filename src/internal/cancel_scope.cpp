@@ -0,0 +1,123 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "cancel_scope.h"
+
+#include "logger.h"
+#include "timer_queue.h"
+
+#include <algorithm>
+
+#include <sqlext.h>
+
+namespace databricks {
+namespace internal {
+// ========== CancelScope Implementation ==========
+
+CancelScope::CancelScope(const QueryOptions& options)
+    : timeout_(options.timeout)
+    , token_(options.cancel) {
+    if (timeout_.count() > 0) {
+        deadline_ = Clock::now() + timeout_;
+        timer_id_ = TimerQueue::instance().schedule(*deadline_, [this]() { fire(Reason::Timeout); });
+    }
+    if (token_) {
+        auto& state = *token_->state_;
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (state.cancelled) {
+            fire(Reason::Cancelled);
+        } else {
+            token_callback_ = state.next_id++;
+            state.callbacks.emplace(token_callback_, [this]() { fire(Reason::Cancelled); });
+        }
+    }
+}
+
+CancelScope::~CancelScope() {
+    // Both wait for a callback that is already running, so `this` outlives it
+    if (timer_id_ != 0) {
+        TimerQueue::instance().cancel(timer_id_);
+    }
+    if (token_callback_ != 0) {
+        auto& state = *token_->state_;
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.callbacks.erase(token_callback_);
+    }
+}
+
+void CancelScope::fire(Reason reason) {
+    Reason expected = Reason::None;
+    if (!reason_.compare_exchange_strong(expected, reason, std::memory_order_acq_rel)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (hstmt_ != SQL_NULL_HSTMT) {
+        DATABRICKS_LOG_DEBUG("Canceling statement: {}", reason == Reason::Timeout ? "timeout" : "token cancelled");
+        SQLCancel(hstmt_);
+    }
+}
+
+QueryOptions CancelScope::remaining() const {
+    QueryOptions options;
+    options.cancel = token_;
+    if (deadline_) {
+        auto left = std::chrono::duration_cast<std::chrono::milliseconds>(*deadline_ - Clock::now());
+        options.timeout = std::max(left, std::chrono::milliseconds(1));
+    }
+    return options;
+}
+
+CancelledError CancelScope::cancelled_error(std::vector<DiagnosticRecord> diagnostics) const {
+    if (reason_.load(std::memory_order_acquire) != Reason::Cancelled) {
+        return CancelledError("Query timed out after " + std::to_string(timeout_.count()) + "ms",
+                              std::move(diagnostics), true);
+    }
+    return CancelledError("Query cancelled", std::move(diagnostics), false);
+}
+
+void CancelScope::throw_if_fired() const {
+    if (fired()) {
+        throw cancelled_error();
+    }
+}
+
+// ========== CancelScope::Attachment Implementation ==========
+
+CancelScope::Attachment::Attachment(CancelScope* scope, SQLHSTMT hstmt)
+    : scope_(scope)
+    , hstmt_(hstmt) {
+    if (!scope_) {
+        return;
+    }
+    {
+        // fire() sets reason_ before taking the lock, so a scope that fires after this check still sees hstmt_
+        std::lock_guard<std::mutex> lock(scope_->mutex_);
+        if (scope_->fired()) {
+            // Fired while nothing was attached (acquiring, connecting, preparing or binding), so SQLCancel missed it
+            throw scope_->cancelled_error();
+        }
+        scope_->hstmt_ = hstmt_;
+    }
+    if (scope_->deadline_) {
+        // The driver's own timeout is a backstop should SQLCancel arrive before execution starts
+        auto left = std::chrono::duration_cast<std::chrono::seconds>(*scope_->deadline_ - Clock::now() +
+                                                                     std::chrono::milliseconds(999));
+        SQLULEN seconds = static_cast<SQLULEN>(std::max<int64_t>(left.count(), 1));
+        timeout_set_ = SQL_SUCCEEDED(SQLSetStmtAttr(hstmt_, SQL_ATTR_QUERY_TIMEOUT, (SQLPOINTER)seconds, 0));
+    }
+}
+
+CancelScope::Attachment::~Attachment() {
+    if (!scope_) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(scope_->mutex_);
+        scope_->hstmt_ = SQL_NULL_HSTMT;
+    }
+    if (timeout_set_) {
+        SQLSetStmtAttr(hstmt_, SQL_ATTR_QUERY_TIMEOUT, (SQLPOINTER)0, 0);
+    }
+}
+
+} // namespace internal
+} // namespace databricks
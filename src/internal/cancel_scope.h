@@ -0,0 +1,124 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "databricks/core/cancellation.h"
+#include "databricks/core/errors.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <sql.h>
+
+namespace databricks {
+/**
+ * @brief Shared state behind copies of a CancellationToken
+ */
+struct CancellationToken::State {
+    std::mutex mutex;
+    bool cancelled = false;
+    uint64_t next_id = 1;
+    std::map<uint64_t, std::function<void()>> callbacks; // Run under mutex by cancel()
+};
+
+namespace internal {
+/**
+ * @brief Enforces one call's QueryOptions on the statements it runs
+ *
+ * Arms a timer for the timeout and subscribes to the token. When either
+ * fires, the statement currently attached is cancelled with SQLCancel; the
+ * statement's pending call then fails (usually HY008), and cancelled_error()
+ * turns that failure into a CancelledError. Only the statement is cancelled,
+ * never the connection, so a pooled connection goes back to its pool ready
+ * for the next query.
+ *
+ * A scope spans retries: the deadline is fixed when it is created.
+ * Thread-safe.
+ */
+class CancelScope {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit CancelScope(const QueryOptions& options);
+    ~CancelScope();
+
+    CancelScope(const CancelScope&) = delete;
+    CancelScope& operator=(const CancelScope&) = delete;
+
+    /**
+     * @brief Makes a statement the one a firing scope cancels, for as long as this lives
+     *
+     * Must be destroyed before the statement is freed or recycled. Also sets
+     * SQL_ATTR_QUERY_TIMEOUT to the time left (rounded up to whole seconds) so
+     * the driver enforces the deadline too, and resets it to none on exit.
+     * A null scope makes this a no-op.
+     *
+     * @throws CancelledError if the scope has already fired, since nothing
+     *         would cancel the statement for it
+     */
+    class Attachment {
+    public:
+        Attachment(CancelScope* scope, SQLHSTMT hstmt);
+        ~Attachment();
+
+        Attachment(const Attachment&) = delete;
+        Attachment& operator=(const Attachment&) = delete;
+
+    private:
+        CancelScope* scope_;
+        SQLHSTMT hstmt_;
+        bool timeout_set_ = false;
+    };
+
+    /**
+     * @brief True once the timeout passed or the token was cancelled
+     */
+    bool fired() const { return reason_.load(std::memory_order_acquire) != Reason::None; }
+
+    bool timed_out() const { return reason_.load(std::memory_order_acquire) == Reason::Timeout; }
+
+    /**
+     * @brief Deadline from QueryOptions::timeout, if one was given
+     */
+    const std::optional<Clock::time_point>& deadline() const { return deadline_; }
+
+    /**
+     * @brief Options carrying the time left and the same token, for a call made on this scope's behalf
+     */
+    QueryOptions remaining() const;
+
+    /**
+     * @brief The error to report once fired() or past the deadline, carrying the driver's diagnostics if any
+     */
+    CancelledError cancelled_error(std::vector<DiagnosticRecord> diagnostics = {}) const;
+
+    /**
+     * @brief Throw cancelled_error() if the scope has fired
+     */
+    void throw_if_fired() const;
+
+private:
+    enum class Reason { None, Cancelled, Timeout };
+
+    void fire(Reason reason);
+
+    std::atomic<Reason> reason_{Reason::None};
+    std::optional<Clock::time_point> deadline_;
+    std::chrono::milliseconds timeout_;
+    std::optional<CancellationToken> token_;
+    uint64_t timer_id_ = 0;
+    uint64_t token_callback_ = 0;
+
+    std::mutex mutex_;                // Guards hstmt_; held while calling SQLCancel on it
+    SQLHSTMT hstmt_ = SQL_NULL_HSTMT; // Attached statement
+};
+
+} // namespace internal
+} // namespace databricks
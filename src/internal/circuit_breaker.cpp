@@ -0,0 +1,115 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "circuit_breaker.h"
+
+#include <algorithm>
+
+namespace databricks {
+namespace internal {
+namespace {
+int64_t seconds_of(CircuitBreaker::Clock::time_point t) {
+    return std::chrono::duration_cast<std::chrono::seconds>(t.time_since_epoch()).count();
+}
+} // namespace
+
+CircuitBreaker::CircuitBreaker(const RetryConfig& retry)
+    : failure_threshold_(retry.circuit_failure_threshold)
+    , open_duration_(std::chrono::milliseconds(retry.circuit_open_ms))
+    , budget_ratio_(retry.retry_budget_ratio)
+    , budget_min_per_second_(static_cast<double>(retry.retry_budget_min_per_second)) {}
+
+CircuitBreaker::Slot& CircuitBreaker::slot(int64_t second) {
+    Slot& s = slots_[static_cast<size_t>(second) % BUDGET_WINDOW_SECONDS];
+    int64_t seen = s.second.load(std::memory_order_acquire);
+    if (seen != second && s.second.compare_exchange_strong(seen, second, std::memory_order_acq_rel)) {
+        s.calls.store(0, std::memory_order_relaxed);
+        s.retries.store(0, std::memory_order_relaxed);
+    }
+    return s;
+}
+
+bool CircuitBreaker::allow() {
+    const Clock::time_point now = Clock::now();
+    if (state_.load(std::memory_order_acquire) != State::Closed) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        State state = state_.load(std::memory_order_relaxed);
+        if (state == State::Open) {
+            if (now - opened_at_ < open_duration_) {
+                return false;
+            }
+            state_.store(State::HalfOpen, std::memory_order_release);
+        } else if (state == State::HalfOpen && probe_in_flight_ && now - probe_started_ < open_duration_) {
+            // A probe that never reported back (its caller died) is replaced after open_duration_
+            return false;
+        }
+        if (state != State::Closed) {
+            probe_in_flight_ = true;
+            probe_started_ = now;
+        }
+    }
+    slot(seconds_of(now)).calls.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void CircuitBreaker::record_success() {
+    if (consecutive_failures_.load(std::memory_order_relaxed) != 0) {
+        consecutive_failures_.store(0, std::memory_order_relaxed);
+    }
+    if (state_.load(std::memory_order_acquire) != State::Closed) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        state_.store(State::Closed, std::memory_order_release);
+        probe_in_flight_ = false;
+    }
+}
+
+void CircuitBreaker::record_failure() {
+    if (failure_threshold_ == 0) {
+        return;
+    }
+    const size_t failures = consecutive_failures_.fetch_add(1, std::memory_order_relaxed) + 1;
+    State state = state_.load(std::memory_order_acquire);
+    if (state == State::HalfOpen || (state == State::Closed && failures >= failure_threshold_)) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (state_.load(std::memory_order_relaxed) != State::Open) {
+            open(Clock::now());
+        }
+    }
+}
+
+void CircuitBreaker::open(Clock::time_point now) {
+    state_.store(State::Open, std::memory_order_release);
+    opened_at_ = now;
+    probe_in_flight_ = false;
+    consecutive_failures_.store(0, std::memory_order_relaxed);
+}
+
+bool CircuitBreaker::try_acquire_retry() {
+    const int64_t now = seconds_of(Clock::now());
+    uint64_t calls = 0;
+    uint64_t retries = 0;
+    for (const Slot& s : slots_) {
+        if (s.second.load(std::memory_order_acquire) > now - static_cast<int64_t>(BUDGET_WINDOW_SECONDS)) {
+            calls += s.calls.load(std::memory_order_relaxed);
+            retries += s.retries.load(std::memory_order_relaxed);
+        }
+    }
+    const double window = static_cast<double>(BUDGET_WINDOW_SECONDS);
+    const double allowed = budget_ratio_ * static_cast<double>(calls) + budget_min_per_second_ * window;
+    if (static_cast<double>(retries) >= allowed) {
+        return false;
+    }
+    slot(now).retries.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+std::chrono::milliseconds CircuitBreaker::retry_after() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (state_.load(std::memory_order_relaxed) != State::Open) {
+        return std::chrono::milliseconds(0);
+    }
+    auto left = opened_at_ + open_duration_ - Clock::now();
+    return std::max(std::chrono::milliseconds(0), std::chrono::duration_cast<std::chrono::milliseconds>(left));
+}
+
+} // namespace internal
+} // namespace databricks
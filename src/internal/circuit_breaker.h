@@ -0,0 +1,106 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "databricks/core/config.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace databricks {
+namespace internal {
+/**
+ * @brief Circuit breaker and retry budget shared by every Client of one warehouse
+ *
+ * Closed: calls pass; RetryConfig::circuit_failure_threshold consecutive
+ * transient failures open the circuit. Open: calls are rejected without
+ * touching the driver for circuit_open_ms. Half-open: one probe call is let
+ * through; its success closes the circuit, its transient failure reopens it.
+ * Any outcome other than a transient failure (including a syntax error) counts
+ * as success, since the warehouse answered.
+ *
+ * The retry budget caps retries at retry_budget_ratio of the calls over the
+ * last ten seconds, plus retry_budget_min_per_second, so retries can't
+ * multiply the load on a struggling warehouse.
+ *
+ * The closed-circuit fast path (allow(), record_success()) takes no lock.
+ * Thread-safe.
+ */
+class CircuitBreaker {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    enum class State { Closed, Open, HalfOpen };
+
+    /**
+     * @param retry Thresholds and budget; the first Client for a warehouse sets them
+     */
+    explicit CircuitBreaker(const RetryConfig& retry);
+
+    CircuitBreaker(const CircuitBreaker&) = delete;
+    CircuitBreaker& operator=(const CircuitBreaker&) = delete;
+
+    /**
+     * @brief Check whether a call may go to the warehouse, and count it for the retry budget
+     * @return false while the circuit is open, or half-open with a probe already in flight
+     */
+    bool allow();
+
+    /**
+     * @brief Record a call that reached the warehouse
+     */
+    void record_success();
+
+    /**
+     * @brief Record a transient failure (timeout, lost connection, throttling)
+     */
+    void record_failure();
+
+    /**
+     * @brief Claim one retry from the budget
+     * @return false if the budget is spent; the caller should fail instead of retrying
+     */
+    bool try_acquire_retry();
+
+    /**
+     * @brief Time left until an open circuit lets a probe through (zero unless open)
+     */
+    std::chrono::milliseconds retry_after() const;
+
+    State state() const { return state_.load(std::memory_order_acquire); }
+
+private:
+    static constexpr size_t BUDGET_WINDOW_SECONDS = 10;
+
+    // Calls and retries counted in one second of the budget window (approximate: a slot
+    // being recycled for a new second may drop a concurrent increment)
+    struct Slot {
+        std::atomic<int64_t> second{-1};
+        std::atomic<uint64_t> calls{0};
+        std::atomic<uint64_t> retries{0};
+    };
+
+    Slot& slot(int64_t second);
+    void open(Clock::time_point now); // Requires mutex_
+
+    const size_t failure_threshold_; // 0 = never open
+    const Clock::duration open_duration_;
+    const double budget_ratio_;
+    const double budget_min_per_second_;
+
+    std::atomic<State> state_{State::Closed};
+    std::atomic<size_t> consecutive_failures_{0};
+    mutable std::mutex mutex_; // Guards state transitions and the fields below
+    Clock::time_point opened_at_;
+    Clock::time_point probe_started_;
+    bool probe_in_flight_ = false;
+
+    std::array<Slot, BUDGET_WINDOW_SECONDS> slots_;
+};
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,77 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "compression.h"
+
+#include <limits>
+#include <stdexcept>
+
+#include <zlib.h>
+
+namespace databricks {
+namespace internal {
+namespace {
+// zlib windowBits: 15 for the maximum window, +16 to write a gzip header, +32 to detect gzip or zlib
+constexpr int GZIP_WINDOW_BITS = 15 + 16;
+constexpr int AUTO_WINDOW_BITS = 15 + 32;
+constexpr size_t CHUNK_BYTES = 64 * 1024;
+
+void check_size(std::string_view data) {
+    if (data.size() > std::numeric_limits<uInt>::max()) {
+        throw std::runtime_error("Payload too large to compress");
+    }
+}
+} // namespace
+
+std::string gzip_compress(std::string_view data) {
+    check_size(data);
+
+    z_stream stream{};
+    if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, GZIP_WINDOW_BITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        throw std::runtime_error("Failed to initialize gzip compression");
+    }
+
+    // deflateBound gives the worst case, so a single deflate call finishes the stream
+    std::string out(deflateBound(&stream, static_cast<uLong>(data.size())), '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = static_cast<uInt>(data.size());
+    stream.next_out = reinterpret_cast<Bytef*>(&out[0]);
+    stream.avail_out = static_cast<uInt>(out.size());
+
+    int result = deflate(&stream, Z_FINISH);
+    out.resize(stream.total_out);
+    deflateEnd(&stream);
+    if (result != Z_STREAM_END) {
+        throw std::runtime_error("gzip compression failed");
+    }
+    return out;
+}
+
+std::string gzip_decompress(std::string_view data) {
+    check_size(data);
+
+    z_stream stream{};
+    if (inflateInit2(&stream, AUTO_WINDOW_BITS) != Z_OK) {
+        throw std::runtime_error("Failed to initialize gzip decompression");
+    }
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = static_cast<uInt>(data.size());
+
+    std::string out;
+    int result = Z_OK;
+    while (result == Z_OK) {
+        size_t offset = out.size();
+        out.resize(offset + CHUNK_BYTES);
+        stream.next_out = reinterpret_cast<Bytef*>(&out[offset]);
+        stream.avail_out = static_cast<uInt>(CHUNK_BYTES);
+        result = inflate(&stream, Z_NO_FLUSH);
+        out.resize(offset + CHUNK_BYTES - stream.avail_out);
+    }
+    inflateEnd(&stream);
+    if (result != Z_STREAM_END) {
+        throw std::runtime_error("Invalid or truncated gzip stream");
+    }
+    return out;
+}
+
+} // namespace internal
+} // namespace databricks
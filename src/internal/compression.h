@@ -0,0 +1,23 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace databricks {
+namespace internal {
+/**
+ * @brief Compress data into a gzip stream (RFC 1952), as sent with Content-Encoding: gzip
+ * @throws std::runtime_error if zlib fails
+ */
+std::string gzip_compress(std::string_view data);
+
+/**
+ * @brief Decompress a gzip or zlib stream
+ * @throws std::runtime_error if the input is not a complete, valid stream
+ */
+std::string gzip_decompress(std::string_view data);
+
+} // namespace internal
+} // namespace databricks
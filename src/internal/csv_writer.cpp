@@ -0,0 +1,106 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "csv_writer.h"
+
+#include <stdexcept>
+#include <utility>
+
+namespace databricks {
+namespace internal {
+namespace {
+// SQL string literal for a value that must not need escaping
+std::string literal(const std::string& value, const char* what) {
+    if (value.find_first_of("'\\") != std::string::npos) {
+        throw std::invalid_argument(std::string(what) + " must not contain quotes or backslashes: " + value);
+    }
+    return "'" + value + "'";
+}
+} // namespace
+
+CsvWriter::CsvWriter(std::vector<std::string> columns)
+    : columns_(std::move(columns)) {
+    if (columns_.empty()) {
+        throw std::invalid_argument("CsvWriter needs at least one column");
+    }
+    start_part();
+}
+
+void CsvWriter::start_part() {
+    text_.clear();
+    rows_ = 0;
+    for (size_t i = 0; i < columns_.size(); ++i) {
+        add_field(i, columns_[i], false);
+    }
+}
+
+void CsvWriter::add_field(size_t column, std::string_view value, bool null) {
+    if (column > 0) {
+        text_ += ',';
+    }
+    if (!null) {
+        text_ += '"';
+        for (char c : value) {
+            if (c == '"') {
+                text_ += '"';
+            }
+            text_ += c;
+        }
+        text_ += '"';
+    }
+    if (column + 1 == columns_.size()) {
+        text_ += '\n';
+    }
+}
+
+void CsvWriter::add_row(const std::vector<std::string>& values) {
+    if (values.size() != columns_.size()) {
+        throw std::invalid_argument("Row has " + std::to_string(values.size()) + " values, expected " +
+                                    std::to_string(columns_.size()));
+    }
+    for (size_t i = 0; i < values.size(); ++i) {
+        add_field(i, values[i], false);
+    }
+    ++rows_;
+}
+
+void CsvWriter::add_rows(const ColumnarBatch& batch, size_t begin, size_t end) {
+    if (batch.num_columns() != columns_.size()) {
+        throw std::invalid_argument("Batch has " + std::to_string(batch.num_columns()) + " columns, expected " +
+                                    std::to_string(columns_.size()));
+    }
+    for (size_t row = begin; row < end; ++row) {
+        for (size_t col = 0; col < columns_.size(); ++col) {
+            add_field(col, batch.value(row, col), batch.is_null(row, col));
+        }
+        ++rows_;
+    }
+}
+
+std::string CsvWriter::take() {
+    std::string part = std::move(text_);
+    start_part();
+    return part;
+}
+
+std::string copy_into_statement(const std::string& table, const std::string& directory,
+                                const std::map<std::string, std::string>& copy_options) {
+    if (table.empty()) {
+        throw std::invalid_argument("COPY INTO needs a target table");
+    }
+    std::string sql = "COPY INTO " + table + " FROM " + literal(directory, "Staging path") +
+                      " FILEFORMAT = CSV FORMAT_OPTIONS ('header' = 'true', 'multiLine' = 'true', 'escape' = '\"')";
+    if (!copy_options.empty()) {
+        sql += " COPY_OPTIONS (";
+        bool first = true;
+        for (const auto& [name, value] : copy_options) {
+            sql += first ? "" : ", ";
+            sql += literal(name, "COPY_OPTIONS name") + " = " + literal(value, "COPY_OPTIONS value");
+            first = false;
+        }
+        sql += ")";
+    }
+    return sql;
+}
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,68 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "databricks/core/result_set.h"
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace databricks {
+namespace internal {
+/**
+ * @brief Builds one CSV part file for a COPY INTO load
+ *
+ * Every part starts with a header row of the column names. Every value is
+ * quoted, with embedded quotes doubled, so commas, quotes and newlines in the
+ * data survive; a NULL is an empty unquoted field, which COPY INTO reads as
+ * NULL while "" stays an empty string. Read it back with the format options
+ * copy_into_statement() sets.
+ */
+class CsvWriter {
+public:
+    explicit CsvWriter(std::vector<std::string> columns);
+
+    /**
+     * @throws std::invalid_argument if the row does not have one value per column
+     */
+    void add_row(const std::vector<std::string>& values);
+
+    /**
+     * @brief Append rows [begin, end) of a batch, NULLs included
+     * @throws std::invalid_argument if the batch does not have one column per column name
+     */
+    void add_rows(const ColumnarBatch& batch, size_t begin, size_t end);
+
+    size_t rows() const { return rows_; }
+    size_t bytes() const { return text_.size(); }
+
+    /**
+     * @brief Hand over the part written so far and start the next one
+     */
+    std::string take();
+
+private:
+    void start_part();
+    void add_field(size_t column, std::string_view value, bool null);
+
+    std::vector<std::string> columns_;
+    std::string text_;
+    size_t rows_ = 0;
+};
+
+/**
+ * @brief COPY INTO statement loading every CSV part written by CsvWriter under directory
+ *
+ * @param table Target table, as it would appear in SQL (e.g. main.sales.orders)
+ * @param directory Staging directory, e.g. /Volumes/main/etl/staging/ingest-3f2a
+ * @param copy_options COPY_OPTIONS entries; none = no COPY_OPTIONS clause
+ * @throws std::invalid_argument if the table is empty or a path or option contains a quote or backslash
+ */
+std::string copy_into_statement(const std::string& table, const std::string& directory,
+                                const std::map<std::string, std::string>& copy_options);
+
+} // namespace internal
+} // namespace databricks
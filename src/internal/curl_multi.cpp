@@ -0,0 +1,217 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "curl_multi.h"
+
+#include "logger.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace databricks {
+namespace internal {
+namespace {
+// Upper bound on one curl_multi_poll wait; submissions and shutdown wake the loop early
+constexpr int MAX_POLL_MS = 1000;
+} // namespace
+
+CurlMulti::CurlMulti(std::shared_ptr<CurlSession> session, size_t max_in_flight, bool http2)
+    : session_(std::move(session))
+    , max_in_flight_(std::max<size_t>(max_in_flight, 1))
+    , http2_(http2)
+    , multi_(curl_multi_init()) {
+    if (!multi_) {
+        throw std::runtime_error("Failed to initialize CURL multi handle");
+    }
+    curl_multi_setopt(multi_, CURLMOPT_PIPELINING, http2_ ? CURLPIPE_MULTIPLEX : CURLPIPE_NOTHING);
+    curl_multi_setopt(multi_, CURLMOPT_MAX_TOTAL_CONNECTIONS, static_cast<long>(max_in_flight_));
+
+    thread_ = std::thread([this]() { run(); });
+}
+
+CurlMulti::~CurlMulti() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    curl_multi_wakeup(multi_);
+    thread_.join();
+    curl_multi_cleanup(multi_);
+}
+
+bool CurlMulti::submit(Request request) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_) {
+            return false;
+        }
+        queued_.push_back(std::move(request));
+    }
+    curl_multi_wakeup(multi_);
+    return true;
+}
+
+void CurlMulti::run() {
+    using Clock = std::chrono::steady_clock;
+
+    while (true) {
+        std::vector<Request> ready;
+        Clock::time_point next_start = Clock::time_point::max();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (stopping_) {
+                break;
+            }
+
+            // Start due requests in submission order while there is capacity
+            const Clock::time_point now = Clock::now();
+            for (auto it = queued_.begin(); it != queued_.end();) {
+                if (active_.size() + ready.size() >= max_in_flight_) {
+                    break;
+                }
+                if (it->not_before <= now) {
+                    ready.push_back(std::move(*it));
+                    it = queued_.erase(it);
+                } else {
+                    next_start = std::min(next_start, it->not_before);
+                    ++it;
+                }
+            }
+        }
+
+        for (auto& request : ready) {
+            start(std::move(request));
+        }
+
+        int running = 0;
+        curl_multi_perform(multi_, &running);
+        finish_completed();
+
+        int timeout_ms = MAX_POLL_MS;
+        if (next_start != Clock::time_point::max()) {
+            auto until_next = std::chrono::duration_cast<std::chrono::milliseconds>(next_start - Clock::now()).count();
+            timeout_ms = static_cast<int>(std::clamp<long long>(until_next, 0, MAX_POLL_MS));
+        }
+        curl_multi_poll(multi_, nullptr, 0, timeout_ms, nullptr);
+    }
+
+    cancel_all();
+}
+
+void CurlMulti::start(Request request) {
+    std::unique_ptr<Transfer> transfer;
+    try {
+        CurlSession::Lease lease = session_->acquire();
+        transfer.reset(new Transfer{std::move(request), std::move(lease), HttpResponse{}, ResponseWriter{}, {}});
+    } catch (const std::exception& e) {
+        complete(request.on_complete, Result{HttpResponse{}, e.what(), false});
+        return;
+    }
+
+    CURL* curl = transfer->lease.get();
+    const Request& req = transfer->request;
+
+    transfer->writer.response = &transfer->response;
+    curl_easy_setopt(curl, CURLOPT_URL, req.url.c_str());
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, curl_write_body);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &transfer->writer);
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, curl_collect_header);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, &transfer->writer);
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT, req.timeout_seconds);
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, req.headers.get());
+    if (req.accept_compressed) {
+        curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, ""); // Every encoding libcurl can decode
+    }
+    if (req.post) {
+        curl_easy_setopt(curl, CURLOPT_POST, 1L);
+        curl_easy_setopt(curl, CURLOPT_POSTFIELDS, req.body.c_str());
+        curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE_LARGE, static_cast<curl_off_t>(req.body.size()));
+    } else {
+        curl_easy_setopt(curl, CURLOPT_HTTPGET, 1L);
+    }
+    if (http2_) {
+        curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+        curl_easy_setopt(curl, CURLOPT_PIPEWAIT, 1L);
+    }
+
+    CURLMcode added = curl_multi_add_handle(multi_, curl);
+    if (added != CURLM_OK) {
+        complete(transfer->request.on_complete, Result{HttpResponse{}, curl_multi_strerror(added), false});
+        return;
+    }
+
+    // Path only: the query string of a presigned link is its credential
+    DATABRICKS_LOG_DEBUG("HTTP {} (async): {}", req.post ? "POST" : "GET",
+                         std::string_view(req.url).substr(0, req.url.find('?')));
+    transfer->started = std::chrono::steady_clock::now();
+    active_.emplace(curl, std::move(transfer));
+    in_flight_++;
+}
+
+void CurlMulti::finish_completed() {
+    int remaining = 0;
+    while (CURLMsg* msg = curl_multi_info_read(multi_, &remaining)) {
+        if (msg->msg != CURLMSG_DONE) {
+            continue;
+        }
+        CURL* curl = msg->easy_handle;
+        CURLcode code = msg->data.result;
+        curl_multi_remove_handle(multi_, curl);
+
+        auto it = active_.find(curl);
+        if (it == active_.end()) {
+            continue;
+        }
+        std::unique_ptr<Transfer> transfer = std::move(it->second);
+        active_.erase(it);
+        in_flight_--;
+
+        Result result{std::move(transfer->response), std::string(), false,
+                      std::chrono::steady_clock::now() - transfer->started};
+        if (code != CURLE_OK) {
+            result.error = "CURL request failed: " + std::string(curl_easy_strerror(code));
+        } else {
+            long http_code = 0;
+            curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &http_code);
+            result.response.status_code = static_cast<int>(http_code);
+        }
+
+        // Hand the handle back before the completion so a retry can reuse it
+        Completion on_complete = std::move(transfer->request.on_complete);
+        transfer.reset();
+        complete(on_complete, std::move(result));
+    }
+}
+
+void CurlMulti::cancel_all() {
+    for (auto& [curl, transfer] : active_) {
+        curl_multi_remove_handle(multi_, curl);
+        complete(transfer->request.on_complete, Result{HttpResponse{}, "HTTP client shut down", true});
+    }
+    active_.clear();
+    in_flight_ = 0;
+
+    std::deque<Request> queued;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queued.swap(queued_);
+    }
+    for (auto& request : queued) {
+        complete(request.on_complete, Result{HttpResponse{}, "HTTP client shut down", true});
+    }
+}
+
+void CurlMulti::complete(Completion& on_complete, Result&& result) {
+    if (!on_complete) {
+        return;
+    }
+    try {
+        on_complete(std::move(result));
+    } catch (const std::exception& e) {
+        DATABRICKS_LOG_ERROR("HTTP completion handler threw: {}", e.what());
+    }
+}
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,121 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "curl_session.h"
+#include "http_client_interface.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include <curl/curl.h>
+
+namespace databricks {
+namespace internal {
+/**
+ * @brief Event loop running many HTTP requests concurrently on one curl_multi handle
+ *
+ * A background thread drives libcurl's multi interface. With HTTP/2 enabled,
+ * requests to the same host are multiplexed as streams over a single
+ * connection (CURLPIPE_MULTIPLEX plus CURLOPT_PIPEWAIT, so new requests wait for
+ * an existing connection instead of opening another). At most max_in_flight
+ * requests are handed to libcurl; the rest wait in submission order. Easy
+ * handles are leased from a CurlSession so DNS, TLS sessions and connections
+ * are shared with synchronous requests.
+ *
+ * Completions run on the engine thread and must not block; they may submit()
+ * follow-up requests (e.g. retries). Thread-safe.
+ */
+class CurlMulti {
+public:
+    /**
+     * @brief Outcome of one request
+     */
+    struct Result {
+        HttpResponse response;              ///< Response (valid when error is empty)
+        std::string error;                  ///< Transport error message, empty on success
+        bool cancelled;                     ///< Request was dropped because the engine shut down
+        std::chrono::nanoseconds elapsed{}; ///< Time from handing the request to libcurl until it finished
+    };
+
+    using Completion = std::function<void(Result&&)>;
+
+    /**
+     * @brief One request to perform
+     */
+    struct Request {
+        std::string url;                                       ///< Absolute URL
+        bool post = false;                                     ///< POST body instead of GET
+        std::string body;                                      ///< POST payload
+        bool accept_compressed = false;                        ///< Negotiate gzip/deflate responses
+        std::shared_ptr<curl_slist> headers;                   ///< Request headers (kept alive by the engine)
+        long timeout_seconds = 60;                             ///< CURLOPT_TIMEOUT
+        std::chrono::steady_clock::time_point not_before = {}; ///< Earliest start time (for delayed retries)
+        Completion on_complete;                                ///< Called exactly once with the outcome
+    };
+
+    /**
+     * @param session Source of easy handles
+     * @param max_in_flight Requests libcurl runs at once (at least 1)
+     * @param http2 Negotiate HTTP/2 over TLS and multiplex requests on one connection
+     * @throws std::runtime_error if libcurl cannot create the multi handle
+     */
+    CurlMulti(std::shared_ptr<CurlSession> session, size_t max_in_flight, bool http2);
+
+    /**
+     * @brief Stop the engine; unfinished requests complete with Result::cancelled set
+     */
+    ~CurlMulti();
+
+    CurlMulti(const CurlMulti&) = delete;
+    CurlMulti& operator=(const CurlMulti&) = delete;
+
+    /**
+     * @brief Queue a request
+     * @return false (without calling on_complete) if the engine is shutting down
+     */
+    bool submit(Request request);
+
+    size_t in_flight() const { return in_flight_.load(); }
+    size_t max_in_flight() const { return max_in_flight_; }
+
+private:
+    // A request handed to libcurl, with the buffers its handle writes into
+    struct Transfer {
+        Request request;
+        CurlSession::Lease lease;
+        HttpResponse response;
+        ResponseWriter writer;
+        std::chrono::steady_clock::time_point started;
+    };
+
+    void run();
+    void start(Request request);
+    void finish_completed();
+    void cancel_all();
+    static void complete(Completion& on_complete, Result&& result);
+
+    std::shared_ptr<CurlSession> session_;
+    size_t max_in_flight_;
+    bool http2_;
+    CURLM* multi_;
+
+    std::mutex mutex_;
+    std::deque<Request> queued_; // Guarded by mutex_
+    bool stopping_ = false;      // Guarded by mutex_
+
+    std::unordered_map<CURL*, std::unique_ptr<Transfer>> active_; // Engine thread only
+    std::atomic<size_t> in_flight_{0};
+    std::thread thread_;
+};
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,197 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "curl_session.h"
+
+#include "logger.h"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <stdexcept>
+
+namespace databricks {
+namespace internal {
+namespace {
+// curl_global_init is not thread-safe; run it exactly once, before any handle exists
+void ensure_curl_initialized() {
+    static std::once_flag once;
+    std::call_once(once, []() { curl_global_init(CURL_GLOBAL_DEFAULT); });
+}
+} // namespace
+
+// ========== CurlSession::Lease Implementation ==========
+
+CurlSession::Lease::~Lease() {
+    if (handle_) {
+        session_->release(handle_);
+    }
+}
+
+// ========== CurlSession Implementation ==========
+
+CurlSession::CurlSession(size_t max_idle_handles)
+    : share_(nullptr)
+    , max_idle_handles_(max_idle_handles) {
+    ensure_curl_initialized();
+
+    share_ = curl_share_init();
+    if (!share_) {
+        throw std::runtime_error("Failed to initialize CURL share handle");
+    }
+    curl_share_setopt(share_, CURLSHOPT_LOCKFUNC, lock_callback);
+    curl_share_setopt(share_, CURLSHOPT_UNLOCKFUNC, unlock_callback);
+    curl_share_setopt(share_, CURLSHOPT_USERDATA, this);
+    curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+}
+
+CurlSession::~CurlSession() {
+    // Easy handles must be detached from the share before it can be cleaned up
+    for (CURL* handle : idle_) {
+        curl_easy_cleanup(handle);
+    }
+    idle_.clear();
+    curl_share_cleanup(share_);
+}
+
+std::shared_ptr<CurlSession> CurlSession::shared() {
+    static std::shared_ptr<CurlSession> session = std::make_shared<CurlSession>();
+    return session;
+}
+
+CurlSession::Lease CurlSession::acquire() {
+    CURL* handle = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        if (!idle_.empty()) {
+            handle = idle_.back();
+            idle_.pop_back();
+        }
+    }
+
+    if (handle) {
+        // Clears the previous request's options but keeps the handle's caches
+        curl_easy_reset(handle);
+    } else {
+        handle = curl_easy_init();
+        if (!handle) {
+            throw std::runtime_error("Failed to initialize CURL");
+        }
+    }
+
+    prepare(handle);
+    return Lease(this, handle);
+}
+
+void CurlSession::prepare(CURL* handle) {
+    curl_easy_setopt(handle, CURLOPT_SHARE, share_);
+    curl_easy_setopt(handle, CURLOPT_TCP_KEEPALIVE, 1L);
+    curl_easy_setopt(handle, CURLOPT_NOSIGNAL, 1L); // Required for multi-threaded use
+}
+
+void CurlSession::release(CURL* handle) {
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        if (idle_.size() < max_idle_handles_) {
+            idle_.push_back(handle);
+            return;
+        }
+    }
+    curl_easy_cleanup(handle);
+}
+
+size_t CurlSession::idle_handles() const {
+    std::lock_guard<std::mutex> lock(pool_mutex_);
+    return idle_.size();
+}
+
+void CurlSession::lock_callback(CURL* /*handle*/, curl_lock_data data, curl_lock_access /*access*/, void* userptr) {
+    auto* session = static_cast<CurlSession*>(userptr);
+    session->share_locks_[static_cast<size_t>(data)].lock();
+}
+
+void CurlSession::unlock_callback(CURL* /*handle*/, curl_lock_data data, void* userptr) {
+    auto* session = static_cast<CurlSession*>(userptr);
+    session->share_locks_[static_cast<size_t>(data)].unlock();
+}
+
+// ========== libcurl callbacks ==========
+
+namespace {
+// Largest body reserved from Content-Length; bigger responses grow as they arrive
+constexpr size_t MAX_RESERVE_BYTES = 64 * 1024 * 1024;
+
+std::string_view trim(std::string_view text) {
+    size_t first = text.find_first_not_of(" \t\r\n");
+    if (first == std::string_view::npos) {
+        return {};
+    }
+    return text.substr(first, text.find_last_not_of(" \t\r\n") - first + 1);
+}
+
+template <typename Number> Number parse_number(std::string_view text) {
+    Number value = 0;
+    std::from_chars(text.data(), text.data() + text.size(), value);
+    return value;
+}
+
+bool iequals(std::string_view a, std::string_view b) {
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+               return std::tolower(static_cast<unsigned char>(x)) == std::tolower(static_cast<unsigned char>(y));
+           });
+}
+} // namespace
+
+size_t curl_write_body(void* contents, size_t size, size_t nmemb, void* userp) {
+    size_t total_size = size * nmemb;
+    auto* writer = static_cast<ResponseWriter*>(userp);
+
+    if (writer->on_chunk && writer->response->status_code == 200) {
+        try {
+            (*writer->on_chunk)(std::string_view(static_cast<char*>(contents), total_size));
+        } catch (...) {
+            writer->error = std::current_exception();
+            return 0; // Abort the transfer (CURLE_WRITE_ERROR)
+        }
+        writer->streamed += total_size;
+        return total_size;
+    }
+
+    writer->response->body.append(static_cast<char*>(contents), total_size);
+    return total_size;
+}
+
+size_t curl_collect_header(char* buffer, size_t size, size_t nitems, void* userdata) {
+    size_t total_size = size * nitems;
+    auto* writer = static_cast<ResponseWriter*>(userdata);
+    HttpResponse& response = *writer->response;
+
+    std::string_view line(buffer, total_size);
+
+    // "HTTP/1.1 200 OK" or "HTTP/2 200"
+    if (line.compare(0, 5, "HTTP/") == 0) {
+        size_t code_pos = line.find(' ');
+        response.status_code = code_pos == std::string_view::npos ? 0 : parse_number<int>(line.substr(code_pos + 1));
+        response.headers.clear();
+        return total_size;
+    }
+
+    // Parse "Key: Value" format
+    size_t colon_pos = line.find(':');
+    if (colon_pos != std::string_view::npos) {
+        std::string_view key = line.substr(0, colon_pos);
+        std::string_view value = trim(line.substr(colon_pos + 1));
+
+        if (iequals(key, "Content-Length") && !writer->on_chunk) {
+            response.body.reserve(std::min(parse_number<size_t>(value), MAX_RESERVE_BYTES));
+        }
+
+        response.headers[std::string(key)].assign(value.data(), value.size());
+    }
+
+    return total_size;
+}
+
+} // namespace internal
+} // namespace databricks
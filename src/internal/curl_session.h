@@ -0,0 +1,134 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "http_client_interface.h"
+
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <curl/curl.h>
+
+namespace databricks {
+namespace internal {
+/**
+ * @brief Pool of reusable libcurl easy handles over one shared cache
+ *
+ * Every handle is attached to a CURLSH that shares the DNS cache, TLS sessions
+ * and the connection cache, so consecutive requests to the same workspace reuse
+ * an open keep-alive connection instead of paying DNS, TCP and TLS setup each
+ * time. Handles are reset between requests (curl_easy_reset keeps their caches)
+ * and handed back to the pool when a Lease is destroyed.
+ *
+ * Thread-safe. The shared() session is used by every HttpClient in the process.
+ */
+class CurlSession {
+public:
+    /**
+     * @brief RAII checkout of one easy handle
+     *
+     * The handle comes with the share attached and the session's default options
+     * set; callers add per-request options only.
+     */
+    class Lease {
+    public:
+        Lease(CurlSession* session, CURL* handle)
+            : session_(session)
+            , handle_(handle) {}
+        ~Lease();
+
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        Lease(Lease&& other) noexcept
+            : session_(other.session_)
+            , handle_(other.handle_) {
+            other.handle_ = nullptr;
+        }
+        Lease& operator=(Lease&&) = delete;
+
+        CURL* get() const { return handle_; }
+
+    private:
+        CurlSession* session_;
+        CURL* handle_;
+    };
+
+    /**
+     * @param max_idle_handles Handles kept for reuse; extra returned handles are freed
+     */
+    explicit CurlSession(size_t max_idle_handles = 32);
+    ~CurlSession();
+
+    CurlSession(const CurlSession&) = delete;
+    CurlSession& operator=(const CurlSession&) = delete;
+
+    /**
+     * @brief The process-wide session
+     */
+    static std::shared_ptr<CurlSession> shared();
+
+    /**
+     * @brief Check out a handle, creating one if none is idle
+     * @throws std::runtime_error if libcurl cannot create a handle
+     */
+    Lease acquire();
+
+    /**
+     * @brief Apply the options every request from this session uses
+     *
+     * Exposed so handles driven by curl_multi get the same setup.
+     */
+    void prepare(CURL* handle);
+
+    /**
+     * @brief Return a handle for reuse (called by Lease)
+     */
+    void release(CURL* handle);
+
+    size_t idle_handles() const;
+
+private:
+    static void lock_callback(CURL* handle, curl_lock_data data, curl_lock_access access, void* userptr);
+    static void unlock_callback(CURL* handle, curl_lock_data data, void* userptr);
+
+    CURLSH* share_;
+    std::array<std::mutex, CURL_LOCK_DATA_LAST> share_locks_;
+    size_t max_idle_handles_;
+    mutable std::mutex pool_mutex_;
+    std::vector<CURL*> idle_;
+};
+
+/**
+ * @brief Destination of one transfer, passed as both WRITEDATA and HEADERDATA
+ *
+ * The body is reserved up front from Content-Length, so a buffered response is
+ * written into a single allocation. With on_chunk set, a 200 body is handed to
+ * the callback straight from libcurl's buffer instead of being stored.
+ */
+struct ResponseWriter {
+    HttpResponse* response = nullptr;            ///< Receives status, headers and (unless streamed) body
+    const BodyChunkCallback* on_chunk = nullptr; ///< Consumer of a 200 body, or null to buffer it
+    size_t streamed = 0;                         ///< Bytes handed to on_chunk
+    std::exception_ptr error;                    ///< Thrown by on_chunk; the transfer was aborted
+};
+
+/**
+ * @brief CURLOPT_WRITEFUNCTION for a ResponseWriter passed as userp
+ */
+size_t curl_write_body(void* contents, size_t size, size_t nmemb, void* userp);
+
+/**
+ * @brief CURLOPT_HEADERFUNCTION for a ResponseWriter passed as userdata
+ *
+ * Records the status line and "Key: Value" headers; a new status line (after
+ * 100 Continue) starts a fresh header set.
+ */
+size_t curl_collect_header(char* buffer, size_t size, size_t nitems, void* userdata);
+
+} // namespace internal
+} // namespace databricks
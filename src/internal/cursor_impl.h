@@ -0,0 +1,45 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "databricks/connection_pool.h"
+#include "databricks/core/cursor.h"
+
+#include "block_prefetcher.h"
+#include "cancel_scope.h"
+#include "odbc_statement.h"
+
+#include <memory>
+#include <optional>
+
+namespace databricks {
+/**
+ * @brief Private implementation of Cursor (shared by Client, which creates cursors)
+ *
+ * Member order matters: members are destroyed in reverse, so the fetcher unbinds
+ * first, then the statement is freed, and only then is the pooled connection
+ * returned to its pool. The cancel scope lets go of the statement before any
+ * of them, and the prefetch thread (which uses the fetcher and the scope) is
+ * stopped first of all.
+ */
+class Cursor::Impl {
+public:
+    std::unique_ptr<ConnectionPool::PooledConnection> connection; // Checked-out connection (pooled clients only)
+    internal::StatementHandle stmt;
+    std::unique_ptr<internal::BlockFetcher> fetcher;
+    ColumnarBatch block;
+    size_t position = 0; // Next unconsumed row in block
+    bool exhausted = false;
+    std::unique_ptr<internal::CancelScope> scope;               // Options the cursor was opened with (if any)
+    std::optional<internal::CancelScope::Attachment> cancel_on; // Lets scope cancel stmt while fetching
+    size_t prefetch_blocks = 0;                                 // SQLConfig::prefetch_blocks (0 = fetch inline)
+    std::unique_ptr<internal::BlockPrefetcher> prefetcher;      // Started by the first fetch when prefetching
+
+    Impl(internal::StatementHandle statement, size_t block_rows, size_t max_column_bytes, bool bound_rereads,
+         size_t prefetch = 0)
+        : stmt(std::move(statement))
+        , fetcher(std::make_unique<internal::BlockFetcher>(stmt.get(), block_rows, max_column_bytes, bound_rereads))
+        , prefetch_blocks(prefetch) {}
+};
+
+} // namespace databricks
@@ -0,0 +1,109 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "executor.h"
+
+#include "logger.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace databricks {
+namespace internal {
+namespace {
+// Executor whose worker is running on this thread, if any
+thread_local const Executor* current_executor = nullptr;
+} // namespace
+
+// ========== Executor Implementation ==========
+
+Executor::Executor(size_t worker_threads, size_t max_pending)
+    : max_pending_(std::max<size_t>(max_pending, 1)) {
+    worker_threads = std::max<size_t>(worker_threads, 1);
+    workers_.reserve(worker_threads);
+    for (size_t i = 0; i < worker_threads; i++) {
+        workers_.emplace_back([this]() { worker_loop(); });
+    }
+    DATABRICKS_LOG_DEBUG("Started executor with {} worker(s), queue limit {}", worker_threads, max_pending_);
+}
+
+Executor::~Executor() {
+    shutdown();
+}
+
+void Executor::post(Task task) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (stopping_) {
+        throw std::runtime_error("Executor has been shut down");
+    }
+
+    if (queue_.size() >= max_pending_) {
+        if (current_executor == this) {
+            // Blocking a worker on its own queue could deadlock; run the task here instead
+            lock.unlock();
+            task();
+            return;
+        }
+        not_full_.wait(lock, [this]() { return stopping_ || queue_.size() < max_pending_; });
+        if (stopping_) {
+            throw std::runtime_error("Executor has been shut down");
+        }
+    }
+
+    queue_.push_back(std::move(task));
+    lock.unlock();
+    not_empty_.notify_one();
+}
+
+void Executor::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_) {
+            return;
+        }
+        stopping_ = true;
+    }
+    not_empty_.notify_all();
+    not_full_.notify_all();
+
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+size_t Executor::pending() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.size();
+}
+
+void Executor::worker_loop() {
+    current_executor = this;
+
+    while (true) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            not_empty_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+            // Drain the queue before exiting so every submitted future is satisfied
+            if (queue_.empty()) {
+                return;
+            }
+            task = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        not_full_.notify_one();
+
+        try {
+            task();
+        } catch (const std::exception& e) {
+            // submit() captures exceptions in the future; only raw post() tasks land here
+            DATABRICKS_LOG_ERROR("Unhandled exception in executor task: {}", e.what());
+        } catch (...) {
+            DATABRICKS_LOG_ERROR("Unhandled exception in executor task");
+        }
+    }
+}
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,85 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace databricks {
+namespace internal {
+/**
+ * @brief Fixed-size thread pool with a bounded task queue
+ *
+ * Runs blocking work (ODBC calls) on a fixed number of worker threads instead of
+ * a thread per call. When max_pending tasks are already queued, post() and
+ * submit() block until a worker frees a slot, so callers fanning out many
+ * operations are throttled rather than piling up unbounded work. Tasks posted
+ * from one of this executor's own workers never block; they run inline so a
+ * saturated executor can't deadlock on itself.
+ *
+ * Destroying the executor runs any tasks still queued and joins the workers.
+ * Thread-safe.
+ */
+class Executor {
+public:
+    using Task = std::function<void()>;
+
+    /**
+     * @param worker_threads Number of worker threads (at least 1)
+     * @param max_pending Queued tasks allowed before post() blocks (at least 1)
+     */
+    Executor(size_t worker_threads, size_t max_pending);
+    ~Executor();
+
+    Executor(const Executor&) = delete;
+    Executor& operator=(const Executor&) = delete;
+
+    /**
+     * @brief Queue a task, blocking while the queue is full
+     * @throws std::runtime_error if the executor has been shut down
+     */
+    void post(Task task);
+
+    /**
+     * @brief Queue a callable and return a future for its result
+     *
+     * Exceptions thrown by func are delivered through the future.
+     */
+    template <typename Func> auto submit(Func&& func) -> std::future<decltype(func())> {
+        using Result = decltype(func());
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Func>(func));
+        std::future<Result> future = task->get_future();
+        post([task]() { (*task)(); });
+        return future;
+    }
+
+    /**
+     * @brief Stop accepting tasks, run the ones already queued and join the workers
+     */
+    void shutdown();
+
+    size_t worker_count() const { return workers_.size(); }
+    size_t pending() const;
+
+private:
+    void worker_loop();
+
+    size_t max_pending_;
+    mutable std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    std::deque<Task> queue_;
+    std::vector<std::thread> workers_;
+    bool stopping_ = false;
+};
+
+} // namespace internal
+} // namespace databricks
@@ -2,9 +2,21 @@
 // SPDX-License-Identifier: MIT
 #include "http_client.h"
 
+#include "compression.h"
+#include "curl_multi.h"
+#include "curl_session.h"
 #include "logger.h"
+#include "metrics.h"
+#include "rate_limiter.h"
+#include "tracing.h"
 
+#include <algorithm>
+#include <cctype>
 #include <chrono>
+#include <cmath>
+#include <exception>
+#include <future>
+#include <random>
 #include <sstream>
 #include <stdexcept>
 #include <thread>
@@ -13,60 +25,284 @@
 
 namespace databricks {
 namespace internal {
-// Callback for libcurl to write response body
-static size_t write_callback(void* contents, size_t size, size_t nmemb, void* userp) {
-    size_t total_size = size * nmemb;
-    std::string* response_str = static_cast<std::string*>(userp);
-    response_str->append(static_cast<char*>(contents), total_size);
-    return total_size;
+// Zero every header (the Authorization line holds the token) before freeing the list
+static void free_header_list(curl_slist* headers) {
+    for (curl_slist* node = headers; node; node = node->next) {
+        volatile char* p = node->data;
+        while (*p) {
+            *p++ = 0;
+        }
+    }
+    curl_slist_free_all(headers);
 }
 
-// Callback for libcurl to capture response headers
-static size_t header_callback(char* buffer, size_t size, size_t nitems, void* userdata) {
-    size_t total_size = size * nitems;
-    auto* headers = static_cast<std::map<std::string, std::string>*>(userdata);
+namespace {
+// Failure after part of a streamed body reached the consumer; retrying would deliver it twice
+class StreamAborted : public std::runtime_error {
+public:
+    StreamAborted(const std::string& message, std::exception_ptr cause)
+        : std::runtime_error(message)
+        , cause(std::move(cause)) {}
+
+    std::exception_ptr cause; // The consumer's exception, or null for a transport error
+};
+
+// Record one attempt's latency and outcome; status_code is 0 for a transport error
+void record_attempt(MetricsSink* sink, const char* method, const std::string& endpoint,
+                    std::chrono::nanoseconds elapsed, int status_code) {
+    if (!sink) {
+        return;
+    }
+    MetricLabels labels;
+    labels.method = method;
+    labels.endpoint = endpoint;
+    sink->observe(MetricTimer::HttpRequest, elapsed, labels);
+    labels.status_code = status_code;
+    sink->add(MetricCounter::HttpResponses, 1, labels);
+}
 
-    std::string header(buffer, total_size);
+void record_retry(MetricsSink* sink) {
+    if (sink) {
+        MetricLabels labels;
+        labels.operation = "http";
+        sink->add(MetricCounter::Retries, 1, labels);
+    }
+}
 
-    // Parse "Key: Value" format
-    size_t colon_pos = header.find(':');
-    if (colon_pos != std::string::npos) {
-        std::string key = header.substr(0, colon_pos);
-        std::string value = header.substr(colon_pos + 1);
+// Body of an upload, passed as READDATA
+struct UploadSource {
+    BodyReader read;
+    std::exception_ptr error; // Thrown by read; the transfer was aborted
+};
+
+size_t curl_read_body(char* buffer, size_t size, size_t nitems, void* userdata) {
+    auto* source = static_cast<UploadSource*>(userdata);
+    try {
+        return source->read(buffer, size * nitems);
+    } catch (...) {
+        source->error = std::current_exception();
+        return CURL_READFUNC_ABORT;
+    }
+}
 
-        // Trim whitespace
-        value.erase(0, value.find_first_not_of(" \t\r\n"));
-        value.erase(value.find_last_not_of(" \t\r\n") + 1);
+// Attributes of a REST span; the route is only computed while the span records
+void trace_request(Span& span, const char* method, const std::string& path) {
+    if (span.recording()) {
+        span.set_attribute("http.request.method", method);
+        span.set_attribute("http.route", endpoint_label(path));
+    }
+}
 
-        (*headers)[key] = value;
+void trace_status(Span& span, int status_code) {
+    span.set_attribute("http.response.status_code", static_cast<int64_t>(status_code));
+    if (status_code >= 400) {
+        span.set_error("HTTP " + std::to_string(status_code));
     }
+}
 
-    return total_size;
+// Sleep between attempts inside a span, so the wait shows up in the trace
+void backoff_sleep(std::chrono::milliseconds delay) {
+    Span span("HttpClient::backoff");
+    span.set_attribute("backoff_ms", static_cast<int64_t>(delay.count()));
+    std::this_thread::sleep_for(delay);
 }
 
-HttpClient::HttpClient(const AuthConfig& auth, const std::string& api_version)
-    : auth_(auth)
-    , api_version_(api_version) {
-    static bool curl_initialized = false;
+// URL without its query string, which holds a presigned link's signature
+std::string without_query(const std::string& url) {
+    return url.substr(0, url.find('?'));
+}
+
+// Headers for an external request: only the caller's, no Authorization
+std::shared_ptr<curl_slist> external_header_list(const std::map<std::string, std::string>& headers) {
+    curl_slist* list = nullptr;
+    for (const auto& [name, value] : headers) {
+        const std::string line = name + ": " + value;
+        curl_slist* appended = curl_slist_append(list, line.c_str());
+        if (!appended) {
+            free_header_list(list);
+            throw std::runtime_error("Failed to build HTTP headers");
+        }
+        list = appended;
+    }
+    return std::shared_ptr<curl_slist>(list, free_header_list);
+}
+
+/**
+ * @brief A cached header list with a traceparent line in front, without copying the list
+ *
+ * The cached list is left untouched: the extra node points at its head.
+ */
+class TracedHeaders {
+public:
+    TracedHeaders(const SpanContext& context, std::shared_ptr<curl_slist> headers)
+        : headers_(std::move(headers))
+        , node_{nullptr, headers_.get()} {
+        if (context.is_valid()) {
+            line_ = "traceparent: " + context.to_traceparent();
+            node_.data = &line_[0];
+        }
+    }
+
+    TracedHeaders(const TracedHeaders&) = delete;
+    TracedHeaders& operator=(const TracedHeaders&) = delete;
+
+    curl_slist* get() { return node_.data ? &node_ : headers_.get(); }
+
+    /**
+     * @brief Shared list for an async request, which outlives the caller's frame
+     */
+    static std::shared_ptr<curl_slist> share(const SpanContext& context, std::shared_ptr<curl_slist> headers) {
+        if (!context.is_valid()) {
+            return headers;
+        }
+        auto traced = std::make_shared<TracedHeaders>(context, std::move(headers));
+        curl_slist* list = traced->get();
+        return std::shared_ptr<curl_slist>(traced, list);
+    }
+
+private:
+    std::shared_ptr<curl_slist> headers_;
+    std::string line_;
+    curl_slist node_;
+};
+} // namespace
+
+// Run a request on a prepared handle and collect the response
+static HttpResponse perform(CURL* curl, const std::string& url, curl_slist* headers, long timeout_seconds,
+                            const BodyChunkCallback* on_chunk = nullptr) {
+    HttpResponse response{};
+    ResponseWriter writer;
+    writer.response = &response;
+    writer.on_chunk = on_chunk;
+
+    // Set CURL options
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, curl_write_body);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &writer);
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, curl_collect_header);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, &writer);
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT, timeout_seconds);
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers); // Cached list, owned by the caller
+
+    // Perform request; the handle's connection stays open for the next request
+    CURLcode res = curl_easy_perform(curl);
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, nullptr);
+
+    if (writer.error) {
+        throw StreamAborted("Response consumer failed", writer.error);
+    }
+    if (res != CURLE_OK) {
+        std::string error_msg = "CURL request failed: " + std::string(curl_easy_strerror(res));
+        DATABRICKS_LOG_ERROR(error_msg);
+        if (writer.streamed > 0) {
+            throw StreamAborted(error_msg + " after " + std::to_string(writer.streamed) + " bytes were delivered",
+                                nullptr);
+        }
+        throw std::runtime_error(error_msg);
+    }
+
+    // Get HTTP status code
+    long http_code = 0;
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &http_code);
+    response.status_code = static_cast<int>(http_code);
+
+    DATABRICKS_LOG_DEBUG("HTTP Response: {}", response.status_code);
+
+    return response;
+}
+
+std::string url_encode(const std::string& value) {
+    static const char HEX[] = "0123456789ABCDEF";
+    std::string encoded;
+    encoded.reserve(value.size());
+    for (unsigned char c : value) {
+        if (std::isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~') {
+            encoded += static_cast<char>(c);
+        } else {
+            encoded += '%';
+            encoded += HEX[c >> 4];
+            encoded += HEX[c & 0x0F];
+        }
+    }
+    return encoded;
+}
 
-    // Initialize Curl Client
-    if (!curl_initialized) {
-        curl_global_init(CURL_GLOBAL_DEFAULT);
-        curl_initialized = true;
+std::optional<std::chrono::milliseconds> parse_retry_after(const HttpResponse& response,
+                                                           std::chrono::system_clock::time_point now) {
+    // Header names are case-insensitive (HTTP/2 sends them lowercase)
+    auto it = std::find_if(response.headers.begin(), response.headers.end(), [](const auto& header) {
+        const std::string& name = header.first;
+        return name.size() == 11 && std::equal(name.begin(), name.end(), "retry-after", [](char a, char b) {
+                   return std::tolower(static_cast<unsigned char>(a)) == b;
+               });
+    });
+    if (it == response.headers.end() || it->second.empty()) {
+        return std::nullopt;
     }
+    const std::string& value = it->second;
+
+    if (std::all_of(value.begin(), value.end(), [](unsigned char c) { return std::isdigit(c); })) {
+        try {
+            return std::chrono::seconds(std::stoll(value));
+        } catch (const std::out_of_range&) {
+            return std::nullopt;
+        }
+    }
+
+    time_t date = curl_getdate(value.c_str(), nullptr);
+    if (date < 0) {
+        return std::nullopt;
+    }
+    auto wait = std::chrono::system_clock::from_time_t(date) - now;
+    return std::max(std::chrono::milliseconds(0), std::chrono::duration_cast<std::chrono::milliseconds>(wait));
 }
 
+HttpClient::HttpClient(const AuthConfig& auth, const std::string& api_version, const HttpConfig& http)
+    : auth_(auth)
+    , api_version_(api_version)
+    , http_config_(http)
+    , session_(CurlSession::shared())
+    , limiter_(RateLimiter::for_host(auth.host, http.requests_per_second, http.burst))
+    , headers_(build_header_list(false))
+    , gzip_headers_(build_header_list(true))
+    , upload_headers_(build_header_list(false, "application/octet-stream")) {}
+
+HttpClient::~HttpClient() = default;
+
 std::string HttpClient::get_base_url() const {
     return auth_.host + "/api/" + api_version_;
 }
 
-std::map<std::string, std::string> HttpClient::get_headers() const {
-    // Convert secure token to string for HTTP header
-    // Note: HTTP headers require std::string, so token will be in plain memory during request
-    std::string token_str = from_secure_string(auth_.get_secure_token());
+void HttpClient::set_token(const std::string& token) {
+    // Rotation is rare; holding the lock keeps the token and its header list consistent
+    std::lock_guard<std::mutex> lock(headers_mutex_);
+    auth_.set_token(token);
+    headers_ = build_header_list(false);
+    gzip_headers_ = build_header_list(true);
+    upload_headers_ = build_header_list(false, "application/octet-stream");
+}
 
-    return {
-        {"Authorization", "Bearer " + token_str}, {"Content-Type", "application/json"}, {"Accept", "application/json"}};
+std::shared_ptr<curl_slist> HttpClient::header_list(bool gzip_body) const {
+    std::lock_guard<std::mutex> lock(headers_mutex_);
+    return gzip_body ? gzip_headers_ : headers_;
+}
+
+std::shared_ptr<curl_slist> HttpClient::build_header_list(bool gzip_body, const char* content_type) const {
+    // Assemble the Authorization line in secure memory; curl_slist_append copies
+    // it into the list, which free_header_list() wipes before freeing
+    internal::SecureString authorization = internal::to_secure_string("Authorization: Bearer ");
+    authorization += auth_.get_secure_token();
+
+    struct curl_slist* headers = curl_slist_append(nullptr, authorization.c_str());
+    headers = curl_slist_append(headers, (std::string("Content-Type: ") + content_type).c_str());
+    headers = curl_slist_append(headers, "Accept: application/json");
+    if (gzip_body) {
+        headers = curl_slist_append(headers, "Content-Encoding: gzip");
+    }
+    if (!headers) {
+        throw std::runtime_error("Failed to build HTTP headers");
+    }
+    return std::shared_ptr<curl_slist>(headers, free_header_list);
 }
 
 // ============================================================================
@@ -74,238 +310,477 @@ std::map<std::string, std::string> HttpClient::get_headers() const {
 // ============================================================================
 
 bool HttpClient::should_retry(int status_code, int attempt) const {
-    const int MAX_RETRIES = 3;
-
-    if (attempt >= MAX_RETRIES) {
+    const RetryConfig& retry = http_config_.retry;
+    if (!retry.enabled || attempt >= static_cast<int>(retry.max_attempts)) {
         return false;
     }
 
+    if (status_code == 408 || status_code == 504) { // Request / Gateway Timeout
+        return retry.retry_on_timeout;
+    }
+
     // Retry on these HTTP status codes
-    return status_code == 408 || // Request Timeout
-           status_code == 429 || // Too Many Requests (rate limit)
+    return status_code == 429 || // Too Many Requests (rate limit)
            status_code == 500 || // Internal Server Error
            status_code == 502 || // Bad Gateway
-           status_code == 503 || // Service Unavailable
-           status_code == 504;   // Gateway Timeout
+           status_code == 503;   // Service Unavailable
 }
 
-int HttpClient::calculate_backoff(int attempt) const {
-    const int INITIAL_BACKOFF_MS = 1000; // 1 second
+bool HttpClient::should_retry_error(const std::string& error, int attempt) const {
+    const RetryConfig& retry = http_config_.retry;
+    if (!retry.enabled || attempt >= static_cast<int>(retry.max_attempts)) {
+        return false;
+    }
+    // CURLE_OPERATION_TIMEDOUT reads "Timeout was reached"; everything else is a lost connection
+    bool timed_out = error.find("Timeout") != std::string::npos;
+    return timed_out ? retry.retry_on_timeout : retry.retry_on_connection_lost;
+}
+
+std::optional<std::chrono::milliseconds> HttpClient::calculate_backoff(int attempt,
+                                                                       const HttpResponse* response) const {
+    const RetryConfig& retry = http_config_.retry;
+
+    // Exponential backoff from initial_backoff_ms, capped at max_backoff_ms
+    double backoff_ms = static_cast<double>(retry.initial_backoff_ms) * std::pow(retry.backoff_multiplier, attempt - 1);
+    backoff_ms = std::min(backoff_ms, static_cast<double>(retry.max_backoff_ms));
+
+    // Add jitter (±25%) so clients that failed together don't retry together
+    thread_local std::mt19937 gen{std::random_device{}()};
+    std::uniform_real_distribution<> jitter_dist(0.75, 1.25);
+    auto delay = std::chrono::milliseconds(static_cast<long long>(backoff_ms * jitter_dist(gen)));
 
-    // Exponential backoff: 1s, 2s, 4s, 8s, etc.
-    return INITIAL_BACKOFF_MS * (1 << attempt);
+    std::optional<std::chrono::milliseconds> retry_after = response ? parse_retry_after(*response) : std::nullopt;
+    if (retry_after) {
+        if (*retry_after > std::chrono::milliseconds(retry.max_backoff_ms)) {
+            return std::nullopt;
+        }
+        // Hold the host's other requests too, and retry once the wait is over,
+        // spread by up to half a backoff so the retries don't land together
+        limiter_->pause_until(RateLimiter::Clock::now() + *retry_after);
+        std::uniform_real_distribution<> spread_dist(0.0, 0.5);
+        delay = *retry_after + std::chrono::milliseconds(static_cast<long long>(backoff_ms * spread_dist(gen)));
+    }
+    return delay;
 }
 
 // ============================================================================
 // Core HTTP Execution Methods (without retry)
 // ============================================================================
 
-HttpResponse HttpClient::execute_get(const std::string& path) {
-    CURL* curl = curl_easy_init();
-    if (!curl) {
-        throw std::runtime_error("Failed to initialize CURL");
-    }
+HttpResponse HttpClient::execute_get(const std::string& path, const BodyChunkCallback* on_chunk) {
+    Span span("HttpClient::execute_get");
+    trace_request(span, "GET", path);
+    CurlSession::Lease lease = session_->acquire();
+    CURL* curl = lease.get();
 
-    HttpResponse response;
     std::string url = get_base_url() + path;
+    DATABRICKS_LOG_DEBUG("HTTP GET: {}", url);
+
+    curl_easy_setopt(curl, CURLOPT_HTTPGET, 1L);
+    if (http_config_.accept_compressed) {
+        curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, ""); // Every encoding libcurl can decode
+    }
+    TracedHeaders headers(span.context(), header_list());
+    HttpResponse response = perform(curl, url, headers.get(), auth_.timeout_seconds, on_chunk);
+    trace_status(span, response.status_code);
+    return response;
+}
 
-    internal::get_logger()->debug("HTTP GET: " + url);
+HttpResponse HttpClient::execute_post(const std::string& path, const std::string& body, bool gzip_body) {
+    Span span("HttpClient::execute_post");
+    trace_request(span, "POST", path);
+    CurlSession::Lease lease = session_->acquire();
+    CURL* curl = lease.get();
 
-    // Set CURL options
-    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_callback);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response.body);
-    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, header_callback);
-    curl_easy_setopt(curl, CURLOPT_HEADERDATA, &response.headers);
-    curl_easy_setopt(curl, CURLOPT_TIMEOUT, auth_.timeout_seconds);
+    std::string url = get_base_url() + path;
+    DATABRICKS_LOG_DEBUG("HTTP POST: {}", url);
 
-    // Set headers
-    struct curl_slist* headers = nullptr;
-    for (const auto& [key, value] : get_headers()) {
-        std::string header = key + ": " + value;
-        headers = curl_slist_append(headers, header.c_str());
+    curl_easy_setopt(curl, CURLOPT_POST, 1L);
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDS, body.data());
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE_LARGE, static_cast<curl_off_t>(body.size()));
+    if (http_config_.accept_compressed) {
+        curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, "");
     }
-    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+    TracedHeaders headers(span.context(), header_list(gzip_body));
+    HttpResponse response = perform(curl, url, headers.get(), auth_.timeout_seconds);
+    trace_status(span, response.status_code);
+    return response;
+}
 
-    // Perform request
-    CURLcode res = curl_easy_perform(curl);
+HttpResponse HttpClient::execute_external(const std::string& url, curl_slist* headers) {
+    Span span("HttpClient::execute_external");
+    span.set_attribute("http.request.method", "GET");
+    CurlSession::Lease lease = session_->acquire();
+    CURL* curl = lease.get();
 
-    if (res != CURLE_OK) {
-        std::string error_msg = "CURL request failed: " + std::string(curl_easy_strerror(res));
-        curl_slist_free_all(headers);
-        curl_easy_cleanup(curl);
-        internal::get_logger()->error(error_msg);
-        throw std::runtime_error(error_msg);
+    DATABRICKS_LOG_DEBUG("HTTP GET (external): {}", without_query(url));
+
+    curl_easy_setopt(curl, CURLOPT_HTTPGET, 1L);
+    if (http_config_.accept_compressed) {
+        curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, "");
     }
+    HttpResponse response = perform(curl, url, headers, auth_.timeout_seconds);
+    trace_status(span, response.status_code);
+    return response;
+}
 
-    // Get HTTP status code
-    long http_code = 0;
-    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &http_code);
-    response.status_code = static_cast<int>(http_code);
+HttpResponse HttpClient::execute_put(const std::string& path, uint64_t size, BodyReader read) {
+    Span span("HttpClient::execute_put");
+    trace_request(span, "PUT", path);
+    CurlSession::Lease lease = session_->acquire();
+    CURL* curl = lease.get();
 
-    // Cleanup
-    curl_slist_free_all(headers);
-    curl_easy_cleanup(curl);
+    std::string url = get_base_url() + path;
+    DATABRICKS_LOG_DEBUG("HTTP PUT: {} ({} bytes)", url, size);
+
+    UploadSource source{std::move(read), nullptr};
+    curl_easy_setopt(curl, CURLOPT_UPLOAD, 1L);
+    curl_easy_setopt(curl, CURLOPT_READFUNCTION, curl_read_body);
+    curl_easy_setopt(curl, CURLOPT_READDATA, &source);
+    curl_easy_setopt(curl, CURLOPT_INFILESIZE_LARGE, static_cast<curl_off_t>(size));
+    // A stall, not the total time, ends an upload (see put_stream())
+    curl_easy_setopt(curl, CURLOPT_LOW_SPEED_LIMIT, 1L);
+    curl_easy_setopt(curl, CURLOPT_LOW_SPEED_TIME, static_cast<long>(auth_.timeout_seconds));
+
+    std::shared_ptr<curl_slist> list;
+    {
+        std::lock_guard<std::mutex> lock(headers_mutex_);
+        list = upload_headers_;
+    }
+    TracedHeaders headers(span.context(), std::move(list));
+    HttpResponse response;
+    try {
+        response = perform(curl, url, headers.get(), 0);
+    } catch (const std::runtime_error&) {
+        if (source.error) {
+            throw StreamAborted("Request body reader failed", source.error);
+        }
+        throw;
+    }
+    trace_status(span, response.status_code);
+    return response;
+}
+
+HttpResponse HttpClient::execute_delete(const std::string& path) {
+    Span span("HttpClient::execute_delete");
+    trace_request(span, "DELETE", path);
+    CurlSession::Lease lease = session_->acquire();
+    CURL* curl = lease.get();
 
-    internal::get_logger()->debug("HTTP Response: " + std::to_string(response.status_code));
+    std::string url = get_base_url() + path;
+    DATABRICKS_LOG_DEBUG("HTTP DELETE: {}", url);
 
+    curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, "DELETE");
+    TracedHeaders headers(span.context(), header_list());
+    HttpResponse response = perform(curl, url, headers.get(), auth_.timeout_seconds);
+    trace_status(span, response.status_code);
     return response;
 }
 
-HttpResponse HttpClient::execute_post(const std::string& path, const std::string& json_body) {
-    CURL* curl = curl_easy_init();
-    if (!curl) {
-        throw std::runtime_error("Failed to initialize CURL");
+bool HttpClient::compress_body(const std::string& json_body, std::string& compressed) const {
+    // Only the size: bodies can carry secret values and large payloads
+    DATABRICKS_LOG_DEBUG("Request body: {} bytes", json_body.size());
+
+    const size_t threshold = http_config_.gzip_request_min_bytes;
+    if (threshold == 0 || json_body.size() < threshold) {
+        return false;
     }
+    compressed = gzip_compress(json_body);
+    DATABRICKS_LOG_DEBUG("Body gzip-compressed from {} to {} bytes", json_body.size(), compressed.size());
+    return true;
+}
 
-    HttpResponse response;
-    std::string url = get_base_url() + path;
+// ============================================================================
+// Public HTTP Methods (with retry)
+// ============================================================================
 
-    internal::get_logger()->debug("HTTP POST: " + url);
-    internal::get_logger()->debug("Body: " + json_body);
+HttpResponse HttpClient::get(const std::string& path) {
+    return with_retry("GET", path, [&]() { return execute_get(path); });
+}
 
-    // Set CURL options
-    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-    curl_easy_setopt(curl, CURLOPT_POST, 1L);
-    curl_easy_setopt(curl, CURLOPT_POSTFIELDS, json_body.c_str());
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_callback);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response.body);
-    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, header_callback);
-    curl_easy_setopt(curl, CURLOPT_HEADERDATA, &response.headers);
-    curl_easy_setopt(curl, CURLOPT_TIMEOUT, auth_.timeout_seconds);
-
-    // Set headers
-    struct curl_slist* headers = nullptr;
-    for (const auto& [key, value] : get_headers()) {
-        std::string header = key + ": " + value;
-        headers = curl_slist_append(headers, header.c_str());
-    }
-    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
-
-    // Perform request
-    CURLcode res = curl_easy_perform(curl);
+HttpResponse HttpClient::post(const std::string& path, const std::string& json_body) {
+    // Compress once; every attempt sends the same bytes
+    std::string compressed;
+    bool gzip_body = compress_body(json_body, compressed);
+    const std::string& body = gzip_body ? compressed : json_body;
+    return with_retry("POST", path, [&]() { return execute_post(path, body, gzip_body); });
+}
 
-    if (res != CURLE_OK) {
-        std::string error_msg = "CURL request failed: " + std::string(curl_easy_strerror(res));
-        curl_slist_free_all(headers);
-        curl_easy_cleanup(curl);
-        internal::get_logger()->error(error_msg);
-        throw std::runtime_error(error_msg);
+HttpResponse HttpClient::get_stream(const std::string& path, const BodyChunkCallback& on_chunk) {
+    try {
+        return with_retry("GET", path, [&]() { return execute_get(path, &on_chunk); });
+    } catch (const StreamAborted& e) {
+        if (e.cause) {
+            std::rethrow_exception(e.cause);
+        }
+        throw;
     }
+}
 
-    // Get HTTP status code
-    long http_code = 0;
-    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &http_code);
-    response.status_code = static_cast<int>(http_code);
+HttpResponse HttpClient::put(const std::string& path, const std::string& body) {
+    return put_stream(path, body.size(), [&body]() -> BodyReader {
+        return [&body, offset = size_t{0}](char* buffer, size_t capacity) mutable {
+            size_t n = std::min(capacity, body.size() - offset);
+            std::copy_n(body.data() + offset, n, buffer);
+            offset += n;
+            return n;
+        };
+    });
+}
 
-    // Cleanup
-    curl_slist_free_all(headers);
-    curl_easy_cleanup(curl);
+HttpResponse HttpClient::put_stream(const std::string& path, uint64_t size,
+                                    const std::function<BodyReader()>& open_body) {
+    try {
+        return with_retry("PUT", path, [&]() { return execute_put(path, size, open_body()); });
+    } catch (const StreamAborted& e) {
+        if (e.cause) {
+            std::rethrow_exception(e.cause);
+        }
+        throw;
+    }
+}
 
-    internal::get_logger()->debug("HTTP Response: " + std::to_string(response.status_code));
+HttpResponse HttpClient::del(const std::string& path) {
+    return with_retry("DELETE", path, [&]() { return execute_delete(path); });
+}
 
-    return response;
+HttpResponse HttpClient::get_external(const std::string& url, const std::map<std::string, std::string>& headers) {
+    std::shared_ptr<curl_slist> list = external_header_list(headers);
+    return with_retry("GET", url, [&]() { return execute_external(url, list.get()); }, true);
 }
 
-// ============================================================================
-// Public HTTP Methods (with retry)
-// ============================================================================
+HttpResponse HttpClient::with_retry(const char* method, const std::string& path,
+                                    const std::function<HttpResponse()>& execute, bool external) {
+    const size_t max_attempts = http_config_.retry.enabled ? http_config_.retry.max_attempts : 1;
+    MetricsSink* metrics = metrics_sink();
+    const std::string endpoint = !metrics ? std::string() : external ? "external" : endpoint_label(path);
 
-HttpResponse HttpClient::get(const std::string& path) {
-    const int MAX_RETRIES = 3;
-    HttpResponse response;
+    for (int attempt = 1;; ++attempt) {
+        if (!external) {
+            std::this_thread::sleep_until(limiter_->reserve());
+        }
 
-    for (int attempt = 0; attempt < MAX_RETRIES; ++attempt) {
+        const auto started = std::chrono::steady_clock::now();
+        HttpResponse response;
         try {
-            response = execute_get(path);
-
-            // Success - return immediately
-            if (response.status_code == 200) {
-                return response;
+            response = execute();
+        } catch (const StreamAborted&) {
+            record_attempt(metrics, method, endpoint, std::chrono::steady_clock::now() - started, 0);
+            throw;
+        } catch (const std::runtime_error& e) {
+            record_attempt(metrics, method, endpoint, std::chrono::steady_clock::now() - started, 0);
+            // Connection error - retry if the policy allows it
+            if (!should_retry_error(e.what(), attempt)) {
+                throw;
             }
+            record_retry(metrics);
+            auto backoff = calculate_backoff(attempt, nullptr);
+            DATABRICKS_LOG_WARN("{} connection error: {}. Retrying in {}ms", method, e.what(), backoff->count());
+            backoff_sleep(*backoff);
+            continue;
+        }
 
-            // Check if we should retry
-            if (!should_retry(response.status_code, attempt + 1)) {
-                // Non-retryable error or max retries reached
-                return response;
-            }
+        record_attempt(metrics, method, endpoint, std::chrono::steady_clock::now() - started, response.status_code);
 
-            // Calculate backoff and log retry
-            int backoff_ms = calculate_backoff(attempt);
-            internal::get_logger()->warn("GET request failed with HTTP " + std::to_string(response.status_code) +
-                                         ". Retrying in " + std::to_string(backoff_ms) + "ms " + "(attempt " +
-                                         std::to_string(attempt + 2) + "/" + std::to_string(MAX_RETRIES) + ")");
+        // Success, non-retryable error, or out of attempts
+        if (response.status_code == 200 || !should_retry(response.status_code, attempt)) {
+            return response;
+        }
 
-            // Wait before retry
-            std::this_thread::sleep_for(std::chrono::milliseconds(backoff_ms));
-        } catch (const std::runtime_error& e) {
-            // Connection error - retry if not last attempt
-            if (attempt + 1 >= MAX_RETRIES) {
-                throw; // Re-throw on last attempt
-            }
+        auto backoff = calculate_backoff(attempt, &response);
+        if (!backoff) {
+            DATABRICKS_LOG_WARN("{} request failed with HTTP {}; Retry-After exceeds the maximum backoff, not retrying",
+                                method, response.status_code);
+            return response;
+        }
+        DATABRICKS_LOG_WARN("{} request failed with HTTP {}. Retrying in {}ms (attempt {}/{})", method,
+                            response.status_code, backoff->count(), attempt + 1, max_attempts);
+        record_retry(metrics);
+        backoff_sleep(*backoff);
+    }
+}
+
+// ============================================================================
+// Async HTTP Methods (with retry)
+// ============================================================================
 
-            int backoff_ms = calculate_backoff(attempt);
-            internal::get_logger()->warn("GET connection error: " + std::string(e.what()) + ". Retrying in " +
-                                         std::to_string(backoff_ms) + "ms");
+// One async request across its attempts
+struct HttpClient::AsyncCall {
+    AsyncCall(const char* method, std::string_view span_name)
+        : method(method)
+        , span(Span::detached(span_name)) {}
+
+    const char* method;
+    bool external = false; // Outside the workspace: no token, traceparent or rate limit
+    std::string endpoint;  // Metrics label, set while recording is enabled
+    CurlMulti::Request request;
+    std::promise<HttpResponse> promise; // Fulfilled unless on_done is set
+    ResponseCallback on_done;
+    int attempt = 0;
+    Span span; // Covers every attempt; ended when the call completes
+
+    void set_value(HttpResponse&& response) {
+        trace_status(span, response.status_code);
+        span.end();
+        if (on_done) {
+            on_done(nullptr, std::move(response));
+        } else {
+            promise.set_value(std::move(response));
+        }
+    }
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(backoff_ms));
+    void set_error(const std::string& message) {
+        span.set_error(message);
+        span.end();
+        auto error = std::make_exception_ptr(std::runtime_error(message));
+        if (on_done) {
+            on_done(error, HttpResponse{});
+        } else {
+            promise.set_exception(error);
         }
     }
+};
 
-    // Return last response if all retries exhausted
-    return response;
+CurlMulti& HttpClient::engine() {
+    std::call_once(engine_once_, [this]() {
+        engine_ = std::make_unique<CurlMulti>(session_, http_config_.max_concurrent_requests, http_config_.http2);
+    });
+    return *engine_;
 }
 
-HttpResponse HttpClient::post(const std::string& path, const std::string& json_body) {
-    const int MAX_RETRIES = 3;
-    HttpResponse response;
+std::shared_ptr<HttpClient::AsyncCall> HttpClient::make_get(const std::string& path, std::string_view span_name) const {
+    auto call = std::make_shared<AsyncCall>("GET", span_name);
+    trace_request(call->span, "GET", path);
+    call->request.url = get_base_url() + path;
+    if (metrics_sink()) {
+        call->endpoint = endpoint_label(path);
+    }
+    return call;
+}
 
-    for (int attempt = 0; attempt < MAX_RETRIES; ++attempt) {
-        try {
-            response = execute_post(path, json_body);
+std::shared_ptr<HttpClient::AsyncCall> HttpClient::make_post(const std::string& path, const std::string& json_body,
+                                                             std::string_view span_name) const {
+    auto call = std::make_shared<AsyncCall>("POST", span_name);
+    trace_request(call->span, "POST", path);
+    call->request.url = get_base_url() + path;
+    if (metrics_sink()) {
+        call->endpoint = endpoint_label(path);
+    }
+    call->request.post = true;
+    bool gzip_body = compress_body(json_body, call->request.body);
+    if (!gzip_body) {
+        call->request.body = json_body;
+    }
+    call->request.headers = header_list(gzip_body);
+    return call;
+}
 
-            // Success - return immediately
-            if (response.status_code == 200) {
-                return response;
-            }
+std::future<HttpResponse> HttpClient::get_async(const std::string& path) {
+    return start_async(make_get(path, "HttpClient::get_async"));
+}
 
-            // Check if we should retry
-            if (!should_retry(response.status_code, attempt + 1)) {
-                // Non-retryable error or max retries reached
-                return response;
-            }
+std::future<HttpResponse> HttpClient::post_async(const std::string& path, const std::string& json_body) {
+    return start_async(make_post(path, json_body, "HttpClient::post_async"));
+}
 
-            // Calculate backoff and log retry
-            int backoff_ms = calculate_backoff(attempt);
-            internal::get_logger()->warn("POST request failed with HTTP " + std::to_string(response.status_code) +
-                                         ". Retrying in " + std::to_string(backoff_ms) + "ms " + "(attempt " +
-                                         std::to_string(attempt + 2) + "/" + std::to_string(MAX_RETRIES) + ")");
+void HttpClient::get_async(const std::string& path, ResponseCallback on_done) {
+    auto call = make_get(path, "HttpClient::get_async");
+    call->on_done = std::move(on_done);
+    start(std::move(call));
+}
 
-            // Wait before retry
-            std::this_thread::sleep_for(std::chrono::milliseconds(backoff_ms));
-        } catch (const std::runtime_error& e) {
-            // Connection error - retry if not last attempt
-            if (attempt + 1 >= MAX_RETRIES) {
-                throw; // Re-throw on last attempt
-            }
+void HttpClient::post_async(const std::string& path, const std::string& json_body, ResponseCallback on_done) {
+    auto call = make_post(path, json_body, "HttpClient::post_async");
+    call->on_done = std::move(on_done);
+    start(std::move(call));
+}
 
-            int backoff_ms = calculate_backoff(attempt);
-            internal::get_logger()->warn("POST connection error: " + std::string(e.what()) + ". Retrying in " +
-                                         std::to_string(backoff_ms) + "ms");
+std::future<HttpResponse> HttpClient::get_external_async(const std::string& url,
+                                                         const std::map<std::string, std::string>& headers) {
+    auto call = std::make_shared<AsyncCall>("GET", "HttpClient::get_external_async");
+    call->span.set_attribute("http.request.method", "GET");
+    call->external = true;
+    call->request.url = url;
+    if (metrics_sink()) {
+        call->endpoint = "external";
+    }
+    call->request.headers = external_header_list(headers);
+    return start_async(std::move(call));
+}
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(backoff_ms));
-        }
+std::future<HttpResponse> HttpClient::start_async(std::shared_ptr<AsyncCall> call) {
+    std::future<HttpResponse> future = call->promise.get_future();
+    start(std::move(call));
+    return future;
+}
+
+void HttpClient::start(std::shared_ptr<AsyncCall> call) {
+    if (!call->request.headers && !call->external) {
+        call->request.headers = header_list();
+    }
+    if (!call->external) {
+        call->request.headers = TracedHeaders::share(call->span.context(), std::move(call->request.headers));
     }
+    call->request.timeout_seconds = auth_.timeout_seconds;
+    call->request.accept_compressed = http_config_.accept_compressed;
+    dispatch(std::move(call));
+}
 
-    // Return last response if all retries exhausted
-    return response;
+void HttpClient::dispatch(std::shared_ptr<AsyncCall> call) {
+    CurlMulti::Request request = call->request;
+    request.on_complete = [this, call](CurlMulti::Result&& result) {
+        const int attempt = ++call->attempt;
+
+        if (result.cancelled) {
+            call->set_error(result.error);
+            return;
+        }
+        MetricsSink* metrics = metrics_sink();
+        record_attempt(metrics, call->method, call->endpoint, result.elapsed,
+                       result.error.empty() ? result.response.status_code : 0);
+
+        std::optional<std::chrono::milliseconds> backoff;
+        if (!result.error.empty()) {
+            // Connection error - retry if the policy allows it
+            if (!should_retry_error(result.error, attempt)) {
+                DATABRICKS_LOG_ERROR(result.error);
+                call->set_error(result.error);
+                return;
+            }
+            backoff = calculate_backoff(attempt, nullptr);
+            DATABRICKS_LOG_WARN("{} connection error: {}. Retrying in {}ms", call->method, result.error,
+                                backoff->count());
+        } else if (result.response.status_code == 200 || !should_retry(result.response.status_code, attempt) ||
+                   !(backoff = calculate_backoff(attempt, &result.response))) {
+            DATABRICKS_LOG_DEBUG("HTTP Response: {}", result.response.status_code);
+            call->set_value(std::move(result.response));
+            return;
+        } else {
+            DATABRICKS_LOG_WARN("{} request failed with HTTP {}. Retrying in {}ms (attempt {}/{})", call->method,
+                                result.response.status_code, backoff->count(), attempt + 1,
+                                http_config_.retry.max_attempts);
+        }
+
+        // Resubmit after the backoff without blocking the engine thread
+        record_retry(metrics);
+        call->request.not_before = std::chrono::steady_clock::now() + *backoff;
+        dispatch(call);
+    };
+
+    // Wait for a rate limiter token on the engine's schedule rather than the caller's thread
+    if (!call->external) {
+        request.not_before = std::max(request.not_before, limiter_->reserve());
+    }
+    if (!engine().submit(std::move(request))) {
+        call->set_error("HTTP client shut down");
+    }
 }
 
 void HttpClient::check_response(const HttpResponse& response, const std::string& operation_name) const {
     if (response.status_code != 200) {
         std::string error_msg =
             "Failed to " + operation_name + ": HTTP " + std::to_string(response.status_code) + " - " + response.body;
-        internal::get_logger()->error(error_msg);
+        DATABRICKS_LOG_ERROR(error_msg);
         throw std::runtime_error(error_msg);
     }
 }
@@ -6,19 +6,59 @@
 
 #include "http_client_interface.h"
 
+#include <chrono>
+#include <functional>
+#include <future>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 
+struct curl_slist;
+
 namespace databricks {
 namespace internal {
+class CurlMulti;
+class CurlSession;
+class RateLimiter;
+
+/**
+ * @brief Percent-encode a value for use in a URL query string
+ *
+ * Keeps RFC 3986 unreserved characters; encodes everything else (so opaque page
+ * tokens containing '=', '+' or '/' survive the round trip).
+ */
+std::string url_encode(const std::string& value);
+
+/**
+ * @brief Wait requested by a response's Retry-After header
+ *
+ * Accepts both forms from RFC 9110: delay-seconds and an HTTP-date.
+ *
+ * @return The wait (zero for a date in the past), or nullopt if the header is absent or malformed
+ */
+std::optional<std::chrono::milliseconds>
+parse_retry_after(const HttpResponse& response,
+                  std::chrono::system_clock::time_point now = std::chrono::system_clock::now());
+
 /**
  * @brief Internal HTTP Client Wrapper around libcurl
  *
  * Production implementation of IHttpClient that makes real HTTP requests.
+ * Requests reuse pooled curl handles from the process-wide CurlSession, so
+ * connections to the workspace are kept alive between calls. Async requests
+ * run concurrently on a CurlMulti engine (created on first use) sized by
+ * HttpConfig, with the same retry policy as the synchronous calls.
+ *
+ * Every attempt first takes a token from the host's shared RateLimiter, and
+ * retries follow HttpConfig::retry with jittered backoff and Retry-After.
  */
 class HttpClient : public IHttpClient {
 public:
-    explicit HttpClient(const AuthConfig& auth, const std::string& api_version = "2.2");
+    explicit HttpClient(const AuthConfig& auth, const std::string& api_version = "2.2",
+                        const HttpConfig& http = HttpConfig{});
+    ~HttpClient() override;
 
     /**
      * @brief Wrapper around a GET REST API Call
@@ -39,21 +79,141 @@ public:
      */
     HttpResponse post(const std::string& path, const std::string& json_body) override;
 
+    /**
+     * @brief Start a GET request on the async engine
+     *
+     * Transport errors and retryable statuses are retried with backoff; the
+     * future holds the final response, or the last transport error.
+     */
+    std::future<HttpResponse> get_async(const std::string& path) override;
+
+    /**
+     * @brief Start a POST request on the async engine
+     * @see get_async()
+     */
+    std::future<HttpResponse> post_async(const std::string& path, const std::string& json_body) override;
+
+    /**
+     * @brief Start a GET request on the async engine, calling on_done on the engine thread when it ends
+     *
+     * Retried like get_async(). on_done must not block, or it stalls every
+     * other request on the engine.
+     */
+    void get_async(const std::string& path, ResponseCallback on_done) override;
+
+    /**
+     * @brief Start a POST request on the async engine, calling on_done on the engine thread when it ends
+     * @see get_async(const std::string&, ResponseCallback)
+     */
+    void post_async(const std::string& path, const std::string& json_body, ResponseCallback on_done) override;
+
+    /**
+     * @brief GET with the body streamed to on_chunk straight from libcurl's buffer
+     *
+     * Retried like get() until the first byte reaches on_chunk; a failure after
+     * that is thrown rather than retried.
+     */
+    HttpResponse get_stream(const std::string& path, const BodyChunkCallback& on_chunk) override;
+
+    /**
+     * @brief GET an absolute URL without the workspace token or rate limit
+     *
+     * Retried like get(). Only the URL's path is logged, never its query string.
+     */
+    HttpResponse get_external(const std::string& url, const std::map<std::string, std::string>& headers) override;
+
+    /**
+     * @brief Start get_external() on the async engine
+     * @see get_async()
+     */
+    std::future<HttpResponse> get_external_async(const std::string& url,
+                                                 const std::map<std::string, std::string>& headers) override;
+
+    /**
+     * @brief PUT a raw body, retried like post()
+     */
+    HttpResponse put(const std::string& path, const std::string& body) override;
+
+    /**
+     * @brief PUT a body read straight into libcurl's send buffer
+     *
+     * Retried like get(), reopening the body for each attempt; an exception
+     * from the reader is thrown, not retried. The transfer has no overall
+     * timeout, since a large body can take longer than any fixed limit;
+     * instead it fails once no data moves for AuthConfig::timeout_seconds.
+     */
+    HttpResponse put_stream(const std::string& path, uint64_t size,
+                            const std::function<BodyReader()>& open_body) override;
+
+    /**
+     * @brief DELETE, retried like get()
+     */
+    HttpResponse del(const std::string& path) override;
+
     void check_response(const HttpResponse& response, const std::string& operation_name) const override;
 
+    /**
+     * @brief Replace the bearer token used by subsequent requests
+     *
+     * Rebuilds the cached header list; requests already in flight keep the
+     * list they started with.
+     */
+    void set_token(const std::string& token);
+
+    /**
+     * @brief Headers sent with every request (built once, rebuilt by set_token())
+     *
+     * The list's strings are zeroed when its last user releases it.
+     *
+     * @param gzip_body The list for a gzip-compressed POST body (adds Content-Encoding)
+     */
+    std::shared_ptr<curl_slist> header_list(bool gzip_body = false) const;
+
 private:
+    struct AsyncCall;
+
     AuthConfig auth_;
     std::string api_version_;
+    HttpConfig http_config_;
+    std::shared_ptr<CurlSession> session_;
+    std::shared_ptr<RateLimiter> limiter_;
     std::string get_base_url() const;
-    std::map<std::string, std::string> get_headers() const;
+    std::shared_ptr<curl_slist> build_header_list(bool gzip_body,
+                                                  const char* content_type = "application/json") const;
 
-    // Retry helper methods
+    mutable std::mutex headers_mutex_;
+    std::shared_ptr<curl_slist> headers_;        // Guarded by headers_mutex_
+    std::shared_ptr<curl_slist> gzip_headers_;   // Guarded by headers_mutex_
+    std::shared_ptr<curl_slist> upload_headers_; // Raw (octet-stream) bodies; guarded by headers_mutex_
+
+    // Retry helper methods; attempt counts the attempts made so far
     bool should_retry(int status_code, int attempt) const;
-    int calculate_backoff(int attempt) const;
+    bool should_retry_error(const std::string& error, int attempt) const;
+    std::optional<std::chrono::milliseconds> calculate_backoff(int attempt, const HttpResponse* response) const;
 
     // Core HTTP execution methods
-    HttpResponse execute_get(const std::string& path);
-    HttpResponse execute_post(const std::string& path, const std::string& json_body);
+    HttpResponse execute_get(const std::string& path, const BodyChunkCallback* on_chunk = nullptr);
+    HttpResponse execute_post(const std::string& path, const std::string& body, bool gzip_body);
+    HttpResponse execute_external(const std::string& url, curl_slist* headers);
+    HttpResponse execute_put(const std::string& path, uint64_t size, BodyReader read);
+    HttpResponse execute_delete(const std::string& path);
+    bool compress_body(const std::string& json_body, std::string& compressed) const;
+    // External requests skip the workspace rate limiter
+    HttpResponse with_retry(const char* method, const std::string& path, const std::function<HttpResponse()>& execute,
+                            bool external = false);
+
+    // Async execution
+    CurlMulti& engine();
+    std::shared_ptr<AsyncCall> make_get(const std::string& path, std::string_view span_name) const;
+    std::shared_ptr<AsyncCall> make_post(const std::string& path, const std::string& json_body,
+                                         std::string_view span_name) const;
+    std::future<HttpResponse> start_async(std::shared_ptr<AsyncCall> call);
+    void start(std::shared_ptr<AsyncCall> call);
+    void dispatch(std::shared_ptr<AsyncCall> call);
+
+    // Declared last so in-flight completions finish before the rest of the client is destroyed
+    std::once_flag engine_once_;
+    std::unique_ptr<CurlMulti> engine_;
 };
 } // namespace internal
 } // namespace databricks
\ No newline at end of file
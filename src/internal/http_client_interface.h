@@ -4,8 +4,15 @@
 
 #include "databricks/core/config.h"
 
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
 #include <map>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 
 namespace databricks {
 namespace internal {
@@ -18,6 +25,32 @@ struct HttpResponse {
     std::map<std::string, std::string> headers;
 };
 
+/**
+ * @brief Receives a response body piece by piece as it arrives
+ *
+ * The view points into the transport's buffer and is only valid during the call.
+ * Throwing aborts the transfer; the exception reaches the caller of get_stream().
+ */
+using BodyChunkCallback = std::function<void(std::string_view chunk)>;
+
+/**
+ * @brief Receives the outcome of a callback-style async request
+ *
+ * Called exactly once, with a null error and the final response, or with the
+ * error that ended the request (response then empty). Runs on the thread that
+ * completed the request, so it must not block.
+ */
+using ResponseCallback = std::function<void(std::exception_ptr error, HttpResponse&& response)>;
+
+/**
+ * @brief Supplies a request body piece by piece as it is sent
+ *
+ * Fills up to capacity bytes of buffer and returns how many it wrote; 0 ends
+ * the body. Throwing aborts the transfer; the exception reaches the caller of
+ * put_stream().
+ */
+using BodyReader = std::function<size_t(char* buffer, size_t capacity)>;
+
 /**
  * @brief Interface for HTTP Client operations
  *
@@ -45,6 +78,158 @@ public:
      */
     virtual HttpResponse post(const std::string& path, const std::string& json_body) = 0;
 
+    /**
+     * @brief Start a GET request without waiting for it
+     *
+     * The default implementation performs the request synchronously and returns
+     * a ready future; HttpClient overrides it to run requests concurrently.
+     *
+     * @param path URL path for the GET request
+     * @return Future for the HTTP response; holds the exception if the request failed
+     */
+    virtual std::future<HttpResponse> get_async(const std::string& path) {
+        return ready([&] { return get(path); });
+    }
+
+    /**
+     * @brief Start a POST request without waiting for it
+     *
+     * @param path URL path for the POST request
+     * @param json_body Request payload as JSON string
+     * @return Future for the HTTP response; holds the exception if the request failed
+     * @see get_async()
+     */
+    virtual std::future<HttpResponse> post_async(const std::string& path, const std::string& json_body) {
+        return ready([&] { return post(path, json_body); });
+    }
+
+    /**
+     * @brief Start a GET request and have on_done called with its outcome instead of waiting on a future
+     *
+     * For callers that must not block a thread per request (see ResponseCallback).
+     * The default implementation performs the request synchronously and calls
+     * on_done before returning.
+     */
+    virtual void get_async(const std::string& path, ResponseCallback on_done) {
+        complete(on_done, [&] { return get(path); });
+    }
+
+    /**
+     * @brief Start a POST request and have on_done called with its outcome
+     * @see get_async(const std::string&, ResponseCallback)
+     */
+    virtual void post_async(const std::string& path, const std::string& json_body, ResponseCallback on_done) {
+        complete(on_done, [&] { return post(path, json_body); });
+    }
+
+    /**
+     * @brief Perform a GET request, handing a successful body to on_chunk as it arrives
+     *
+     * The body of a 200 response is delivered to on_chunk and not stored in the
+     * returned response, so it is never held in memory whole. Any other status
+     * is buffered in body as usual for check_response(). The default
+     * implementation performs get() and delivers the body in one piece.
+     *
+     * @param path URL path for the GET request
+     * @param on_chunk Consumer of the body
+     * @return HttpResponse HTTP response object (body empty on 200)
+     */
+    virtual HttpResponse get_stream(const std::string& path, const BodyChunkCallback& on_chunk) {
+        HttpResponse response = get(path);
+        if (response.status_code == 200) {
+            on_chunk(response.body);
+            response.body.clear();
+        }
+        return response;
+    }
+
+    /**
+     * @brief GET an absolute URL outside the workspace API, such as a presigned cloud storage link
+     *
+     * The workspace token is not sent (the URL carries its own credentials);
+     * only the given headers are. Presigned URLs are secrets until they expire,
+     * so implementations must not log the query string. The default
+     * implementation throws.
+     *
+     * @param url Absolute URL
+     * @param headers Extra request headers, sent as given
+     * @return HttpResponse HTTP response object
+     * @throws std::runtime_error if the client cannot reach external URLs or the request fails
+     */
+    virtual HttpResponse get_external(const std::string& url, const std::map<std::string, std::string>& headers) {
+        (void)url;
+        (void)headers;
+        throw std::runtime_error("External GET not supported by this HTTP client");
+    }
+
+    /**
+     * @brief Start get_external() without waiting for it
+     *
+     * @return Future for the HTTP response; holds the exception if the request failed
+     * @see get_async()
+     */
+    virtual std::future<HttpResponse> get_external_async(const std::string& url,
+                                                         const std::map<std::string, std::string>& headers) {
+        return ready([&] { return get_external(url, headers); });
+    }
+
+    /**
+     * @brief Perform a PUT request with a raw (not JSON) body
+     *
+     * The default implementation throws.
+     *
+     * @param path URL path for the PUT request
+     * @param body Request payload, sent as application/octet-stream
+     * @return HttpResponse HTTP response object
+     * @throws std::runtime_error if the client cannot send PUT requests or the request fails
+     */
+    virtual HttpResponse put(const std::string& path, const std::string& body) {
+        (void)path;
+        (void)body;
+        throw std::runtime_error("PUT not supported by this HTTP client");
+    }
+
+    /**
+     * @brief PUT a body of known size that is read as it is sent, so it is never held in memory whole
+     *
+     * open_body is called once per attempt and returns a reader positioned at
+     * the start of the body, which lets a retry resend it from the beginning.
+     * The default implementation reads the whole body and calls put().
+     *
+     * @param path URL path for the PUT request
+     * @param size Exact length of the body in bytes
+     * @param open_body Returns a fresh reader over the body
+     * @return HttpResponse HTTP response object
+     */
+    virtual HttpResponse put_stream(const std::string& path, uint64_t size,
+                                    const std::function<BodyReader()>& open_body) {
+        std::string body(static_cast<size_t>(size), '\0');
+        BodyReader read = open_body();
+        size_t filled = 0;
+        while (filled < body.size()) {
+            size_t n = read(&body[filled], body.size() - filled);
+            if (n == 0) {
+                throw std::runtime_error("Request body ended before its declared size");
+            }
+            filled += n;
+        }
+        return put(path, body);
+    }
+
+    /**
+     * @brief Perform a DELETE request
+     *
+     * The default implementation throws.
+     *
+     * @param path URL path for the DELETE request
+     * @return HttpResponse HTTP response object
+     * @throws std::runtime_error if the client cannot send DELETE requests or the request fails
+     */
+    virtual HttpResponse del(const std::string& path) {
+        (void)path;
+        throw std::runtime_error("DELETE not supported by this HTTP client");
+    }
+
     /**
      * @brief Check HTTP response and throw on error
      *
@@ -53,6 +238,29 @@ public:
      * @throws std::runtime_error if response indicates an error
      */
     virtual void check_response(const HttpResponse& response, const std::string& operation_name) const = 0;
+
+private:
+    // Run a request now and wrap its outcome in a ready future
+    template <typename Request> static std::future<HttpResponse> ready(Request request) {
+        std::promise<HttpResponse> promise;
+        try {
+            promise.set_value(request());
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+        }
+        return promise.get_future();
+    }
+
+    template <typename Request> static void complete(const ResponseCallback& on_done, Request request) {
+        HttpResponse response;
+        try {
+            response = request();
+        } catch (...) {
+            on_done(std::current_exception(), HttpResponse{});
+            return;
+        }
+        on_done(nullptr, std::move(response));
+    }
 };
 } // namespace internal
 } // namespace databricks
@@ -0,0 +1,35 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "latency_tracker.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace databricks {
+namespace internal {
+LatencyTracker::LatencyTracker(double percentile, std::chrono::microseconds initial, std::chrono::microseconds floor,
+                               size_t min_samples)
+    : percentile_(percentile)
+    , floor_us_(floor.count())
+    , min_samples_(std::min(std::max<size_t>(min_samples, 1), WINDOW))
+    , threshold_us_(std::max(initial.count(), floor.count())) {}
+
+void LatencyTracker::record(std::chrono::steady_clock::duration latency) {
+    const int64_t us = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    std::lock_guard<std::mutex> lock(mutex_);
+    samples_[recorded_ % WINDOW] = us;
+    recorded_++;
+    if (recorded_ < min_samples_ || (recorded_ % RECOMPUTE_EVERY != 0 && recorded_ != min_samples_)) {
+        return;
+    }
+
+    const size_t count = std::min(recorded_, WINDOW);
+    std::array<int64_t, WINDOW> sorted;
+    std::copy(samples_.begin(), samples_.begin() + count, sorted.begin());
+    const size_t rank = std::min(count - 1, static_cast<size_t>(std::ceil(percentile_ / 100.0 * count)) - 1);
+    std::nth_element(sorted.begin(), sorted.begin() + rank, sorted.begin() + count);
+    threshold_us_.store(std::max(sorted[rank], floor_us_), std::memory_order_relaxed);
+}
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,58 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace databricks {
+namespace internal {
+/**
+ * @brief Percentile of recent latencies, used as the hedged query delay
+ *
+ * Keeps the last WINDOW samples in a ring and recomputes the percentile
+ * every RECOMPUTE_EVERY samples, so threshold() is one atomic load.
+ * Until min_samples have been recorded threshold() is the initial delay.
+ *
+ * Thread-safe.
+ */
+class LatencyTracker {
+public:
+    static constexpr size_t WINDOW = 512;
+    static constexpr size_t RECOMPUTE_EVERY = 16;
+
+    /**
+     * @param percentile Percentile to track, in (0, 100)
+     * @param initial Threshold until min_samples are known
+     * @param floor Lowest threshold returned
+     * @param min_samples Samples needed before the percentile is used (capped at WINDOW)
+     */
+    LatencyTracker(double percentile, std::chrono::microseconds initial, std::chrono::microseconds floor,
+                   size_t min_samples);
+
+    LatencyTracker(const LatencyTracker&) = delete;
+    LatencyTracker& operator=(const LatencyTracker&) = delete;
+
+    void record(std::chrono::steady_clock::duration latency);
+
+    std::chrono::microseconds threshold() const {
+        return std::chrono::microseconds(threshold_us_.load(std::memory_order_relaxed));
+    }
+
+private:
+    const double percentile_;
+    const int64_t floor_us_;
+    const size_t min_samples_;
+
+    std::mutex mutex_; // Guards the ring
+    std::array<int64_t, WINDOW> samples_{};
+    size_t recorded_ = 0; // Total samples recorded
+    std::atomic<int64_t> threshold_us_;
+};
+
+} // namespace internal
+} // namespace databricks
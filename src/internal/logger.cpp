@@ -2,67 +2,97 @@
 // SPDX-License-Identifier: MIT
 #include "logger.h"
 
+#include <cctype>
 #include <cstdlib>
+#include <cstring>
 #include <string>
 
+#include <spdlog/async.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
 namespace databricks {
 namespace internal {
-std::shared_ptr<spdlog::logger> get_logger() {
-    static std::shared_ptr<spdlog::logger> logger = []() {
-        std::shared_ptr<spdlog::logger> log;
-
-        // Check for log file environment variable
-        const char* log_file = std::getenv("DATABRICKS_LOG_FILE");
-
-        try {
-            if (log_file && std::strlen(log_file) > 0) {
-                // Log to file
-                log = spdlog::basic_logger_mt("databricks", log_file);
-            } else {
-                // Log to stderr with colors
-                log = spdlog::stderr_color_mt("databricks");
-            }
-        } catch (const spdlog::spdlog_ex& ex) {
-            // Fallback to stderr if file creation fails
-            log = spdlog::stderr_color_mt("databricks");
-        }
+namespace {
+// Messages queued for the async logger's background thread
+constexpr size_t ASYNC_QUEUE_SIZE = 8192;
+
+std::string env_upper(const char* name) {
+    const char* value = std::getenv(name);
+    std::string upper(value ? value : "");
+    for (char& c : upper) {
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+    return upper;
+}
 
-        // Set log level from environment (default: INFO)
-        const char* log_level_str = std::getenv("DATABRICKS_LOG_LEVEL");
-        spdlog::level::level_enum level = spdlog::level::info; // Default
-
-        if (log_level_str) {
-            std::string level_upper(log_level_str);
-            // Convert to uppercase
-            for (char& c : level_upper) {
-                c = std::toupper(c);
-            }
-
-            if (level_upper == "DEBUG" || level_upper == "TRACE") {
-                level = spdlog::level::debug;
-            } else if (level_upper == "INFO") {
-                level = spdlog::level::info;
-            } else if (level_upper == "WARN" || level_upper == "WARNING") {
-                level = spdlog::level::warn;
-            } else if (level_upper == "ERROR" || level_upper == "ERR") {
-                level = spdlog::level::err;
-            } else if (level_upper == "OFF" || level_upper == "NONE") {
-                level = spdlog::level::off;
-            }
+spdlog::sink_ptr create_sink() {
+    // Check for log file environment variable
+    const char* log_file = std::getenv("DATABRICKS_LOG_FILE");
+
+    try {
+        if (log_file && std::strlen(log_file) > 0) {
+            // Log to file
+            return std::make_shared<spdlog::sinks::basic_file_sink_mt>(log_file);
         }
+    } catch (const spdlog::spdlog_ex&) {
+        // Fallback to stderr if file creation fails
+    }
+    // Log to stderr with colors
+    return std::make_shared<spdlog::sinks::stderr_color_sink_mt>();
+}
+
+std::shared_ptr<spdlog::logger> create_logger() {
+    spdlog::sink_ptr sink = create_sink();
+    std::shared_ptr<spdlog::logger> log;
+
+    const std::string async = env_upper("DATABRICKS_LOG_ASYNC");
+    if (async == "1" || async == "TRUE" || async == "ON") {
+        // Declared static so the worker outlives the logger and drains the queue at exit
+        static auto pool = std::make_shared<spdlog::details::thread_pool>(ASYNC_QUEUE_SIZE, 1);
+        log = std::make_shared<spdlog::async_logger>("databricks", std::move(sink), pool,
+                                                     spdlog::async_overflow_policy::overrun_oldest);
+    } else {
+        log = std::make_shared<spdlog::logger>("databricks", std::move(sink));
+    }
 
-        log->set_level(level);
+    // Set log level from environment (default: INFO)
+    const std::string level_upper = env_upper("DATABRICKS_LOG_LEVEL");
+    spdlog::level::level_enum level = spdlog::level::info; // Default
 
-        // Set pattern: [timestamp] [level] [logger_name] message
-        log->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%^%l%$] [%n] %v");
+    if (level_upper == "DEBUG" || level_upper == "TRACE") {
+        level = spdlog::level::debug;
+    } else if (level_upper == "INFO") {
+        level = spdlog::level::info;
+    } else if (level_upper == "WARN" || level_upper == "WARNING") {
+        level = spdlog::level::warn;
+    } else if (level_upper == "ERROR" || level_upper == "ERR") {
+        level = spdlog::level::err;
+    } else if (level_upper == "OFF" || level_upper == "NONE") {
+        level = spdlog::level::off;
+    }
 
-        return log;
-    }();
+    log->set_level(level);
 
+    // Set pattern: [timestamp] [level] [logger_name] message
+    log->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%^%l%$] [%n] %v");
+
+    return log;
+}
+
+std::shared_ptr<spdlog::logger>& shared_logger() {
+    static std::shared_ptr<spdlog::logger> logger = create_logger();
     return logger;
-};
+}
+} // namespace
+
+spdlog::logger& logger() {
+    static spdlog::logger& instance = *shared_logger();
+    return instance;
+}
+
+std::shared_ptr<spdlog::logger> get_logger() {
+    return shared_logger();
+}
 } // namespace internal
-} // namespace databricks
\ No newline at end of file
+} // namespace databricks
@@ -6,14 +6,57 @@
 
 #include <spdlog/spdlog.h>
 
+// Lowest level compiled in (an SPDLOG_LEVEL_* value); calls below it are removed entirely.
+// Set with the LOG_COMPILE_LEVEL CMake option.
+#ifndef DATABRICKS_LOG_ACTIVE_LEVEL
+#    define DATABRICKS_LOG_ACTIVE_LEVEL SPDLOG_LEVEL_DEBUG
+#endif
+
+/**
+ * @brief Log through the SDK logger, evaluating the arguments only if the level is enabled
+ *
+ * Levels below DATABRICKS_LOG_ACTIVE_LEVEL compile to nothing; the others cost
+ * one level check unless they are enabled at runtime. Prefer format arguments
+ * over string concatenation so enabled levels don't build temporary strings:
+ * @code
+ * DATABRICKS_LOG_DEBUG("HTTP GET: {}", url);
+ * @endcode
+ */
+#define DATABRICKS_LOG(level, ...)                                                                                     \
+    do {                                                                                                               \
+        if constexpr (static_cast<int>(level) >= DATABRICKS_LOG_ACTIVE_LEVEL) {                                        \
+            spdlog::logger& databricks_logger_ = ::databricks::internal::logger();                                     \
+            if (databricks_logger_.should_log(level)) {                                                                \
+                databricks_logger_.log(level, __VA_ARGS__);                                                            \
+            }                                                                                                          \
+        }                                                                                                              \
+    } while (false)
+
+#define DATABRICKS_LOG_DEBUG(...) DATABRICKS_LOG(spdlog::level::debug, __VA_ARGS__)
+#define DATABRICKS_LOG_INFO(...) DATABRICKS_LOG(spdlog::level::info, __VA_ARGS__)
+#define DATABRICKS_LOG_WARN(...) DATABRICKS_LOG(spdlog::level::warn, __VA_ARGS__)
+#define DATABRICKS_LOG_ERROR(...) DATABRICKS_LOG(spdlog::level::err, __VA_ARGS__)
+
 namespace databricks {
 namespace internal {
+/**
+ * @brief The SDK logger, created on first use
+ *
+ * Configured from the environment:
+ *   DATABRICKS_LOG_LEVEL  debug, info (default), warn, error or off
+ *   DATABRICKS_LOG_FILE   Log to this file instead of stderr
+ *   DATABRICKS_LOG_ASYNC  When 1/true/on, format and write on a background thread;
+ *                         if the queue fills, the oldest messages are dropped
+ *                         rather than blocking the caller
+ */
+spdlog::logger& logger();
+
 /**
  * @brief Get an instance of the spdLogger
  *
- * Internal Logger object for outputs
- *   Log Level from DATABRICKS_LOG_LEVEL (default: INFO)
+ * Shared handle to logger(); each call copies the reference count, so hot
+ * paths should use logger() or the DATABRICKS_LOG_* macros instead.
  */
 std::shared_ptr<spdlog::logger> get_logger();
 } // namespace internal
-} // namespace databricks
\ No newline at end of file
+} // namespace databricks
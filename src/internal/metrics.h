@@ -0,0 +1,124 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "databricks/core/metrics.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace databricks {
+namespace internal {
+/**
+ * @brief The installed sink, nullptr when recording is disabled
+ *
+ * Cheaper than get_metrics_sink() (no reference count); the sink stays valid
+ * because replaced sinks are never destroyed.
+ */
+MetricsSink* metrics_sink();
+
+/**
+ * @brief Add to a counter if recording is enabled
+ */
+inline void add_metric(MetricCounter counter, uint64_t value, const MetricLabels& labels = {}) {
+    if (MetricsSink* sink = metrics_sink()) {
+        sink->add(counter, value, labels);
+    }
+}
+
+/**
+ * @brief Records the time from construction to stop() (or destruction) into a timer
+ *
+ * Does nothing, not even read the clock, when recording is disabled.
+ */
+class ScopedTimer {
+public:
+    explicit ScopedTimer(MetricTimer timer, const MetricLabels& labels = {})
+        : sink_(metrics_sink())
+        , timer_(timer)
+        , labels_(labels) {
+        if (sink_) {
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ScopedTimer() { stop(); }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    /**
+     * @brief Record now instead of at destruction; later calls do nothing
+     */
+    void stop() {
+        if (sink_) {
+            sink_->observe(timer_, std::chrono::steady_clock::now() - start_, labels_);
+            sink_ = nullptr;
+        }
+    }
+
+    /**
+     * @brief Drop the measurement (e.g. the operation failed)
+     */
+    void cancel() { sink_ = nullptr; }
+
+private:
+    MetricsSink* sink_;
+    MetricTimer timer_;
+    MetricLabels labels_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+/**
+ * @brief Records the total time spent inside measure() calls as one QueryFetch sample
+ *
+ * For fetch loops that hand each batch to caller code, so only the SDK's share
+ * of the loop is recorded. The sample is taken at destruction.
+ */
+class FetchTimer {
+public:
+    FetchTimer()
+        : sink_(metrics_sink()) {}
+
+    ~FetchTimer() {
+        if (sink_) {
+            sink_->observe(MetricTimer::QueryFetch, total_, {});
+        }
+    }
+
+    FetchTimer(const FetchTimer&) = delete;
+    FetchTimer& operator=(const FetchTimer&) = delete;
+
+    /**
+     * @brief Run func, adding its duration to the total (also when it throws)
+     */
+    template <typename Func> auto measure(Func&& func) -> decltype(func()) {
+        if (!sink_) {
+            return func();
+        }
+        struct Accumulate {
+            FetchTimer& timer;
+            std::chrono::steady_clock::time_point start;
+            ~Accumulate() { timer.total_ += std::chrono::steady_clock::now() - start; }
+        } accumulate{*this, std::chrono::steady_clock::now()};
+        return func();
+    }
+
+private:
+    MetricsSink* sink_;
+    std::chrono::nanoseconds total_{0};
+};
+
+/**
+ * @brief Low-cardinality endpoint label for a REST path
+ *
+ * Drops the query string and replaces Unity Catalog object names with
+ * "{name}", e.g. "/unity-catalog/tables/main.default.t" becomes
+ * "/unity-catalog/tables/{name}".
+ */
+std::string endpoint_label(std::string_view path);
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,76 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "odbc_environment.h"
+
+#include "logger.h"
+
+#include <mutex>
+#include <set>
+#include <stdexcept>
+
+#include <sqlext.h>
+
+namespace databricks {
+namespace internal {
+namespace {
+std::mutex environment_mutex;
+SQLHENV environment = SQL_NULL_HENV; // Guarded by environment_mutex until set
+
+std::mutex drivers_mutex;
+std::set<std::string> drivers; // Installed driver names as last listed, guarded by drivers_mutex
+
+std::set<std::string> list_drivers(SQLHENV henv) {
+    SQLCHAR driver[256];
+    SQLCHAR attributes[256];
+    SQLSMALLINT driver_len, attr_len;
+    SQLUSMALLINT direction = SQL_FETCH_FIRST;
+
+    std::set<std::string> names;
+    while (SQL_SUCCEEDED(SQLDrivers(henv, direction, driver, sizeof(driver), &driver_len, attributes,
+                                    sizeof(attributes), &attr_len))) {
+        names.insert(reinterpret_cast<char*>(driver));
+        direction = SQL_FETCH_NEXT;
+    }
+    return names;
+}
+} // namespace
+
+SQLHENV shared_odbc_environment() {
+    std::lock_guard<std::mutex> lock(environment_mutex);
+    if (environment != SQL_NULL_HENV) {
+        return environment;
+    }
+
+    SQLHENV henv = SQL_NULL_HENV;
+    SQLRETURN ret = SQLAllocHandle(SQL_HANDLE_ENV, SQL_NULL_HANDLE, &henv);
+    if (!SQL_SUCCEEDED(ret)) {
+        DATABRICKS_LOG_ERROR("Failed to allocate ODBC environment handle");
+        throw std::runtime_error("Failed to allocate ODBC environment handle");
+    }
+
+    ret = SQLSetEnvAttr(henv, SQL_ATTR_ODBC_VERSION, (SQLPOINTER)SQL_OV_ODBC3, 0);
+    if (!SQL_SUCCEEDED(ret)) {
+        DATABRICKS_LOG_ERROR("Failed to set ODBC version");
+        SQLFreeHandle(SQL_HANDLE_ENV, henv);
+        throw std::runtime_error("Failed to set ODBC version");
+    }
+
+    DATABRICKS_LOG_DEBUG("Allocated shared ODBC environment handle");
+    environment = henv;
+    return environment;
+}
+
+bool odbc_driver_installed(const std::string& driver_name) {
+    SQLHENV henv = shared_odbc_environment();
+
+    std::lock_guard<std::mutex> lock(drivers_mutex);
+    if (drivers.count(driver_name)) {
+        return true;
+    }
+    // First call, or a miss that may be a driver installed since the last listing
+    drivers = list_drivers(henv);
+    return drivers.count(driver_name) > 0;
+}
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,33 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <string>
+
+#include <sql.h>
+
+namespace databricks {
+namespace internal {
+/**
+ * @brief The process-wide ODBC environment handle (ODBC 3), allocated on first use
+ *
+ * Every connection handle is allocated from this one environment instead of
+ * each client allocating its own. The handle is never freed: clients may be
+ * destroyed during static destruction, and the driver manager releases it at
+ * process exit. Thread-safe.
+ *
+ * @throws std::runtime_error if the environment cannot be allocated (retried on the next call)
+ */
+SQLHENV shared_odbc_environment();
+
+/**
+ * @brief Whether an ODBC driver of this name is installed
+ *
+ * The driver list is enumerated with SQLDrivers once and cached; a name that
+ * is not found triggers one fresh enumeration, so a driver installed while
+ * the process runs is still picked up. Thread-safe.
+ */
+bool odbc_driver_installed(const std::string& driver_name);
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,824 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "odbc_statement.h"
+
+#include "cancel_scope.h"
+#include "logger.h"
+#include "metrics.h"
+#include "odbc_types.h"
+#include "statement_cache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace databricks {
+namespace internal {
+// ========== Diagnostics ==========
+
+std::vector<DiagnosticRecord> get_odbc_diagnostics(SQLSMALLINT handle_type, SQLHANDLE handle) {
+    SQLCHAR sqlState[6];
+    SQLCHAR message[SQL_MAX_MESSAGE_LENGTH];
+    SQLINTEGER nativeError;
+    SQLSMALLINT msgLen;
+
+    std::vector<DiagnosticRecord> diagnostics;
+    SQLSMALLINT i = 1;
+
+    while (SQLGetDiagRec(handle_type, handle, i, sqlState, &nativeError, message, sizeof(message), &msgLen) ==
+           SQL_SUCCESS) {
+        DiagnosticRecord record;
+        record.sqlstate = reinterpret_cast<const char*>(sqlState);
+        record.native_error = static_cast<int32_t>(nativeError);
+        record.message = reinterpret_cast<const char*>(message);
+        diagnostics.push_back(std::move(record));
+        i++;
+    }
+
+    return diagnostics;
+}
+
+std::string format_diagnostics(const std::vector<DiagnosticRecord>& diagnostics) {
+    std::string error;
+    for (const DiagnosticRecord& record : diagnostics) {
+        error += "[" + record.sqlstate + "] " + record.message + "; ";
+    }
+    return error;
+}
+
+std::string get_odbc_error(SQLSMALLINT handle_type, SQLHANDLE handle) {
+    return format_diagnostics(get_odbc_diagnostics(handle_type, handle));
+}
+
+void throw_sql_error(const std::string& message, std::vector<DiagnosticRecord> diagnostics) {
+    SqlError error(message, diagnostics);
+    switch (error.category()) {
+    case ErrorCategory::Connection:
+        throw ConnectionError(message, std::move(diagnostics));
+    case ErrorCategory::Timeout:
+        throw TimeoutError(message, std::move(diagnostics));
+    case ErrorCategory::Authentication:
+        throw AuthenticationError(message, std::move(diagnostics));
+    case ErrorCategory::Query:
+        throw QueryError(message, std::move(diagnostics));
+    default:
+        throw error;
+    }
+}
+
+void throw_odbc_error(const std::string& context, SQLSMALLINT handle_type, SQLHANDLE handle) {
+    std::vector<DiagnosticRecord> diagnostics = get_odbc_diagnostics(handle_type, handle);
+    throw_sql_error(context + ": " + format_diagnostics(diagnostics), std::move(diagnostics));
+}
+
+// ========== StatementHandle Implementation ==========
+
+void StatementHandle::reset(SQLHSTMT hstmt) {
+    if (hstmt_ != SQL_NULL_HSTMT) {
+        if (cache_) {
+            // Close the cursor and drop parameter bindings so the next user starts clean
+            SQLFreeStmt(hstmt_, SQL_CLOSE);
+            SQLFreeStmt(hstmt_, SQL_RESET_PARAMS);
+            cache_->put(cache_key_, hstmt_);
+        } else {
+            SQLFreeHandle(SQL_HANDLE_STMT, hstmt_);
+        }
+    }
+    hstmt_ = hstmt;
+    cache_ = nullptr;
+    cache_key_.clear();
+}
+
+// ========== Shared fetch helpers ==========
+
+namespace {
+// Size of the SQLGetData buffer used for unbounded columns
+constexpr size_t ROW_MODE_CHUNK_BYTES = 4096;
+
+/**
+ * @brief Ask the driver for a row array of `requested` rows
+ * @return The row array size the driver accepted
+ */
+size_t set_row_array_size(SQLHSTMT hstmt, size_t requested) {
+    SQLRETURN ret = SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_BIND_TYPE, (SQLPOINTER)SQL_BIND_BY_COLUMN, 0);
+    if (!SQL_SUCCEEDED(ret)) {
+        throw_odbc_error("Failed to set column-wise binding", SQL_HANDLE_STMT, hstmt);
+    }
+
+    ret = SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)requested, 0);
+    if (!SQL_SUCCEEDED(ret)) {
+        DATABRICKS_LOG_DEBUG("Driver rejected row array size {}, fetching one row at a time", requested);
+        return 1;
+    }
+    if (ret == SQL_SUCCESS_WITH_INFO) {
+        // Driver substituted a different value (01S02); use what it accepted
+        SQLULEN actual = 0;
+        if (SQL_SUCCEEDED(SQLGetStmtAttr(hstmt, SQL_ATTR_ROW_ARRAY_SIZE, &actual, 0, nullptr)) && actual > 0) {
+            return actual;
+        }
+    }
+    return requested;
+}
+
+/**
+ * @brief Detach bound buffers and row-array attributes so the statement can be reused
+ */
+void reset_bindings(SQLHSTMT hstmt) {
+    SQLFreeStmt(hstmt, SQL_UNBIND);
+    SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)1, 0);
+    SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_STATUS_PTR, nullptr, 0);
+    SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR, nullptr, 0);
+}
+
+/**
+ * @brief Run one block SQLFetch
+ * @return Rows fetched (0 at end of data)
+ */
+size_t fetch_row_array(SQLHSTMT hstmt, const std::vector<SQLUSMALLINT>& row_status, SQLULEN& rows_fetched) {
+    rows_fetched = 0;
+    SQLRETURN ret = SQLFetch(hstmt);
+    if (ret == SQL_NO_DATA) {
+        return 0;
+    }
+    if (!SQL_SUCCEEDED(ret)) {
+        throw_odbc_error("Failed to fetch results", SQL_HANDLE_STMT, hstmt);
+    }
+
+    const size_t fetched = std::min<size_t>(rows_fetched, row_status.size());
+    for (size_t r = 0; r < fetched; r++) {
+        if (row_status[r] == SQL_ROW_ERROR) {
+            throw_odbc_error("Failed to fetch row", SQL_HANDLE_STMT, hstmt);
+        }
+    }
+    return fetched;
+}
+
+/**
+ * @brief Run one single-row SQLFetch
+ * @return false at end of data
+ */
+bool fetch_single_row(SQLHSTMT hstmt) {
+    SQLRETURN ret = SQLFetch(hstmt);
+    if (ret == SQL_NO_DATA) {
+        return false;
+    }
+    if (!SQL_SUCCEEDED(ret)) {
+        throw_odbc_error("Failed to fetch results", SQL_HANDLE_STMT, hstmt);
+    }
+    return true;
+}
+
+/**
+ * @brief Count a batch's rows and value bytes in the fetch metrics
+ */
+void record_fetched(const ColumnarBatch& batch) {
+    MetricsSink* sink = metrics_sink();
+    if (!sink || batch.num_rows() == 0) {
+        return;
+    }
+    size_t bytes = 0;
+    for (size_t c = 0; c < batch.num_columns(); c++) {
+        bytes += batch.column(c).data.size();
+    }
+    sink->add(MetricCounter::RowsFetched, batch.num_rows(), {});
+    sink->add(MetricCounter::BytesFetched, bytes, {});
+}
+
+void record_fetched(const TypedBatch& batch) {
+    MetricsSink* sink = metrics_sink();
+    if (!sink || batch.num_rows() == 0) {
+        return;
+    }
+    size_t bytes = 0;
+    for (size_t c = 0; c < batch.num_columns(); c++) {
+        const auto& column = batch.column(c);
+        bytes += column.bools.size() + column.int64s.size() * sizeof(int64_t) + column.doubles.size() * sizeof(double) +
+                 column.dates.size() * sizeof(Date) + column.timestamps.size() * sizeof(Timestamp) + column.text.size();
+    }
+    sink->add(MetricCounter::RowsFetched, batch.num_rows(), {});
+    sink->add(MetricCounter::BytesFetched, bytes, {});
+}
+
+/**
+ * @brief Copy one bound SQL_C_CHAR value into a data + offsets + nulls column
+ * @return false, appending nothing, if the value was longer than the binding (see reread_bound_text())
+ */
+bool append_bound_text(const char* value, SQLLEN width, SQLLEN indicator, std::vector<char>& data,
+                       std::vector<uint64_t>& offsets, std::vector<uint8_t>& nulls) {
+    if (indicator == SQL_NULL_DATA) {
+        offsets.push_back(data.size());
+        nulls.push_back(1);
+        return true;
+    }
+    if (indicator == SQL_NO_TOTAL || indicator >= width) {
+        return false;
+    }
+
+    data.insert(data.end(), value, value + indicator);
+    offsets.push_back(data.size());
+    nulls.push_back(0);
+    return true;
+}
+} // namespace
+
+std::vector<ColumnMetadata> describe_result(SQLHSTMT hstmt) {
+    SQLSMALLINT colCount = 0;
+    SQLRETURN ret = SQLNumResultCols(hstmt, &colCount);
+    if (!SQL_SUCCEEDED(ret)) {
+        throw_odbc_error("Failed to get column count", SQL_HANDLE_STMT, hstmt);
+    }
+
+    std::vector<ColumnMetadata> schema;
+    schema.reserve(colCount);
+    for (SQLSMALLINT i = 1; i <= colCount; i++) {
+        SQLCHAR name[256];
+        SQLSMALLINT nameLen = 0;
+        SQLSMALLINT dataType = 0;
+        SQLULEN columnSize = 0;
+        SQLSMALLINT decimalDigits = 0;
+        SQLSMALLINT nullable = SQL_NULLABLE_UNKNOWN;
+
+        ret = SQLDescribeCol(hstmt, i, name, sizeof(name), &nameLen, &dataType, &columnSize, &decimalDigits,
+                             &nullable);
+        if (!SQL_SUCCEEDED(ret)) {
+            throw_odbc_error("Failed to describe column " + std::to_string(i), SQL_HANDLE_STMT, hstmt);
+        }
+
+        ColumnMetadata column;
+        column.name.assign(reinterpret_cast<const char*>(name),
+                           std::min<size_t>(static_cast<size_t>(std::max<SQLSMALLINT>(nameLen, 0)), sizeof(name) - 1));
+        column.sql_type = dataType;
+        column.column_size = columnSize;
+        column.decimal_digits = decimalDigits;
+        column.nullable = nullable != SQL_NO_NULLS;
+        schema.push_back(std::move(column));
+    }
+    return schema;
+}
+
+bool supports_bound_rereads(SQLHDBC hdbc) {
+    SQLUINTEGER extensions = 0;
+    SQLUINTEGER cursor = 0;
+    if (!SQL_SUCCEEDED(SQLGetInfo(hdbc, SQL_GETDATA_EXTENSIONS, &extensions, sizeof(extensions), nullptr)) ||
+        !SQL_SUCCEEDED(SQLGetInfo(hdbc, SQL_FORWARD_ONLY_CURSOR_ATTRIBUTES1, &cursor, sizeof(cursor), nullptr))) {
+        return false;
+    }
+    const SQLUINTEGER needed = SQL_GD_BLOCK | SQL_GD_BOUND;
+    return (extensions & needed) == needed && (cursor & SQL_CA1_POS_POSITION) != 0;
+}
+
+namespace {
+/**
+ * @brief First SQLGetData buffer size for a column: its bound width, or one chunk if unbounded
+ */
+size_t initial_read_bytes(const ColumnMetadata& column, size_t max_column_bytes) {
+    size_t width = BlockFetcher::bound_width(column, max_column_bytes);
+    return width > 0 ? width : ROW_MODE_CHUNK_BYTES;
+}
+} // namespace
+
+template <typename Buffer>
+bool read_char_data(SQLHSTMT hstmt, SQLUSMALLINT column_number, size_t initial_bytes, Buffer& out) {
+    const size_t start = out.size();
+    size_t filled = start;
+    out.resize(start + std::max<size_t>(initial_bytes, 2));
+
+    while (true) {
+        const size_t available = out.size() - filled;
+        SQLLEN indicator = 0;
+        SQLRETURN ret = SQLGetData(hstmt, column_number, SQL_C_CHAR, &out[filled], static_cast<SQLLEN>(available),
+                                   &indicator);
+        if (ret == SQL_NO_DATA) {
+            break;
+        }
+        if (!SQL_SUCCEEDED(ret)) {
+            out.resize(start);
+            throw_odbc_error("Failed to read column " + std::to_string(column_number), SQL_HANDLE_STMT, hstmt);
+        }
+        if (indicator == SQL_NULL_DATA) {
+            out.resize(start);
+            return false;
+        }
+
+        const bool truncated =
+            ret == SQL_SUCCESS_WITH_INFO && (indicator == SQL_NO_TOTAL || static_cast<size_t>(indicator) >= available);
+        if (!truncated) {
+            filled += static_cast<size_t>(indicator);
+            break;
+        }
+
+        // The driver filled the buffer minus its terminator; the indicator is what was
+        // left before this call, so grow by exactly the rest (double when unknown)
+        filled += available - 1;
+        const size_t remaining =
+            indicator == SQL_NO_TOTAL ? out.size() - start : static_cast<size_t>(indicator) - (available - 1);
+        out.resize(filled + remaining + 1);
+    }
+
+    out.resize(filled);
+    return true;
+}
+
+template bool read_char_data<std::string>(SQLHSTMT, SQLUSMALLINT, size_t, std::string&);
+template bool read_char_data<std::vector<char>>(SQLHSTMT, SQLUSMALLINT, size_t, std::vector<char>&);
+
+namespace {
+/**
+ * @brief Read a value the driver truncated into its binding again, whole, with SQLGetData
+ *
+ * The bound width comes from the declared column size, which is only
+ * nominal for strings (Simba Spark describes STRING as VARCHAR(255)), so any
+ * value may turn out longer. Positioning the cursor on the value's row of the
+ * rowset lets SQLGetData read it from the start; the rest of the block stays
+ * bound.
+ *
+ * @param row Row within the current rowset (0-based)
+ * @param indicator The binding's indicator for the value (its full length, or SQL_NO_TOTAL)
+ */
+void reread_bound_text(SQLHSTMT hstmt, size_t row, SQLUSMALLINT column_number, SQLLEN indicator,
+                       std::vector<char>& data, std::vector<uint64_t>& offsets, std::vector<uint8_t>& nulls) {
+    SQLRETURN ret = SQLSetPos(hstmt, static_cast<SQLSETPOSIROW>(row + 1), SQL_POSITION, SQL_LOCK_NO_CHANGE);
+    if (!SQL_SUCCEEDED(ret)) {
+        throw_odbc_error("Failed to position on row " + std::to_string(row + 1) + " of the rowset to read column " +
+                             std::to_string(column_number) + " past its bound length",
+                         SQL_HANDLE_STMT, hstmt);
+    }
+    const size_t initial_bytes = indicator == SQL_NO_TOTAL ? ROW_MODE_CHUNK_BYTES : static_cast<size_t>(indicator) + 1;
+    const bool has_value = read_char_data(hstmt, column_number, initial_bytes, data);
+    offsets.push_back(data.size());
+    nulls.push_back(has_value ? 0 : 1);
+}
+} // namespace
+
+std::vector<std::vector<std::string>> fetch_all_strings(SQLHSTMT hstmt, size_t block_rows, size_t max_column_bytes,
+                                                        bool bound_rereads, const CancelScope* scope) {
+    std::vector<std::vector<std::string>> results;
+
+    BlockFetcher fetcher(hstmt, block_rows, max_column_bytes, bound_rereads);
+    const auto& schema = fetcher.schema();
+
+    if (fetcher.block_mode()) {
+        ColumnarBatch batch;
+        while (fetcher.fetch_next(batch)) {
+            if (scope) {
+                scope->throw_if_fired();
+            }
+            results.reserve(results.size() + batch.num_rows());
+            for (size_t r = 0; r < batch.num_rows(); r++) {
+                results.push_back(RowView(batch, r).to_strings());
+            }
+        }
+        return results;
+    }
+
+    // Unbounded columns: read each value straight into its std::string, sized from
+    // the declared column width and grown from the indicator when longer
+    std::vector<size_t> initial_bytes;
+    initial_bytes.reserve(schema.size());
+    for (const auto& column : schema) {
+        initial_bytes.push_back(initial_read_bytes(column, max_column_bytes));
+    }
+
+    size_t bytes = 0;
+    while (!schema.empty() && fetch_single_row(hstmt)) {
+        if (scope) {
+            scope->throw_if_fired();
+        }
+        std::vector<std::string> row(schema.size());
+        for (size_t c = 0; c < schema.size(); c++) {
+            read_char_data(hstmt, static_cast<SQLUSMALLINT>(c + 1), initial_bytes[c], row[c]);
+            bytes += row[c].size();
+        }
+        results.push_back(std::move(row));
+    }
+    add_metric(MetricCounter::RowsFetched, results.size());
+    add_metric(MetricCounter::BytesFetched, bytes);
+    return results;
+}
+
+// ========== BlockFetcher Implementation ==========
+
+BlockFetcher::BlockFetcher(SQLHSTMT hstmt, size_t block_rows, size_t max_column_bytes, bool bound_rereads)
+    : hstmt_(hstmt)
+    , block_rows_(std::max<size_t>(block_rows, 1))
+    , max_column_bytes_(max_column_bytes)
+    , schema_(describe_result(hstmt)) {
+    // Statements without a result set (DDL, DML) have nothing to fetch
+    exhausted_ = schema_.empty();
+    // Without bound rereads, a value longer than its nominal width could not be read whole
+    block_mode_ = !schema_.empty() && std::all_of(schema_.begin(), schema_.end(), [&](const ColumnMetadata& c) {
+        return bound_width(c, max_column_bytes_) > 0 && (bound_rereads || !nominal_width(c));
+    });
+
+    if (block_mode_) {
+        bind_columns();
+    }
+
+    DATABRICKS_LOG_DEBUG("Fetching {} columns in {} mode ({} rows per block)", schema_.size(),
+                         block_mode_ ? "block" : "row", block_rows_);
+}
+
+BlockFetcher::~BlockFetcher() {
+    if (block_mode_) {
+        reset_bindings(hstmt_);
+    }
+}
+
+size_t BlockFetcher::bound_width(const ColumnMetadata& column, size_t max_column_bytes) {
+    size_t width = 0;
+    switch (column.sql_type) {
+    case SQL_BIT:
+        width = 2;
+        break;
+    case SQL_TINYINT:
+        width = 5;
+        break;
+    case SQL_SMALLINT:
+        width = 7;
+        break;
+    case SQL_INTEGER:
+        width = 12;
+        break;
+    case SQL_BIGINT:
+        width = 21;
+        break;
+    case SQL_REAL:
+        width = 24;
+        break;
+    case SQL_FLOAT:
+    case SQL_DOUBLE:
+        width = 32;
+        break;
+    case SQL_DECIMAL:
+    case SQL_NUMERIC:
+        // Digits plus sign, decimal point and terminator
+        width = column.column_size > 0 ? column.column_size + 3 : 0;
+        break;
+    case SQL_TYPE_DATE:
+        width = 11;
+        break;
+    case SQL_TYPE_TIME:
+        width = 17;
+        break;
+    case SQL_TYPE_TIMESTAMP:
+        width = 32;
+        break;
+    default:
+        // Character and binary data: allow up to 4 bytes per character for UTF-8
+        width = column.column_size > 0 ? column.column_size * 4 + 1 : 0;
+        break;
+    }
+
+    return width <= max_column_bytes ? width : 0;
+}
+
+bool BlockFetcher::nominal_width(const ColumnMetadata& column) {
+    switch (column.sql_type) {
+    case SQL_BIT:
+    case SQL_TINYINT:
+    case SQL_SMALLINT:
+    case SQL_INTEGER:
+    case SQL_BIGINT:
+    case SQL_REAL:
+    case SQL_FLOAT:
+    case SQL_DOUBLE:
+    case SQL_DECIMAL:
+    case SQL_NUMERIC:
+    case SQL_TYPE_DATE:
+    case SQL_TYPE_TIME:
+    case SQL_TYPE_TIMESTAMP:
+        return false;
+    default:
+        return true;
+    }
+}
+
+void BlockFetcher::bind_columns() {
+    block_rows_ = set_row_array_size(hstmt_, block_rows_);
+
+    row_status_.resize(block_rows_);
+    SQLSetStmtAttr(hstmt_, SQL_ATTR_ROW_STATUS_PTR, row_status_.data(), 0);
+    SQLSetStmtAttr(hstmt_, SQL_ATTR_ROWS_FETCHED_PTR, &rows_fetched_, 0);
+
+    bindings_.resize(schema_.size());
+    for (size_t c = 0; c < schema_.size(); c++) {
+        auto& binding = bindings_[c];
+        binding.width = static_cast<SQLLEN>(bound_width(schema_[c], max_column_bytes_));
+        binding.buffer.resize(block_rows_ * static_cast<size_t>(binding.width));
+        binding.indicators.resize(block_rows_);
+
+        SQLRETURN ret = SQLBindCol(hstmt_, static_cast<SQLUSMALLINT>(c + 1), SQL_C_CHAR, binding.buffer.data(),
+                                   binding.width, binding.indicators.data());
+        if (!SQL_SUCCEEDED(ret)) {
+            throw_odbc_error("Failed to bind column " + std::to_string(c + 1), SQL_HANDLE_STMT, hstmt_);
+        }
+    }
+}
+
+bool BlockFetcher::fetch_next(ColumnarBatch& batch) {
+    if (&batch != last_batch_) {
+        batch.reset(schema_);
+        last_batch_ = &batch;
+    } else {
+        batch.clear();
+    }
+
+    if (exhausted_) {
+        return false;
+    }
+
+    const bool fetched = block_mode_ ? fetch_block(batch) : fetch_rows(batch);
+    record_fetched(batch);
+    return fetched;
+}
+
+bool BlockFetcher::fetch_block(ColumnarBatch& batch) {
+    const size_t fetched = fetch_row_array(hstmt_, row_status_, rows_fetched_);
+    if (fetched < block_rows_) {
+        // A short block is the last one
+        exhausted_ = true;
+    }
+
+    batch.reserve_rows(fetched);
+    for (size_t c = 0; c < bindings_.size(); c++) {
+        const auto& binding = bindings_[c];
+        auto& column = batch.mutable_column(c);
+
+        for (size_t r = 0; r < fetched; r++) {
+            if (!append_bound_text(binding.buffer.data() + r * static_cast<size_t>(binding.width), binding.width,
+                                   binding.indicators[r], column.data, column.offsets, column.nulls)) {
+                reread_bound_text(hstmt_, r, static_cast<SQLUSMALLINT>(c + 1), binding.indicators[r], column.data,
+                                  column.offsets, column.nulls);
+            }
+        }
+    }
+    batch.commit_rows(fetched);
+
+    return fetched > 0;
+}
+
+bool BlockFetcher::fetch_rows(ColumnarBatch& batch) {
+    while (batch.num_rows() < block_rows_) {
+        if (!fetch_single_row(hstmt_)) {
+            exhausted_ = true;
+            break;
+        }
+
+        for (size_t c = 0; c < schema_.size(); c++) {
+            read_value(static_cast<SQLUSMALLINT>(c + 1), batch);
+        }
+        batch.commit_row();
+    }
+
+    return batch.num_rows() > 0;
+}
+
+void BlockFetcher::read_value(SQLUSMALLINT column_number, ColumnarBatch& batch) {
+    const size_t col = column_number - 1;
+    auto& column = batch.mutable_column(col);
+
+    const size_t initial_bytes = initial_read_bytes(schema_[col], max_column_bytes_);
+    if (!read_char_data(hstmt_, column_number, initial_bytes, column.data)) {
+        batch.append_null(col);
+        return;
+    }
+    column.offsets.push_back(column.data.size());
+    column.nulls.push_back(0);
+}
+
+// ========== TypedFetcher Implementation ==========
+
+namespace {
+/**
+ * @brief Bytes needed to bind one value of a fixed-size native type (0 for String)
+ */
+size_t native_width(ValueType type) {
+    switch (type) {
+    case ValueType::Boolean:
+        return sizeof(unsigned char);
+    case ValueType::Int64:
+        return sizeof(int64_t);
+    case ValueType::Double:
+        return sizeof(double);
+    case ValueType::Date:
+        return sizeof(Date);
+    case ValueType::Timestamp:
+        return sizeof(Timestamp);
+    case ValueType::String:
+        break;
+    }
+    return 0;
+}
+
+/**
+ * @brief Append `rows` bound values to a typed vector in one copy, zeroing NULL slots
+ */
+template <typename T>
+void append_fixed(std::vector<T>& out, const char* buffer, const SQLLEN* indicators, size_t rows,
+                  std::vector<uint8_t>& nulls) {
+    const size_t start = out.size();
+    out.resize(start + rows);
+    std::memcpy(out.data() + start, buffer, rows * sizeof(T));
+
+    for (size_t r = 0; r < rows; r++) {
+        const bool is_null = indicators[r] == SQL_NULL_DATA;
+        if (is_null) {
+            out[start + r] = T{};
+        }
+        nulls.push_back(is_null ? 1 : 0);
+    }
+}
+
+/**
+ * @brief Read one fixed-size native value with SQLGetData
+ */
+template <typename T>
+void read_fixed(SQLHSTMT hstmt, SQLUSMALLINT column_number, SQLSMALLINT c_type, std::vector<T>& out,
+                std::vector<uint8_t>& nulls) {
+    T value{};
+    SQLLEN indicator = 0;
+    SQLRETURN ret = SQLGetData(hstmt, column_number, c_type, &value, sizeof(T), &indicator);
+    if (!SQL_SUCCEEDED(ret)) {
+        throw_odbc_error("Failed to read column " + std::to_string(column_number), SQL_HANDLE_STMT, hstmt);
+    }
+
+    const bool is_null = indicator == SQL_NULL_DATA;
+    out.push_back(is_null ? T{} : value);
+    nulls.push_back(is_null ? 1 : 0);
+}
+} // namespace
+
+TypedFetcher::TypedFetcher(SQLHSTMT hstmt, size_t block_rows, size_t max_column_bytes, bool bound_rereads)
+    : hstmt_(hstmt)
+    , block_rows_(std::max<size_t>(block_rows, 1))
+    , max_column_bytes_(max_column_bytes)
+    , schema_(describe_result(hstmt)) {
+    types_.reserve(schema_.size());
+    for (const auto& column : schema_) {
+        types_.push_back(value_type_for(column.sql_type));
+    }
+
+    exhausted_ = schema_.empty();
+    block_mode_ = !schema_.empty();
+    for (size_t c = 0; c < schema_.size(); c++) {
+        if (types_[c] == ValueType::String && (BlockFetcher::bound_width(schema_[c], max_column_bytes_) == 0 ||
+                                               (!bound_rereads && BlockFetcher::nominal_width(schema_[c])))) {
+            block_mode_ = false;
+        }
+    }
+
+    if (block_mode_) {
+        bind_columns();
+    }
+
+    DATABRICKS_LOG_DEBUG("Fetching {} typed columns in {} mode ({} rows per block)", schema_.size(),
+                         block_mode_ ? "block" : "row", block_rows_);
+}
+
+TypedFetcher::~TypedFetcher() {
+    if (block_mode_) {
+        reset_bindings(hstmt_);
+    }
+}
+
+void TypedFetcher::bind_columns() {
+    block_rows_ = set_row_array_size(hstmt_, block_rows_);
+
+    row_status_.resize(block_rows_);
+    SQLSetStmtAttr(hstmt_, SQL_ATTR_ROW_STATUS_PTR, row_status_.data(), 0);
+    SQLSetStmtAttr(hstmt_, SQL_ATTR_ROWS_FETCHED_PTR, &rows_fetched_, 0);
+
+    bindings_.resize(schema_.size());
+    for (size_t c = 0; c < schema_.size(); c++) {
+        auto& binding = bindings_[c];
+        binding.c_type = c_type_for(types_[c]);
+        size_t width = native_width(types_[c]);
+        if (width == 0) {
+            width = BlockFetcher::bound_width(schema_[c], max_column_bytes_);
+        }
+        binding.width = static_cast<SQLLEN>(width);
+        binding.buffer.resize(block_rows_ * width);
+        binding.indicators.resize(block_rows_);
+
+        SQLRETURN ret = SQLBindCol(hstmt_, static_cast<SQLUSMALLINT>(c + 1), binding.c_type, binding.buffer.data(),
+                                   binding.width, binding.indicators.data());
+        if (!SQL_SUCCEEDED(ret)) {
+            throw_odbc_error("Failed to bind column " + std::to_string(c + 1), SQL_HANDLE_STMT, hstmt_);
+        }
+    }
+}
+
+bool TypedFetcher::fetch_next(TypedBatch& batch) {
+    if (&batch != last_batch_) {
+        batch.reset(schema_, types_);
+        last_batch_ = &batch;
+    } else {
+        batch.clear();
+    }
+
+    if (exhausted_) {
+        return false;
+    }
+
+    const bool fetched = block_mode_ ? fetch_block(batch) : fetch_rows(batch);
+    record_fetched(batch);
+    return fetched;
+}
+
+bool TypedFetcher::fetch_block(TypedBatch& batch) {
+    const size_t fetched = fetch_row_array(hstmt_, row_status_, rows_fetched_);
+    if (fetched < block_rows_) {
+        exhausted_ = true;
+    }
+
+    for (size_t c = 0; c < bindings_.size(); c++) {
+        const auto& binding = bindings_[c];
+        auto& column = batch.mutable_column(c);
+        column.nulls.reserve(fetched);
+
+        switch (column.type) {
+        case ValueType::Boolean:
+            append_fixed(column.bools, binding.buffer.data(), binding.indicators.data(), fetched, column.nulls);
+            break;
+        case ValueType::Int64:
+            append_fixed(column.int64s, binding.buffer.data(), binding.indicators.data(), fetched, column.nulls);
+            break;
+        case ValueType::Double:
+            append_fixed(column.doubles, binding.buffer.data(), binding.indicators.data(), fetched, column.nulls);
+            break;
+        case ValueType::Date:
+            append_fixed(column.dates, binding.buffer.data(), binding.indicators.data(), fetched, column.nulls);
+            break;
+        case ValueType::Timestamp:
+            append_fixed(column.timestamps, binding.buffer.data(), binding.indicators.data(), fetched, column.nulls);
+            break;
+        case ValueType::String:
+            column.text_offsets.reserve(fetched + 1);
+            for (size_t r = 0; r < fetched; r++) {
+                if (!append_bound_text(binding.buffer.data() + r * static_cast<size_t>(binding.width),
+                                       binding.width, binding.indicators[r], column.text, column.text_offsets,
+                                       column.nulls)) {
+                    reread_bound_text(hstmt_, r, static_cast<SQLUSMALLINT>(c + 1), binding.indicators[r],
+                                      column.text, column.text_offsets, column.nulls);
+                }
+            }
+            break;
+        }
+    }
+    batch.commit_rows(fetched);
+
+    return fetched > 0;
+}
+
+bool TypedFetcher::fetch_rows(TypedBatch& batch) {
+    size_t rows = 0;
+    while (rows < block_rows_) {
+        if (!fetch_single_row(hstmt_)) {
+            exhausted_ = true;
+            break;
+        }
+
+        for (size_t c = 0; c < schema_.size(); c++) {
+            read_value(c, batch);
+        }
+        rows++;
+    }
+    batch.commit_rows(rows);
+
+    return rows > 0;
+}
+
+void TypedFetcher::read_value(size_t col, TypedBatch& batch) {
+    const auto column_number = static_cast<SQLUSMALLINT>(col + 1);
+    const SQLSMALLINT c_type = c_type_for(types_[col]);
+    auto& column = batch.mutable_column(col);
+
+    switch (column.type) {
+    case ValueType::Boolean:
+        read_fixed(hstmt_, column_number, c_type, column.bools, column.nulls);
+        break;
+    case ValueType::Int64:
+        read_fixed(hstmt_, column_number, c_type, column.int64s, column.nulls);
+        break;
+    case ValueType::Double:
+        read_fixed(hstmt_, column_number, c_type, column.doubles, column.nulls);
+        break;
+    case ValueType::Date:
+        read_fixed(hstmt_, column_number, c_type, column.dates, column.nulls);
+        break;
+    case ValueType::Timestamp:
+        read_fixed(hstmt_, column_number, c_type, column.timestamps, column.nulls);
+        break;
+    case ValueType::String: {
+        const size_t initial_bytes = initial_read_bytes(schema_[col], max_column_bytes_);
+        const bool has_value = read_char_data(hstmt_, column_number, initial_bytes, column.text);
+        column.text_offsets.push_back(column.text.size());
+        column.nulls.push_back(has_value ? 0 : 1);
+        break;
+    }
+    }
+}
+
+} // namespace internal
+} // namespace databricks
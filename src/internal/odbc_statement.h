@@ -0,0 +1,337 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "databricks/core/errors.h"
+#include "databricks/core/result_set.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <sql.h>
+#include <sqlext.h>
+
+namespace databricks {
+namespace internal {
+class CancelScope;
+
+/**
+ * @brief Collect all diagnostic records for an ODBC handle
+ *
+ * @param handle_type ODBC handle type (SQL_HANDLE_DBC, SQL_HANDLE_STMT, ...)
+ * @param handle The handle to read diagnostics from
+ * @return Diagnostics formatted as "[SQLSTATE] message; " for each record
+ */
+std::string get_odbc_error(SQLSMALLINT handle_type, SQLHANDLE handle);
+
+/**
+ * @brief Collect all diagnostic records for an ODBC handle as structured fields
+ */
+std::vector<DiagnosticRecord> get_odbc_diagnostics(SQLSMALLINT handle_type, SQLHANDLE handle);
+
+/**
+ * @brief Format diagnostic records as "[SQLSTATE] message; " for each record
+ */
+std::string format_diagnostics(const std::vector<DiagnosticRecord>& diagnostics);
+
+/**
+ * @brief Throw the SqlError subclass matching the diagnostics' category
+ *
+ * ConnectionError, TimeoutError, AuthenticationError or QueryError where one
+ * applies, SqlError otherwise.
+ */
+[[noreturn]] void throw_sql_error(const std::string& message, std::vector<DiagnosticRecord> diagnostics);
+
+/**
+ * @brief Read a handle's diagnostics and throw them as "<context>: [SQLSTATE] message; ..."
+ * @throws SqlError (or a subclass, see throw_sql_error()) always
+ */
+[[noreturn]] void throw_odbc_error(const std::string& context, SQLSMALLINT handle_type, SQLHANDLE handle);
+
+/**
+ * @brief Describe every column of an executed statement's result set
+ * @throws std::runtime_error if the driver cannot describe the result
+ */
+std::vector<ColumnMetadata> describe_result(SQLHSTMT hstmt);
+
+/**
+ * @brief Whether a connection's driver can read a bound value of a block cursor again with SQLGetData
+ *
+ * Needs SQL_GD_BLOCK and SQL_GD_BOUND (SQL_GETDATA_EXTENSIONS) and
+ * SQL_POSITION on forward-only cursors (SQL_CA1_POS_POSITION). Fetchers told
+ * it can't fall back to SQLGetData row by row for results with string
+ * columns, whose declared sizes are only nominal.
+ */
+bool supports_bound_rereads(SQLHDBC hdbc);
+
+/**
+ * @brief Read one character value with SQLGetData directly into the end of a buffer
+ *
+ * The value is written in place (no intermediate copy). If the driver reports
+ * truncation (SQL_SUCCESS_WITH_INFO / 01004), the buffer grows by the remaining
+ * length from the indicator and the rest is read in the next call. The value's
+ * length always comes from the indicator, never from strlen, so embedded NULs
+ * survive.
+ *
+ * @tparam Buffer std::string or std::vector<char>
+ * @param initial_bytes Space to try for the first call (e.g., from SQLDescribeCol)
+ * @param out Bytes are appended here
+ * @return false if the value is NULL (nothing appended)
+ * @throws std::runtime_error on driver errors
+ */
+template <typename Buffer>
+bool read_char_data(SQLHSTMT hstmt, SQLUSMALLINT column_number, size_t initial_bytes, Buffer& out);
+
+/**
+ * @brief Fetch a whole result set as strings (NULL as empty string)
+ *
+ * Uses bound row-array fetching when every column has a bounded width, and
+ * per-column SQLGetData with buffers sized from SQLDescribeCol otherwise.
+ * Either way values are never truncated: one longer than its declared size
+ * is read again in full (see BlockFetcher).
+ *
+ * With a scope, stops with its CancelledError between blocks (or rows) once
+ * it fires, for drivers whose SQLFetch does not heed SQLCancel.
+ *
+ * @param bound_rereads supports_bound_rereads() of the statement's connection
+ */
+std::vector<std::vector<std::string>> fetch_all_strings(SQLHSTMT hstmt, size_t block_rows, size_t max_column_bytes,
+                                                        bool bound_rereads, const CancelScope* scope = nullptr);
+
+class StatementCache;
+
+/**
+ * @brief RAII owner of an ODBC statement handle
+ *
+ * Frees the statement with SQLFreeHandle on destruction, or, once
+ * recycle_into() has been called, closes it and hands it back to a
+ * StatementCache for reuse. Move-only.
+ */
+class StatementHandle {
+public:
+    StatementHandle() = default;
+    explicit StatementHandle(SQLHSTMT hstmt)
+        : hstmt_(hstmt) {}
+    ~StatementHandle() { reset(); }
+
+    StatementHandle(const StatementHandle&) = delete;
+    StatementHandle& operator=(const StatementHandle&) = delete;
+
+    StatementHandle(StatementHandle&& other) noexcept
+        : cache_(other.cache_)
+        , cache_key_(std::move(other.cache_key_)) {
+        hstmt_ = other.release();
+    }
+    StatementHandle& operator=(StatementHandle&& other) noexcept {
+        if (this != &other) {
+            reset();
+            cache_ = other.cache_;
+            cache_key_ = std::move(other.cache_key_);
+            hstmt_ = other.release();
+        }
+        return *this;
+    }
+
+    SQLHSTMT get() const { return hstmt_; }
+    explicit operator bool() const { return hstmt_ != SQL_NULL_HSTMT; }
+
+    /**
+     * @brief Give up ownership without freeing or recycling the handle
+     */
+    SQLHSTMT release() {
+        SQLHSTMT h = hstmt_;
+        hstmt_ = SQL_NULL_HSTMT;
+        cache_ = nullptr;
+        cache_key_.clear();
+        return h;
+    }
+
+    /**
+     * @brief Return the handle to cache under sql when this owner is done with it
+     *
+     * The cache must outlive this handle.
+     */
+    void recycle_into(StatementCache* cache, std::string sql) {
+        cache_ = cache;
+        cache_key_ = std::move(sql);
+    }
+
+    /**
+     * @brief Free (or recycle) the current handle and take ownership of another
+     */
+    void reset(SQLHSTMT hstmt = SQL_NULL_HSTMT);
+
+private:
+    SQLHSTMT hstmt_ = SQL_NULL_HSTMT;
+    StatementCache* cache_ = nullptr; // Where to return the handle (nullptr = free it)
+    std::string cache_key_;
+};
+
+/**
+ * @brief Reads an executed statement's result set into ColumnarBatch blocks
+ *
+ * When every column has a bounded width (from SQLDescribeCol), the fetcher binds
+ * one buffer per column with SQLBindCol, sets SQL_ATTR_ROW_ARRAY_SIZE and pulls
+ * block_rows rows per SQLFetch call. Result sets containing unbounded columns
+ * (declared size unknown or above max_column_bytes) fall back to row-at-a-time
+ * SQLGetData, still delivered in blocks of block_rows.
+ *
+ * A declared string size is only nominal, so a bound value may come back
+ * longer than its buffer. Such a value is read again, whole, with SQLSetPos
+ * and SQLGetData. On a driver that can't do that (see supports_bound_rereads())
+ * results with character or binary columns are fetched row by row instead.
+ *
+ * The fetcher does not own the statement. Bindings and row-array attributes are
+ * reset on destruction so the statement can be reused.
+ */
+class BlockFetcher {
+public:
+    /**
+     * @param hstmt Executed statement with a pending result set
+     * @param block_rows Maximum rows per block (at least 1)
+     * @param max_column_bytes Largest per-value buffer to bind; wider columns use SQLGetData
+     * @param bound_rereads supports_bound_rereads() of the statement's connection
+     * @throws std::runtime_error if the result set cannot be described or bound
+     */
+    BlockFetcher(SQLHSTMT hstmt, size_t block_rows, size_t max_column_bytes, bool bound_rereads);
+    ~BlockFetcher();
+
+    // The driver holds pointers into this object's buffers
+    BlockFetcher(const BlockFetcher&) = delete;
+    BlockFetcher& operator=(const BlockFetcher&) = delete;
+    BlockFetcher(BlockFetcher&&) = delete;
+    BlockFetcher& operator=(BlockFetcher&&) = delete;
+
+    /**
+     * @brief Column descriptions for the result set
+     */
+    const std::vector<ColumnMetadata>& schema() const { return schema_; }
+
+    /**
+     * @brief Whether the fetcher is using bound row-array fetching
+     */
+    bool block_mode() const { return block_mode_; }
+
+    /**
+     * @brief Fill batch with the next block of rows
+     *
+     * The batch is reset to this result's schema the first time it is passed in and cleared
+     * (capacity kept) before every block.
+     *
+     * @return true if at least one row was fetched, false once the result set is exhausted
+     * @throws std::runtime_error on fetch errors
+     */
+    bool fetch_next(ColumnarBatch& batch);
+
+    /**
+     * @brief Byte width a column needs when bound as SQL_C_CHAR, including the terminator
+     * @return 0 if the column has no usable bound (unknown size or wider than max_column_bytes)
+     */
+    static size_t bound_width(const ColumnMetadata& column, size_t max_column_bytes);
+
+    /**
+     * @brief Whether a column's bound_width() is only its declared size, which values may exceed
+     */
+    static bool nominal_width(const ColumnMetadata& column);
+
+private:
+    struct Binding {
+        SQLLEN width = 0;               // Bytes per row, including the null terminator
+        std::vector<char> buffer;       // block_rows * width bytes
+        std::vector<SQLLEN> indicators; // One length/indicator per row
+    };
+
+    void bind_columns();
+    bool fetch_block(ColumnarBatch& batch);
+    bool fetch_rows(ColumnarBatch& batch);
+    void read_value(SQLUSMALLINT column_number, ColumnarBatch& batch);
+
+    SQLHSTMT hstmt_;
+    size_t block_rows_;
+    size_t max_column_bytes_;
+    std::vector<ColumnMetadata> schema_;
+    std::vector<Binding> bindings_;
+    std::vector<SQLUSMALLINT> row_status_;
+    SQLULEN rows_fetched_ = 0;
+    bool block_mode_ = false;
+    bool exhausted_ = false;
+    const ColumnarBatch* last_batch_ = nullptr;
+};
+
+/**
+ * @brief Reads an executed statement's result set into TypedBatch blocks
+ *
+ * Same strategy as BlockFetcher, but each column is bound to the native C type
+ * for its SQL type (see value_type_for), so the driver never formats numbers,
+ * booleans, dates or timestamps as text. Strings longer than their binding
+ * are read again the same way.
+ */
+class TypedFetcher {
+public:
+    /**
+     * @param hstmt Executed statement with a pending result set
+     * @param block_rows Maximum rows per block (at least 1)
+     * @param max_column_bytes Largest string buffer to bind; wider columns use SQLGetData
+     * @param bound_rereads supports_bound_rereads() of the statement's connection
+     * @throws std::runtime_error if the result set cannot be described or bound
+     */
+    TypedFetcher(SQLHSTMT hstmt, size_t block_rows, size_t max_column_bytes, bool bound_rereads);
+    ~TypedFetcher();
+
+    // The driver holds pointers into this object's buffers
+    TypedFetcher(const TypedFetcher&) = delete;
+    TypedFetcher& operator=(const TypedFetcher&) = delete;
+    TypedFetcher(TypedFetcher&&) = delete;
+    TypedFetcher& operator=(TypedFetcher&&) = delete;
+
+    /**
+     * @brief Column descriptions for the result set
+     */
+    const std::vector<ColumnMetadata>& schema() const { return schema_; }
+
+    /**
+     * @brief Native type of each column
+     */
+    const std::vector<ValueType>& types() const { return types_; }
+
+    /**
+     * @brief Whether the fetcher is using bound row-array fetching
+     */
+    bool block_mode() const { return block_mode_; }
+
+    /**
+     * @brief Fill batch with the next block of rows
+     * @return true if at least one row was fetched, false once the result set is exhausted
+     * @throws std::runtime_error on fetch errors
+     */
+    bool fetch_next(TypedBatch& batch);
+
+private:
+    struct Binding {
+        SQLSMALLINT c_type = SQL_C_CHAR;
+        SQLLEN width = 0;               // Bytes per row
+        std::vector<char> buffer;       // block_rows * width bytes
+        std::vector<SQLLEN> indicators; // One length/indicator per row
+    };
+
+    void bind_columns();
+    bool fetch_block(TypedBatch& batch);
+    bool fetch_rows(TypedBatch& batch);
+    void read_value(size_t col, TypedBatch& batch);
+
+    SQLHSTMT hstmt_;
+    size_t block_rows_;
+    size_t max_column_bytes_;
+    std::vector<ColumnMetadata> schema_;
+    std::vector<ValueType> types_;
+    std::vector<Binding> bindings_;
+    std::vector<SQLUSMALLINT> row_status_;
+    SQLULEN rows_fetched_ = 0;
+    bool block_mode_ = false;
+    bool exhausted_ = false;
+    const TypedBatch* last_batch_ = nullptr;
+};
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,242 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "odbc_types.h"
+
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+namespace databricks {
+namespace internal {
+// The public Date/Timestamp structs are bound directly as ODBC structs
+static_assert(sizeof(Date) == sizeof(SQL_DATE_STRUCT), "Date must match SQL_DATE_STRUCT");
+static_assert(sizeof(Timestamp) == sizeof(SQL_TIMESTAMP_STRUCT), "Timestamp must match SQL_TIMESTAMP_STRUCT");
+static_assert(offsetof(Timestamp, fraction) == offsetof(SQL_TIMESTAMP_STRUCT, fraction),
+              "Timestamp must match SQL_TIMESTAMP_STRUCT");
+
+// ========== Type mapping ==========
+
+ValueType value_type_for(SQLSMALLINT sql_type) {
+    switch (sql_type) {
+    case SQL_BIT:
+        return ValueType::Boolean;
+    case SQL_TINYINT:
+    case SQL_SMALLINT:
+    case SQL_INTEGER:
+    case SQL_BIGINT:
+        return ValueType::Int64;
+    case SQL_REAL:
+    case SQL_FLOAT:
+    case SQL_DOUBLE:
+        return ValueType::Double;
+    case SQL_TYPE_DATE:
+        return ValueType::Date;
+    case SQL_TYPE_TIMESTAMP:
+        return ValueType::Timestamp;
+    default:
+        // DECIMAL stays textual so no precision is lost
+        return ValueType::String;
+    }
+}
+
+SQLSMALLINT c_type_for(ValueType type) {
+    switch (type) {
+    case ValueType::Boolean:
+        return SQL_C_BIT;
+    case ValueType::Int64:
+        return SQL_C_SBIGINT;
+    case ValueType::Double:
+        return SQL_C_DOUBLE;
+    case ValueType::Date:
+        return SQL_C_TYPE_DATE;
+    case ValueType::Timestamp:
+        return SQL_C_TYPE_TIMESTAMP;
+    case ValueType::String:
+        break;
+    }
+    return SQL_C_CHAR;
+}
+
+// ========== Date/time text ==========
+
+std::string format_date(const Date& date) {
+    char buf[24];
+    std::snprintf(buf, sizeof(buf), "%04d-%02u-%02u", date.year, date.month, date.day);
+    return buf;
+}
+
+std::string format_timestamp(const Timestamp& ts) {
+    char buf[40];
+    int n = std::snprintf(buf, sizeof(buf), "%04d-%02u-%02u %02u:%02u:%02u", ts.year, ts.month, ts.day, ts.hour,
+                          ts.minute, ts.second);
+    std::string out(buf, static_cast<size_t>(n));
+
+    if (ts.fraction > 0) {
+        std::snprintf(buf, sizeof(buf), ".%09u", ts.fraction);
+        std::string fraction(buf);
+        fraction.erase(fraction.find_last_not_of('0') + 1);
+        out += fraction;
+    }
+    return out;
+}
+
+namespace {
+// Parse exactly `digits` decimal digits at text[pos]
+template <typename T> bool parse_fixed(std::string_view text, size_t pos, size_t digits, T& out) {
+    if (pos + digits > text.size()) {
+        return false;
+    }
+    for (size_t i = pos; i < pos + digits; i++) {
+        if (text[i] < '0' || text[i] > '9') {
+            return false;
+        }
+    }
+    auto result = std::from_chars(text.data() + pos, text.data() + pos + digits, out);
+    return result.ec == std::errc();
+}
+
+bool parse_date_prefix(std::string_view text, Date& out) {
+    if (text.size() < 10 || text[4] != '-' || text[7] != '-') {
+        return false;
+    }
+    return parse_fixed(text, 0, 4, out.year) && parse_fixed(text, 5, 2, out.month) &&
+           parse_fixed(text, 8, 2, out.day) && out.month >= 1 && out.month <= 12 && out.day >= 1 && out.day <= 31;
+}
+} // namespace
+
+bool parse_date(std::string_view text, Date& out) {
+    return text.size() == 10 && parse_date_prefix(text, out);
+}
+
+bool parse_timestamp(std::string_view text, Timestamp& out) {
+    Date date;
+    if (text.size() < 19 || !parse_date_prefix(text, date) || (text[10] != ' ' && text[10] != 'T') ||
+        text[13] != ':' || text[16] != ':') {
+        return false;
+    }
+
+    Timestamp ts;
+    ts.year = date.year;
+    ts.month = date.month;
+    ts.day = date.day;
+    if (!parse_fixed(text, 11, 2, ts.hour) || !parse_fixed(text, 14, 2, ts.minute) ||
+        !parse_fixed(text, 17, 2, ts.second) || ts.hour > 23 || ts.minute > 59 || ts.second > 59) {
+        return false;
+    }
+
+    if (text.size() > 19) {
+        const size_t digits = text.size() - 20;
+        if (text[19] != '.' || digits == 0 || digits > 9 || !parse_fixed(text, 20, digits, ts.fraction)) {
+            return false;
+        }
+        for (size_t i = digits; i < 9; i++) {
+            ts.fraction *= 10;
+        }
+    }
+
+    out = ts;
+    return true;
+}
+
+// ========== Parameter encoding ==========
+
+namespace {
+template <typename T> void store(EncodedParameter& param, const T& value) {
+    param.buffer.resize(sizeof(T));
+    std::memcpy(param.buffer.data(), &value, sizeof(T));
+    param.length = sizeof(T);
+}
+
+[[noreturn]] void invalid_value(const std::string& value, const char* type) {
+    throw std::runtime_error("Invalid " + std::string(type) + " parameter value: '" + value + "'");
+}
+} // namespace
+
+void encode_parameter(const std::string& value, SQLSMALLINT c_type, EncodedParameter& param) {
+    param.column_size = 0;
+    param.decimal_digits = 0;
+
+    switch (c_type) {
+    case SQL_C_SBIGINT:
+    case SQL_C_SLONG:
+    case SQL_C_LONG: {
+        int64_t parsed = 0;
+        auto result = std::from_chars(value.data(), value.data() + value.size(), parsed);
+        if (value.empty() || result.ec != std::errc() || result.ptr != value.data() + value.size()) {
+            invalid_value(value, "integer");
+        }
+        if (c_type == SQL_C_SBIGINT) {
+            store(param, parsed);
+        } else {
+            if (parsed < INT32_MIN || parsed > INT32_MAX) {
+                invalid_value(value, "32-bit integer");
+            }
+            store(param, static_cast<int32_t>(parsed));
+        }
+        return;
+    }
+    case SQL_C_DOUBLE: {
+        char* end = nullptr;
+        errno = 0;
+        double parsed = std::strtod(value.c_str(), &end);
+        if (value.empty() || end != value.c_str() + value.size() || errno == ERANGE) {
+            invalid_value(value, "double");
+        }
+        store(param, parsed);
+        return;
+    }
+    case SQL_C_BIT: {
+        unsigned char parsed;
+        if (value == "1" || value == "true" || value == "TRUE") {
+            parsed = 1;
+        } else if (value == "0" || value == "false" || value == "FALSE") {
+            parsed = 0;
+        } else {
+            invalid_value(value, "boolean");
+        }
+        store(param, parsed);
+        return;
+    }
+    case SQL_C_TYPE_DATE: {
+        Date parsed;
+        if (!parse_date(value, parsed)) {
+            invalid_value(value, "date");
+        }
+        store(param, parsed);
+        param.column_size = 10;
+        return;
+    }
+    case SQL_C_TYPE_TIMESTAMP: {
+        Timestamp parsed;
+        if (!parse_timestamp(value, parsed)) {
+            invalid_value(value, "timestamp");
+        }
+        store(param, parsed);
+        // Databricks timestamps carry microsecond precision
+        param.column_size = 26;
+        param.decimal_digits = 6;
+        return;
+    }
+    default:
+        // Character data: bind the text as-is, keeping a terminator so the pointer is never null
+        param.buffer.assign(value.begin(), value.end());
+        param.buffer.push_back('\0');
+        param.length = static_cast<SQLLEN>(value.size());
+        param.column_size = value.size();
+        return;
+    }
+}
+
+EncodedParameter encode_parameter(const std::string& value, SQLSMALLINT c_type) {
+    EncodedParameter param;
+    encode_parameter(value, c_type, param);
+    return param;
+}
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,75 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "databricks/core/result_set.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <sql.h>
+#include <sqlext.h>
+
+namespace databricks {
+namespace internal {
+/**
+ * @brief Native value type used to fetch a column of the given ODBC SQL type
+ */
+ValueType value_type_for(SQLSMALLINT sql_type);
+
+/**
+ * @brief ODBC C type used to bind values of a ValueType
+ */
+SQLSMALLINT c_type_for(ValueType type);
+
+/**
+ * @brief Format a date as "YYYY-MM-DD"
+ */
+std::string format_date(const Date& date);
+
+/**
+ * @brief Format a timestamp as "YYYY-MM-DD HH:MM:SS[.fraction]" (fraction trimmed of trailing zeros)
+ */
+std::string format_timestamp(const Timestamp& ts);
+
+/**
+ * @brief Parse "YYYY-MM-DD"
+ * @return false if the text is not a valid date
+ */
+bool parse_date(std::string_view text, Date& out);
+
+/**
+ * @brief Parse "YYYY-MM-DD[ |T]HH:MM:SS[.fraction]" (fraction of up to 9 digits)
+ * @return false if the text is not a valid timestamp
+ */
+bool parse_timestamp(std::string_view text, Timestamp& out);
+
+/**
+ * @brief A parameter value ready to pass to SQLBindParameter
+ */
+struct EncodedParameter {
+    std::vector<char> buffer;       // Value bytes (native struct/integer or text)
+    SQLLEN length = 0;              // Length/indicator value
+    SQLULEN column_size = 0;        // ColumnSize argument
+    SQLSMALLINT decimal_digits = 0; // DecimalDigits argument
+};
+
+/**
+ * @brief Convert a parameter's text value into the representation for its C type
+ *
+ * Native C types (SQL_C_SBIGINT, SQL_C_SLONG, SQL_C_DOUBLE, SQL_C_BIT,
+ * SQL_C_TYPE_DATE, SQL_C_TYPE_TIMESTAMP) are parsed from text into their binary
+ * form. Any other C type is bound as the raw text bytes.
+ *
+ * @throws std::runtime_error if the text is not a valid value for c_type
+ */
+EncodedParameter encode_parameter(const std::string& value, SQLSMALLINT c_type);
+
+/**
+ * @brief Encode into an existing EncodedParameter, reusing its buffer
+ */
+void encode_parameter(const std::string& value, SQLSMALLINT c_type, EncodedParameter& out);
+
+} // namespace internal
+} // namespace databricks
@@ -2,65 +2,210 @@
 // SPDX-License-Identifier: MIT
 #include "pool_manager.h"
 
+#include "logger.h"
+
 #include <functional>
+#include <iterator>
+#include <mutex>
 
 namespace databricks {
 namespace internal {
+namespace {
+void hash_combine(size_t& seed, size_t value) {
+    seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+}
+
+bool same_pool(const PoolingConfig& a, const PoolingConfig& b) {
+    return a.min_connections == b.min_connections && a.max_connections == b.max_connections &&
+           a.connection_timeout_ms == b.connection_timeout_ms && a.idle_timeout_ms == b.idle_timeout_ms &&
+           a.max_lifetime_ms == b.max_lifetime_ms && a.validate_on_borrow == b.validate_on_borrow &&
+           a.validation_idle_ms == b.validation_idle_ms && a.maintenance_interval_ms == b.maintenance_interval_ms &&
+           a.shards == b.shards && a.reuse_policy == b.reuse_policy;
+}
+
+bool same_retry(const RetryConfig& a, const RetryConfig& b) {
+    return a.enabled == b.enabled && a.max_attempts == b.max_attempts && a.initial_backoff_ms == b.initial_backoff_ms &&
+           a.backoff_multiplier == b.backoff_multiplier && a.max_backoff_ms == b.max_backoff_ms &&
+           a.retry_on_timeout == b.retry_on_timeout && a.retry_on_connection_lost == b.retry_on_connection_lost &&
+           a.circuit_failure_threshold == b.circuit_failure_threshold && a.circuit_open_ms == b.circuit_open_ms &&
+           a.retry_budget_ratio == b.retry_budget_ratio &&
+           a.retry_budget_min_per_second == b.retry_budget_min_per_second;
+}
+} // namespace
+
 // ========== PoolKey Implementation ==========
 
-size_t PoolKey::hash() const {
-    std::hash<std::string> hasher;
+PoolKeyView PoolKeyView::of(const AuthConfig& auth, const SQLConfig& sql, const PoolingConfig& pooling,
+                            const RetryConfig& retry) {
+    const SecureString& token = auth.get_secure_token();
+    return PoolKeyView{auth.host, std::string_view(token.data(), token.size()), sql.http_path, auth.timeout_seconds,
+                       sql.odbc_driver_name, &pooling, &retry};
+}
+
+size_t PoolKeyView::hash() const {
+    std::hash<std::string_view> hasher;
     size_t h = hasher(host);
-    // SecureString can be hashed as std::string since it uses the same char_traits
-    h ^= std::hash<SecureString>()(token) << 1;
-    h ^= hasher(http_path) << 2;
-    h ^= std::hash<int>()(timeout_seconds) << 3;
-    h ^= hasher(odbc_driver_name) << 4;
+    hash_combine(h, hasher(token));
+    hash_combine(h, hasher(http_path));
+    hash_combine(h, std::hash<int>()(timeout_seconds));
+    hash_combine(h, hasher(odbc_driver_name));
     return h;
 }
 
+bool PoolKeyView::matches(const PoolKey& key) const {
+    return host == key.host && token == std::string_view(key.token.data(), key.token.size()) &&
+           http_path == key.http_path && timeout_seconds == key.timeout_seconds &&
+           odbc_driver_name == key.odbc_driver_name && same_pool(*pooling, key.pooling) &&
+           same_retry(*retry, key.retry);
+}
+
+PoolKeyView PoolKey::view() const {
+    return PoolKeyView{host, std::string_view(token.data(), token.size()), http_path, timeout_seconds,
+                       odbc_driver_name, &pooling, &retry};
+}
+
+size_t PoolKey::hash() const {
+    return view().hash();
+}
+
 bool PoolKey::operator==(const PoolKey& other) const {
     return host == other.host && token == other.token && http_path == other.http_path &&
-           timeout_seconds == other.timeout_seconds && odbc_driver_name == other.odbc_driver_name;
+           timeout_seconds == other.timeout_seconds && odbc_driver_name == other.odbc_driver_name &&
+           same_pool(pooling, other.pooling) && same_retry(retry, other.retry);
 }
 
 // ========== PoolManager Implementation ==========
 
 PoolManager& PoolManager::instance() {
+    // Pools log while shutting down at exit, so the logger must be destroyed after them
+    logger();
     static PoolManager instance;
     return instance;
 }
 
+PoolManager::Entry* PoolManager::find(size_t key_hash, const PoolKeyView& key) const {
+    auto bucket = pools_.find(key_hash);
+    if (bucket == pools_.end()) {
+        return nullptr;
+    }
+    for (const auto& entry : bucket->second) {
+        if (key.matches(entry->key)) {
+            return entry.get();
+        }
+    }
+    return nullptr;
+}
+
 std::shared_ptr<ConnectionPool> PoolManager::get_pool(const AuthConfig& auth, const SQLConfig& sql,
-                                                      const PoolingConfig& pooling) {
-    std::lock_guard<std::mutex> lock(mutex_);
+                                                      const PoolingConfig& pooling, const RetryConfig& retry) {
+    PoolKeyView key = PoolKeyView::of(auth, sql, pooling, retry);
+    size_t key_hash = key.hash();
+    Clock::rep now = Clock::now().time_since_epoch().count();
 
-    // Create pool key from configuration using secure token
-    SecureString secure_token;
-    secure_token = auth.get_secure_token();
+    // Fast path: the pool already exists
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        if (Entry* entry = find(key_hash, key)) {
+            entry->last_used.store(now, std::memory_order_relaxed);
+            return entry->pool;
+        }
+    }
 
-    PoolKey key{auth.host, secure_token, sql.http_path, auth.timeout_seconds, sql.odbc_driver_name};
+    std::vector<std::shared_ptr<ConnectionPool>> reclaimed;
+    std::shared_ptr<ConnectionPool> pool;
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        // Another thread may have created it while the lock was released
+        if (Entry* entry = find(key_hash, key)) {
+            entry->last_used.store(now, std::memory_order_relaxed);
+            return entry->pool;
+        }
 
-    size_t key_hash = key.hash();
+        // Pools are created when a new token shows up, which is also when an old one goes stale
+        reclaimed = take_idle(now);
 
-    // Check if pool already exists
-    auto it = pools_.find(key_hash);
-    if (it != pools_.end()) {
-        return it->second;
-    }
+        // Create new pool; the key carries its PoolingConfig and RetryConfig, so it never serves other settings
+        pool = std::make_shared<ConnectionPool>(auth, sql, pooling, retry);
 
-    // Create new pool - pass modular configs instead of legacy Config
-    // The ConnectionPool will need to be updated to accept modular configs
-    auto pool = std::make_shared<ConnectionPool>(auth, sql, pooling.min_connections, pooling.max_connections);
+        auto entry = std::make_unique<Entry>();
+        entry->key = PoolKey{auth.host, auth.get_secure_token(), sql.http_path, auth.timeout_seconds,
+                             sql.odbc_driver_name, pooling, retry};
+        entry->pool = pool;
+        entry->reclaim_after = std::chrono::milliseconds(pooling.idle_timeout_ms);
+        entry->last_used.store(now, std::memory_order_relaxed);
+        pools_[key_hash].push_back(std::move(entry));
+    }
 
-    pools_[key_hash] = pool;
+    // Closing connections may be server round trips, so shut down reclaimed pools outside the lock
+    for (auto& idle : reclaimed) {
+        idle->shutdown();
+    }
     return pool;
 }
 
+std::vector<std::shared_ptr<ConnectionPool>> PoolManager::take_idle(Clock::rep now) {
+    std::vector<std::shared_ptr<ConnectionPool>> reclaimed;
+    for (auto bucket = pools_.begin(); bucket != pools_.end();) {
+        auto& entries = bucket->second;
+        for (auto it = entries.begin(); it != entries.end();) {
+            const Entry& entry = **it;
+            // With only the registry holding it, no one else can take a new reference meanwhile. A connection
+            // still checked out (say by a Cursor that outlived its Client) points back at the pool, so wait for it
+            bool unused = entry.pool.use_count() == 1 && entry.pool->get_stats().active_connections == 0 &&
+                          entry.reclaim_after.count() > 0 &&
+                          now - entry.last_used.load(std::memory_order_relaxed) >= entry.reclaim_after.count();
+            if (unused) {
+                reclaimed.push_back(std::move((*it)->pool));
+                it = entries.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        bucket = entries.empty() ? pools_.erase(bucket) : std::next(bucket);
+    }
+    if (!reclaimed.empty()) {
+        DATABRICKS_LOG_INFO("Reclaiming {} idle connection pool(s)", reclaimed.size());
+    }
+    return reclaimed;
+}
+
+std::shared_ptr<CircuitBreaker> PoolManager::circuit_breaker(const AuthConfig& auth, const SQLConfig& sql,
+                                                             const RetryConfig& retry) {
+    std::string key = auth.host + '\n' + sql.http_path;
+    {
+        std::shared_lock<std::shared_mutex> lock(breakers_mutex_);
+        auto it = breakers_.find(key);
+        if (it != breakers_.end()) {
+            return it->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(breakers_mutex_);
+    auto& breaker = breakers_[key];
+    if (!breaker) {
+        breaker = std::make_shared<CircuitBreaker>(retry);
+    }
+    return breaker;
+}
+
+size_t PoolManager::reclaim_idle() {
+    std::vector<std::shared_ptr<ConnectionPool>> reclaimed;
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        reclaimed = take_idle(Clock::now().time_since_epoch().count());
+    }
+    for (auto& pool : reclaimed) {
+        pool->shutdown();
+    }
+    return reclaimed.size();
+}
+
 void PoolManager::shutdown_all() {
-    std::lock_guard<std::mutex> lock(mutex_);
-    for (auto& pair : pools_) {
-        pair.second->shutdown();
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    for (auto& bucket : pools_) {
+        for (auto& entry : bucket.second) {
+            entry->pool->shutdown();
+        }
     }
     pools_.clear();
 }
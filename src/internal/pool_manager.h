@@ -2,22 +2,61 @@
 // SPDX-License-Identifier: MIT
 #pragma once
 
+#include "circuit_breaker.h"
+
 #include "databricks/connection_pool.h"
 #include "databricks/core/config.h"
 #include "databricks/internal/secure_string.h"
 
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <memory>
-#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 namespace databricks {
 namespace internal {
+struct PoolKey;
+
+/**
+ * @brief Non-owning view of a PoolKey, so lookups don't copy the token
+ */
+struct PoolKeyView {
+    std::string_view host;
+    std::string_view token;
+    std::string_view http_path;
+    int timeout_seconds;
+    std::string_view odbc_driver_name;
+    const PoolingConfig* pooling;
+    const RetryConfig* retry;
+
+    /**
+     * @brief The key the pool for these configs is stored under
+     */
+    static PoolKeyView of(const AuthConfig& auth, const SQLConfig& sql, const PoolingConfig& pooling,
+                          const RetryConfig& retry);
+
+    /**
+     * @brief Hash of the connection fields (not the configs); equals PoolKey::hash() of the same key
+     */
+    size_t hash() const;
+
+    /**
+     * @brief Check every field against a stored key
+     */
+    bool matches(const PoolKey& key) const;
+};
+
 /**
  * @brief Configuration key for pool sharing
  *
  * This struct is used internally to determine if two clients
- * can share the same connection pool.
+ * can share the same connection pool: they must connect the same way and
+ * ask for the same pool (every PoolingConfig field) and retry policy.
  */
 struct PoolKey {
     std::string host;
@@ -25,6 +64,13 @@ struct PoolKey {
     std::string http_path;
     int timeout_seconds;
     std::string odbc_driver_name;
+    PoolingConfig pooling;
+    RetryConfig retry;
+
+    /**
+     * @brief View of this key's fields
+     */
+    PoolKeyView view() const;
 
     /**
      * @brief Generate hash for pool key
@@ -53,16 +99,32 @@ public:
     /**
      * @brief Get or create a pool for the given configuration
      *
-     * Pools are shared across all Clients with equivalent configs.
-     * Thread-safe.
+     * Pools are shared across all Clients with equivalent configs (same host,
+     * token, HTTP path, timeout and driver, and equal PoolingConfig and
+     * RetryConfig), so each pool runs with its own Clients' settings. Thread-safe: looking up an
+     * existing pool takes only a shared lock and copies nothing. Creating a
+     * pool also reclaims idle ones (see reclaim_idle()).
      *
      * @param auth Authentication configuration
      * @param sql SQL configuration
      * @param pooling Pooling configuration
+     * @param retry Retry configuration for the pool's connections
      * @return Shared pointer to ConnectionPool
      */
     std::shared_ptr<ConnectionPool> get_pool(const AuthConfig& auth, const SQLConfig& sql,
-                                             const PoolingConfig& pooling);
+                                             const PoolingConfig& pooling, const RetryConfig& retry = RetryConfig{});
+
+    /**
+     * @brief Get or create the circuit breaker for a warehouse
+     *
+     * Shared by every Client for the same host and HTTP path, pooled or not and
+     * whatever their token, since an outage affects all of them. The first
+     * Client's RetryConfig decides the thresholds. Breakers live until exit.
+     *
+     * @return Shared pointer to the warehouse's CircuitBreaker
+     */
+    std::shared_ptr<CircuitBreaker> circuit_breaker(const AuthConfig& auth, const SQLConfig& sql,
+                                                    const RetryConfig& retry);
 
     /**
      * @brief Shutdown all pools
@@ -71,7 +133,31 @@ public:
      */
     void shutdown_all();
 
+    /**
+     * @brief Shut down and forget pools no Client uses any more
+     *
+     * A pool is reclaimed once no Client holds it, none of its connections is
+     * checked out (a Cursor may outlive its Client) and it has not been looked
+     * up for its PoolingConfig::idle_timeout_ms (0 keeps it until
+     * shutdown_all()), so pools for rotated tokens don't accumulate.
+     *
+     * @return Number of pools reclaimed
+     */
+    size_t reclaim_idle();
+
 private:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief A registered pool
+     */
+    struct Entry {
+        PoolKey key;
+        std::shared_ptr<ConnectionPool> pool;
+        Clock::duration reclaim_after;        // Zero = never reclaim
+        std::atomic<Clock::rep> last_used{0}; // Updated under the shared lock, hence atomic
+    };
+
     PoolManager() = default;
     ~PoolManager() = default;
 
@@ -81,8 +167,24 @@ private:
     PoolManager(PoolManager&&) = delete;
     PoolManager& operator=(PoolManager&&) = delete;
 
-    std::unordered_map<size_t, std::shared_ptr<ConnectionPool>> pools_;
-    std::mutex mutex_;
+    /**
+     * @brief Find the entry for a key (must be called with mutex_ held)
+     */
+    Entry* find(size_t key_hash, const PoolKeyView& key) const;
+
+    /**
+     * @brief Remove reclaimable entries (must be called with mutex_ held exclusively)
+     */
+    std::vector<std::shared_ptr<ConnectionPool>> take_idle(Clock::rep now);
+
+    // Entries by key hash; colliding keys (including the same connection with other configs) share a bucket and
+    // are told apart by the full key
+    std::unordered_map<size_t, std::vector<std::unique_ptr<Entry>>> pools_;
+    mutable std::shared_mutex mutex_;
+
+    // Circuit breakers by "host\nhttp_path"
+    std::unordered_map<std::string, std::shared_ptr<CircuitBreaker>> breakers_;
+    mutable std::shared_mutex breakers_mutex_;
 };
 
 } // namespace internal
@@ -0,0 +1,120 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "profile_file.h"
+
+#include "logger.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+
+namespace databricks {
+namespace internal {
+namespace {
+// Strip leading and trailing spaces and tabs
+std::string trim(const std::string& text) {
+    auto start = text.find_first_not_of(" \t");
+    if (start == std::string::npos) {
+        return "";
+    }
+    auto end = text.find_last_not_of(" \t");
+    return text.substr(start, end - start + 1);
+}
+
+std::shared_ptr<ProfileFile> parse_profile_file(std::ifstream& file) {
+    auto parsed = std::make_shared<ProfileFile>();
+    ProfileFile::Section* section = nullptr;
+    std::string line;
+
+    while (std::getline(file, line)) {
+        line = trim(line);
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        if (line.front() == '[' && line.back() == ']') {
+            section = &parsed->sections[line.substr(1, line.size() - 2)];
+            continue;
+        }
+
+        auto pos = line.find('=');
+        if (!section || pos == std::string::npos) {
+            continue;
+        }
+        std::string value = trim(line.substr(pos + 1));
+        (*section)[trim(line.substr(0, pos))] = to_secure_string(value);
+        secure_zero_string(value);
+    }
+    secure_zero_string(line);
+    return parsed;
+}
+
+// Cache of the last file read per path
+struct CachedFile {
+    std::filesystem::file_time_type mtime;
+    std::filesystem::file_time_type read_at; // When the file was parsed
+    uintmax_t size = 0;
+    std::shared_ptr<const ProfileFile> parsed;
+
+    // A write landing in the same timestamp tick as the read would leave mtime unchanged, so an
+    // entry is only trusted once the file had gone unmodified for a while before it was read
+    bool matches(std::filesystem::file_time_type file_mtime, uintmax_t file_size) const {
+        return mtime == file_mtime && size == file_size && read_at - mtime > std::chrono::seconds(2);
+    }
+};
+} // namespace
+
+std::optional<std::string> ProfileFile::value(const std::string& profile, const std::string& key) const {
+    auto section = sections.find(profile);
+    if (section == sections.end()) {
+        return std::nullopt;
+    }
+    auto entry = section->second.find(key);
+    if (entry == section->second.end()) {
+        return std::nullopt;
+    }
+    return from_secure_string(entry->second);
+}
+
+std::string default_profile_path() {
+    const char* home = std::getenv("HOME");
+    if (!home) {
+        throw std::runtime_error("HOME environment variable not set");
+    }
+    return std::string(home) + "/.databrickscfg";
+}
+
+std::shared_ptr<const ProfileFile> load_profile_file(const std::string& path) {
+    static std::mutex mutex;
+    static std::map<std::string, CachedFile> cache;
+
+    std::error_code error;
+    auto mtime = std::filesystem::last_write_time(path, error);
+    uintmax_t size = error ? 0 : std::filesystem::file_size(path, error);
+    if (error) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto cached = cache.find(path);
+    if (cached != cache.end() && cached->second.matches(mtime, size)) {
+        return cached->second.parsed;
+    }
+
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return nullptr;
+    }
+    DATABRICKS_LOG_DEBUG("Parsing configuration file {}", path);
+    CachedFile entry{mtime, std::filesystem::file_time_type::clock::now(), size, parse_profile_file(file)};
+    cache[path] = entry;
+    return entry.parsed;
+}
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,48 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "databricks/internal/secure_string.h"
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace databricks {
+namespace internal {
+/**
+ * @brief Parsed contents of a Databricks configuration file (~/.databrickscfg)
+ *
+ * Values are kept in SecureStrings because profiles hold tokens.
+ */
+struct ProfileFile {
+    using Section = std::map<std::string, SecureString>;
+
+    std::map<std::string, Section> sections; ///< Profile name to its key/value pairs (a repeated key keeps the last)
+
+    /**
+     * @brief Value of key in a profile, if both exist
+     */
+    std::optional<std::string> value(const std::string& profile, const std::string& key) const;
+};
+
+/**
+ * @brief Path of the default configuration file, $HOME/.databrickscfg
+ * @throws std::runtime_error if HOME is not set
+ */
+std::string default_profile_path();
+
+/**
+ * @brief Parsed configuration file, read at most once per modification
+ *
+ * The parse is cached process-wide by path and invalidated when the file's
+ * modification time or size changes, so building many clients from the same
+ * profile reads the file once.
+ *
+ * @return The parsed file, or null if it cannot be opened
+ */
+std::shared_ptr<const ProfileFile> load_profile_file(const std::string& path);
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,165 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "query_cache.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+
+namespace databricks {
+namespace internal {
+std::string normalize_sql(std::string_view sql) {
+    std::string out;
+    out.reserve(sql.size());
+    bool pending_space = false; // Whitespace or a comment since the last token
+
+    size_t i = 0;
+    while (i < sql.size()) {
+        const char c = sql[i];
+        if (std::isspace(static_cast<unsigned char>(c))) {
+            pending_space = true;
+            ++i;
+            continue;
+        }
+        if (c == '-' && i + 1 < sql.size() && sql[i + 1] == '-') {
+            const size_t end = sql.find('\n', i);
+            i = end == std::string_view::npos ? sql.size() : end;
+            pending_space = true;
+            continue;
+        }
+        if (c == '/' && i + 1 < sql.size() && sql[i + 1] == '*') {
+            const size_t end = sql.find("*/", i + 2);
+            i = end == std::string_view::npos ? sql.size() : end + 2;
+            pending_space = true;
+            continue;
+        }
+
+        if (pending_space && !out.empty()) {
+            out += ' ';
+        }
+        pending_space = false;
+
+        if (c == '\'' || c == '"' || c == '`') {
+            // Copy the quoted run; a backslash escapes the next character, a doubled quote stays inside
+            size_t end = i + 1;
+            while (end < sql.size()) {
+                if (sql[end] == '\\' && end + 1 < sql.size()) {
+                    end += 2;
+                } else if (sql[end] == c) {
+                    if (end + 1 < sql.size() && sql[end + 1] == c) {
+                        end += 2;
+                    } else {
+                        break;
+                    }
+                } else {
+                    ++end;
+                }
+            }
+            end = std::min(end + 1, sql.size());
+            out.append(sql.substr(i, end - i));
+            i = end;
+            continue;
+        }
+        out += c;
+        ++i;
+    }
+
+    while (!out.empty() && (out.back() == ';' || out.back() == ' ')) {
+        out.pop_back();
+    }
+    return out;
+}
+
+bool is_read_only_sql(std::string_view normalized_sql) {
+    static constexpr std::array<std::string_view, 7> READ_KEYWORDS = {"SELECT", "WITH",     "VALUES", "SHOW",
+                                                                      "DESC",   "DESCRIBE", "EXPLAIN"};
+    static constexpr std::array<std::string_view, 4> WRITE_KEYWORDS = {"INSERT", "UPDATE", "DELETE", "MERGE"};
+
+    // Bare words outside quotes, as they appear
+    std::vector<std::string_view> words;
+    for (size_t i = 0; i < normalized_sql.size();) {
+        const char c = normalized_sql[i];
+        if (c == '\'' || c == '"' || c == '`') {
+            size_t end = i + 1;
+            while (end < normalized_sql.size() && normalized_sql[end] != c) {
+                end += normalized_sql[end] == '\\' ? 2 : 1;
+            }
+            i = end + 1;
+        } else if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+            size_t end = i;
+            while (end < normalized_sql.size() &&
+                   (std::isalnum(static_cast<unsigned char>(normalized_sql[end])) || normalized_sql[end] == '_')) {
+                ++end;
+            }
+            words.push_back(normalized_sql.substr(i, end - i));
+            i = end;
+        } else {
+            ++i;
+        }
+    }
+    if (words.empty()) {
+        return false;
+    }
+
+    // The first word, after any leading parentheses as in "(SELECT ...) UNION (SELECT ...)"
+    if (normalized_sql.find_first_not_of("( ") != static_cast<size_t>(words[0].data() - normalized_sql.data())) {
+        return false;
+    }
+    auto matches = [](std::string_view word, std::string_view keyword) {
+        return word.size() == keyword.size() &&
+               std::equal(word.begin(), word.end(), keyword.begin(),
+                          [](char a, char b) { return std::toupper(static_cast<unsigned char>(a)) == b; });
+    };
+    if (std::none_of(READ_KEYWORDS.begin(), READ_KEYWORDS.end(),
+                     [&](std::string_view keyword) { return matches(words[0], keyword); })) {
+        return false;
+    }
+    // A common table expression can front a write
+    if (matches(words[0], "WITH")) {
+        for (std::string_view word : words) {
+            if (std::any_of(WRITE_KEYWORDS.begin(), WRITE_KEYWORDS.end(),
+                            [&](std::string_view keyword) { return matches(word, keyword); })) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+std::string query_cache_key(std::string_view normalized_sql, const std::vector<Client::Parameter>& params) {
+    size_t size = normalized_sql.size() + 1;
+    for (const auto& param : params) {
+        size += param.value.size() + 32;
+    }
+    std::string key;
+    key.reserve(size);
+    key.append(normalized_sql);
+    key += '\0';
+    for (const auto& param : params) {
+        key += std::to_string(param.c_type);
+        key += ',';
+        key += std::to_string(param.sql_type);
+        key += ',';
+        key += std::to_string(param.value.size());
+        key += ':';
+        key += param.value;
+    }
+    return key;
+}
+
+size_t result_bytes(const std::vector<std::vector<std::string>>& rows) {
+    size_t bytes = sizeof(rows) + rows.capacity() * sizeof(std::vector<std::string>);
+    for (const auto& row : rows) {
+        bytes += row.capacity() * sizeof(std::string);
+        for (const auto& cell : row) {
+            // Short strings live inside the std::string itself
+            if (cell.capacity() >= sizeof(std::string)) {
+                bytes += cell.capacity() + 1;
+            }
+        }
+    }
+    return bytes;
+}
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,45 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "databricks/core/client.h"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace databricks {
+namespace internal {
+/**
+ * @brief SQL text with comments removed and whitespace runs collapsed to one space
+ *
+ * Quoted strings and identifiers ('...', "...", `...`) are kept byte for byte,
+ * as is the case of everything else; a trailing semicolon is dropped. Two
+ * statements that differ only in layout normalize to the same text.
+ */
+std::string normalize_sql(std::string_view sql);
+
+/**
+ * @brief True if normalized SQL starts with a keyword that only reads
+ *
+ * SELECT, WITH, VALUES, SHOW, DESCRIBE/DESC and EXPLAIN, in any case. Since a
+ * WITH clause can front a write, a WITH statement only counts if it contains no
+ * INSERT, UPDATE, DELETE or MERGE outside quotes.
+ */
+bool is_read_only_sql(std::string_view normalized_sql);
+
+/**
+ * @brief Result cache key for a query: normalized SQL plus each parameter's types and value
+ *
+ * Values are length-prefixed, so no choice of parameter text can collide with another.
+ */
+std::string query_cache_key(std::string_view normalized_sql, const std::vector<Client::Parameter>& params);
+
+/**
+ * @brief Approximate heap memory held by a query() result
+ */
+size_t result_bytes(const std::vector<std::vector<std::string>>& rows);
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,77 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "rate_limiter.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace databricks {
+namespace internal {
+RateLimiter::RateLimiter(double requests_per_second, size_t burst)
+    : rate_(requests_per_second)
+    , burst_(static_cast<double>(std::max<size_t>(burst, 1)))
+    , tokens_(burst_)
+    , refilled_at_(Clock::now())
+    , paused_until_() {}
+
+RateLimiter::Clock::time_point RateLimiter::reserve() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const Clock::time_point now = std::max(Clock::now(), paused_until_);
+    if (rate_ <= 0.0) {
+        return now;
+    }
+
+    // Refill for the time since the last reservation; tokens_ goes negative when
+    // callers have reserved ahead, and the deficit is their queueing delay
+    if (now > refilled_at_) {
+        std::chrono::duration<double> elapsed = now - refilled_at_;
+        tokens_ = std::min(burst_, tokens_ + elapsed.count() * rate_);
+        refilled_at_ = now;
+    }
+    tokens_ -= 1.0;
+    if (tokens_ >= 0.0) {
+        return now;
+    }
+    return now + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(-tokens_ / rate_));
+}
+
+void RateLimiter::pause_until(Clock::time_point until) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    paused_until_ = std::max(paused_until_, until);
+}
+
+void RateLimiter::tighten(double requests_per_second, size_t burst) {
+    if (requests_per_second <= 0.0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (rate_ <= 0.0 || requests_per_second < rate_) {
+        rate_ = requests_per_second;
+    }
+    burst_ = std::min(burst_, static_cast<double>(std::max<size_t>(burst, 1)));
+    tokens_ = std::min(tokens_, burst_);
+}
+
+double RateLimiter::requests_per_second() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return rate_;
+}
+
+std::shared_ptr<RateLimiter> RateLimiter::for_host(const std::string& host, double requests_per_second,
+                                                   size_t burst) {
+    // Hosts are few and long-lived; buckets are kept for the life of the process
+    static std::mutex registry_mutex;
+    static std::unordered_map<std::string, std::shared_ptr<RateLimiter>> registry;
+
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    auto& limiter = registry[host];
+    if (!limiter) {
+        limiter = std::make_shared<RateLimiter>(requests_per_second, burst);
+    } else {
+        limiter->tighten(requests_per_second, burst);
+    }
+    return limiter;
+}
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,75 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace databricks {
+namespace internal {
+/**
+ * @brief Token bucket shared by every REST client talking to one workspace
+ *
+ * Tokens refill at a steady rate up to a burst size; each request attempt takes
+ * one. reserve() never blocks: it claims the next token and returns when the
+ * caller may use it, so synchronous callers sleep until then and the async
+ * engine schedules the request for that time without tying up its thread.
+ *
+ * A 429/503 with Retry-After pauses the whole bucket, so every thread backs off
+ * together instead of each finding the limit on its own.
+ *
+ * Thread-safe.
+ */
+class RateLimiter {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @param requests_per_second Sustained rate; 0 or less disables limiting (pauses still apply)
+     * @param burst Requests allowed back to back after an idle period (at least 1)
+     */
+    RateLimiter(double requests_per_second, size_t burst);
+
+    RateLimiter(const RateLimiter&) = delete;
+    RateLimiter& operator=(const RateLimiter&) = delete;
+
+    /**
+     * @brief Claim a token
+     * @return The time the request may start (now if a token is available)
+     */
+    Clock::time_point reserve();
+
+    /**
+     * @brief Hold every reservation until at least the given time
+     */
+    void pause_until(Clock::time_point until);
+
+    /**
+     * @brief Lower the rate to the given limits if they are stricter than the current ones
+     */
+    void tighten(double requests_per_second, size_t burst);
+
+    double requests_per_second() const;
+
+    /**
+     * @brief Process-wide limiter for a workspace host
+     *
+     * Clients configured with different limits for one host share a bucket
+     * running at the strictest of them.
+     */
+    static std::shared_ptr<RateLimiter> for_host(const std::string& host, double requests_per_second, size_t burst);
+
+private:
+    mutable std::mutex mutex_;
+    double rate_;  // Tokens per second, <= 0 for unlimited
+    double burst_; // Bucket capacity
+    double tokens_;
+    Clock::time_point refilled_at_;
+    Clock::time_point paused_until_;
+};
+
+} // namespace internal
+} // namespace databricks
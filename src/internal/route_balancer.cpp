@@ -0,0 +1,158 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "route_balancer.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace databricks {
+namespace internal {
+namespace {
+// Keeps a route that fails every call (error rate 1) finite, and far behind the rest
+constexpr double MAX_PENALIZED_RATE = 0.95;
+} // namespace
+
+RouteBalancer::RouteBalancer(size_t routes, const RouterConfig& config)
+    : config_(config)
+    , routes_(routes) {
+    if (routes == 0) {
+        throw std::invalid_argument("RouteBalancer needs at least one route");
+    }
+}
+
+bool RouteBalancer::draining(Route& route, Clock::time_point now) {
+    if (!route.state.draining) {
+        return false;
+    }
+    if (route.health_drained || now < route.drained_until) {
+        return true;
+    }
+    route.state.draining = false;
+    route.state.error_rate = 0.0;
+    route.samples = 0;
+    return false;
+}
+
+RouteBalancer::Clock::time_point RouteBalancer::drain_end(const Route& route) {
+    return route.health_drained ? Clock::time_point::max() : route.drained_until;
+}
+
+std::optional<size_t> RouteBalancer::pick(const std::vector<bool>& exclude) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto now = Clock::now();
+
+    double known_latency = 0.0;
+    size_t known = 0;
+    for (const auto& route : routes_) {
+        if (route.state.latency_ms > 0.0) {
+            known_latency += route.state.latency_ms;
+            ++known;
+        }
+    }
+    const double prior = known > 0 ? known_latency / static_cast<double>(known) : 1.0;
+
+    // Best route that is not draining, else the drained route whose drain ends first
+    std::optional<size_t> best;
+    double best_score = std::numeric_limits<double>::infinity();
+    std::optional<size_t> fallback;
+    const size_t count = routes_.size();
+    for (size_t offset = 0; offset < count; ++offset) {
+        const size_t index = (next_ + offset) % count;
+        if (index < exclude.size() && exclude[index]) {
+            continue;
+        }
+        auto& route = routes_[index];
+        if (draining(route, now)) {
+            if (!fallback || drain_end(route) < drain_end(routes_[*fallback])) {
+                fallback = index;
+            }
+            continue;
+        }
+        const double latency = route.state.latency_ms > 0.0 ? route.state.latency_ms : prior;
+        const double score = static_cast<double>(route.state.outstanding + 1) * latency /
+                             (1.0 - std::min(route.state.error_rate, MAX_PENALIZED_RATE));
+        if (score < best_score) {
+            best_score = score;
+            best = index;
+        }
+    }
+    if (!best) {
+        best = fallback;
+    }
+    if (best) {
+        ++routes_[*best].state.outstanding;
+        ++routes_[*best].state.queries;
+        next_ = (next_ + 1) % count;
+    }
+    return best;
+}
+
+void RouteBalancer::finish(size_t route_index, Clock::duration latency, Outcome outcome) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& route = routes_.at(route_index);
+    if (route.state.outstanding > 0) {
+        --route.state.outstanding;
+    }
+    if (outcome == Outcome::Ignored) {
+        return;
+    }
+
+    const bool failed = outcome == Outcome::Failure;
+    if (failed) {
+        ++route.state.failures;
+    } else {
+        // A failure's latency is only how long it took to fail, which says little about the route
+        const double ms = std::chrono::duration<double, std::milli>(latency).count();
+        auto& average = route.state.latency_ms;
+        average = average > 0.0 ? average + config_.latency_smoothing * (ms - average) : std::max(ms, 0.001);
+    }
+    route.state.error_rate += config_.error_smoothing * ((failed ? 1.0 : 0.0) - route.state.error_rate);
+    ++route.samples;
+
+    if (!route.state.draining && route.samples >= config_.min_samples &&
+        route.state.error_rate > config_.max_error_rate) {
+        route.state.draining = true;
+        route.drained_until = Clock::now() + std::chrono::milliseconds(config_.drain_ms);
+    }
+}
+
+void RouteBalancer::drain(size_t route_index, std::chrono::milliseconds duration) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& route = routes_.at(route_index);
+    const auto until = Clock::now() + duration;
+    if (!route.state.draining || route.drained_until < until) {
+        route.drained_until = until;
+    }
+    route.state.draining = true;
+}
+
+void RouteBalancer::drain_until_restored(size_t route_index) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& route = routes_.at(route_index);
+    route.health_drained = true;
+    route.state.draining = true;
+}
+
+void RouteBalancer::restore(size_t route_index) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& route = routes_.at(route_index);
+    route.health_drained = false;
+    if (route.state.draining) {
+        route.drained_until = Clock::now();
+        draining(route, route.drained_until);
+    }
+}
+
+RouteBalancer::RouteState RouteBalancer::state(size_t route_index) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto route = routes_.at(route_index);
+    if (route.state.draining && !route.health_drained && Clock::now() >= route.drained_until) {
+        route.state.draining = false;
+        route.state.error_rate = 0.0;
+    }
+    return route.state;
+}
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,109 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "databricks/core/config.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace databricks {
+namespace internal {
+/**
+ * @brief Picks a route per query from outstanding calls, latency and error rate
+ *
+ * The routing half of WarehouseRouter, kept apart from the pools so it can be
+ * driven directly. Each route carries an EWMA of its latency and of its error
+ * rate (1 per failure, 0 per success). pick() takes the route with the lowest
+ * (outstanding + 1) x latency / (1 - error rate); a route with no latency yet
+ * is scored with the mean of the others, so it is tried without being
+ * flooded. Ties rotate, spreading the first queries.
+ *
+ * A route is drained (skipped unless every candidate is drained) once its
+ * error rate passes RouterConfig::max_error_rate after min_samples outcomes,
+ * or when drain() is called, until the drain times out; one drained with
+ * drain_until_restored() stays drained until restore(). When the drain ends
+ * its error rate starts over.
+ *
+ * Thread-safe: one lock, held only for the arithmetic.
+ */
+class RouteBalancer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    enum class Outcome {
+        Success, ///< The warehouse answered (including with a query error)
+        Failure, ///< Transient failure: the warehouse timed out, was unreachable, or refused the call
+        Ignored  ///< Says nothing about the warehouse (for example the caller cancelled)
+    };
+
+    struct RouteState {
+        size_t outstanding = 0;
+        uint64_t queries = 0;
+        uint64_t failures = 0;
+        double latency_ms = 0.0; ///< EWMA, 0 until the first sample
+        double error_rate = 0.0; ///< EWMA of failures
+        bool draining = false;
+    };
+
+    RouteBalancer(size_t routes, const RouterConfig& config);
+
+    RouteBalancer(const RouteBalancer&) = delete;
+    RouteBalancer& operator=(const RouteBalancer&) = delete;
+
+    /**
+     * @brief Choose a route and count a call outstanding on it
+     * @param exclude Routes that must not be chosen (empty = none)
+     * @return The route, or std::nullopt if every route is excluded
+     */
+    std::optional<size_t> pick(const std::vector<bool>& exclude = {});
+
+    /**
+     * @brief End a call started by pick() and fold its latency and outcome in
+     */
+    void finish(size_t route, Clock::duration latency, Outcome outcome);
+
+    /**
+     * @brief Keep queries off a route for a while (a later drain() can only extend it)
+     */
+    void drain(size_t route, std::chrono::milliseconds duration);
+
+    /**
+     * @brief Keep queries off a route until restore() is called, for example after a failed health check
+     */
+    void drain_until_restored(size_t route);
+
+    /**
+     * @brief End a drain early, for example once a health check passes
+     */
+    void restore(size_t route);
+
+    RouteState state(size_t route) const;
+
+    size_t size() const { return routes_.size(); }
+
+private:
+    struct Route {
+        RouteState state;
+        uint64_t samples = 0; // Outcomes since the last drain ended
+        Clock::time_point drained_until{};
+        bool health_drained = false; // Drained by drain_until_restored(); drained_until doesn't end it
+    };
+
+    bool draining(Route& route, Clock::time_point now);
+
+    // When a drained route's drain ends (never, for health_drained), which orders drained fallbacks
+    static Clock::time_point drain_end(const Route& route);
+
+    const RouterConfig config_;
+    mutable std::mutex mutex_;
+    std::vector<Route> routes_;
+    size_t next_ = 0; // Where the next tie-break scan starts
+};
+
+} // namespace internal
+} // namespace databricks
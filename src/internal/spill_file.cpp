@@ -0,0 +1,116 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "spill_file.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace databricks {
+namespace internal {
+namespace {
+// Writes smaller than this are gathered before reaching the kernel
+constexpr size_t WRITE_BUFFER_BYTES = 1 << 20;
+
+std::runtime_error io_error(const std::string& what) {
+    return std::runtime_error(what + ": " + std::strerror(errno));
+}
+
+void write_all(int fd, const char* p, size_t left) {
+    while (left > 0) {
+        ssize_t written = ::write(fd, p, left);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw io_error("Failed to write spill file");
+        }
+        p += written;
+        left -= static_cast<size_t>(written);
+    }
+}
+} // namespace
+
+SpillFile::SpillFile(const std::string& directory) {
+    std::string dir = directory;
+    if (dir.empty()) {
+        std::error_code error;
+        dir = std::filesystem::temp_directory_path(error).string();
+        if (error) {
+            dir = "/tmp";
+        }
+    }
+    std::string path = dir + "/databricks-spill-XXXXXX";
+    fd_ = ::mkstemp(&path[0]);
+    if (fd_ < 0) {
+        throw io_error("Failed to create spill file in " + dir);
+    }
+    ::unlink(path.c_str());
+    buffer_.reserve(WRITE_BUFFER_BYTES);
+}
+
+SpillFile::~SpillFile() {
+    if (mapping_) {
+        ::munmap(const_cast<char*>(mapping_), static_cast<size_t>(size_));
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+void SpillFile::flush() {
+    write_all(fd_, buffer_.data(), buffer_.size());
+    buffer_.clear();
+}
+
+uint64_t SpillFile::append(const void* data, size_t size) {
+    if (mapped_) {
+        throw std::runtime_error("Spill file is already mapped");
+    }
+    const uint64_t offset = size_;
+    const char* bytes = static_cast<const char*>(data);
+    if (buffer_.size() + size > WRITE_BUFFER_BYTES) {
+        flush();
+    }
+    if (size >= WRITE_BUFFER_BYTES) {
+        write_all(fd_, bytes, size); // Large pieces skip the buffer
+    } else {
+        buffer_.insert(buffer_.end(), bytes, bytes + size);
+    }
+    size_ += size;
+    return offset;
+}
+
+void SpillFile::align(size_t alignment) {
+    static const char zeros[64] = {};
+    size_t pad = static_cast<size_t>((alignment - size_ % alignment) % alignment);
+    while (pad > 0) {
+        size_t n = std::min(pad, sizeof(zeros));
+        append(zeros, n);
+        pad -= n;
+    }
+}
+
+void SpillFile::map() {
+    if (mapped_) {
+        return;
+    }
+    flush();
+    if (size_ > 0) {
+        void* mapping = ::mmap(nullptr, static_cast<size_t>(size_), PROT_READ, MAP_SHARED, fd_, 0);
+        if (mapping == MAP_FAILED) {
+            // Still unmapped, so a later map() tries again instead of leaving readers a null data()
+            throw io_error("Failed to map spill file");
+        }
+        mapping_ = static_cast<const char*>(mapping);
+    }
+    mapped_ = true;
+}
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,69 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace databricks {
+namespace internal {
+/**
+ * @brief Anonymous temp file that is written once, front to back, then memory-mapped for reading
+ *
+ * The file is unlinked as soon as it is created, so it never outlives the
+ * process (not even after a crash) and no other process can open it. Writes
+ * go through a buffer; map() flushes it and maps the whole file read-only.
+ * Mapped pages are backed by the file, so the kernel can drop them under
+ * memory pressure and read them back on the next access.
+ */
+class SpillFile {
+public:
+    /**
+     * @param directory Where to create the file (empty = the system temp directory)
+     * @throws std::runtime_error if the file cannot be created
+     */
+    explicit SpillFile(const std::string& directory);
+    ~SpillFile();
+
+    SpillFile(const SpillFile&) = delete;
+    SpillFile& operator=(const SpillFile&) = delete;
+
+    /**
+     * @brief Append bytes at the end of the file
+     * @return Offset of the first byte appended
+     * @throws std::runtime_error if the write fails (e.g. the disk is full)
+     */
+    uint64_t append(const void* data, size_t size);
+
+    /**
+     * @brief Pad the file with zeros to a multiple of alignment (a power of two)
+     */
+    void align(size_t alignment);
+
+    /**
+     * @brief Flush and map the file; no more appends afterwards
+     * @throws std::runtime_error if the file cannot be mapped (it stays unmapped, and map() may be retried)
+     */
+    void map();
+
+    /**
+     * @brief Start of the mapping (null before map() or for an empty file)
+     */
+    const char* data() const { return mapping_; }
+
+    uint64_t size() const { return size_; }
+
+private:
+    void flush();
+
+    int fd_ = -1;
+    uint64_t size_ = 0; // Bytes appended, including those still in buffer_
+    std::vector<char> buffer_;
+    const char* mapping_ = nullptr;
+    bool mapped_ = false;
+};
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,111 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "statement_cache.h"
+
+#include "logger.h"
+
+#include <vector>
+
+namespace databricks {
+namespace internal {
+// ========== StatementCache Implementation ==========
+
+StatementCache::StatementCache(size_t capacity, Releaser release)
+    : capacity_(capacity)
+    , release_(std::move(release)) {
+    if (!release_) {
+        release_ = [](SQLHSTMT hstmt) { SQLFreeHandle(SQL_HANDLE_STMT, hstmt); };
+    }
+}
+
+StatementCache::~StatementCache() {
+    clear();
+}
+
+SQLHSTMT StatementCache::take(const std::string& sql) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = index_.find(sql);
+    if (it == index_.end()) {
+        misses_++;
+        return SQL_NULL_HSTMT;
+    }
+
+    SQLHSTMT hstmt = it->second->second;
+    lru_.erase(it->second);
+    index_.erase(it);
+    hits_++;
+    return hstmt;
+}
+
+void StatementCache::put(const std::string& sql, SQLHSTMT hstmt) {
+    if (hstmt == SQL_NULL_HSTMT) {
+        return;
+    }
+    if (capacity_ == 0) {
+        release_(hstmt);
+        return;
+    }
+
+    std::vector<SQLHSTMT> evicted;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        auto it = index_.find(sql);
+        if (it != index_.end()) {
+            // Another query prepared the same SQL concurrently; keep the newest
+            evicted.push_back(it->second->second);
+            lru_.erase(it->second);
+            index_.erase(it);
+        }
+
+        lru_.emplace_front(sql, hstmt);
+        index_[sql] = lru_.begin();
+
+        while (lru_.size() > capacity_) {
+            auto& lru = lru_.back();
+            evicted.push_back(lru.second);
+            index_.erase(lru.first);
+            lru_.pop_back();
+        }
+    }
+
+    // Free outside the lock; releasing a statement may be a driver round trip
+    for (SQLHSTMT h : evicted) {
+        release_(h);
+    }
+    if (!evicted.empty()) {
+        DATABRICKS_LOG_DEBUG("Evicted {} prepared statement(s) from cache", evicted.size());
+    }
+}
+
+void StatementCache::clear() {
+    std::list<Entry> entries;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries.swap(lru_);
+        index_.clear();
+    }
+
+    for (auto& entry : entries) {
+        release_(entry.second);
+    }
+}
+
+size_t StatementCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lru_.size();
+}
+
+size_t StatementCache::hits() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hits_;
+}
+
+size_t StatementCache::misses() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return misses_;
+}
+
+} // namespace internal
+} // namespace databricks
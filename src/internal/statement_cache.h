@@ -0,0 +1,80 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <sql.h>
+
+namespace databricks {
+namespace internal {
+/**
+ * @brief LRU cache of prepared ODBC statements for one connection, keyed by SQL text
+ *
+ * Statements are checked out with take() and handed back with put(), so a
+ * prepared handle is never used by two queries at once; a concurrent query for
+ * the same SQL simply prepares its own handle. Callers close the cursor and reset
+ * parameters before put() (StatementHandle does this). When the cache is full
+ * the least recently used statement is freed.
+ *
+ * All cached statements belong to the connection they were prepared on; call
+ * clear() before disconnecting. Thread-safe.
+ */
+class StatementCache {
+public:
+    using Releaser = std::function<void(SQLHSTMT)>;
+
+    /**
+     * @param capacity Maximum statements kept (0 disables caching)
+     * @param release Called to free evicted statements (default: SQLFreeHandle)
+     */
+    explicit StatementCache(size_t capacity, Releaser release = nullptr);
+    ~StatementCache();
+
+    StatementCache(const StatementCache&) = delete;
+    StatementCache& operator=(const StatementCache&) = delete;
+
+    /**
+     * @brief Check out the prepared statement for sql
+     * @return The statement, or SQL_NULL_HSTMT on a cache miss
+     */
+    SQLHSTMT take(const std::string& sql);
+
+    /**
+     * @brief Return a prepared statement so later queries can reuse it
+     *
+     * Frees the statement instead if caching is disabled, and frees the least
+     * recently used entry if the cache is full.
+     */
+    void put(const std::string& sql, SQLHSTMT hstmt);
+
+    /**
+     * @brief Free every cached statement
+     */
+    void clear();
+
+    size_t size() const;
+    size_t capacity() const { return capacity_; }
+    size_t hits() const;
+    size_t misses() const;
+
+private:
+    using Entry = std::pair<std::string, SQLHSTMT>;
+
+    size_t capacity_;
+    Releaser release_;
+    mutable std::mutex mutex_;
+    std::list<Entry> lru_; // Most recently used at the front
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+    size_t hits_ = 0;
+    size_t misses_ = 0;
+};
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,142 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "status_poller.h"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace databricks {
+namespace internal {
+StatusPoller& StatusPoller::shared() {
+    static StatusPoller poller;
+    return poller;
+}
+
+StatusPoller::StatusPoller()
+    : thread_([this]() { run(); }) {}
+
+StatusPoller::~StatusPoller() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    thread_.join();
+}
+
+void StatusPoller::add(Watch watch) {
+    Entry entry;
+    entry.interval = std::chrono::milliseconds(watch.poll.initial_interval_ms);
+    entry.next_check = Clock::now();
+    entry.watch = std::move(watch);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_) {
+            fail(entry, std::make_exception_ptr(std::runtime_error("Status poller shut down")));
+            return;
+        }
+        entries_.push_back(std::move(entry));
+    }
+    cv_.notify_all();
+}
+
+size_t StatusPoller::watching() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size() + checking_;
+}
+
+void StatusPoller::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopping_) {
+        if (entries_.empty()) {
+            cv_.wait(lock, [this]() { return stopping_ || !entries_.empty(); });
+            continue;
+        }
+
+        const Clock::time_point now = Clock::now();
+        auto first_undue =
+            std::partition(entries_.begin(), entries_.end(), [now](const Entry& e) { return e.next_check <= now; });
+        if (first_undue == entries_.begin()) {
+            auto earliest = std::min_element(entries_.begin(), entries_.end(), [](const Entry& a, const Entry& b) {
+                return a.next_check < b.next_check;
+            });
+            cv_.wait_until(lock, earliest->next_check);
+            continue;
+        }
+
+        // Check every due watch as one batch, outside the lock so add() never waits on the network
+        std::vector<Entry> due(std::make_move_iterator(entries_.begin()), std::make_move_iterator(first_undue));
+        entries_.erase(entries_.begin(), first_undue);
+        checking_ = due.size();
+        lock.unlock();
+        std::vector<Entry> pending = check(std::move(due));
+        lock.lock();
+        checking_ = 0;
+        std::move(pending.begin(), pending.end(), std::back_inserter(entries_));
+    }
+
+    for (Entry& entry : entries_) {
+        fail(entry, std::make_exception_ptr(std::runtime_error("Status poller shut down")));
+    }
+    entries_.clear();
+}
+
+std::vector<StatusPoller::Entry> StatusPoller::check(std::vector<Entry> due) {
+    // Start all requests before reading any response
+    std::vector<std::future<HttpResponse>> responses(due.size());
+    for (size_t i = 0; i < due.size(); i++) {
+        try {
+            responses[i] = due[i].watch.check();
+        } catch (...) {
+            fail(due[i], std::current_exception());
+        }
+    }
+
+    std::vector<Entry> pending;
+    for (size_t i = 0; i < due.size(); i++) {
+        if (!responses[i].valid()) {
+            continue;
+        }
+        Entry& entry = due[i];
+        std::string state;
+        try {
+            if (entry.watch.on_status(responses[i].get(), state)) {
+                continue;
+            }
+        } catch (...) {
+            fail(entry, std::current_exception());
+            continue;
+        }
+
+        const Clock::time_point now = Clock::now();
+        if (now >= entry.watch.deadline) {
+            fail(entry, std::make_exception_ptr(std::runtime_error("Timed out waiting for " + entry.watch.description +
+                                                                   " (last state: " + state + ")")));
+            continue;
+        }
+
+        // Back off while nothing changes; check again soon after a transition
+        const PollConfig& poll = entry.watch.poll;
+        if (state != entry.last_state) {
+            entry.interval = std::chrono::milliseconds(poll.initial_interval_ms);
+        } else {
+            auto grown = static_cast<long long>(static_cast<double>(entry.interval.count()) * poll.backoff_multiplier);
+            entry.interval = std::chrono::milliseconds(std::min<long long>(grown, poll.max_interval_ms));
+        }
+        entry.last_state = std::move(state);
+        // Always make one last check at the deadline before timing out
+        entry.next_check = std::min(now + entry.interval, entry.watch.deadline);
+        pending.push_back(std::move(entry));
+    }
+    return pending;
+}
+
+void StatusPoller::fail(Entry& entry, std::exception_ptr error) {
+    if (entry.watch.on_error) {
+        entry.watch.on_error(error);
+    }
+}
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,100 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "databricks/core/config.h"
+
+#include "http_client_interface.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace databricks {
+namespace internal {
+/**
+ * @brief One background thread polling the status of many long-running operations
+ *
+ * Backs the wait APIs (Jobs::wait_for_run(), Compute::wait_for_state()). Each
+ * watch describes how to request its status and how to read the response.
+ * On every tick the poller starts the status requests of all due watches at
+ * once (with get_async, so they share the client's multiplexed connection)
+ * and then reads the responses. Waiting on hundreds of runs costs one thread
+ * and a round of concurrent requests, not a thread per run.
+ *
+ * Intervals adapt per watch as described by PollConfig.
+ *
+ * Thread-safe.
+ */
+class StatusPoller {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief An operation to wait for
+     */
+    struct Watch {
+        std::string description;                          ///< What is awaited, for the timeout message
+        std::function<std::future<HttpResponse>()> check; ///< Start one status request
+        /// Read a status response: store the observed state and return true once the watch
+        /// has delivered its result. Throwing fails the watch with that exception.
+        std::function<bool(const HttpResponse& response, std::string& state)> on_status;
+        std::function<void(std::exception_ptr)> on_error; ///< Settle with a failure (timeout or shutdown)
+        Clock::time_point deadline;                       ///< Give up after this time
+        PollConfig poll;                                  ///< Interval schedule
+    };
+
+    /**
+     * @brief Poller shared by every service client in the process
+     */
+    static StatusPoller& shared();
+
+    StatusPoller();
+
+    /**
+     * @brief Stop polling; unfinished watches fail with std::runtime_error
+     */
+    ~StatusPoller();
+
+    StatusPoller(const StatusPoller&) = delete;
+    StatusPoller& operator=(const StatusPoller&) = delete;
+
+    /**
+     * @brief Start watching; the first status check runs immediately
+     */
+    void add(Watch watch);
+
+    /**
+     * @brief Number of watches not yet finished
+     */
+    size_t watching() const;
+
+private:
+    struct Entry {
+        Watch watch;
+        Clock::time_point next_check;
+        std::chrono::milliseconds interval;
+        std::string last_state;
+    };
+
+    void run();
+    std::vector<Entry> check(std::vector<Entry> due);
+    static void fail(Entry& entry, std::exception_ptr error);
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<Entry> entries_; // Guarded by mutex_; excludes the batch being checked
+    size_t checking_ = 0;        // Guarded by mutex_
+    bool stopping_ = false;      // Guarded by mutex_
+    std::thread thread_;
+};
+
+} // namespace internal
+} // namespace databricks
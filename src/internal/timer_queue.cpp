@@ -0,0 +1,76 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "timer_queue.h"
+
+namespace databricks {
+namespace internal {
+// ========== TimerQueue Implementation ==========
+
+TimerQueue& TimerQueue::instance() {
+    static TimerQueue queue;
+    return queue;
+}
+
+TimerQueue::~TimerQueue() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    changed_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+uint64_t TimerQueue::schedule(Clock::time_point deadline, Callback callback) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const uint64_t id = next_id_++;
+    timers_.emplace(std::make_pair(deadline, id), std::move(callback));
+    deadlines_.emplace(id, deadline);
+    if (!thread_.joinable()) {
+        thread_ = std::thread([this]() { run(); });
+    }
+    changed_.notify_all();
+    return id;
+}
+
+bool TimerQueue::cancel(uint64_t id) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto it = deadlines_.find(id);
+    if (it != deadlines_.end()) {
+        timers_.erase(std::make_pair(it->second, id));
+        deadlines_.erase(it);
+        return true;
+    }
+    changed_.wait(lock, [&]() { return running_ != id; });
+    return false;
+}
+
+void TimerQueue::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopping_) {
+        if (timers_.empty()) {
+            changed_.wait(lock);
+            continue;
+        }
+        auto next = timers_.begin();
+        if (Clock::now() < next->first.first) {
+            changed_.wait_until(lock, next->first.first);
+            continue;
+        }
+
+        const uint64_t id = next->first.second;
+        Callback callback = std::move(next->second);
+        timers_.erase(next);
+        deadlines_.erase(id);
+        running_ = id;
+        lock.unlock();
+        callback();
+        lock.lock();
+        running_ = 0;
+        changed_.notify_all();
+    }
+}
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,72 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace databricks {
+namespace internal {
+/**
+ * @brief Runs callbacks at deadlines on one background thread
+ *
+ * Used for per-query timeouts, so a timeout costs a map entry instead of a
+ * thread. Callbacks must be short (they delay every later timer). The thread
+ * starts on the first schedule() and is joined when the queue is destroyed.
+ *
+ * Thread-safe.
+ */
+class TimerQueue {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Callback = std::function<void()>;
+
+    /**
+     * @brief Process-wide queue
+     */
+    static TimerQueue& instance();
+
+    TimerQueue() = default;
+    ~TimerQueue();
+
+    TimerQueue(const TimerQueue&) = delete;
+    TimerQueue& operator=(const TimerQueue&) = delete;
+
+    /**
+     * @brief Run callback at deadline
+     * @return Id for cancel() (never 0)
+     */
+    uint64_t schedule(Clock::time_point deadline, Callback callback);
+
+    /**
+     * @brief Drop a timer that hasn't fired
+     *
+     * If the callback is running on the timer thread, waits for it to return,
+     * so once cancel() returns the callback's captures may be destroyed.
+     * Must not be called from a callback.
+     *
+     * @return true if the timer was dropped before firing
+     */
+    bool cancel(uint64_t id);
+
+private:
+    void run();
+
+    std::mutex mutex_;
+    std::condition_variable changed_;
+    std::map<std::pair<Clock::time_point, uint64_t>, Callback> timers_; // Ordered by deadline
+    std::map<uint64_t, Clock::time_point> deadlines_;                   // Id to its key in timers_
+    uint64_t next_id_ = 1;
+    uint64_t running_ = 0; // Id of the callback being run (0 = none)
+    bool stopping_ = false;
+    std::thread thread_;
+};
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,133 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "databricks/core/tracing.h"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace databricks {
+namespace internal {
+#ifdef DATABRICKS_ENABLE_TRACING
+/**
+ * @brief One timed operation in a trace, ended at destruction
+ *
+ * An active span (the one-argument constructor) becomes the thread's current
+ * context until it ends, so spans started inside it are its children; active
+ * spans must end on the thread and in the reverse order they started. A
+ * detached span has an explicit parent, never becomes current and may be moved
+ * to and ended on another thread.
+ *
+ * Nothing is recorded while no SpanExporter is installed or the parent trace is
+ * not sampled; context() then still returns the parent so it keeps propagating.
+ * A span left by an exception is marked as an error.
+ */
+class Span {
+public:
+    /**
+     * @brief Start an active span, child of this thread's current context
+     */
+    explicit Span(std::string_view name);
+
+    /**
+     * @brief Start a detached span, child of parent
+     */
+    Span(std::string_view name, const SpanContext& parent);
+
+    /**
+     * @brief Start a detached span, child of this thread's current context
+     */
+    static Span detached(std::string_view name);
+
+    ~Span() { end(); }
+
+    Span(Span&& other) noexcept;
+    Span& operator=(Span&&) = delete;
+    Span(const Span&) = delete;
+    Span& operator=(const Span&) = delete;
+
+    /**
+     * @brief True when attributes and the end time will be exported
+     */
+    bool recording() const { return data_ != nullptr; }
+
+    /**
+     * @brief Context to propagate: this span's while recording, otherwise the parent's
+     */
+    const SpanContext& context() const { return context_; }
+
+    void set_attribute(const char* key, std::string_view value);
+    void set_attribute(const char* key, int64_t value);
+
+    /**
+     * @brief Mark the span failed; the first message is kept
+     */
+    void set_error(std::string_view message);
+
+    /**
+     * @brief Export the span and restore the previous context; later calls do nothing
+     */
+    void end();
+
+private:
+    std::unique_ptr<SpanData> data_; // Null when not recording
+    SpanContext context_;
+    SpanContext previous_; // Restored by end() for active spans
+    bool active_ = false;
+    int uncaught_exceptions_ = 0;
+    std::chrono::steady_clock::time_point start_;
+};
+
+/// Trace context carried to another thread by async calls
+using CapturedContext = SpanContext;
+
+/**
+ * @brief This thread's current context, to hand to work run elsewhere
+ */
+inline CapturedContext capture_context() {
+    return current_span_context();
+}
+
+/**
+ * @brief Makes a captured context current for the rest of the scope
+ */
+class ResumeContext : private TraceContextScope {
+public:
+    explicit ResumeContext(const CapturedContext& context)
+        : TraceContextScope(context) {}
+};
+#else
+// Tracing compiled out: every operation is an inline no-op
+
+class Span {
+public:
+    explicit Span(std::string_view) {}
+    Span(std::string_view, const SpanContext&) {}
+    static Span detached(std::string_view) { return Span(std::string_view()); }
+
+    bool recording() const { return false; }
+    SpanContext context() const { return {}; }
+    void set_attribute(const char*, std::string_view) {}
+    void set_attribute(const char*, int64_t) {}
+    void set_error(std::string_view) {}
+    void end() {}
+};
+
+struct CapturedContext {};
+
+inline CapturedContext capture_context() {
+    return {};
+}
+
+class ResumeContext {
+public:
+    explicit ResumeContext(const CapturedContext&) {}
+};
+#endif
+
+} // namespace internal
+} // namespace databricks
@@ -0,0 +1,341 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "databricks/core/config.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace databricks {
+namespace internal {
+/**
+ * @brief Failure that a TtlCache remembers (negative caching), e.g. HTTP 404
+ *
+ * Loaders throw this for answers that are as stable as a successful lookup;
+ * any other exception is passed to the caller without being cached.
+ */
+class CacheableError : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+/**
+ * @brief Sharded, read-mostly cache with expiry and request coalescing
+ *
+ * Keys hash to one of several shards, each guarded by its own shared_mutex, so
+ * concurrent hits on different keys never contend and hits on the same shard
+ * only take a shared lock. Entries expire after a TTL; CacheableError results
+ * are kept for a separate (usually shorter) negative TTL, and a lookup may pass
+ * its own TTL. Shards are bounded by entry count and, with a Weigher, by bytes;
+ * when one is full its least recently used entry is evicted. Recency is tracked
+ * with a second-chance clock (a hit only sets a flag, so it stays under the
+ * shared lock): the oldest entry is evicted unless it was hit since it last
+ * came up, in which case it moves to the back.
+ *
+ * Concurrent misses for one key are coalesced: the first caller runs the loader
+ * and the others wait for its result, so a burst of lookups produces a single
+ * backend request.
+ *
+ * Thread-safe.
+ */
+template <typename Value> class TtlCache {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Loader = std::function<Value()>;
+    /// Approximate memory held by a value, for the byte limit
+    using Weigher = std::function<size_t(const Value&)>;
+
+    /**
+     * @param max_entries Entries kept across all shards (at least one per shard)
+     * @param ttl How long a loaded value is served
+     * @param negative_ttl How long a CacheableError is served (zero disables negative caching)
+     * @param shards Number of independently locked shards
+     * @param max_bytes Weighed size kept across all shards, 0 for no limit; values larger
+     *                  than a shard's share are returned but not cached
+     * @param weigher Size of a value (the key's length is added); required for max_bytes
+     */
+    TtlCache(size_t max_entries, std::chrono::milliseconds ttl, std::chrono::milliseconds negative_ttl,
+             size_t shards = 16, size_t max_bytes = 0, Weigher weigher = nullptr)
+        : ttl_(ttl)
+        , negative_ttl_(negative_ttl)
+        , weigher_(max_bytes > 0 ? std::move(weigher) : nullptr)
+        , shards_(std::max<size_t>(shards, 1)) {
+        shard_capacity_ = std::max<size_t>(1, (max_entries + shards_.size() - 1) / shards_.size());
+        shard_byte_capacity_ = weigher_ ? std::max<size_t>(1, max_bytes / shards_.size()) : 0;
+    }
+
+    TtlCache(const TtlCache&) = delete;
+    TtlCache& operator=(const TtlCache&) = delete;
+
+    /**
+     * @brief Return the cached value for key, loading it on a miss
+     *
+     * @throws CacheableError if the key is negatively cached or the loader threw one
+     * @throws Whatever the loader throws (not cached)
+     */
+    Value get_or_load(const std::string& key, const Loader& load) { return get_or_load(key, load, ttl_); }
+
+    /**
+     * @brief Return the cached value for key, loading it on a miss and keeping it for ttl
+     *
+     * Callers coalesced onto the same load share the leader's ttl.
+     */
+    Value get_or_load(const std::string& key, const Loader& load, std::chrono::milliseconds ttl) {
+        Shard& shard = shard_for(key);
+        const Clock::time_point now = Clock::now();
+
+        {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            auto it = shard.entries.find(key);
+            if (it != shard.entries.end() && it->second.expires_at > now) {
+                return serve(it->second);
+            }
+        }
+
+        std::shared_ptr<InFlight> flight;
+        bool leader = false;
+        {
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            auto it = shard.entries.find(key);
+            if (it != shard.entries.end()) {
+                if (it->second.expires_at > now) {
+                    return serve(it->second);
+                }
+                erase(shard, it);
+            }
+
+            auto flying = shard.in_flight.find(key);
+            if (flying != shard.in_flight.end()) {
+                flight = flying->second;
+                coalesced_++;
+            } else {
+                flight = std::make_shared<InFlight>();
+                flight->result = flight->promise.get_future().share();
+                shard.in_flight.emplace(key, flight);
+                leader = true;
+                misses_++;
+            }
+        }
+
+        if (leader) {
+            run_loader(shard, key, *flight, load, ttl);
+        }
+        return flight->result.get();
+    }
+
+    /**
+     * @brief Return the cached value for key without loading it
+     *
+     * Counts a hit when found; a miss is not counted, since the caller is
+     * expected to load through get_or_load().
+     *
+     * @return The value, or nullopt if key is absent, expired or negatively cached
+     */
+    std::optional<Value> find(const std::string& key) {
+        Shard& shard = shard_for(key);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        auto it = shard.entries.find(key);
+        if (it == shard.entries.end() || it->second.error || it->second.expires_at <= Clock::now()) {
+            return std::nullopt;
+        }
+        return serve(it->second);
+    }
+
+    /**
+     * @brief Drop one key
+     */
+    void invalidate(const std::string& key) {
+        Shard& shard = shard_for(key);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        auto it = shard.entries.find(key);
+        if (it != shard.entries.end()) {
+            erase(shard, it);
+        }
+        // A load already running started before the write; don't let it repopulate the entry
+        auto flying = shard.in_flight.find(key);
+        if (flying != shard.in_flight.end()) {
+            flying->second->stale = true;
+        }
+    }
+
+    /**
+     * @brief Drop every key starting with prefix
+     */
+    void invalidate_prefix(const std::string& prefix) {
+        for (Shard& shard : shards_) {
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            for (auto it = shard.entries.begin(); it != shard.entries.end();) {
+                auto next = std::next(it);
+                if (it->first.compare(0, prefix.size(), prefix) == 0) {
+                    erase(shard, it);
+                }
+                it = next;
+            }
+            for (auto& [key, flight] : shard.in_flight) {
+                if (key.compare(0, prefix.size(), prefix) == 0) {
+                    flight->stale = true;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Drop every entry (statistics are kept)
+     */
+    void clear() { invalidate_prefix(""); }
+
+    /**
+     * @brief Counters since construction, plus the current entry count
+     */
+    CacheStats stats() const {
+        CacheStats stats;
+        stats.hits = hits_.load();
+        stats.negative_hits = negative_hits_.load();
+        stats.misses = misses_.load();
+        stats.coalesced = coalesced_.load();
+        stats.evictions = evictions_.load();
+        for (const Shard& shard : shards_) {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            stats.entries += shard.entries.size();
+            stats.bytes += shard.bytes;
+        }
+        return stats;
+    }
+
+private:
+    struct Entry {
+        Entry() = default;
+        Entry(Entry&& other) noexcept
+            : value(std::move(other.value))
+            , error(std::move(other.error))
+            , expires_at(other.expires_at)
+            , age(other.age)
+            , bytes(other.bytes)
+            , referenced(other.referenced.load(std::memory_order_relaxed)) {}
+
+        std::shared_ptr<const Value> value; // Null for a negative entry
+        std::exception_ptr error;           // Set for a negative entry
+        Clock::time_point expires_at;
+        std::list<std::string>::iterator age;        // Position in Shard::order
+        size_t bytes = 0;                            // Weighed size (0 without a weigher)
+        mutable std::atomic<bool> referenced{false}; // Hit since it last reached the front of order
+    };
+
+    struct InFlight {
+        std::promise<Value> promise;
+        std::shared_future<Value> result;
+        bool stale = false; // Invalidated while loading; guarded by the shard mutex
+    };
+
+    struct Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<std::string, Entry> entries;
+        std::list<std::string> order; // Eviction candidates, next at the front
+        size_t bytes = 0;             // Weighed size of the entries
+        std::unordered_map<std::string, std::shared_ptr<InFlight>> in_flight;
+    };
+
+    Shard& shard_for(const std::string& key) { return shards_[std::hash<std::string>()(key) % shards_.size()]; }
+
+    Value serve(const Entry& entry) {
+        // Check first so repeated hits don't keep writing the shared cache line
+        if (!entry.referenced.load(std::memory_order_relaxed)) {
+            entry.referenced.store(true, std::memory_order_relaxed);
+        }
+        if (entry.error) {
+            negative_hits_++;
+            std::rethrow_exception(entry.error);
+        }
+        hits_++;
+        return *entry.value;
+    }
+
+    void run_loader(Shard& shard, const std::string& key, InFlight& flight, const Loader& load,
+                    std::chrono::milliseconds ttl) {
+        Entry entry;
+        bool cache = true;
+        try {
+            Value value = load();
+            if (weigher_) {
+                entry.bytes = weigher_(value) + key.size();
+                cache = entry.bytes <= shard_byte_capacity_;
+            }
+            if (cache) {
+                entry.value = std::make_shared<const Value>(value);
+                entry.expires_at = Clock::now() + ttl;
+            }
+            flight.promise.set_value(std::move(value));
+        } catch (const CacheableError&) {
+            entry.error = std::current_exception();
+            entry.expires_at = Clock::now() + negative_ttl_;
+            cache = negative_ttl_.count() > 0;
+            flight.promise.set_exception(entry.error);
+        } catch (...) {
+            cache = false;
+            flight.promise.set_exception(std::current_exception());
+        }
+
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        if (cache && !flight.stale) {
+            insert(shard, key, std::move(entry));
+        }
+        shard.in_flight.erase(key);
+    }
+
+    void insert(Shard& shard, const std::string& key, Entry entry) {
+        auto existing = shard.entries.find(key);
+        if (existing != shard.entries.end()) {
+            erase(shard, existing);
+        }
+        while (!shard.entries.empty() && (shard.entries.size() >= shard_capacity_ ||
+                                          (weigher_ && shard.bytes + entry.bytes > shard_byte_capacity_))) {
+            auto victim = shard.entries.find(shard.order.front());
+            if (victim->second.referenced.exchange(false, std::memory_order_relaxed)) {
+                shard.order.splice(shard.order.end(), shard.order, victim->second.age); // Second chance
+                continue;
+            }
+            erase(shard, victim);
+            evictions_++;
+        }
+        entry.age = shard.order.insert(shard.order.end(), key);
+        shard.bytes += entry.bytes;
+        shard.entries.emplace(key, std::move(entry));
+    }
+
+    static void erase(Shard& shard, typename std::unordered_map<std::string, Entry>::iterator it) {
+        shard.bytes -= it->second.bytes;
+        shard.order.erase(it->second.age);
+        shard.entries.erase(it);
+    }
+
+    std::chrono::milliseconds ttl_;
+    std::chrono::milliseconds negative_ttl_;
+    Weigher weigher_; // Null without a byte limit
+    size_t shard_capacity_;
+    size_t shard_byte_capacity_;
+    std::vector<Shard> shards_;
+
+    std::atomic<size_t> hits_{0};
+    std::atomic<size_t> negative_hits_{0};
+    std::atomic<size_t> misses_{0};
+    std::atomic<size_t> coalesced_{0};
+    std::atomic<size_t> evictions_{0};
+};
+
+} // namespace internal
+} // namespace databricks
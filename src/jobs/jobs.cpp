@@ -5,9 +5,15 @@
 #include "../internal/http_client.h"
 #include "../internal/http_client_interface.h"
 #include "../internal/logger.h"
+#include "../internal/status_poller.h"
 
+#include <algorithm>
+#include <deque>
+#include <future>
+#include <memory>
 #include <sstream>
 #include <stdexcept>
+#include <utility>
 
 #include <nlohmann/json.hpp>
 
@@ -18,8 +24,8 @@ namespace databricks {
 // Pimpl implementation class
 class Jobs::Impl {
 public:
-    explicit Impl(const AuthConfig& auth)
-        : http_client_(std::make_unique<internal::HttpClient>(auth)) {}
+    explicit Impl(const AuthConfig& auth, const HttpConfig& http = HttpConfig{})
+        : http_client_(std::make_unique<internal::HttpClient>(auth, "2.2", http)) {}
 
     explicit Impl(std::shared_ptr<internal::IHttpClient> http_client)
         : http_client_(std::move(http_client)) {}
@@ -50,15 +56,52 @@ std::string build_query_string(const std::map<std::string, std::string>& params)
     }
     return oss.str();
 }
+
+// Token for the page after this response, or empty on the last page
+std::string next_page_token(const json& j) {
+    if (!j.value("has_more", true)) {
+        return "";
+    }
+    return j.value("next_page_token", "");
+}
+
+// Request body for /jobs/run-now
+std::string run_now_body(uint64_t job_id, const std::map<std::string, std::string>& notebook_params,
+                         const std::string& idempotency_token = "") {
+    json body_json;
+    body_json["job_id"] = job_id;
+
+    if (!notebook_params.empty()) {
+        body_json["notebook_params"] = notebook_params;
+    }
+    if (!idempotency_token.empty()) {
+        body_json["idempotency_token"] = idempotency_token;
+    }
+    return body_json.dump();
+}
+
+// run_id from a /jobs/run-now response
+uint64_t parse_run_id(const std::string& body) {
+    try {
+        auto response_json = json::parse(body);
+        uint64_t run_id = response_json.value("run_id", uint64_t(0));
+
+        if (run_id == 0) {
+            throw std::runtime_error("run_id not found or is 0 in response");
+        }
+        return run_id;
+    } catch (const json::exception& e) {
+        throw std::runtime_error("Failed to parse run response: " + std::string(e.what()));
+    }
+}
 } // namespace
 
 // ============================================================================
 // JSON Parsing Helper Functions
 // ============================================================================
 
-Job Job::from_json(const std::string& json_str) {
+Job Job::from_json(const json& j) {
     try {
-        auto j = json::parse(json_str);
         Job job;
 
         // Use auto to preserve the original JSON types
@@ -78,9 +121,16 @@ Job Job::from_json(const std::string& json_str) {
     }
 }
 
-JobRun JobRun::from_json(const std::string& json_str) {
+Job Job::from_json(const std::string& json_str) {
+    try {
+        return from_json(json::parse(json_str));
+    } catch (const json::exception& e) {
+        throw std::runtime_error("Failed to parse Job JSON: " + std::string(e.what()));
+    }
+}
+
+JobRun JobRun::from_json(const json& j) {
     try {
-        auto j = json::parse(json_str);
         JobRun run;
 
         // Use auto to preserve the original JSON types
@@ -101,9 +151,16 @@ JobRun JobRun::from_json(const std::string& json_str) {
     }
 }
 
-RunOutput RunOutput::from_json(const std::string& json_str) {
+JobRun JobRun::from_json(const std::string& json_str) {
+    try {
+        return from_json(json::parse(json_str));
+    } catch (const json::exception& e) {
+        throw std::runtime_error("Failed to parse JobRun JSON: " + std::string(e.what()));
+    }
+}
+
+RunOutput RunOutput::from_json(const json& j) {
     try {
-        auto j = json::parse(json_str);
         RunOutput run_output;
 
         run_output.notebook_output = j.value("notebook_output", "");
@@ -122,6 +179,14 @@ RunOutput RunOutput::from_json(const std::string& json_str) {
     }
 }
 
+RunOutput RunOutput::from_json(const std::string& json_str) {
+    try {
+        return from_json(json::parse(json_str));
+    } catch (const json::exception& e) {
+        throw std::runtime_error("Failed to parse RunOutput JSON: " + std::string(e.what()));
+    }
+}
+
 // ============================================================================
 // Jobs Constructor and Destructor
 // ============================================================================
@@ -129,6 +194,9 @@ RunOutput RunOutput::from_json(const std::string& json_str) {
 Jobs::Jobs(const AuthConfig& auth)
     : pimpl_(std::make_unique<Impl>(auth)) {}
 
+Jobs::Jobs(const AuthConfig& auth, const HttpConfig& http)
+    : pimpl_(std::make_unique<Impl>(auth, http)) {}
+
 Jobs::Jobs(std::shared_ptr<internal::IHttpClient> http_client)
     : pimpl_(std::make_unique<Impl>(std::move(http_client))) {}
 
@@ -139,8 +207,7 @@ Jobs::~Jobs() = default;
 // ============================================================================
 
 std::vector<Job> Jobs::list_jobs(int limit, int offset) {
-    internal::get_logger()->info("Listing jobs (limit=" + std::to_string(limit) + ", offset=" + std::to_string(offset) +
-                                 ")");
+    DATABRICKS_LOG_INFO("Listing jobs (limit=" + std::to_string(limit) + ", offset=" + std::to_string(offset) + ")");
 
     // Build query parameters
     std::map<std::string, std::string> params;
@@ -157,12 +224,39 @@ std::vector<Job> Jobs::list_jobs(int limit, int offset) {
     auto response = pimpl_->http_client_->get("/jobs/list" + query);
     pimpl_->http_client_->check_response(response, "listJobs");
 
-    internal::get_logger()->debug("Jobs list response: " + response.body);
+    DATABRICKS_LOG_DEBUG("Jobs list response: " + response.body);
     return parse_jobs_list(response.body);
 }
 
+Paginator<Job> Jobs::jobs(int max_results) {
+    DATABRICKS_LOG_INFO("Iterating jobs (max_results=" + std::to_string(max_results) + ")");
+
+    // The fetcher holds the client, not this object, so the paginator may outlive it
+    std::shared_ptr<internal::IHttpClient> http_client = pimpl_->http_client_;
+    return Paginator<Job>([http_client, max_results](const std::string& page_token) {
+        std::map<std::string, std::string> params;
+        if (max_results > 0) {
+            params["limit"] = std::to_string(max_results);
+        }
+        if (!page_token.empty()) {
+            params["page_token"] = internal::url_encode(page_token);
+        }
+        params["expand_tasks"] = "false";
+
+        auto response = http_client->get("/jobs/list" + build_query_string(params));
+        http_client->check_response(response, "listJobs");
+        json page;
+        try {
+            page = json::parse(response.body);
+        } catch (const json::exception& e) {
+            throw std::runtime_error("Failed to parse jobs list: " + std::string(e.what()));
+        }
+        return Paginator<Job>::Page{parse_jobs_list(page), next_page_token(page)};
+    });
+}
+
 Job Jobs::get_job(uint64_t job_id) {
-    internal::get_logger()->info("Getting job details for job_id=" + std::to_string(job_id));
+    DATABRICKS_LOG_INFO("Getting job details for job_id=" + std::to_string(job_id));
 
     // Build query parameters
     std::map<std::string, std::string> params;
@@ -173,66 +267,178 @@ Job Jobs::get_job(uint64_t job_id) {
     auto response = pimpl_->http_client_->get("/jobs/get" + query);
     pimpl_->http_client_->check_response(response, "getJob");
 
-    internal::get_logger()->debug("Job details response: " + response.body);
+    DATABRICKS_LOG_DEBUG("Job details response: " + response.body);
     return Job::from_json(response.body);
 }
 
-uint64_t Jobs::run_now(uint64_t job_id, const std::map<std::string, std::string>& notebook_params) {
-    internal::get_logger()->info("Running job_id=" + std::to_string(job_id));
+std::vector<Job> Jobs::get_jobs(const std::vector<uint64_t>& job_ids) {
+    DATABRICKS_LOG_INFO("Getting job details for " + std::to_string(job_ids.size()) + " jobs");
 
-    // Build request body using nlohmann/json
-    json body_json;
-    body_json["job_id"] = job_id;
+    // Start every request before waiting on any of them
+    std::vector<std::future<internal::HttpResponse>> responses;
+    responses.reserve(job_ids.size());
+    for (uint64_t job_id : job_ids) {
+        std::string query = build_query_string({{"job_id", std::to_string(job_id)}});
+        responses.push_back(pimpl_->http_client_->get_async("/jobs/get" + query));
+    }
 
-    if (!notebook_params.empty()) {
-        body_json["notebook_params"] = notebook_params;
+    std::vector<Job> jobs;
+    jobs.reserve(job_ids.size());
+    for (auto& pending : responses) {
+        auto response = pending.get();
+        pimpl_->http_client_->check_response(response, "getJob");
+        jobs.push_back(Job::from_json(response.body));
     }
+    return jobs;
+}
 
-    std::string body = body_json.dump();
-    internal::get_logger()->debug("Run now request body: " + body);
+uint64_t Jobs::run_now(uint64_t job_id, const std::map<std::string, std::string>& notebook_params) {
+    DATABRICKS_LOG_INFO("Running job_id=" + std::to_string(job_id));
+
+    std::string body = run_now_body(job_id, notebook_params);
+    DATABRICKS_LOG_DEBUG("Run now request body: " + body);
 
     // Make API request
     auto response = pimpl_->http_client_->post("/jobs/run-now", body);
     pimpl_->http_client_->check_response(response, "runJob");
 
-    internal::get_logger()->debug("Run now response: " + response.body);
+    DATABRICKS_LOG_DEBUG("Run now response: " + response.body);
 
-    // Extract run_id from response
-    try {
-        auto response_json = json::parse(response.body);
-        uint64_t run_id = response_json.value("run_id", uint64_t(0));
+    uint64_t run_id = parse_run_id(response.body);
+    DATABRICKS_LOG_INFO("Job started with run_id=" + std::to_string(run_id));
+    return run_id;
+}
 
-        if (run_id == 0) {
-            throw std::runtime_error("run_id not found or is 0 in response");
+std::vector<RunNowResult> Jobs::run_now_batch(const std::vector<RunNowRequest>& requests, size_t max_in_flight) {
+    if (max_in_flight == 0) {
+        throw std::invalid_argument("max_in_flight must be positive");
+    }
+    DATABRICKS_LOG_INFO("Triggering " + std::to_string(requests.size()) + " job runs");
+
+    std::vector<RunNowResult> results(requests.size());
+    std::deque<std::pair<size_t, std::future<internal::HttpResponse>>> in_flight;
+    size_t next = 0;
+    while (next < requests.size() || !in_flight.empty()) {
+        // Keep the pipeline full, then settle the oldest trigger
+        while (in_flight.size() < max_in_flight && next < requests.size()) {
+            const RunNowRequest& request = requests[next];
+            std::string body = run_now_body(request.job_id, request.notebook_params, request.idempotency_token);
+            in_flight.emplace_back(next, pimpl_->http_client_->post_async("/jobs/run-now", body));
+            ++next;
         }
 
-        internal::get_logger()->info("Job started with run_id=" + std::to_string(run_id));
-        return run_id;
-    } catch (const json::exception& e) {
-        throw std::runtime_error("Failed to parse run response: " + std::string(e.what()));
+        auto [index, pending] = std::move(in_flight.front());
+        in_flight.pop_front();
+        RunNowResult& result = results[index];
+        result.job_id = requests[index].job_id;
+        try {
+            auto response = pending.get();
+            result.status_code = response.status_code;
+            pimpl_->http_client_->check_response(response, "runJob");
+            result.run_id = parse_run_id(response.body);
+            result.success = true;
+        } catch (const std::exception& e) {
+            result.error = e.what();
+        }
     }
+
+    size_t started = std::count_if(results.begin(), results.end(), [](const RunNowResult& r) { return r.success; });
+    DATABRICKS_LOG_INFO("Started " + std::to_string(started) + " of " + std::to_string(results.size()) + " job runs");
+    return results;
+}
+
+Paginator<JobRun> Jobs::list_runs(uint64_t job_id, bool active_only, uint64_t since, int max_results) {
+    DATABRICKS_LOG_INFO("Iterating job runs (job_id=" + std::to_string(job_id) +
+                        ", active_only=" + (active_only ? "true" : "false") + ")");
+
+    // The fetcher holds the client, not this object, so the paginator may outlive it
+    std::shared_ptr<internal::IHttpClient> http_client = pimpl_->http_client_;
+    return Paginator<JobRun>([http_client, job_id, active_only, since, max_results](const std::string& page_token) {
+        std::map<std::string, std::string> params;
+        if (job_id != 0) {
+            params["job_id"] = std::to_string(job_id);
+        }
+        if (active_only) {
+            params["active_only"] = "true";
+        }
+        if (since > 0) {
+            params["start_time_from"] = std::to_string(since);
+        }
+        if (max_results > 0) {
+            params["limit"] = std::to_string(max_results);
+        }
+        if (!page_token.empty()) {
+            params["page_token"] = internal::url_encode(page_token);
+        }
+        params["expand_tasks"] = "false";
+
+        auto response = http_client->get("/jobs/runs/list" + build_query_string(params));
+        http_client->check_response(response, "listRuns");
+        json page;
+        try {
+            page = json::parse(response.body);
+        } catch (const json::exception& e) {
+            throw std::runtime_error("Failed to parse runs list: " + std::string(e.what()));
+        }
+        return Paginator<JobRun>::Page{parse_runs_list(page), next_page_token(page)};
+    });
 }
 
 bool Jobs::cancel_run(uint64_t run_id) {
-    internal::get_logger()->info("Cancelling run for run_id=" + std::to_string(run_id));
+    DATABRICKS_LOG_INFO("Cancelling run for run_id=" + std::to_string(run_id));
 
     // Build request body
     json body_json;
     body_json["run_id"] = run_id;
     std::string body = body_json.dump();
 
-    internal::get_logger()->debug("Request body: " + body);
+    DATABRICKS_LOG_DEBUG("Request body: " + body);
 
     // Make API request
     auto response = pimpl_->http_client_->post("/jobs/runs/cancel", body);
     pimpl_->http_client_->check_response(response, "cancelJob");
-    internal::get_logger()->info("Successfully cancelled run for run_id=" + std::to_string(run_id));
+    DATABRICKS_LOG_INFO("Successfully cancelled run for run_id=" + std::to_string(run_id));
 
     return true;
 }
 
+std::future<JobRun> Jobs::wait_for_run(uint64_t run_id, std::chrono::milliseconds timeout, const PollConfig& poll) {
+    if (!poll.is_valid()) {
+        throw std::invalid_argument("Invalid poll configuration");
+    }
+    DATABRICKS_LOG_INFO("Waiting for run_id=" + std::to_string(run_id));
+
+    auto promise = std::make_shared<std::promise<JobRun>>();
+    std::future<JobRun> future = promise->get_future();
+
+    // The watch holds the client, not this object, so the wait may outlive it
+    std::shared_ptr<internal::IHttpClient> http_client = pimpl_->http_client_;
+    std::string path = "/jobs/runs/get" + build_query_string({{"run_id", std::to_string(run_id)}});
+
+    internal::StatusPoller::Watch watch;
+    watch.description = "run_id=" + std::to_string(run_id);
+    watch.check = [http_client, path]() { return http_client->get_async(path); };
+    watch.on_status = [http_client, promise](const internal::HttpResponse& response, std::string& state) {
+        http_client->check_response(response, "getRun");
+        JobRun run = JobRun::from_json(response.body);
+        state = run.state;
+        if (state != "TERMINATED" && state != "SKIPPED" && state != "INTERNAL_ERROR") {
+            return false;
+        }
+        DATABRICKS_LOG_INFO("Run " + std::to_string(run.run_id) + " finished: " + run.result_state);
+        promise->set_value(std::move(run));
+        return true;
+    };
+    watch.on_error = [promise](std::exception_ptr error) { promise->set_exception(error); };
+    watch.deadline = internal::StatusPoller::Clock::now() + timeout;
+    watch.poll = poll;
+
+    internal::StatusPoller::shared().add(std::move(watch));
+    return future;
+}
+
 RunOutput Jobs::get_run_output(uint64_t run_id) {
-    internal::get_logger()->info("Retrieving the output for run_id=" + std::to_string(run_id));
+    DATABRICKS_LOG_INFO("Retrieving the output for run_id=" + std::to_string(run_id));
 
     // Build query parameters
     std::map<std::string, std::string> params;
@@ -243,32 +449,68 @@ RunOutput Jobs::get_run_output(uint64_t run_id) {
     auto response = pimpl_->http_client_->get("/jobs/runs/get-output" + query);
     pimpl_->http_client_->check_response(response, "getRunOutput");
 
-    internal::get_logger()->debug("Job run output response: " + response.body);
+    DATABRICKS_LOG_DEBUG("Job run output response: " + response.body);
     return RunOutput::from_json(response.body);
 }
 
+#ifdef DATABRICKS_ENABLE_COROUTINES
+Awaitable<RunOutput> Jobs::co_get_run_output(uint64_t run_id) {
+    return Awaitable<RunOutput>([this, run_id](Awaitable<RunOutput>::Completion done) {
+        DATABRICKS_LOG_INFO("Retrieving the output for run_id=" + std::to_string(run_id));
+        std::map<std::string, std::string> params;
+        params["run_id"] = std::to_string(run_id);
+        pimpl_->http_client_->get_async(
+            "/jobs/runs/get-output" + build_query_string(params),
+            [this, done](std::exception_ptr error, internal::HttpResponse&& response) mutable {
+                RunOutput output;
+                if (!error) {
+                    try {
+                        pimpl_->http_client_->check_response(response, "getRunOutput");
+                        output = RunOutput::from_json(response.body);
+                    } catch (...) {
+                        error = std::current_exception();
+                    }
+                }
+                // Outside the try: completing may resume the coroutine on this thread
+                if (error) {
+                    done.set_error(error);
+                } else {
+                    done.set_value(std::move(output));
+                }
+            });
+    });
+}
+#endif
+
 // ============================================================================
 // Private Helper Methods
 // ============================================================================
 
 std::vector<Job> Jobs::parse_jobs_list(const std::string& json_str) {
+    try {
+        return parse_jobs_list(json::parse(json_str));
+    } catch (const json::exception& e) {
+        DATABRICKS_LOG_ERROR("Failed to parse jobs list: " + std::string(e.what()));
+        throw std::runtime_error("Failed to parse jobs list: " + std::string(e.what()));
+    }
+}
+
+std::vector<Job> Jobs::parse_jobs_list(const json& j) {
     std::vector<Job> jobs;
 
     try {
-        auto j = json::parse(json_str);
-
         if (!j.contains("jobs") || !j["jobs"].is_array()) {
-            internal::get_logger()->warn("No jobs array found in response");
+            DATABRICKS_LOG_WARN("No jobs array found in response");
             return jobs;
         }
 
         for (const auto& job_json : j["jobs"]) {
-            jobs.push_back(Job::from_json(job_json.dump()));
+            jobs.push_back(Job::from_json(job_json));
         }
 
-        internal::get_logger()->info("Parsed " + std::to_string(jobs.size()) + " jobs");
+        DATABRICKS_LOG_INFO("Parsed " + std::to_string(jobs.size()) + " jobs");
     } catch (const json::exception& e) {
-        internal::get_logger()->error("Failed to parse jobs list: " + std::string(e.what()));
+        DATABRICKS_LOG_ERROR("Failed to parse jobs list: " + std::string(e.what()));
         throw std::runtime_error("Failed to parse jobs list: " + std::string(e.what()));
     }
 
@@ -276,23 +518,30 @@ std::vector<Job> Jobs::parse_jobs_list(const std::string& json_str) {
 }
 
 std::vector<JobRun> Jobs::parse_runs_list(const std::string& json_str) {
+    try {
+        return parse_runs_list(json::parse(json_str));
+    } catch (const json::exception& e) {
+        DATABRICKS_LOG_ERROR("Failed to parse runs list: " + std::string(e.what()));
+        throw std::runtime_error("Failed to parse runs list: " + std::string(e.what()));
+    }
+}
+
+std::vector<JobRun> Jobs::parse_runs_list(const json& j) {
     std::vector<JobRun> runs;
 
     try {
-        auto j = json::parse(json_str);
-
         if (!j.contains("runs") || !j["runs"].is_array()) {
-            internal::get_logger()->warn("No runs array found in response");
+            // The API omits the array when no run matches
             return runs;
         }
 
         for (const auto& run_json : j["runs"]) {
-            runs.push_back(JobRun::from_json(run_json.dump()));
+            runs.push_back(JobRun::from_json(run_json));
         }
 
-        internal::get_logger()->info("Parsed " + std::to_string(runs.size()) + " runs");
+        DATABRICKS_LOG_INFO("Parsed " + std::to_string(runs.size()) + " runs");
     } catch (const json::exception& e) {
-        internal::get_logger()->error("Failed to parse runs list: " + std::string(e.what()));
+        DATABRICKS_LOG_ERROR("Failed to parse runs list: " + std::string(e.what()));
         throw std::runtime_error("Failed to parse runs list: " + std::string(e.what()));
     }
 
@@ -5,8 +5,16 @@
 #include "../internal/http_client.h"
 #include "../internal/http_client_interface.h"
 #include "../internal/logger.h"
-
+#include "../internal/ttl_cache.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <optional>
 #include <unordered_map>
+#include <vector>
 
 #include <nlohmann/json.hpp>
 
@@ -14,19 +22,108 @@ using json = nlohmann::json;
 
 namespace databricks {
 
+namespace {
+// Secret bytes in locked memory. A vector rather than a SecureString so that short values are
+// not stored inline (small-string buffer), where the allocator can neither lock nor zero them.
+using LockedBytes = std::vector<char, internal::SecureAllocator<char>>;
+
+// Decode standard base64 into locked memory; no intermediate copy of the value is made
+LockedBytes decode_base64(const std::string& encoded) {
+    static const std::array<int8_t, 256> table = [] {
+        std::array<int8_t, 256> t{};
+        t.fill(-1);
+        const char* alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        for (int i = 0; i < 64; i++) {
+            t[static_cast<unsigned char>(alphabet[i])] = static_cast<int8_t>(i);
+        }
+        return t;
+    }();
+
+    LockedBytes decoded;
+    decoded.reserve(encoded.size() / 4 * 3);
+    uint32_t bits = 0;
+    int pending = 0;
+    for (char c : encoded) {
+        if (c == '=') {
+            break;
+        }
+        int8_t sextet = table[static_cast<unsigned char>(c)];
+        if (sextet < 0) {
+            throw std::runtime_error("Failed to decode secret value: invalid base64");
+        }
+        bits = (bits << 6) | static_cast<uint32_t>(sextet);
+        pending += 6;
+        if (pending >= 8) {
+            pending -= 8;
+            decoded.push_back(static_cast<char>((bits >> pending) & 0xFF));
+        }
+    }
+    return decoded;
+}
+
+// Decode the value of a get-secret response, zeroing the response text and the parsed copy
+LockedBytes parse_secret_value(std::string& json_str) {
+    try {
+        auto j = json::parse(json_str);
+        internal::secure_zero_string(json_str);
+
+        auto it = j.find("value");
+        if (it == j.end() || !it->is_string()) {
+            throw std::runtime_error("Failed to parse secret value: no value in response");
+        }
+        std::string& encoded = it->get_ref<std::string&>();
+        LockedBytes value;
+        try {
+            value = decode_base64(encoded);
+        } catch (...) {
+            internal::secure_zero_string(encoded);
+            throw;
+        }
+        internal::secure_zero_string(encoded);
+        return value;
+    } catch (const json::exception& e) {
+        internal::secure_zero_string(json_str);
+        throw std::runtime_error("Failed to parse secret value: " + std::string(e.what()));
+    }
+}
+} // namespace
+
 // ==================== PIMPL IMPLEMENTATION ====================
 
 class Secrets::Impl {
 public:
     // Constructor for production use (creates real HttpClient)
-    explicit Impl(const AuthConfig& auth, const std::string& api_version = "2.0")
-        : http_client_(std::make_shared<internal::HttpClient>(auth, api_version)) {}
+    explicit Impl(const AuthConfig& auth, const std::string& api_version = "2.0",
+                  const HttpConfig& http = HttpConfig{})
+        : http_client_(std::make_shared<internal::HttpClient>(auth, api_version, http)) {}
 
     // Constructor for testing (accepts injected client)
     explicit Impl(std::shared_ptr<internal::IHttpClient> client)
         : http_client_(std::move(client)) {}
 
+    using ValueCache = internal::TtlCache<LockedBytes>;
+
+    std::shared_ptr<ValueCache> cache() const { return std::atomic_load(&cache_); }
+
+    static std::string cache_key(const std::string& scope, const std::string& key) { return scope + "/" + key; }
+
+    static std::string secret_path(const std::string& scope, const std::string& key) {
+        return "/secrets/get?scope=" + internal::url_encode(scope) + "&key=" + internal::url_encode(key);
+    }
+
+    // Validate a get-secret response, decode its value and zero the response body
+    LockedBytes take_value(internal::HttpResponse& response) const {
+        try {
+            http_client_->check_response(response, "getSecret");
+        } catch (...) {
+            internal::secure_zero_string(response.body);
+            throw;
+        }
+        return parse_secret_value(response.body);
+    }
+
     std::shared_ptr<internal::IHttpClient> http_client_;
+    std::shared_ptr<ValueCache> cache_; // Null while caching is disabled; swapped atomically
 };
 
 // ==================== CONSTRUCTORS & DESTRUCTOR ====================
@@ -34,20 +131,48 @@ public:
 Secrets::Secrets(const AuthConfig& auth, const std::string& api_version)
     : pimpl_(std::make_unique<Impl>(auth, api_version)) {}
 
+Secrets::Secrets(const AuthConfig& auth, const HttpConfig& http)
+    : pimpl_(std::make_unique<Impl>(auth, "2.0", http)) {}
+
 Secrets::Secrets(std::shared_ptr<internal::IHttpClient> http_client)
     : pimpl_(std::make_unique<Impl>(std::move(http_client))) {}
 
 Secrets::~Secrets() = default;
 
+// ==================== SECRET VALUE CACHE ====================
+
+void Secrets::set_cache_config(const SecretCacheConfig& config) {
+    if (!config.is_valid()) {
+        throw std::invalid_argument("Invalid SecretCacheConfig");
+    }
+    std::shared_ptr<Impl::ValueCache> cache;
+    if (config.enabled) {
+        cache = std::make_shared<Impl::ValueCache>(config.max_entries, std::chrono::milliseconds(config.ttl_ms),
+                                                   std::chrono::milliseconds(0), config.shards);
+    }
+    std::atomic_store(&pimpl_->cache_, std::move(cache));
+}
+
+CacheStats Secrets::cache_stats() const {
+    auto cache = pimpl_->cache();
+    return cache ? cache->stats() : CacheStats{};
+}
+
+void Secrets::invalidate_cache() {
+    if (auto cache = pimpl_->cache()) {
+        cache->clear();
+    }
+}
+
 // ==================== PUBLIC API METHODS ====================
 
 std::vector<SecretScope> Secrets::list_scopes() {
-    internal::get_logger()->info("Listing secret scopes");
+    DATABRICKS_LOG_INFO("Listing secret scopes");
 
     auto response = pimpl_->http_client_->get("/secrets/scopes/list");
     pimpl_->http_client_->check_response(response, "listScopes");
 
-    internal::get_logger()->debug("Successfully retrieved secret scopes");
+    DATABRICKS_LOG_DEBUG("Successfully retrieved secret scopes");
     return parse_scopes_list(response.body);
 }
 
@@ -64,7 +189,7 @@ void Secrets::create_scope(const std::string& scope, const std::string& initial_
         }
     }
 
-    internal::get_logger()->info("Creating secret scope: " + scope);
+    DATABRICKS_LOG_INFO("Creating secret scope: " + scope);
 
     // Build JSON Body
     json body_json;
@@ -80,33 +205,36 @@ void Secrets::create_scope(const std::string& scope, const std::string& initial_
     }
 
     std::string body = body_json.dump();
-    internal::get_logger()->debug("Create scope request body: " + body);
+    DATABRICKS_LOG_DEBUG("Create scope request body: " + body);
 
     auto response = pimpl_->http_client_->post("/secrets/scopes/create", body);
     pimpl_->http_client_->check_response(response, "createScope");
 
-    internal::get_logger()->info("Successfully created secret scope: " + scope);
+    DATABRICKS_LOG_INFO("Successfully created secret scope: " + scope);
 }
 
 void Secrets::delete_scope(const std::string& scope) {
-    internal::get_logger()->info("Deleting secret scope: " + scope);
+    DATABRICKS_LOG_INFO("Deleting secret scope: " + scope);
 
     // Build JSON body
     json body_json;
     body_json["scope"] = scope;
     std::string body = body_json.dump();
 
-    internal::get_logger()->debug("Delete scope request body: " + body);
+    DATABRICKS_LOG_DEBUG("Delete scope request body: " + body);
 
     // Make API request
     auto response = pimpl_->http_client_->post("/secrets/scopes/delete", body);
     pimpl_->http_client_->check_response(response, "deleteScope");
+    if (auto cache = pimpl_->cache()) {
+        cache->invalidate_prefix(scope + "/");
+    }
 
-    internal::get_logger()->info("Successfully deleted secret scope: " + scope);
+    DATABRICKS_LOG_INFO("Successfully deleted secret scope: " + scope);
 }
 
 void Secrets::put_secret(const std::string& scope, const std::string& key, const std::string& value) {
-    internal::get_logger()->info("Putting secret: scope=" + scope + ", key=" + key);
+    DATABRICKS_LOG_INFO("Putting secret: scope=" + scope + ", key=" + key);
 
     // Build JSON body
     json body_json;
@@ -116,15 +244,19 @@ void Secrets::put_secret(const std::string& scope, const std::string& key, const
     std::string body = body_json.dump();
 
     // Make API request (DO NOT log the secret value!)
-    internal::get_logger()->debug("Put secret request for scope=" + scope + ", key=" + key);
+    DATABRICKS_LOG_DEBUG("Put secret request for scope=" + scope + ", key=" + key);
     auto response = pimpl_->http_client_->post("/secrets/put", body);
+    internal::secure_zero_string(body);
     pimpl_->http_client_->check_response(response, "putSecret");
+    if (auto cache = pimpl_->cache()) {
+        cache->invalidate(Impl::cache_key(scope, key));
+    }
 
-    internal::get_logger()->info("Successfully put secret: scope=" + scope + ", key=" + key);
+    DATABRICKS_LOG_INFO("Successfully put secret: scope=" + scope + ", key=" + key);
 }
 
 void Secrets::delete_secret(const std::string& scope, const std::string& key) {
-    internal::get_logger()->info("Deleting secret: scope=" + scope + ", key=" + key);
+    DATABRICKS_LOG_INFO("Deleting secret: scope=" + scope + ", key=" + key);
 
     // Build JSON body
     json body_json;
@@ -132,31 +264,96 @@ void Secrets::delete_secret(const std::string& scope, const std::string& key) {
     body_json["key"] = key;
     std::string body = body_json.dump();
 
-    internal::get_logger()->debug("Delete secret request body: " + body);
+    DATABRICKS_LOG_DEBUG("Delete secret request body: " + body);
 
     // Make API request
     auto response = pimpl_->http_client_->post("/secrets/delete", body);
     pimpl_->http_client_->check_response(response, "deleteSecret");
+    if (auto cache = pimpl_->cache()) {
+        cache->invalidate(Impl::cache_key(scope, key));
+    }
 
-    internal::get_logger()->info("Successfully deleted secret: scope=" + scope + ", key=" + key);
+    DATABRICKS_LOG_INFO("Successfully deleted secret: scope=" + scope + ", key=" + key);
 }
 
 std::vector<Secret> Secrets::list_secrets(const std::string& scope) {
-    internal::get_logger()->info("Listing secrets in scope: " + scope);
+    DATABRICKS_LOG_INFO("Listing secrets in scope: " + scope);
 
     // Make GET request with scope as query parameter
     auto response = pimpl_->http_client_->get("/secrets/list?scope=" + scope);
     pimpl_->http_client_->check_response(response, "listSecrets");
 
-    internal::get_logger()->debug("Successfully retrieved secrets list");
+    DATABRICKS_LOG_DEBUG("Successfully retrieved secrets list");
     return parse_secrets_list(response.body);
 }
 
+SecretValue Secrets::get_secret(const std::string& scope, const std::string& key) {
+    auto load = [&]() {
+        // DO NOT log the secret value!
+        DATABRICKS_LOG_INFO("Getting secret: scope=" + scope + ", key=" + key);
+        auto response = pimpl_->http_client_->get(Impl::secret_path(scope, key));
+        return pimpl_->take_value(response);
+    };
+
+    auto cache = pimpl_->cache();
+    LockedBytes bytes = cache ? cache->get_or_load(Impl::cache_key(scope, key), load) : load();
+    return SecretValue(bytes.begin(), bytes.end());
+}
+
+std::vector<SecretValue> Secrets::get_secrets(const std::string& scope, const std::vector<std::string>& keys) {
+    DATABRICKS_LOG_INFO("Getting " + std::to_string(keys.size()) + " secrets from scope=" + scope);
+    auto cache = pimpl_->cache();
+
+    // Start every request the cache can't answer before waiting on any of them
+    std::vector<std::optional<LockedBytes>> cached(keys.size());
+    std::vector<std::future<internal::HttpResponse>> responses(keys.size());
+    for (size_t i = 0; i < keys.size(); i++) {
+        if (cache) {
+            cached[i] = cache->find(Impl::cache_key(scope, keys[i]));
+        }
+        if (!cached[i]) {
+            responses[i] = pimpl_->http_client_->get_async(Impl::secret_path(scope, keys[i]));
+        }
+    }
+
+    std::vector<SecretValue> values;
+    values.reserve(keys.size());
+    std::exception_ptr error;
+    for (size_t i = 0; i < keys.size(); i++) {
+        try {
+            if (!cached[i]) {
+                auto load = [&]() {
+                    auto response = responses[i].get();
+                    return pimpl_->take_value(response);
+                };
+                // Through the cache, so concurrent readers of the same secret share this response
+                cached[i] = cache ? cache->get_or_load(Impl::cache_key(scope, keys[i]), load) : load();
+            }
+            values.emplace_back(cached[i]->begin(), cached[i]->end());
+        } catch (...) {
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+        // A response the cache made redundant still holds a value; wipe it
+        if (responses[i].valid()) {
+            try {
+                auto unused = responses[i].get();
+                internal::secure_zero_string(unused.body);
+            } catch (...) {
+            }
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return values;
+}
+
 // ==================== FROM_JSON IMPLEMENTATIONS ====================
 
-SecretScope SecretScope::from_json(const std::string& json_str) {
+SecretScope SecretScope::from_json(const json& j) {
     try {
-        auto j = json::parse(json_str);
         SecretScope scope;
 
         scope.name = j.value("name", "");
@@ -184,9 +381,16 @@ SecretScope SecretScope::from_json(const std::string& json_str) {
     }
 }
 
-Secret Secret::from_json(const std::string& json_str) {
+SecretScope SecretScope::from_json(const std::string& json_str) {
+    try {
+        return from_json(json::parse(json_str));
+    } catch (const json::exception& e) {
+        throw std::runtime_error("Failed to parse SecretScope JSON: " + std::string(e.what()));
+    }
+}
+
+Secret Secret::from_json(const json& j) {
     try {
-        auto j = json::parse(json_str);
         Secret secret;
 
         secret.key = j.value("key", "");
@@ -198,9 +402,16 @@ Secret Secret::from_json(const std::string& json_str) {
     }
 }
 
-SecretACL SecretACL::from_json(const std::string& json_str) {
+Secret Secret::from_json(const std::string& json_str) {
+    try {
+        return from_json(json::parse(json_str));
+    } catch (const json::exception& e) {
+        throw std::runtime_error("Failed to parse Secret JSON: " + std::string(e.what()));
+    }
+}
+
+SecretACL SecretACL::from_json(const json& j) {
     try {
-        auto j = json::parse(json_str);
         SecretACL acl;
 
         acl.principal = j.value("principal", "");
@@ -223,6 +434,14 @@ SecretACL SecretACL::from_json(const std::string& json_str) {
     }
 }
 
+SecretACL SecretACL::from_json(const std::string& json_str) {
+    try {
+        return from_json(json::parse(json_str));
+    } catch (const json::exception& e) {
+        throw std::runtime_error("Failed to parse SecretACL JSON: " + std::string(e.what()));
+    }
+}
+
 // ==================== PRIVATE HELPER METHODS ====================
 
 std::string Secrets::backend_type_to_string(SecretScopeBackendType backend_type) const {
@@ -243,17 +462,17 @@ std::vector<SecretScope> Secrets::parse_scopes_list(const std::string& json_str)
         auto j = json::parse(json_str);
 
         if (!j.contains("scopes") || !j["scopes"].is_array()) {
-            internal::get_logger()->warn("No scopes array found in response");
+            DATABRICKS_LOG_WARN("No scopes array found in response");
             return scopes;
         }
 
         for (const auto& scope_json : j["scopes"]) {
-            scopes.push_back(SecretScope::from_json(scope_json.dump()));
+            scopes.push_back(SecretScope::from_json(scope_json));
         }
 
-        internal::get_logger()->info("Parsed " + std::to_string(scopes.size()) + " secret scopes");
+        DATABRICKS_LOG_INFO("Parsed " + std::to_string(scopes.size()) + " secret scopes");
     } catch (const json::exception& e) {
-        internal::get_logger()->error("Failed to parse scopes list: " + std::string(e.what()));
+        DATABRICKS_LOG_ERROR("Failed to parse scopes list: " + std::string(e.what()));
         throw std::runtime_error("Failed to parse scopes list: " + std::string(e.what()));
     }
 
@@ -267,17 +486,17 @@ std::vector<Secret> Secrets::parse_secrets_list(const std::string& json_str) {
         auto j = json::parse(json_str);
 
         if (!j.contains("secrets") || !j["secrets"].is_array()) {
-            internal::get_logger()->warn("No secrets array found in response");
+            DATABRICKS_LOG_WARN("No secrets array found in response");
             return secrets;
         }
 
         for (const auto& secret_json : j["secrets"]) {
-            secrets.push_back(Secret::from_json(secret_json.dump()));
+            secrets.push_back(Secret::from_json(secret_json));
         }
 
-        internal::get_logger()->info("Parsed " + std::to_string(secrets.size()) + " secrets");
+        DATABRICKS_LOG_INFO("Parsed " + std::to_string(secrets.size()) + " secrets");
     } catch (const json::exception& e) {
-        internal::get_logger()->error("Failed to parse secrets list: " + std::string(e.what()));
+        DATABRICKS_LOG_ERROR("Failed to parse secrets list: " + std::string(e.what()));
         throw std::runtime_error("Failed to parse secrets list: " + std::string(e.what()));
     }
 
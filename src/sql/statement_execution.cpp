@@ -0,0 +1,470 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "databricks/sql/statement_execution.h"
+
+#include "../internal/http_client.h"
+#include "../internal/http_client_interface.h"
+#include "../internal/logger.h"
+#include "../internal/status_poller.h"
+
+#include <deque>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::json;
+
+namespace databricks {
+
+// ============================================================================
+// Types
+// ============================================================================
+
+StatementState parse_statement_state(const std::string& state_str) {
+    static const std::unordered_map<std::string, StatementState> states = {
+        {"PENDING", StatementState::PENDING},     {"RUNNING", StatementState::RUNNING},
+        {"SUCCEEDED", StatementState::SUCCEEDED}, {"FAILED", StatementState::FAILED},
+        {"CANCELED", StatementState::CANCELED},   {"CLOSED", StatementState::CLOSED}};
+    auto it = states.find(state_str);
+    return it != states.end() ? it->second : StatementState::UNKNOWN;
+}
+
+std::string statement_state_to_string(StatementState state) {
+    switch (state) {
+    case StatementState::PENDING:
+        return "PENDING";
+    case StatementState::RUNNING:
+        return "RUNNING";
+    case StatementState::SUCCEEDED:
+        return "SUCCEEDED";
+    case StatementState::FAILED:
+        return "FAILED";
+    case StatementState::CANCELED:
+        return "CANCELED";
+    case StatementState::CLOSED:
+        return "CLOSED";
+    default:
+        return "UNKNOWN";
+    }
+}
+
+std::string statement_format_to_string(StatementFormat format) {
+    switch (format) {
+    case StatementFormat::JSON_ARRAY:
+        return "JSON_ARRAY";
+    case StatementFormat::CSV:
+        return "CSV";
+    default:
+        return "ARROW_STREAM";
+    }
+}
+
+std::string StatementRequest::to_json() const {
+    json body;
+    body["statement"] = statement;
+    body["warehouse_id"] = warehouse_id;
+    body["disposition"] = "EXTERNAL_LINKS";
+    body["format"] = statement_format_to_string(format);
+    body["wait_timeout"] = std::to_string(wait_timeout_seconds) + "s";
+    body["on_wait_timeout"] = "CONTINUE";
+    if (!catalog.empty()) {
+        body["catalog"] = catalog;
+    }
+    if (!schema.empty()) {
+        body["schema"] = schema;
+    }
+    if (!parameters.empty()) {
+        json params = json::array();
+        for (const auto& parameter : parameters) {
+            json p;
+            p["name"] = parameter.name;
+            if (parameter.value) { // An absent value binds NULL
+                p["value"] = *parameter.value;
+            }
+            if (!parameter.type.empty()) {
+                p["type"] = parameter.type;
+            }
+            params.push_back(std::move(p));
+        }
+        body["parameters"] = std::move(params);
+    }
+    if (row_limit > 0) {
+        body["row_limit"] = row_limit;
+    }
+    if (byte_limit > 0) {
+        body["byte_limit"] = byte_limit;
+    }
+    return body.dump();
+}
+
+ExternalLink ExternalLink::from_json(const json& j) {
+    try {
+        ExternalLink link;
+        link.chunk_index = j.value("chunk_index", uint64_t(0));
+        link.row_offset = j.value("row_offset", uint64_t(0));
+        link.row_count = j.value("row_count", uint64_t(0));
+        link.byte_count = j.value("byte_count", uint64_t(0));
+        link.external_link = j.value("external_link", "");
+        link.expiration = j.value("expiration", "");
+        if (j.contains("http_headers") && j["http_headers"].is_object()) {
+            for (const auto& [name, value] : j["http_headers"].items()) {
+                link.http_headers[name] = value.get<std::string>();
+            }
+        }
+        if (j.contains("next_chunk_index") && j["next_chunk_index"].is_number()) {
+            link.next_chunk_index = j["next_chunk_index"].get<uint64_t>();
+        }
+        return link;
+    } catch (const json::exception& e) {
+        throw std::runtime_error("Failed to parse ExternalLink JSON: " + std::string(e.what()));
+    }
+}
+
+StatementResponse StatementResponse::from_json(const json& j) {
+    try {
+        StatementResponse response;
+        response.statement_id = j.value("statement_id", "");
+
+        if (j.contains("status") && j["status"].is_object()) {
+            const json& status = j["status"];
+            response.state = parse_statement_state(status.value("state", ""));
+            if (status.contains("error") && status["error"].is_object()) {
+                response.error_code = status["error"].value("error_code", "");
+                response.error_message = status["error"].value("message", "");
+            }
+        }
+
+        if (j.contains("manifest") && j["manifest"].is_object()) {
+            const json& manifest = j["manifest"];
+            response.format = manifest.value("format", "");
+            response.total_chunk_count = manifest.value("total_chunk_count", uint64_t(0));
+            response.total_row_count = manifest.value("total_row_count", uint64_t(0));
+            response.total_byte_count = manifest.value("total_byte_count", uint64_t(0));
+            response.truncated = manifest.value("truncated", false);
+            if (manifest.contains("schema") && manifest["schema"].contains("columns")) {
+                for (const auto& c : manifest["schema"]["columns"]) {
+                    StatementColumn column;
+                    column.name = c.value("name", "");
+                    column.type_name = c.value("type_name", "");
+                    column.type_text = c.value("type_text", "");
+                    column.position = c.value("position", 0);
+                    response.columns.push_back(std::move(column));
+                }
+            }
+        }
+
+        if (j.contains("result") && j["result"].contains("external_links")) {
+            for (const auto& link : j["result"]["external_links"]) {
+                response.external_links.push_back(ExternalLink::from_json(link));
+            }
+        }
+        return response;
+    } catch (const json::exception& e) {
+        throw std::runtime_error("Failed to parse StatementResponse JSON: " + std::string(e.what()));
+    }
+}
+
+StatementResponse StatementResponse::from_json(const std::string& json_str) {
+    try {
+        return from_json(json::parse(json_str));
+    } catch (const json::exception& e) {
+        throw std::runtime_error("Failed to parse StatementResponse JSON: " + std::string(e.what()));
+    }
+}
+
+// ============================================================================
+// Helper Functions
+// ============================================================================
+
+namespace {
+std::string statement_path(const std::string& statement_id) {
+    return "/sql/statements/" + internal::url_encode(statement_id);
+}
+
+// Fetch the links for one chunk; the response may also carry links for the chunks after it
+std::vector<ExternalLink> fetch_chunk_links(internal::IHttpClient& http, const std::string& statement_id,
+                                            uint64_t chunk_index) {
+    auto response = http.get(statement_path(statement_id) + "/result/chunks/" + std::to_string(chunk_index));
+    http.check_response(response, "getStatementResultChunk");
+
+    std::vector<ExternalLink> links;
+    try {
+        json j = json::parse(response.body);
+        if (j.contains("external_links")) {
+            for (const auto& link : j["external_links"]) {
+                links.push_back(ExternalLink::from_json(link));
+            }
+        }
+    } catch (const json::exception& e) {
+        throw std::runtime_error("Failed to parse result chunk links: " + std::string(e.what()));
+    }
+    return links;
+}
+} // namespace
+
+// ============================================================================
+// ResultChunkStream
+// ============================================================================
+
+class ResultChunkStream::Impl {
+public:
+    Impl(std::shared_ptr<internal::IHttpClient> http, const StatementResponse& response, size_t window)
+        : http_(std::move(http))
+        , statement_id_(response.statement_id)
+        , total_chunks_(response.total_chunk_count)
+        , window_(window) {
+        for (const auto& link : response.external_links) {
+            links_.emplace(link.chunk_index, link);
+        }
+    }
+
+    bool next(ResultChunk& chunk) {
+        start_downloads();
+        if (pending_.empty()) {
+            return false;
+        }
+        Download download = std::move(pending_.front());
+        pending_.pop_front();
+
+        internal::HttpResponse response = download.response.get();
+        if (response.status_code == 403) {
+            // Presigned links expire; a slow reader can outlive the ones it was given
+            DATABRICKS_LOG_DEBUG("Link for chunk {} rejected; requesting a fresh one", download.link.chunk_index);
+            links_.erase(download.link.chunk_index);
+            download.link = refresh_link(download.link.chunk_index);
+            response = http_->get_external(download.link.external_link, download.link.http_headers);
+        }
+        http_->check_response(response, "downloadResultChunk");
+
+        chunk.chunk_index = download.link.chunk_index;
+        chunk.row_offset = download.link.row_offset;
+        chunk.row_count = download.link.row_count;
+        chunk.data = std::move(response.body);
+        delivered_++;
+
+        // Keep the window full while the caller reads this chunk
+        start_downloads();
+        return true;
+    }
+
+    uint64_t total_chunks() const { return total_chunks_; }
+    uint64_t delivered() const { return delivered_; }
+
+private:
+    struct Download {
+        ExternalLink link;
+        std::future<internal::HttpResponse> response;
+    };
+
+    void start_downloads() {
+        while (pending_.size() < window_ && next_chunk_ < total_chunks_) {
+            Download download;
+            download.link = link_for(next_chunk_);
+            download.response = http_->get_external_async(download.link.external_link, download.link.http_headers);
+            pending_.push_back(std::move(download));
+            next_chunk_++;
+        }
+    }
+
+    ExternalLink link_for(uint64_t chunk_index) {
+        auto it = links_.find(chunk_index);
+        if (it == links_.end()) {
+            return refresh_link(chunk_index);
+        }
+        ExternalLink link = std::move(it->second);
+        links_.erase(it);
+        return link;
+    }
+
+    // Request links starting at chunk_index, keeping any extra ones for later chunks
+    ExternalLink refresh_link(uint64_t chunk_index) {
+        std::optional<ExternalLink> found;
+        for (auto& link : fetch_chunk_links(*http_, statement_id_, chunk_index)) {
+            if (link.chunk_index == chunk_index) {
+                found = std::move(link);
+            } else if (link.chunk_index >= next_chunk_) {
+                links_[link.chunk_index] = std::move(link);
+            }
+        }
+        if (!found) {
+            throw std::runtime_error("No link returned for result chunk " + std::to_string(chunk_index) +
+                                     " of statement " + statement_id_);
+        }
+        return std::move(*found);
+    }
+
+    std::shared_ptr<internal::IHttpClient> http_;
+    std::string statement_id_;
+    uint64_t total_chunks_;
+    size_t window_;
+    std::unordered_map<uint64_t, ExternalLink> links_; // Known links for chunks not yet started
+    std::deque<Download> pending_;                     // Downloads in chunk order
+    uint64_t next_chunk_ = 0;                          // First chunk not yet started
+    uint64_t delivered_ = 0;
+};
+
+ResultChunkStream::ResultChunkStream(std::unique_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+ResultChunkStream::~ResultChunkStream() = default;
+ResultChunkStream::ResultChunkStream(ResultChunkStream&&) noexcept = default;
+ResultChunkStream& ResultChunkStream::operator=(ResultChunkStream&&) noexcept = default;
+
+bool ResultChunkStream::next(ResultChunk& chunk) {
+    return impl_->next(chunk);
+}
+
+uint64_t ResultChunkStream::total_chunks() const {
+    return impl_->total_chunks();
+}
+
+uint64_t ResultChunkStream::chunks_delivered() const {
+    return impl_->delivered();
+}
+
+// ============================================================================
+// StatementExecution
+// ============================================================================
+
+class StatementExecution::Impl {
+public:
+    explicit Impl(const AuthConfig& auth, const HttpConfig& http = HttpConfig{})
+        : http_client_(std::make_shared<internal::HttpClient>(auth, "2.0", http)) {}
+
+    explicit Impl(std::shared_ptr<internal::IHttpClient> http_client)
+        : http_client_(std::move(http_client)) {}
+
+    std::shared_ptr<internal::IHttpClient> http_client_;
+};
+
+StatementExecution::StatementExecution(const AuthConfig& auth)
+    : pimpl_(std::make_unique<Impl>(auth)) {}
+
+StatementExecution::StatementExecution(const AuthConfig& auth, const HttpConfig& http)
+    : pimpl_(std::make_unique<Impl>(auth, http)) {}
+
+StatementExecution::StatementExecution(std::shared_ptr<internal::IHttpClient> http_client)
+    : pimpl_(std::make_unique<Impl>(std::move(http_client))) {}
+
+StatementExecution::~StatementExecution() = default;
+
+StatementResponse StatementExecution::submit(const StatementRequest& request) {
+    if (request.statement.empty() || request.warehouse_id.empty()) {
+        throw std::invalid_argument("Statement and warehouse_id are required");
+    }
+    if (request.wait_timeout_seconds != 0 && (request.wait_timeout_seconds < 5 || request.wait_timeout_seconds > 50)) {
+        throw std::invalid_argument("wait_timeout_seconds must be 0 or between 5 and 50");
+    }
+    DATABRICKS_LOG_INFO("Submitting statement to warehouse " + request.warehouse_id);
+
+    auto response = pimpl_->http_client_->post("/sql/statements", request.to_json());
+    pimpl_->http_client_->check_response(response, "executeStatement");
+
+    StatementResponse statement = StatementResponse::from_json(response.body);
+    DATABRICKS_LOG_DEBUG("Statement {} is {}", statement.statement_id, statement_state_to_string(statement.state));
+    return statement;
+}
+
+StatementResponse StatementExecution::get_statement(const std::string& statement_id) {
+    auto response = pimpl_->http_client_->get(statement_path(statement_id));
+    pimpl_->http_client_->check_response(response, "getStatement");
+    return StatementResponse::from_json(response.body);
+}
+
+std::future<StatementResponse> StatementExecution::wait_for_statement(const std::string& statement_id,
+                                                                      std::chrono::milliseconds timeout,
+                                                                      const PollConfig& poll) {
+    if (!poll.is_valid()) {
+        throw std::invalid_argument("Invalid poll configuration");
+    }
+    DATABRICKS_LOG_INFO("Waiting for statement " + statement_id);
+
+    auto promise = std::make_shared<std::promise<StatementResponse>>();
+    std::future<StatementResponse> future = promise->get_future();
+
+    // The watch holds the client, not this object, so the wait may outlive it
+    std::shared_ptr<internal::IHttpClient> http_client = pimpl_->http_client_;
+    std::string path = statement_path(statement_id);
+
+    internal::StatusPoller::Watch watch;
+    watch.description = "statement " + statement_id;
+    watch.check = [http_client, path]() { return http_client->get_async(path); };
+    watch.on_status = [http_client, promise](const internal::HttpResponse& response, std::string& state) {
+        http_client->check_response(response, "getStatement");
+        StatementResponse statement = StatementResponse::from_json(response.body);
+        state = statement_state_to_string(statement.state);
+        if (!statement.is_terminal()) {
+            return false;
+        }
+        DATABRICKS_LOG_INFO("Statement " + statement.statement_id + " finished: " + state);
+        promise->set_value(std::move(statement));
+        return true;
+    };
+    watch.on_error = [promise](std::exception_ptr error) { promise->set_exception(error); };
+    watch.deadline = internal::StatusPoller::Clock::now() + timeout;
+    watch.poll = poll;
+
+    internal::StatusPoller::shared().add(std::move(watch));
+    return future;
+}
+
+void StatementExecution::cancel_statement(const std::string& statement_id) {
+    DATABRICKS_LOG_INFO("Canceling statement " + statement_id);
+    auto response = pimpl_->http_client_->post(statement_path(statement_id) + "/cancel", "{}");
+    pimpl_->http_client_->check_response(response, "cancelStatement");
+}
+
+ExternalLink StatementExecution::get_chunk_link(const std::string& statement_id, uint64_t chunk_index) {
+    for (auto& link : fetch_chunk_links(*pimpl_->http_client_, statement_id, chunk_index)) {
+        if (link.chunk_index == chunk_index) {
+            return std::move(link);
+        }
+    }
+    throw std::runtime_error("No link returned for result chunk " + std::to_string(chunk_index) + " of statement " +
+                             statement_id);
+}
+
+ResultChunkStream StatementExecution::fetch_chunks(const StatementResponse& response, size_t max_parallel_downloads) {
+    if (response.state != StatementState::SUCCEEDED) {
+        throw std::invalid_argument("Statement " + response.statement_id + " has not succeeded (" +
+                                    statement_state_to_string(response.state) + ")");
+    }
+    if (max_parallel_downloads == 0) {
+        throw std::invalid_argument("max_parallel_downloads must be at least 1");
+    }
+    DATABRICKS_LOG_DEBUG("Streaming {} chunks ({} rows) of statement {}", response.total_chunk_count,
+                         response.total_row_count, response.statement_id);
+    return ResultChunkStream(
+        std::make_unique<ResultChunkStream::Impl>(pimpl_->http_client_, response, max_parallel_downloads));
+}
+
+ResultChunkStream StatementExecution::execute(const StatementRequest& request, std::chrono::milliseconds timeout,
+                                              size_t max_parallel_downloads) {
+    StatementResponse statement = submit(request);
+    if (!statement.is_terminal()) {
+        try {
+            statement = wait_for_statement(statement.statement_id, timeout).get();
+        } catch (const std::runtime_error&) {
+            // Don't leave the warehouse working on a result nobody will read
+            try {
+                cancel_statement(statement.statement_id);
+            } catch (const std::exception& e) {
+                DATABRICKS_LOG_WARN("Failed to cancel statement {}: {}", statement.statement_id, e.what());
+            }
+            throw;
+        }
+    }
+    if (statement.state != StatementState::SUCCEEDED) {
+        std::string message = "Statement " + statement.statement_id + " " + statement_state_to_string(statement.state);
+        if (!statement.error_message.empty()) {
+            message += ": " + statement.error_code + " " + statement.error_message;
+        }
+        DATABRICKS_LOG_ERROR(message);
+        throw std::runtime_error(message);
+    }
+    return fetch_chunks(statement, max_parallel_downloads);
+}
+
+} // namespace databricks
@@ -0,0 +1,639 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "databricks/unity_catalog/metadata_store.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace databricks {
+namespace {
+// Append-only text storage in large blocks; returned views stay valid for the arena's lifetime
+class Arena {
+public:
+    static constexpr size_t kBlockSize = 64 * 1024;
+
+    std::string_view store(std::string_view text) {
+        if (text.empty()) {
+            return {};
+        }
+        if (text.size() > kBlockSize / 4) {
+            // Large text (e.g. a view definition) gets a block of its own so it doesn't strand the current one
+            large_.push_back(std::make_unique<char[]>(text.size()));
+            bytes_ += text.size();
+            std::memcpy(large_.back().get(), text.data(), text.size());
+            return {large_.back().get(), text.size()};
+        }
+        if (blocks_.empty() || used_ + text.size() > kBlockSize) {
+            blocks_.push_back(std::make_unique<char[]>(kBlockSize));
+            bytes_ += kBlockSize;
+            used_ = 0;
+        }
+        char* out = blocks_.back().get() + used_;
+        std::memcpy(out, text.data(), text.size());
+        used_ += text.size();
+        return {out, text.size()};
+    }
+
+    size_t bytes() const { return bytes_ + (blocks_.capacity() + large_.capacity()) * sizeof(blocks_[0]); }
+
+private:
+    std::vector<std::unique_ptr<char[]>> blocks_; // The last block is the one being filled
+    std::vector<std::unique_ptr<char[]>> large_;  // One per large text
+    size_t used_ = 0;                             // Bytes used in the last block
+    size_t bytes_ = 0;
+};
+
+// Dictionary of repeated strings; id 0 is always the empty string
+class Interner {
+public:
+    Interner() { strings_.emplace_back(); }
+
+    uint32_t intern(std::string_view text) {
+        if (text.empty()) {
+            return 0;
+        }
+        auto it = ids_.find(text);
+        if (it != ids_.end()) {
+            return it->second;
+        }
+        const uint32_t id = static_cast<uint32_t>(strings_.size());
+        std::string_view stored = arena_.store(text);
+        strings_.push_back(stored);
+        ids_.emplace(stored, id);
+        return id;
+    }
+
+    // Id of text if it has been interned, without adding it
+    std::optional<uint32_t> lookup(std::string_view text) const {
+        if (text.empty()) {
+            return 0;
+        }
+        auto it = ids_.find(text);
+        return it == ids_.end() ? std::nullopt : std::optional<uint32_t>(it->second);
+    }
+
+    std::string get(uint32_t id) const { return std::string(strings_[id]); }
+
+    size_t size() const { return strings_.size() - 1; }
+
+    size_t bytes() const {
+        // Each map entry costs a node (key, value, hash and next pointer) plus its bucket
+        return arena_.bytes() + strings_.capacity() * sizeof(std::string_view) +
+               ids_.size() * (sizeof(std::string_view) + 3 * sizeof(void*)) + ids_.bucket_count() * sizeof(void*);
+    }
+
+private:
+    Arena arena_;
+    std::vector<std::string_view> strings_;
+    std::unordered_map<std::string_view, uint32_t> ids_;
+};
+
+// Slice [begin, begin + count) of one of the flat arrays
+struct Range {
+    uint32_t begin = 0;
+    uint32_t count = 0;
+};
+
+// Presence bits for optional fields
+enum : uint8_t {
+    kHasStorageRoot = 1 << 0,
+    kHasStorageLocation = 1 << 1,
+    kHasViewDefinition = 1 << 2,
+    kHasTableId = 1 << 3,
+    kHasPartitionIndex = 1 << 4,
+    kNullable = 1 << 5,
+    kErased = 1 << 6,
+};
+
+struct CatalogRecord {
+    uint32_t name;
+    uint32_t owner;
+    uint32_t metastore_id;
+    uint32_t type_text; // Kept only when type is UNKNOWN, so unrecognized types survive
+    CatalogTypeEnum type;
+    uint8_t flags;
+    uint64_t created_at;
+    uint64_t updated_at;
+    std::string_view comment;
+    std::string_view storage_root;
+    std::string_view storage_location;
+    Range properties;
+};
+
+struct SchemaRecord {
+    uint32_t name;
+    uint32_t catalog_name;
+    uint32_t owner;
+    uint32_t metastore_id;
+    uint8_t flags;
+    uint64_t created_at;
+    uint64_t updated_at;
+    std::string_view comment;
+    std::string_view storage_root;
+    std::string_view storage_location;
+    Range properties;
+};
+
+struct ColumnRecord {
+    uint32_t name;
+    uint32_t type_text;
+    uint32_t type_name;
+    uint32_t partition_index;
+    int32_t position;
+    uint8_t flags;
+    std::string_view comment;
+};
+
+struct TableRecord {
+    uint32_t catalog_name;
+    uint32_t schema_name;
+    uint32_t owner;
+    uint32_t metastore_id;
+    uint32_t data_source_format;
+    uint32_t type_text; // Kept only when type is UNKNOWN
+    TableTypeEnum type;
+    uint8_t flags;
+    uint64_t created_at;
+    uint64_t updated_at;
+    uint64_t table_id;
+    std::string_view name;
+    std::string_view comment;
+    std::string_view storage_location;
+    std::string_view view_definition;
+    Range properties;
+    Range columns;
+};
+
+struct TableKey {
+    uint32_t catalog_name;
+    uint32_t schema_name;
+    std::string_view name;
+
+    bool operator==(const TableKey& other) const {
+        return catalog_name == other.catalog_name && schema_name == other.schema_name && name == other.name;
+    }
+};
+
+struct TableKeyHash {
+    size_t operator()(const TableKey& key) const {
+        size_t h = std::hash<std::string_view>()(key.name);
+        size_t parent = std::hash<uint64_t>()(static_cast<uint64_t>(key.catalog_name) << 32 | key.schema_name);
+        return h ^ (parent + 0x9e3779b9 + (h << 6) + (h >> 2));
+    }
+};
+
+uint64_t schema_key(uint32_t catalog_name, uint32_t schema_name) {
+    return static_cast<uint64_t>(catalog_name) << 32 | schema_name;
+}
+
+// Split a dotted full name into at most `parts` pieces; the last piece keeps any further dots
+std::vector<std::string_view> split_name(std::string_view full_name, size_t parts) {
+    std::vector<std::string_view> pieces;
+    while (pieces.size() + 1 < parts) {
+        size_t dot = full_name.find('.');
+        if (dot == std::string_view::npos) {
+            break;
+        }
+        pieces.push_back(full_name.substr(0, dot));
+        full_name.remove_prefix(dot + 1);
+    }
+    pieces.push_back(full_name);
+    return pieces;
+}
+
+std::optional<std::string> optional_text(uint8_t flags, uint8_t bit, std::string_view text) {
+    return flags & bit ? std::optional<std::string>(std::string(text)) : std::nullopt;
+}
+} // namespace
+
+// ==================== PIMPL IMPLEMENTATION ====================
+
+class MetadataStore::Impl {
+public:
+    // Everything compact() rebuilds; not synchronized
+    struct Data {
+        Interner strings;
+        Arena text;
+        std::vector<std::pair<uint32_t, uint32_t>> properties; // Interned key/value pairs, sorted by key per record
+        std::vector<ColumnRecord> columns;
+        std::vector<CatalogRecord> catalogs;
+        std::vector<SchemaRecord> schemas;
+        std::vector<TableRecord> tables;
+        std::vector<uint32_t> free_tables; // Erased slots in tables, reused by add()
+        std::unordered_map<uint32_t, uint32_t> catalog_index;
+        std::unordered_map<uint64_t, uint32_t> schema_index;
+        std::unordered_map<TableKey, uint32_t, TableKeyHash> table_index;
+        size_t dead_slots = 0; // Column and property slots no longer referenced by a record
+
+        std::string_view store_optional(const std::optional<std::string>& text, uint8_t bit, uint8_t& flags) {
+            if (!text) {
+                return {};
+            }
+            flags |= bit;
+            return this->text.store(*text);
+        }
+
+        Range add_properties(const std::map<std::string, std::string>& map) {
+            // std::map iterates in key order, so the slice is already sorted
+            Range range{static_cast<uint32_t>(properties.size()), static_cast<uint32_t>(map.size())};
+            for (const auto& entry : map) {
+                properties.emplace_back(strings.intern(entry.first), strings.intern(entry.second));
+            }
+            return range;
+        }
+
+        std::map<std::string, std::string> get_properties(Range range) const {
+            std::map<std::string, std::string> map;
+            for (uint32_t i = range.begin; i < range.begin + range.count; ++i) {
+                map.emplace_hint(map.end(), strings.get(properties[i].first), strings.get(properties[i].second));
+            }
+            return map;
+        }
+
+        void add(const CatalogInfo& catalog) {
+            CatalogRecord record{};
+            record.name = strings.intern(catalog.name);
+            record.owner = strings.intern(catalog.owner);
+            record.metastore_id = strings.intern(catalog.metastore_id);
+            record.type = parse_catalog_type(catalog.catalog_type);
+            record.type_text = record.type == CatalogTypeEnum::UNKNOWN ? strings.intern(catalog.catalog_type) : 0;
+            record.created_at = catalog.created_at;
+            record.updated_at = catalog.updated_at;
+            record.comment = text.store(catalog.comment);
+            record.storage_root = store_optional(catalog.storage_root, kHasStorageRoot, record.flags);
+            record.storage_location = store_optional(catalog.storage_location, kHasStorageLocation, record.flags);
+            record.properties = add_properties(catalog.properties);
+
+            auto inserted = catalog_index.emplace(record.name, static_cast<uint32_t>(catalogs.size()));
+            if (inserted.second) {
+                catalogs.push_back(record);
+            } else {
+                dead_slots += catalogs[inserted.first->second].properties.count;
+                catalogs[inserted.first->second] = record;
+            }
+        }
+
+        void add(const SchemaInfo& schema) {
+            std::string_view catalog_name = schema.catalog_name;
+            if (catalog_name.empty()) {
+                auto parts = split_name(schema.full_name, 2);
+                catalog_name = parts.size() == 2 ? parts[0] : std::string_view();
+            }
+            SchemaRecord record{};
+            record.name = strings.intern(schema.name);
+            record.catalog_name = strings.intern(catalog_name);
+            record.owner = strings.intern(schema.owner);
+            record.metastore_id = strings.intern(schema.metastore_id);
+            record.created_at = schema.created_at;
+            record.updated_at = schema.updated_at;
+            record.comment = text.store(schema.comment);
+            record.storage_root = store_optional(schema.storage_root, kHasStorageRoot, record.flags);
+            record.storage_location = store_optional(schema.storage_location, kHasStorageLocation, record.flags);
+            record.properties = add_properties(schema.properties);
+
+            auto key = schema_key(record.catalog_name, record.name);
+            auto inserted = schema_index.emplace(key, static_cast<uint32_t>(schemas.size()));
+            if (inserted.second) {
+                schemas.push_back(record);
+            } else {
+                dead_slots += schemas[inserted.first->second].properties.count;
+                schemas[inserted.first->second] = record;
+            }
+        }
+
+        void add(const TableInfo& table) {
+            std::string_view catalog_name = table.catalog_name;
+            std::string_view schema_name = table.schema_name;
+            if (catalog_name.empty() || schema_name.empty()) {
+                auto parts = split_name(table.full_name, 3);
+                if (parts.size() == 3) {
+                    catalog_name = parts[0];
+                    schema_name = parts[1];
+                }
+            }
+            TableRecord record{};
+            record.catalog_name = strings.intern(catalog_name);
+            record.schema_name = strings.intern(schema_name);
+            record.owner = strings.intern(table.owner);
+            record.metastore_id = strings.intern(table.metastore_id);
+            record.data_source_format = strings.intern(table.data_source_format);
+            record.type = parse_table_type(table.table_type);
+            record.type_text = record.type == TableTypeEnum::UNKNOWN ? strings.intern(table.table_type) : 0;
+            record.created_at = table.created_at;
+            record.updated_at = table.updated_at;
+            if (table.table_id) {
+                record.flags |= kHasTableId;
+                record.table_id = *table.table_id;
+            }
+            record.comment = text.store(table.comment);
+            record.storage_location = store_optional(table.storage_location, kHasStorageLocation, record.flags);
+            record.view_definition = store_optional(table.view_definition, kHasViewDefinition, record.flags);
+            record.properties = add_properties(table.properties);
+            record.columns = {static_cast<uint32_t>(columns.size()), static_cast<uint32_t>(table.columns.size())};
+            for (const ColumnInfo& column : table.columns) {
+                ColumnRecord slot{};
+                slot.name = strings.intern(column.name);
+                slot.type_text = strings.intern(column.type_text);
+                slot.type_name = strings.intern(column.type_name);
+                slot.position = column.position;
+                slot.flags = column.nullable ? kNullable : 0;
+                if (column.partition_index) {
+                    slot.flags |= kHasPartitionIndex;
+                    slot.partition_index = strings.intern(*column.partition_index);
+                }
+                slot.comment = text.store(column.comment);
+                columns.push_back(slot);
+            }
+
+            TableKey key{record.catalog_name, record.schema_name, table.name};
+            auto existing = table_index.find(key);
+            if (existing != table_index.end()) {
+                TableRecord& old = tables[existing->second];
+                dead_slots += old.properties.count + old.columns.count;
+                record.name = old.name;
+                old = record;
+                return;
+            }
+            record.name = text.store(table.name);
+            key.name = record.name;
+            uint32_t slot;
+            if (!free_tables.empty()) {
+                slot = free_tables.back();
+                free_tables.pop_back();
+                tables[slot] = record;
+            } else {
+                slot = static_cast<uint32_t>(tables.size());
+                tables.push_back(record);
+            }
+            table_index.emplace(key, slot);
+        }
+
+        bool erase_table(const std::string& full_name) {
+            auto key = table_key(full_name);
+            auto it = key ? table_index.find(*key) : table_index.end();
+            if (it == table_index.end()) {
+                return false;
+            }
+            TableRecord& record = tables[it->second];
+            dead_slots += record.properties.count + record.columns.count;
+            record = TableRecord{};
+            record.flags = kErased;
+            free_tables.push_back(it->second);
+            table_index.erase(it);
+            return true;
+        }
+
+        // Index key for a full name, or nullopt if no held table can have it
+        std::optional<TableKey> table_key(const std::string& full_name) const {
+            auto parts = split_name(full_name, 3);
+            if (parts.size() != 3) {
+                return std::nullopt;
+            }
+            auto catalog_name = strings.lookup(parts[0]);
+            auto schema_name = strings.lookup(parts[1]);
+            if (!catalog_name || !schema_name) {
+                return std::nullopt;
+            }
+            return TableKey{*catalog_name, *schema_name, parts[2]};
+        }
+
+        CatalogInfo catalog_info(const CatalogRecord& record) const {
+            CatalogInfo catalog;
+            catalog.name = strings.get(record.name);
+            catalog.full_name = catalog.name;
+            catalog.comment = std::string(record.comment);
+            catalog.owner = strings.get(record.owner);
+            catalog.catalog_type = record.type == CatalogTypeEnum::UNKNOWN ? strings.get(record.type_text)
+                                                                           : catalog_type_to_string(record.type);
+            catalog.created_at = record.created_at;
+            catalog.updated_at = record.updated_at;
+            catalog.metastore_id = strings.get(record.metastore_id);
+            catalog.properties = get_properties(record.properties);
+            catalog.storage_root = optional_text(record.flags, kHasStorageRoot, record.storage_root);
+            catalog.storage_location = optional_text(record.flags, kHasStorageLocation, record.storage_location);
+            return catalog;
+        }
+
+        SchemaInfo schema_info(const SchemaRecord& record) const {
+            SchemaInfo schema;
+            schema.name = strings.get(record.name);
+            schema.catalog_name = strings.get(record.catalog_name);
+            schema.full_name = schema.catalog_name + "." + schema.name;
+            schema.comment = std::string(record.comment);
+            schema.owner = strings.get(record.owner);
+            schema.created_at = record.created_at;
+            schema.updated_at = record.updated_at;
+            schema.metastore_id = strings.get(record.metastore_id);
+            schema.properties = get_properties(record.properties);
+            schema.storage_root = optional_text(record.flags, kHasStorageRoot, record.storage_root);
+            schema.storage_location = optional_text(record.flags, kHasStorageLocation, record.storage_location);
+            return schema;
+        }
+
+        TableInfo table_info(const TableRecord& record) const {
+            TableInfo table;
+            table.name = std::string(record.name);
+            table.catalog_name = strings.get(record.catalog_name);
+            table.schema_name = strings.get(record.schema_name);
+            table.full_name = table.catalog_name + "." + table.schema_name + "." + table.name;
+            table.table_type = record.type == TableTypeEnum::UNKNOWN ? strings.get(record.type_text)
+                                                                     : table_type_to_string(record.type);
+            table.data_source_format = strings.get(record.data_source_format);
+            table.comment = std::string(record.comment);
+            table.owner = strings.get(record.owner);
+            table.created_at = record.created_at;
+            table.updated_at = record.updated_at;
+            table.metastore_id = strings.get(record.metastore_id);
+            table.storage_location = optional_text(record.flags, kHasStorageLocation, record.storage_location);
+            table.properties = get_properties(record.properties);
+            table.view_definition = optional_text(record.flags, kHasViewDefinition, record.view_definition);
+            if (record.flags & kHasTableId) {
+                table.table_id = record.table_id;
+            }
+            table.columns.reserve(record.columns.count);
+            for (uint32_t i = record.columns.begin; i < record.columns.begin + record.columns.count; ++i) {
+                const ColumnRecord& slot = columns[i];
+                ColumnInfo column;
+                column.name = strings.get(slot.name);
+                column.type_text = strings.get(slot.type_text);
+                column.type_name = strings.get(slot.type_name);
+                column.position = slot.position;
+                column.comment = std::string(slot.comment);
+                column.nullable = (slot.flags & kNullable) != 0;
+                if (slot.flags & kHasPartitionIndex) {
+                    column.partition_index = strings.get(slot.partition_index);
+                }
+                table.columns.push_back(std::move(column));
+            }
+            return table;
+        }
+
+        // Copy every live record into a fresh Data, dropping dead slots, text and strings
+        Data compacted() const {
+            Data fresh;
+            for (const CatalogRecord& record : catalogs) {
+                fresh.add(catalog_info(record));
+            }
+            for (const SchemaRecord& record : schemas) {
+                fresh.add(schema_info(record));
+            }
+            for (const TableRecord& record : tables) {
+                if (!(record.flags & kErased)) {
+                    fresh.add(table_info(record));
+                }
+            }
+            return fresh;
+        }
+
+        void compact_if_wasteful() {
+            // Also bounds the text and strings left behind, which are freed at the same time
+            const size_t slots = properties.size() + columns.size();
+            if (dead_slots > 4096 && dead_slots * 2 > slots) {
+                *this = compacted();
+            }
+        }
+    };
+
+    mutable std::shared_mutex mutex_;
+    Data data_;
+};
+
+// ==================== CONSTRUCTORS & DESTRUCTOR ====================
+
+MetadataStore::MetadataStore()
+    : pimpl_(std::make_unique<Impl>()) {}
+
+MetadataStore::~MetadataStore() = default;
+
+MetadataStore::MetadataStore(MetadataStore&&) noexcept = default;
+
+MetadataStore& MetadataStore::operator=(MetadataStore&&) noexcept = default;
+
+// ==================== WRITES ====================
+
+void MetadataStore::add(const CatalogInfo& catalog) {
+    std::unique_lock<std::shared_mutex> lock(pimpl_->mutex_);
+    pimpl_->data_.add(catalog);
+    pimpl_->data_.compact_if_wasteful();
+}
+
+void MetadataStore::add(const SchemaInfo& schema) {
+    std::unique_lock<std::shared_mutex> lock(pimpl_->mutex_);
+    pimpl_->data_.add(schema);
+    pimpl_->data_.compact_if_wasteful();
+}
+
+void MetadataStore::add(const TableInfo& table) {
+    std::unique_lock<std::shared_mutex> lock(pimpl_->mutex_);
+    pimpl_->data_.add(table);
+    pimpl_->data_.compact_if_wasteful();
+}
+
+bool MetadataStore::erase_table(const std::string& full_name) {
+    std::unique_lock<std::shared_mutex> lock(pimpl_->mutex_);
+    bool erased = pimpl_->data_.erase_table(full_name);
+    pimpl_->data_.compact_if_wasteful();
+    return erased;
+}
+
+void MetadataStore::compact() {
+    std::unique_lock<std::shared_mutex> lock(pimpl_->mutex_);
+    pimpl_->data_ = pimpl_->data_.compacted();
+}
+
+// ==================== LOOKUPS ====================
+
+std::optional<CatalogInfo> MetadataStore::find_catalog(const std::string& name) const {
+    std::shared_lock<std::shared_mutex> lock(pimpl_->mutex_);
+    const auto& data = pimpl_->data_;
+    auto id = data.strings.lookup(name);
+    auto it = id ? data.catalog_index.find(*id) : data.catalog_index.end();
+    if (it == data.catalog_index.end()) {
+        return std::nullopt;
+    }
+    return data.catalog_info(data.catalogs[it->second]);
+}
+
+std::optional<SchemaInfo> MetadataStore::find_schema(const std::string& full_name) const {
+    std::shared_lock<std::shared_mutex> lock(pimpl_->mutex_);
+    const auto& data = pimpl_->data_;
+    auto parts = split_name(full_name, 2);
+    if (parts.size() != 2) {
+        return std::nullopt;
+    }
+    auto catalog_name = data.strings.lookup(parts[0]);
+    auto schema_name = data.strings.lookup(parts[1]);
+    if (!catalog_name || !schema_name) {
+        return std::nullopt;
+    }
+    auto it = data.schema_index.find(schema_key(*catalog_name, *schema_name));
+    if (it == data.schema_index.end()) {
+        return std::nullopt;
+    }
+    return data.schema_info(data.schemas[it->second]);
+}
+
+std::optional<TableInfo> MetadataStore::find_table(const std::string& full_name) const {
+    std::shared_lock<std::shared_mutex> lock(pimpl_->mutex_);
+    const auto& data = pimpl_->data_;
+    auto key = data.table_key(full_name);
+    auto it = key ? data.table_index.find(*key) : data.table_index.end();
+    if (it == data.table_index.end()) {
+        return std::nullopt;
+    }
+    return data.table_info(data.tables[it->second]);
+}
+
+void MetadataStore::for_each_table(const std::function<void(const TableInfo&)>& visit) const {
+    std::shared_lock<std::shared_mutex> lock(pimpl_->mutex_);
+    const auto& data = pimpl_->data_;
+    for (const TableRecord& record : data.tables) {
+        if (!(record.flags & kErased)) {
+            visit(data.table_info(record));
+        }
+    }
+}
+
+size_t MetadataStore::table_count() const {
+    std::shared_lock<std::shared_mutex> lock(pimpl_->mutex_);
+    return pimpl_->data_.table_index.size();
+}
+
+MetadataStoreStats MetadataStore::stats() const {
+    std::shared_lock<std::shared_mutex> lock(pimpl_->mutex_);
+    const auto& data = pimpl_->data_;
+    MetadataStoreStats stats;
+    stats.catalogs = data.catalogs.size();
+    stats.schemas = data.schemas.size();
+    stats.tables = data.table_index.size();
+    for (const TableRecord& record : data.tables) {
+        stats.columns += record.columns.count;
+    }
+    stats.distinct_strings = data.strings.size();
+
+    // Index entries cost a node (key, value, next pointer and cached hash) plus a bucket
+    auto index_bytes = [](const auto& index, size_t entry) {
+        return index.size() * (entry + 2 * sizeof(void*)) + index.bucket_count() * sizeof(void*);
+    };
+    stats.bytes = data.strings.bytes() + data.text.bytes() +
+                  data.properties.capacity() * sizeof(data.properties[0]) +
+                  data.columns.capacity() * sizeof(ColumnRecord) + data.catalogs.capacity() * sizeof(CatalogRecord) +
+                  data.schemas.capacity() * sizeof(SchemaRecord) + data.tables.capacity() * sizeof(TableRecord) +
+                  data.free_tables.capacity() * sizeof(uint32_t) +
+                  index_bytes(data.catalog_index, sizeof(std::pair<uint32_t, uint32_t>)) +
+                  index_bytes(data.schema_index, sizeof(std::pair<uint64_t, uint32_t>)) +
+                  index_bytes(data.table_index, sizeof(std::pair<TableKey, uint32_t>));
+    return stats;
+}
+
+} // namespace databricks
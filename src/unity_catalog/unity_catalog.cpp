@@ -5,6 +5,14 @@
 #include "../internal/http_client.h"
 #include "../internal/http_client_interface.h"
 #include "../internal/logger.h"
+#include "../internal/ttl_cache.h"
+
+#include <deque>
+#include <functional>
+#include <future>
+#include <set>
+#include <stdexcept>
+#include <utility>
 
 #include <nlohmann/json.hpp>
 
@@ -16,78 +24,319 @@ namespace databricks {
 class UnityCatalog::Impl {
 public:
     // Constructor for production use (creates real HttpClient with Unity Catalog API version)
-    explicit Impl(const AuthConfig& auth, const std::string& api_version = "2.1")
-        : http_client_(std::make_shared<internal::HttpClient>(auth, api_version)) {}
+    explicit Impl(const AuthConfig& auth, const std::string& api_version = "2.1",
+                  const HttpConfig& http = HttpConfig{})
+        : http_client_(std::make_shared<internal::HttpClient>(auth, api_version, http)) {}
 
     // Constructor for testing (accepts injected client)
     explicit Impl(std::shared_ptr<internal::IHttpClient> client)
         : http_client_(std::move(client)) {}
 
+    // Read-through cache for lookups, one TtlCache per result type
+    struct MetadataCache {
+        explicit MetadataCache(const MetadataCacheConfig& config)
+            : catalogs(config.max_entries, ttl(config), negative_ttl(config), config.shards)
+            , schemas(config.max_entries, ttl(config), negative_ttl(config), config.shards)
+            , tables(config.max_entries, ttl(config), negative_ttl(config), config.shards)
+            , catalog_lists(config.max_entries, ttl(config), negative_ttl(config), config.shards)
+            , schema_lists(config.max_entries, ttl(config), negative_ttl(config), config.shards)
+            , table_lists(config.max_entries, ttl(config), negative_ttl(config), config.shards) {}
+
+        static std::chrono::milliseconds ttl(const MetadataCacheConfig& config) {
+            return std::chrono::milliseconds(config.ttl_ms);
+        }
+        static std::chrono::milliseconds negative_ttl(const MetadataCacheConfig& config) {
+            return std::chrono::milliseconds(config.negative_ttl_ms);
+        }
+
+        CacheStats stats() const {
+            CacheStats total;
+            for (const CacheStats& part : {catalogs.stats(), schemas.stats(), tables.stats(), catalog_lists.stats(),
+                                           schema_lists.stats(), table_lists.stats()}) {
+                total.hits += part.hits;
+                total.negative_hits += part.negative_hits;
+                total.misses += part.misses;
+                total.coalesced += part.coalesced;
+                total.evictions += part.evictions;
+                total.entries += part.entries;
+            }
+            return total;
+        }
+
+        internal::TtlCache<CatalogInfo> catalogs;                   // Key: catalog
+        internal::TtlCache<SchemaInfo> schemas;                     // Key: catalog.schema
+        internal::TtlCache<TableInfo> tables;                       // Key: catalog.schema.table
+        internal::TtlCache<std::vector<CatalogInfo>> catalog_lists; // Key: ""
+        internal::TtlCache<std::vector<SchemaInfo>> schema_lists;   // Key: catalog
+        internal::TtlCache<std::vector<TableInfo>> table_lists;     // Key: catalog.schema
+    };
+
+    std::shared_ptr<MetadataCache> cache() const { return std::atomic_load(&cache_); }
+
+    // Like check_response(), but reports 404 as a CacheableError so lookups can cache it
+    void check_lookup(const internal::HttpResponse& response, const std::string& operation_name) const {
+        if (response.status_code == 404) {
+            std::string error_msg = "Failed to " + operation_name + ": HTTP 404 - " + response.body;
+            DATABRICKS_LOG_ERROR(error_msg);
+            throw internal::CacheableError(error_msg);
+        }
+        http_client_->check_response(response, operation_name);
+    }
+
+    // Drop cached entries a write may have changed; nested objects carry the parent's name as a prefix
+    void invalidate_catalog(const std::string& catalog_name) {
+        if (auto cached = cache()) {
+            cached->catalogs.invalidate(catalog_name);
+            cached->catalog_lists.clear();
+            cached->schemas.invalidate_prefix(catalog_name + ".");
+            cached->schema_lists.invalidate(catalog_name);
+            cached->tables.invalidate_prefix(catalog_name + ".");
+            cached->table_lists.invalidate_prefix(catalog_name + ".");
+        }
+    }
+
+    void invalidate_schema(const std::string& full_name) {
+        if (auto cached = cache()) {
+            cached->schemas.invalidate(full_name);
+            cached->schema_lists.invalidate(full_name.substr(0, full_name.rfind('.')));
+            cached->tables.invalidate_prefix(full_name + ".");
+            cached->table_lists.invalidate(full_name);
+        }
+    }
+
+    void invalidate_table(const std::string& full_name) {
+        if (auto cached = cache()) {
+            cached->tables.invalidate(full_name);
+            cached->table_lists.invalidate(full_name.substr(0, full_name.rfind('.')));
+        }
+    }
+
     std::shared_ptr<internal::IHttpClient> http_client_;
+    std::shared_ptr<MetadataCache> cache_; // Null when caching is disabled; use std::atomic_load/store
 };
 
+namespace {
+// Start of a JSON document for error messages
+std::string preview(const json& j) {
+    std::string text = j.dump();
+    return text.length() > 200 ? text.substr(0, 200) + "... (truncated)" : text;
+}
+
+// Parse a response body, reporting malformed JSON with the given message prefix
+json parse_body(const std::string& json_str, const std::string& message) {
+    try {
+        return json::parse(json_str);
+    } catch (const json::parse_error& e) {
+        std::string error = message + ": " + std::string(e.what());
+        error += "\nJSON (first 200 chars): " + json_str.substr(0, std::min(size_t(200), json_str.length()));
+        DATABRICKS_LOG_ERROR(error);
+        throw std::runtime_error(error);
+    }
+}
+
+// Token for the page after this response, or empty on the last page
+std::string next_page_token(const json& j) {
+    return j.value("next_page_token", "");
+}
+
+// Add the paging parameters to a listing endpoint that already has a query string
+std::string page_query(const std::string& endpoint, int max_results, const std::string& page_token) {
+    std::string url = endpoint;
+    char separator = endpoint.find('?') == std::string::npos ? '?' : '&';
+    if (max_results > 0) {
+        url += separator + std::string("max_results=") + std::to_string(max_results);
+        separator = '&';
+    }
+    if (!page_token.empty()) {
+        url += separator + std::string("page_token=") + internal::url_encode(page_token);
+    }
+    return url;
+}
+
+// Runs listing requests with a bounded number in flight, following each listing's page tokens.
+// Responses are handled on the calling thread in the order their requests started.
+class Crawler {
+public:
+    using PageHandler = std::function<void(const json& page)>;
+
+    Crawler(internal::IHttpClient& http, size_t window, int page_size)
+        : http_(http)
+        , window_(window)
+        , page_size_(page_size) {}
+
+    // Queue a request; paged listings are followed until the last page, each page going to on_page
+    void add(const std::string& endpoint, const std::string& operation, PageHandler on_page, bool paged = true) {
+        waiting_.push_back({endpoint, operation, "", paged, std::make_shared<PageHandler>(std::move(on_page))});
+    }
+
+    // Run until every queued request and every request queued by a handler has completed
+    void run() {
+        while (!waiting_.empty() || !in_flight_.empty()) {
+            while (in_flight_.size() < window_ && !waiting_.empty()) {
+                Request request = std::move(waiting_.front());
+                waiting_.pop_front();
+                std::string url =
+                    request.paged ? page_query(request.endpoint, page_size_, request.page_token) : request.endpoint;
+                auto response = http_.get_async(url);
+                in_flight_.emplace_back(std::move(request), std::move(response));
+            }
+
+            Request request = std::move(in_flight_.front().first);
+            auto response = in_flight_.front().second.get();
+            in_flight_.pop_front();
+            http_.check_response(response, request.operation);
+            json page = parse_body(response.body, "Malformed JSON in " + request.operation + " response");
+
+            std::string token = request.paged ? next_page_token(page) : "";
+            (*request.on_page)(page);
+            if (!token.empty()) {
+                request.page_token = std::move(token);
+                waiting_.push_back(std::move(request));
+            }
+        }
+    }
+
+private:
+    struct Request {
+        std::string endpoint;
+        std::string operation;
+        std::string page_token;
+        bool paged;
+        std::shared_ptr<PageHandler> on_page; // Shared by every page of a listing
+    };
+
+    internal::IHttpClient& http_;
+    size_t window_;
+    int page_size_;
+    std::deque<Request> waiting_;
+    std::deque<std::pair<Request, std::future<internal::HttpResponse>>> in_flight_;
+};
+} // namespace
+
 // ==================== CONSTRUCTORS & DESTRUCTOR ====================
 
 UnityCatalog::UnityCatalog(const AuthConfig& auth, const std::string& api_version)
     : pimpl_(std::make_unique<Impl>(auth, api_version)) {}
 
+UnityCatalog::UnityCatalog(const AuthConfig& auth, const HttpConfig& http, const std::string& api_version)
+    : pimpl_(std::make_unique<Impl>(auth, api_version, http)) {}
+
 UnityCatalog::UnityCatalog(std::shared_ptr<internal::IHttpClient> http_client)
     : pimpl_(std::make_unique<Impl>(std::move(http_client))) {}
 
 UnityCatalog::~UnityCatalog() = default;
 
+// ==================== METADATA CACHE ====================
+
+void UnityCatalog::set_cache_config(const MetadataCacheConfig& config) {
+    if (!config.is_valid()) {
+        throw std::invalid_argument("Invalid MetadataCacheConfig");
+    }
+    std::shared_ptr<Impl::MetadataCache> cache;
+    if (config.enabled) {
+        cache = std::make_shared<Impl::MetadataCache>(config);
+    }
+    std::atomic_store(&pimpl_->cache_, std::move(cache));
+}
+
+CacheStats UnityCatalog::cache_stats() const {
+    auto cache = pimpl_->cache();
+    return cache ? cache->stats() : CacheStats{};
+}
+
+void UnityCatalog::invalidate_cache() {
+    if (auto cache = pimpl_->cache()) {
+        cache->catalogs.clear();
+        cache->schemas.clear();
+        cache->tables.clear();
+        cache->catalog_lists.clear();
+        cache->schema_lists.clear();
+        cache->table_lists.clear();
+    }
+}
+
 // ==================== CATALOG OPERATIONS ====================
 
 std::vector<CatalogInfo> UnityCatalog::list_catalogs() {
-    internal::get_logger()->info("Listing Unity Catalog catalogs");
+    auto load = [&]() {
+        DATABRICKS_LOG_INFO("Listing Unity Catalog catalogs");
 
-    auto response = pimpl_->http_client_->get("/unity-catalog/catalogs");
-    pimpl_->http_client_->check_response(response, "listCatalogs");
+        auto response = pimpl_->http_client_->get("/unity-catalog/catalogs");
+        pimpl_->check_lookup(response, "listCatalogs");
 
-    internal::get_logger()->debug("Catalogs list response: " + response.body);
-    return parse_catalog_list(response.body);
+        DATABRICKS_LOG_DEBUG("Catalogs list response: " + response.body);
+        return parse_catalog_list(response.body);
+    };
+    if (auto cache = pimpl_->cache()) {
+        return cache->catalog_lists.get_or_load("", load);
+    }
+    return load();
+}
+
+Paginator<CatalogInfo> UnityCatalog::catalogs(int max_results) {
+    DATABRICKS_LOG_INFO("Iterating Unity Catalog catalogs");
+
+    // The fetcher holds the client, not this object, so the paginator may outlive it
+    std::shared_ptr<internal::IHttpClient> http_client = pimpl_->http_client_;
+    return Paginator<CatalogInfo>([http_client, max_results](const std::string& page_token) {
+        auto response = http_client->get(page_query("/unity-catalog/catalogs", max_results, page_token));
+        http_client->check_response(response, "listCatalogs");
+        json page = parse_body(response.body, "Malformed JSON in catalogs list");
+        return Paginator<CatalogInfo>::Page{parse_catalog_list(page), next_page_token(page)};
+    });
 }
 
 CatalogInfo UnityCatalog::get_catalog(const std::string& catalog_name) {
-    internal::get_logger()->info("Getting catalog details for catalog=" + catalog_name);
+    auto load = [&]() {
+        DATABRICKS_LOG_INFO("Getting catalog details for catalog=" + catalog_name);
 
-    auto response = pimpl_->http_client_->get("/unity-catalog/catalogs/" + catalog_name);
-    pimpl_->http_client_->check_response(response, "getCatalog");
+        auto response = pimpl_->http_client_->get("/unity-catalog/catalogs/" + catalog_name);
+        pimpl_->check_lookup(response, "getCatalog");
 
-    internal::get_logger()->debug("Catalog details response: " + response.body);
-    return parse_catalog(response.body);
+        DATABRICKS_LOG_DEBUG("Catalog details response: " + response.body);
+        return parse_catalog(response.body);
+    };
+    if (auto cache = pimpl_->cache()) {
+        return cache->catalogs.get_or_load(catalog_name, load);
+    }
+    return load();
 }
 
 CatalogInfo UnityCatalog::create_catalog(const CreateCatalogRequest& request) {
-    internal::get_logger()->info("Creating catalog: " + request.name);
+    DATABRICKS_LOG_INFO("Creating catalog: " + request.name);
 
     json body_json = request;
     std::string body = body_json.dump();
-    internal::get_logger()->debug("Create catalog request body: " + body);
+    DATABRICKS_LOG_DEBUG("Create catalog request body: " + body);
 
     auto response = pimpl_->http_client_->post("/unity-catalog/catalogs", body);
     pimpl_->http_client_->check_response(response, "createCatalog");
+    pimpl_->invalidate_catalog(request.name);
 
-    internal::get_logger()->info("Successfully created catalog: " + request.name);
+    DATABRICKS_LOG_INFO("Successfully created catalog: " + request.name);
     return parse_catalog(response.body);
 }
 
 CatalogInfo UnityCatalog::update_catalog(const UpdateCatalogRequest& request) {
-    internal::get_logger()->info("Updating catalog: " + request.name);
+    DATABRICKS_LOG_INFO("Updating catalog: " + request.name);
 
     json body_json = request;
     std::string body = body_json.dump();
-    internal::get_logger()->debug("Update catalog request body: " + body);
+    DATABRICKS_LOG_DEBUG("Update catalog request body: " + body);
 
     auto response = pimpl_->http_client_->post("/unity-catalog/catalogs/" + request.name, body);
     pimpl_->http_client_->check_response(response, "updateCatalog");
+    pimpl_->invalidate_catalog(request.name);
+    if (request.new_name) {
+        pimpl_->invalidate_catalog(*request.new_name);
+    }
 
-    internal::get_logger()->info("Successfully updated catalog: " + request.name);
+    DATABRICKS_LOG_INFO("Successfully updated catalog: " + request.name);
     return parse_catalog(response.body);
 }
 
 bool UnityCatalog::delete_catalog(const std::string& catalog_name, bool force) {
-    internal::get_logger()->info("Deleting catalog: " + catalog_name);
+    DATABRICKS_LOG_INFO("Deleting catalog: " + catalog_name);
 
     // Force Delete Endpoint
     std::string endpoint = "/api/2.1/unity-catalog/catalogs/" + catalog_name;
@@ -95,114 +344,301 @@ bool UnityCatalog::delete_catalog(const std::string& catalog_name, bool force) {
         endpoint += "?force=true";
     }
 
-    internal::get_logger()->debug("Delete catalog endpoint: " + endpoint);
+    DATABRICKS_LOG_DEBUG("Delete catalog endpoint: " + endpoint);
 
     auto response = pimpl_->http_client_->post(endpoint, "");
     pimpl_->http_client_->check_response(response, "deleteCatalog");
+    pimpl_->invalidate_catalog(catalog_name);
 
-    internal::get_logger()->info("Successfully deleted catalog: " + catalog_name);
+    DATABRICKS_LOG_INFO("Successfully deleted catalog: " + catalog_name);
     return true;
 }
 
 // ==================== SCHEMA OPERATIONS ====================
 
 std::vector<SchemaInfo> UnityCatalog::list_schemas(const std::string& catalog_name) {
-    internal::get_logger()->info("Listing schemas in catalog: " + catalog_name);
+    auto load = [&]() {
+        DATABRICKS_LOG_INFO("Listing schemas in catalog: " + catalog_name);
 
-    auto response = pimpl_->http_client_->get("/unity-catalog/schemas?catalog_name=" + catalog_name);
-    pimpl_->http_client_->check_response(response, "listSchemas");
+        auto response = pimpl_->http_client_->get("/unity-catalog/schemas?catalog_name=" + catalog_name);
+        pimpl_->check_lookup(response, "listSchemas");
 
-    internal::get_logger()->debug("Schemas list response: " + response.body);
-    return parse_schema_list(response.body);
+        DATABRICKS_LOG_DEBUG("Schemas list response: " + response.body);
+        return parse_schema_list(response.body);
+    };
+    if (auto cache = pimpl_->cache()) {
+        return cache->schema_lists.get_or_load(catalog_name, load);
+    }
+    return load();
+}
+
+Paginator<SchemaInfo> UnityCatalog::schemas(const std::string& catalog_name, int max_results) {
+    DATABRICKS_LOG_INFO("Iterating schemas in catalog: " + catalog_name);
+
+    std::shared_ptr<internal::IHttpClient> http_client = pimpl_->http_client_;
+    std::string endpoint = "/unity-catalog/schemas?catalog_name=" + catalog_name;
+    return Paginator<SchemaInfo>([http_client, endpoint, max_results](const std::string& page_token) {
+        auto response = http_client->get(page_query(endpoint, max_results, page_token));
+        http_client->check_response(response, "listSchemas");
+        json page = parse_body(response.body, "Malformed JSON in schemas list");
+        return Paginator<SchemaInfo>::Page{parse_schema_list(page), next_page_token(page)};
+    });
 }
 
 SchemaInfo UnityCatalog::get_schema(const std::string& full_name) {
-    internal::get_logger()->info("Getting schema details for: " + full_name);
+    auto load = [&]() {
+        DATABRICKS_LOG_INFO("Getting schema details for: " + full_name);
 
-    auto response = pimpl_->http_client_->get("/unity-catalog/schemas/" + full_name);
-    pimpl_->http_client_->check_response(response, "getSchema");
+        auto response = pimpl_->http_client_->get("/unity-catalog/schemas/" + full_name);
+        pimpl_->check_lookup(response, "getSchema");
 
-    internal::get_logger()->debug("Schema details response: " + response.body);
-    return parse_schema(response.body);
+        DATABRICKS_LOG_DEBUG("Schema details response: " + response.body);
+        return parse_schema(response.body);
+    };
+    if (auto cache = pimpl_->cache()) {
+        return cache->schemas.get_or_load(full_name, load);
+    }
+    return load();
 }
 
 SchemaInfo UnityCatalog::create_schema(const CreateSchemaRequest& request) {
-    internal::get_logger()->info("Creating schema: " + request.catalog_name + "." + request.name);
+    DATABRICKS_LOG_INFO("Creating schema: " + request.catalog_name + "." + request.name);
 
     json body_json = request;
     std::string body = body_json.dump();
-    internal::get_logger()->debug("Create schema request body: " + body);
+    DATABRICKS_LOG_DEBUG("Create schema request body: " + body);
 
     auto response = pimpl_->http_client_->post("/unity-catalog/schemas", body);
     pimpl_->http_client_->check_response(response, "createSchema");
+    pimpl_->invalidate_schema(request.catalog_name + "." + request.name);
 
-    internal::get_logger()->info("Successfully created schema: " + request.catalog_name + "." + request.name);
+    DATABRICKS_LOG_INFO("Successfully created schema: " + request.catalog_name + "." + request.name);
     return parse_schema(response.body);
 }
 
 SchemaInfo UnityCatalog::update_schema(const UpdateSchemaRequest& request) {
-    internal::get_logger()->info("Updating schema: " + request.full_name);
+    DATABRICKS_LOG_INFO("Updating schema: " + request.full_name);
 
     json body_json = request;
     std::string body = body_json.dump();
-    internal::get_logger()->debug("Update schema request body: " + body);
+    DATABRICKS_LOG_DEBUG("Update schema request body: " + body);
 
     auto response = pimpl_->http_client_->post("/unity-catalog/schemas/" + request.full_name, body);
     pimpl_->http_client_->check_response(response, "updateSchema");
+    pimpl_->invalidate_schema(request.full_name);
+    if (request.new_name) {
+        pimpl_->invalidate_schema(request.full_name.substr(0, request.full_name.rfind('.') + 1) + *request.new_name);
+    }
 
-    internal::get_logger()->info("Successfully updated schema: " + request.full_name);
+    DATABRICKS_LOG_INFO("Successfully updated schema: " + request.full_name);
     return parse_schema(response.body);
 }
 
 bool UnityCatalog::delete_schema(const std::string& full_name) {
-    internal::get_logger()->info("Deleting schema: " + full_name);
+    DATABRICKS_LOG_INFO("Deleting schema: " + full_name);
 
     auto response = pimpl_->http_client_->post("/unity-catalog/schemas/" + full_name, "");
     pimpl_->http_client_->check_response(response, "deleteSchema");
+    pimpl_->invalidate_schema(full_name);
 
-    internal::get_logger()->info("Successfully deleted schema: " + full_name);
+    DATABRICKS_LOG_INFO("Successfully deleted schema: " + full_name);
     return true;
 }
 
 // ==================== TABLE OPERATIONS ====================
 
 std::vector<TableInfo> UnityCatalog::list_tables(const std::string& catalog_name, const std::string& schema_name) {
-    internal::get_logger()->info("Listing tables in " + catalog_name + "." + schema_name);
+    auto load = [&]() {
+        DATABRICKS_LOG_INFO("Listing tables in " + catalog_name + "." + schema_name);
+
+        // Create Endpoint with Catalog and Schema name
+        std::string endpoint = "/unity-catalog/tables?catalog_name=" + catalog_name + "&schema_name=" + schema_name;
+        auto response = pimpl_->http_client_->get(endpoint);
+        pimpl_->check_lookup(response, "listTables");
+
+        DATABRICKS_LOG_DEBUG("Tables list response: " + response.body);
+        return parse_table_list(response.body);
+    };
+    if (auto cache = pimpl_->cache()) {
+        return cache->table_lists.get_or_load(catalog_name + "." + schema_name, load);
+    }
+    return load();
+}
 
-    // Create Endpoint with Catalog and Schema name
-    std::string endpoint = "/unity-catalog/tables?catalog_name=" + catalog_name + "&schema_name=" + schema_name;
-    auto response = pimpl_->http_client_->get(endpoint);
-    pimpl_->http_client_->check_response(response, "listTables");
+Paginator<TableInfo> UnityCatalog::tables(const std::string& catalog_name, const std::string& schema_name,
+                                          int max_results) {
+    DATABRICKS_LOG_INFO("Iterating tables in " + catalog_name + "." + schema_name);
 
-    internal::get_logger()->debug("Tables list response: " + response.body);
-    return parse_table_list(response.body);
+    std::shared_ptr<internal::IHttpClient> http_client = pimpl_->http_client_;
+    std::string endpoint = "/unity-catalog/tables?catalog_name=" + catalog_name + "&schema_name=" + schema_name;
+    return Paginator<TableInfo>([http_client, endpoint, max_results](const std::string& page_token) {
+        auto response = http_client->get(page_query(endpoint, max_results, page_token));
+        http_client->check_response(response, "listTables");
+        json page = parse_body(response.body, "Malformed JSON in tables list");
+        return Paginator<TableInfo>::Page{parse_table_list(page), next_page_token(page)};
+    });
 }
 
 TableInfo UnityCatalog::get_table(const std::string& full_name) {
-    internal::get_logger()->info("Getting table details for: " + full_name);
+    auto load = [&]() {
+        DATABRICKS_LOG_INFO("Getting table details for: " + full_name);
+
+        auto response = pimpl_->http_client_->get("/unity-catalog/tables/" + full_name);
+        pimpl_->check_lookup(response, "getTable");
+
+        DATABRICKS_LOG_DEBUG("Table details response: " + response.body);
+        return parse_table(response.body);
+    };
+    if (auto cache = pimpl_->cache()) {
+        return cache->tables.get_or_load(full_name, load);
+    }
+    return load();
+}
+
+#ifdef DATABRICKS_ENABLE_COROUTINES
+Awaitable<TableInfo> UnityCatalog::co_get_table(const std::string& full_name) {
+    return Awaitable<TableInfo>([this, full_name](Awaitable<TableInfo>::Completion done) {
+        auto cache = pimpl_->cache();
+        if (cache) {
+            if (auto cached = cache->tables.find(full_name)) {
+                done.set_value(std::move(*cached));
+                return;
+            }
+        }
+        DATABRICKS_LOG_INFO("Getting table details for: " + full_name);
+        pimpl_->http_client_->get_async(
+            "/unity-catalog/tables/" + full_name,
+            [this, full_name, cache, done](std::exception_ptr error, internal::HttpResponse&& response) mutable {
+                TableInfo table;
+                if (!error) {
+                    try {
+                        pimpl_->check_lookup(response, "getTable");
+                        table = parse_table(response.body);
+                        if (cache) {
+                            cache->tables.get_or_load(full_name, [&]() { return table; });
+                        }
+                    } catch (...) {
+                        error = std::current_exception();
+                    }
+                }
+                // Outside the try: completing may resume the coroutine on this thread
+                if (error) {
+                    done.set_error(error);
+                } else {
+                    done.set_value(std::move(table));
+                }
+            });
+    });
+}
+#endif
+
+std::vector<TableInfo> UnityCatalog::get_tables(const std::vector<std::string>& full_names) {
+    DATABRICKS_LOG_INFO("Getting table details for " + std::to_string(full_names.size()) + " tables");
 
-    auto response = pimpl_->http_client_->get("/unity-catalog/tables/" + full_name);
-    pimpl_->http_client_->check_response(response, "getTable");
+    // Start every request before waiting on any of them
+    std::vector<std::future<internal::HttpResponse>> responses;
+    responses.reserve(full_names.size());
+    for (const auto& full_name : full_names) {
+        responses.push_back(pimpl_->http_client_->get_async("/unity-catalog/tables/" + full_name));
+    }
 
-    internal::get_logger()->debug("Table details response: " + response.body);
-    return parse_table(response.body);
+    std::vector<TableInfo> tables;
+    tables.reserve(full_names.size());
+    for (auto& pending : responses) {
+        auto response = pending.get();
+        pimpl_->http_client_->check_response(response, "getTable");
+        tables.push_back(parse_table(response.body));
+    }
+    return tables;
 }
 
 bool UnityCatalog::delete_table(const std::string& full_name) {
-    internal::get_logger()->info("Deleting table: " + full_name);
+    DATABRICKS_LOG_INFO("Deleting table: " + full_name);
 
     auto response = pimpl_->http_client_->post("/unity-catalog/tables/" + full_name, "");
     pimpl_->http_client_->check_response(response, "deleteTable");
+    pimpl_->invalidate_table(full_name);
 
-    internal::get_logger()->info("Successfully deleted table: " + full_name);
+    DATABRICKS_LOG_INFO("Successfully deleted table: " + full_name);
     return true;
 }
 
+// ==================== METASTORE SNAPSHOT ====================
+
+MetastoreSnapshot UnityCatalog::snapshot(const std::function<void(const TableInfo&)>& on_table,
+                                         const SnapshotOptions& options) {
+    if (options.max_concurrent_requests == 0) {
+        throw std::invalid_argument("max_concurrent_requests must be positive");
+    }
+    if (options.page_size < 0) {
+        throw std::invalid_argument("page_size must not be negative");
+    }
+    DATABRICKS_LOG_INFO("Taking metastore snapshot (" + std::to_string(options.previous_schema_versions.size()) +
+                        " previous schema versions)");
+
+    MetastoreSnapshot snapshot;
+    std::set<std::string> crawled_catalogs;
+    Crawler crawler(*pimpl_->http_client_, options.max_concurrent_requests, options.page_size);
+
+    auto on_tables = [&](const json& page) {
+        for (const TableInfo& table : parse_table_list(page)) {
+            on_table(table);
+            ++snapshot.tables;
+        }
+    };
+    auto on_schemas = [&](const std::string& catalog_name, const json& page) {
+        for (SchemaInfo& schema : parse_schema_list(page)) {
+            snapshot.schema_versions[schema.full_name] = schema.updated_at;
+            auto previous = options.previous_schema_versions.find(schema.full_name);
+            if (schema.updated_at != 0 && previous != options.previous_schema_versions.end() &&
+                previous->second == schema.updated_at) {
+                snapshot.unchanged_schemas.push_back(schema.full_name);
+            } else {
+                crawler.add("/unity-catalog/tables?catalog_name=" + catalog_name + "&schema_name=" + schema.name,
+                            "listTables", on_tables);
+            }
+            snapshot.schemas.push_back(std::move(schema));
+        }
+    };
+    auto add_catalog = [&](CatalogInfo catalog) {
+        crawled_catalogs.insert(catalog.name);
+        crawler.add("/unity-catalog/schemas?catalog_name=" + catalog.name, "listSchemas",
+                    [&on_schemas, catalog_name = catalog.name](const json& page) { on_schemas(catalog_name, page); });
+        snapshot.catalogs.push_back(std::move(catalog));
+    };
+
+    if (options.catalogs.empty()) {
+        crawler.add("/unity-catalog/catalogs", "listCatalogs", [&](const json& page) {
+            for (CatalogInfo& catalog : parse_catalog_list(page)) {
+                add_catalog(std::move(catalog));
+            }
+        });
+    } else {
+        for (const auto& name : options.catalogs) {
+            crawler.add(
+                "/unity-catalog/catalogs/" + name, "getCatalog",
+                [&](const json& page) { add_catalog(parse_catalog(page)); }, false);
+        }
+    }
+    crawler.run();
+
+    for (const auto& previous : options.previous_schema_versions) {
+        const std::string catalog_name = previous.first.substr(0, previous.first.find('.'));
+        if (crawled_catalogs.count(catalog_name) && !snapshot.schema_versions.count(previous.first)) {
+            snapshot.removed_schemas.push_back(previous.first);
+        }
+    }
+
+    DATABRICKS_LOG_INFO("Snapshot found " + std::to_string(snapshot.schemas.size()) + " schemas (" +
+                        std::to_string(snapshot.unchanged_schemas.size()) + " unchanged), streamed " +
+                        std::to_string(snapshot.tables) + " tables");
+    return snapshot;
+}
+
 // ==================== PRIVATE PARSING METHODS ====================
 
-CatalogInfo UnityCatalog::parse_catalog(const std::string& json_str) {
+CatalogInfo UnityCatalog::parse_catalog(const json& j) {
     try {
-        auto j = json::parse(json_str);
         CatalogInfo catalog;
 
         // Validate required fields BEFORE accessing
@@ -220,10 +656,10 @@ CatalogInfo UnityCatalog::parse_catalog(const std::string& json_str) {
             }
 
             // Include truncated JSON for debugging
-            std::string json_preview = json_str.length() > 200 ? json_str.substr(0, 200) + "... (truncated)" : json_str;
+            std::string json_preview = preview(j);
             error += "\nJSON received: " + json_preview;
 
-            internal::get_logger()->error(error);
+            DATABRICKS_LOG_ERROR(error);
             throw std::runtime_error(error);
         }
 
@@ -242,8 +678,7 @@ CatalogInfo UnityCatalog::parse_catalog(const std::string& json_str) {
                 if (value.is_string()) {
                     catalog.properties[key] = value.get<std::string>();
                 } else {
-                    internal::get_logger()->warn("Skipping non-string property '{}' in catalog '{}'", key,
-                                                 catalog.name);
+                    DATABRICKS_LOG_WARN("Skipping non-string property '{}' in catalog '{}'", key, catalog.name);
                 }
             }
         }
@@ -258,67 +693,62 @@ CatalogInfo UnityCatalog::parse_catalog(const std::string& json_str) {
         }
 
         return catalog;
-    } catch (const json::parse_error& e) {
-        // JSON is malformed
-        std::string error = "Malformed JSON for Catalog: " + std::string(e.what());
-        error += "\nJSON (first 200 chars): " + json_str.substr(0, std::min(size_t(200), json_str.length()));
-        internal::get_logger()->error(error);
-        throw std::runtime_error(error);
     } catch (const json::type_error& e) {
         // Field has wrong type
         std::string error = "Type error in Catalog JSON: " + std::string(e.what());
         error += "\nThis usually means a field has unexpected type (e.g., string instead of number)";
-        error += "\nJSON (first 200 chars): " + json_str.substr(0, std::min(size_t(200), json_str.length()));
-        internal::get_logger()->error(error);
+        error += "\nJSON (first 200 chars): " + preview(j);
+        DATABRICKS_LOG_ERROR(error);
         throw std::runtime_error(error);
     } catch (const json::exception& e) {
         // Other JSON library errors
         std::string error = "Failed to parse Catalog JSON: " + std::string(e.what());
-        error += "\nJSON (first 200 chars): " + json_str.substr(0, std::min(size_t(200), json_str.length()));
-        internal::get_logger()->error(error);
+        error += "\nJSON (first 200 chars): " + preview(j);
+        DATABRICKS_LOG_ERROR(error);
         throw std::runtime_error(error);
     }
 }
 
-std::vector<CatalogInfo> UnityCatalog::parse_catalog_list(const std::string& json_str) {
+CatalogInfo UnityCatalog::parse_catalog(const std::string& json_str) {
+    return parse_catalog(parse_body(json_str, "Malformed JSON for Catalog"));
+}
+
+std::vector<CatalogInfo> UnityCatalog::parse_catalog_list(const json& j) {
     std::vector<CatalogInfo> catalogs;
 
     try {
-        auto j = json::parse(json_str);
 
         if (!j.contains("catalogs") || !j["catalogs"].is_array()) {
-            internal::get_logger()->warn("No catalogs array found in response");
+            DATABRICKS_LOG_WARN("No catalogs array found in response");
             return catalogs;
         }
 
         for (const auto& catalog_json : j["catalogs"]) {
             try {
-                catalogs.push_back(parse_catalog(catalog_json.dump()));
+                catalogs.push_back(parse_catalog(catalog_json));
             } catch (const std::exception& e) {
-                internal::get_logger()->error("Failed to parse individual catalog: {}", e.what());
+                DATABRICKS_LOG_ERROR("Failed to parse individual catalog: {}", e.what());
                 // Continue parsing other catalogs instead of failing completely
             }
         }
 
-        internal::get_logger()->info("Parsed {} catalogs", catalogs.size());
-    } catch (const json::parse_error& e) {
-        std::string error = "Malformed JSON in catalogs list: " + std::string(e.what());
-        error += "\nJSON (first 200 chars): " + json_str.substr(0, std::min(size_t(200), json_str.length()));
-        internal::get_logger()->error(error);
-        throw std::runtime_error(error);
+        DATABRICKS_LOG_INFO("Parsed {} catalogs", catalogs.size());
     } catch (const json::exception& e) {
         std::string error = "Failed to parse catalogs list: " + std::string(e.what());
-        error += "\nJSON (first 200 chars): " + json_str.substr(0, std::min(size_t(200), json_str.length()));
-        internal::get_logger()->error(error);
+        error += "\nJSON (first 200 chars): " + preview(j);
+        DATABRICKS_LOG_ERROR(error);
         throw std::runtime_error(error);
     }
 
     return catalogs;
 }
 
-SchemaInfo UnityCatalog::parse_schema(const std::string& json_str) {
+std::vector<CatalogInfo> UnityCatalog::parse_catalog_list(const std::string& json_str) {
+    return parse_catalog_list(parse_body(json_str, "Malformed JSON in catalogs list"));
+}
+
+SchemaInfo UnityCatalog::parse_schema(const json& j) {
     try {
-        auto j = json::parse(json_str);
         SchemaInfo schema;
 
         // Validate required fields
@@ -334,8 +764,8 @@ SchemaInfo UnityCatalog::parse_schema(const std::string& json_str) {
                 if (i < missing_fields.size() - 1)
                     error += ", ";
             }
-            error += "\nJSON received: " + json_str.substr(0, std::min(size_t(200), json_str.length()));
-            internal::get_logger()->error(error);
+            error += "\nJSON received: " + preview(j);
+            DATABRICKS_LOG_ERROR(error);
             throw std::runtime_error(error);
         }
 
@@ -367,63 +797,59 @@ SchemaInfo UnityCatalog::parse_schema(const std::string& json_str) {
         }
 
         return schema;
-    } catch (const json::parse_error& e) {
-        std::string error = "Malformed JSON for Schema: " + std::string(e.what());
-        error += "\nJSON (first 200 chars): " + json_str.substr(0, std::min(size_t(200), json_str.length()));
-        internal::get_logger()->error(error);
-        throw std::runtime_error(error);
     } catch (const json::type_error& e) {
         std::string error = "Type error in Schema JSON: " + std::string(e.what());
-        error += "\nJSON (first 200 chars): " + json_str.substr(0, std::min(size_t(200), json_str.length()));
-        internal::get_logger()->error(error);
+        error += "\nJSON (first 200 chars): " + preview(j);
+        DATABRICKS_LOG_ERROR(error);
         throw std::runtime_error(error);
     } catch (const json::exception& e) {
         std::string error = "Failed to parse Schema JSON: " + std::string(e.what());
-        error += "\nJSON (first 200 chars): " + json_str.substr(0, std::min(size_t(200), json_str.length()));
-        internal::get_logger()->error(error);
+        error += "\nJSON (first 200 chars): " + preview(j);
+        DATABRICKS_LOG_ERROR(error);
         throw std::runtime_error(error);
     }
 }
 
-std::vector<SchemaInfo> UnityCatalog::parse_schema_list(const std::string& json_str) {
+SchemaInfo UnityCatalog::parse_schema(const std::string& json_str) {
+    return parse_schema(parse_body(json_str, "Malformed JSON for Schema"));
+}
+
+std::vector<SchemaInfo> UnityCatalog::parse_schema_list(const json& j) {
     std::vector<SchemaInfo> schemas;
 
     try {
-        auto j = json::parse(json_str);
 
         if (!j.contains("schemas") || !j["schemas"].is_array()) {
-            internal::get_logger()->warn("No schemas array found in response");
+            DATABRICKS_LOG_WARN("No schemas array found in response");
             return schemas;
         }
 
         for (const auto& schema_json : j["schemas"]) {
             try {
-                schemas.push_back(parse_schema(schema_json.dump()));
+                schemas.push_back(parse_schema(schema_json));
             } catch (const std::exception& e) {
-                internal::get_logger()->error("Failed to parse individual schema: {}", e.what());
+                DATABRICKS_LOG_ERROR("Failed to parse individual schema: {}", e.what());
                 // Continue parsing other schemas
             }
         }
 
-        internal::get_logger()->info("Parsed {} schemas", schemas.size());
-    } catch (const json::parse_error& e) {
-        std::string error = "Malformed JSON in schemas list: " + std::string(e.what());
-        error += "\nJSON (first 200 chars): " + json_str.substr(0, std::min(size_t(200), json_str.length()));
-        internal::get_logger()->error(error);
-        throw std::runtime_error(error);
+        DATABRICKS_LOG_INFO("Parsed {} schemas", schemas.size());
     } catch (const json::exception& e) {
         std::string error = "Failed to parse schemas list: " + std::string(e.what());
-        error += "\nJSON (first 200 chars): " + json_str.substr(0, std::min(size_t(200), json_str.length()));
-        internal::get_logger()->error(error);
+        error += "\nJSON (first 200 chars): " + preview(j);
+        DATABRICKS_LOG_ERROR(error);
         throw std::runtime_error(error);
     }
 
     return schemas;
 }
 
-ColumnInfo UnityCatalog::parse_column(const std::string& json_str) {
+std::vector<SchemaInfo> UnityCatalog::parse_schema_list(const std::string& json_str) {
+    return parse_schema_list(parse_body(json_str, "Malformed JSON in schemas list"));
+}
+
+ColumnInfo UnityCatalog::parse_column(const json& j) {
     try {
-        auto j = json::parse(json_str);
         ColumnInfo column;
 
         column.name = j.value("name", "");
@@ -438,7 +864,7 @@ ColumnInfo UnityCatalog::parse_column(const std::string& json_str) {
                 try {
                     column.position = std::stoi(j["position"].get<std::string>());
                 } catch (const std::exception& e) {
-                    internal::get_logger()->warn("Failed to parse position for column '{}': {}", column.name, e.what());
+                    DATABRICKS_LOG_WARN("Failed to parse position for column '{}': {}", column.name, e.what());
                     column.position = 0;
                 }
             }
@@ -457,22 +883,20 @@ ColumnInfo UnityCatalog::parse_column(const std::string& json_str) {
         }
 
         return column;
-    } catch (const json::parse_error& e) {
-        std::string error = "Malformed JSON for Column: " + std::string(e.what());
-        error += "\nJSON (first 200 chars): " + json_str.substr(0, std::min(size_t(200), json_str.length()));
-        internal::get_logger()->error(error);
-        throw std::runtime_error(error);
     } catch (const json::exception& e) {
         std::string error = "Failed to parse Column JSON: " + std::string(e.what());
-        error += "\nJSON (first 200 chars): " + json_str.substr(0, std::min(size_t(200), json_str.length()));
-        internal::get_logger()->error(error);
+        error += "\nJSON (first 200 chars): " + preview(j);
+        DATABRICKS_LOG_ERROR(error);
         throw std::runtime_error(error);
     }
 }
 
-TableInfo UnityCatalog::parse_table(const std::string& json_str) {
+ColumnInfo UnityCatalog::parse_column(const std::string& json_str) {
+    return parse_column(parse_body(json_str, "Malformed JSON for Column"));
+}
+
+TableInfo UnityCatalog::parse_table(const json& j) {
     try {
-        auto j = json::parse(json_str);
         TableInfo table;
 
         // Validate required fields
@@ -488,8 +912,8 @@ TableInfo UnityCatalog::parse_table(const std::string& json_str) {
                 if (i < missing_fields.size() - 1)
                     error += ", ";
             }
-            error += "\nJSON received: " + json_str.substr(0, std::min(size_t(200), json_str.length()));
-            internal::get_logger()->error(error);
+            error += "\nJSON received: " + preview(j);
+            DATABRICKS_LOG_ERROR(error);
             throw std::runtime_error(error);
         }
 
@@ -523,9 +947,9 @@ TableInfo UnityCatalog::parse_table(const std::string& json_str) {
         if (j.contains("columns") && j["columns"].is_array()) {
             for (const auto& col_json : j["columns"]) {
                 try {
-                    table.columns.push_back(parse_column(col_json.dump()));
+                    table.columns.push_back(parse_column(col_json));
                 } catch (const std::exception& e) {
-                    internal::get_logger()->warn("Failed to parse column in table '{}': {}", table.name, e.what());
+                    DATABRICKS_LOG_WARN("Failed to parse column in table '{}': {}", table.name, e.what());
                     // Continue parsing other columns
                 }
             }
@@ -543,8 +967,8 @@ TableInfo UnityCatalog::parse_table(const std::string& json_str) {
                 try {
                     table.table_id = std::stoull(j["table_id"].get<std::string>());
                 } catch (const std::exception& e) {
-                    internal::get_logger()->warn("Failed to parse table_id as uint64_t for table '{}': {}", table.name,
-                                                 e.what());
+                    DATABRICKS_LOG_WARN("Failed to parse table_id as uint64_t for table '{}': {}", table.name,
+                                        e.what());
                 }
             } else if (j["table_id"].is_number()) {
                 table.table_id = j["table_id"].get<uint64_t>();
@@ -552,58 +976,55 @@ TableInfo UnityCatalog::parse_table(const std::string& json_str) {
         }
 
         return table;
-    } catch (const json::parse_error& e) {
-        std::string error = "Malformed JSON for Table: " + std::string(e.what());
-        error += "\nJSON (first 200 chars): " + json_str.substr(0, std::min(size_t(200), json_str.length()));
-        internal::get_logger()->error(error);
-        throw std::runtime_error(error);
     } catch (const json::type_error& e) {
         std::string error = "Type error in Table JSON: " + std::string(e.what());
-        error += "\nJSON (first 200 chars): " + json_str.substr(0, std::min(size_t(200), json_str.length()));
-        internal::get_logger()->error(error);
+        error += "\nJSON (first 200 chars): " + preview(j);
+        DATABRICKS_LOG_ERROR(error);
         throw std::runtime_error(error);
     } catch (const json::exception& e) {
         std::string error = "Failed to parse Table JSON: " + std::string(e.what());
-        error += "\nJSON (first 200 chars): " + json_str.substr(0, std::min(size_t(200), json_str.length()));
-        internal::get_logger()->error(error);
+        error += "\nJSON (first 200 chars): " + preview(j);
+        DATABRICKS_LOG_ERROR(error);
         throw std::runtime_error(error);
     }
 }
 
-std::vector<TableInfo> UnityCatalog::parse_table_list(const std::string& json_str) {
+TableInfo UnityCatalog::parse_table(const std::string& json_str) {
+    return parse_table(parse_body(json_str, "Malformed JSON for Table"));
+}
+
+std::vector<TableInfo> UnityCatalog::parse_table_list(const json& j) {
     std::vector<TableInfo> tables;
 
     try {
-        auto j = json::parse(json_str);
 
         if (!j.contains("tables") || !j["tables"].is_array()) {
-            internal::get_logger()->warn("No tables array found in response");
+            DATABRICKS_LOG_WARN("No tables array found in response");
             return tables;
         }
 
         for (const auto& table_json : j["tables"]) {
             try {
-                tables.push_back(parse_table(table_json.dump()));
+                tables.push_back(parse_table(table_json));
             } catch (const std::exception& e) {
-                internal::get_logger()->error("Failed to parse individual table: {}", e.what());
+                DATABRICKS_LOG_ERROR("Failed to parse individual table: {}", e.what());
                 // Continue parsing other tables
             }
         }
 
-        internal::get_logger()->info("Parsed {} tables", tables.size());
-    } catch (const json::parse_error& e) {
-        std::string error = "Malformed JSON in tables list: " + std::string(e.what());
-        error += "\nJSON (first 200 chars): " + json_str.substr(0, std::min(size_t(200), json_str.length()));
-        internal::get_logger()->error(error);
-        throw std::runtime_error(error);
+        DATABRICKS_LOG_INFO("Parsed {} tables", tables.size());
     } catch (const json::exception& e) {
         std::string error = "Failed to parse tables list: " + std::string(e.what());
-        error += "\nJSON (first 200 chars): " + json_str.substr(0, std::min(size_t(200), json_str.length()));
-        internal::get_logger()->error(error);
+        error += "\nJSON (first 200 chars): " + preview(j);
+        DATABRICKS_LOG_ERROR(error);
         throw std::runtime_error(error);
     }
 
     return tables;
 }
 
+std::vector<TableInfo> UnityCatalog::parse_table_list(const std::string& json_str) {
+    return parse_table_list(parse_body(json_str, "Malformed JSON in tables list"));
+}
+
 } // namespace databricks
@@ -0,0 +1,211 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "databricks/warehouse_router.h"
+
+#include "databricks/core/errors.h"
+
+#include "internal/logger.h"
+#include "internal/route_balancer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace databricks {
+namespace {
+using internal::RouteBalancer;
+
+/**
+ * @brief What a failed call says about the route it ran on
+ */
+RouteBalancer::Outcome classify(std::exception_ptr error) {
+    try {
+        std::rethrow_exception(error);
+    } catch (const CancelledError&) {
+        return RouteBalancer::Outcome::Ignored;
+    } catch (const AuthenticationError&) {
+        return RouteBalancer::Outcome::Ignored; // Same credentials on every route
+    } catch (const SqlError& e) {
+        return e.is_transient() ? RouteBalancer::Outcome::Failure : RouteBalancer::Outcome::Success;
+    } catch (const std::invalid_argument&) {
+        return RouteBalancer::Outcome::Ignored; // Bad parameters from the caller
+    } catch (...) {
+        return RouteBalancer::Outcome::Failure; // Pool exhausted or connection could not be opened
+    }
+}
+} // namespace
+
+class WarehouseRouter::Impl {
+public:
+    struct Route {
+        std::string http_path;
+        Client client;
+        std::atomic<bool> healthy{true};
+
+        explicit Route(Client pooled, std::string path)
+            : http_path(std::move(path))
+            , client(std::move(pooled)) {}
+    };
+
+    Impl(const AuthConfig& auth, const std::vector<SQLConfig>& sql_routes, const PoolingConfig& pooling,
+         const RouterConfig& routing, const RetryConfig& retry)
+        : routing_(routing)
+        , balancer_(std::max<size_t>(sql_routes.size(), 1), routing) {
+        if (sql_routes.empty()) {
+            throw std::invalid_argument("WarehouseRouter needs at least one SQLConfig");
+        }
+        if (!routing.is_valid()) {
+            throw std::invalid_argument("Invalid RouterConfig");
+        }
+        PoolingConfig route_pooling = pooling;
+        route_pooling.enabled = true;
+        routes_.reserve(sql_routes.size());
+        for (const auto& sql : sql_routes) {
+            auto client = Client::Builder()
+                              .with_auth(auth)
+                              .with_sql(sql)
+                              .with_pooling(route_pooling)
+                              .with_retry(retry)
+                              .build();
+            routes_.push_back(std::make_unique<Route>(std::move(client), sql.http_path));
+        }
+        if (routing_.health_check_interval_ms > 0) {
+            health_thread_ = std::thread([this]() { health_loop(); });
+        }
+    }
+
+    ~Impl() {
+        {
+            std::lock_guard<std::mutex> lock(health_mutex_);
+            stopping_ = true;
+        }
+        health_cv_.notify_all();
+        if (health_thread_.joinable()) {
+            health_thread_.join();
+        }
+    }
+
+    void run(const std::function<void(Client&)>& work) {
+        std::vector<bool> tried(routes_.size(), false);
+        std::exception_ptr rejected;
+        while (auto index = balancer_.pick(tried)) {
+            auto& route = *routes_[*index];
+            const auto start = RouteBalancer::Clock::now();
+            try {
+                work(route.client);
+                balancer_.finish(*index, RouteBalancer::Clock::now() - start, RouteBalancer::Outcome::Success);
+                return;
+            } catch (const CircuitOpenError& e) {
+                // The call never left this process, so another route may take it
+                balancer_.finish(*index, RouteBalancer::Clock::now() - start, RouteBalancer::Outcome::Failure);
+                balancer_.drain(*index, std::max(e.retry_after(), std::chrono::milliseconds(1)));
+                DATABRICKS_LOG_DEBUG("Circuit open on {}, trying another warehouse", route.http_path);
+                tried[*index] = true;
+                rejected = std::current_exception();
+            } catch (...) {
+                auto error = std::current_exception();
+                balancer_.finish(*index, RouteBalancer::Clock::now() - start, classify(error));
+                std::rethrow_exception(error);
+            }
+        }
+        std::rethrow_exception(rejected); // Every route's circuit is open
+    }
+
+    size_t check_health() {
+        size_t passed = 0;
+        for (size_t i = 0; i < routes_.size(); ++i) {
+            auto& route = *routes_[i];
+            try {
+                route.client.query("SELECT 1");
+                ++passed;
+                if (!route.healthy.exchange(true)) {
+                    DATABRICKS_LOG_INFO("Warehouse {} passed its health check, back in service", route.http_path);
+                    balancer_.restore(i);
+                }
+            } catch (const std::exception& e) {
+                if (route.healthy.exchange(false)) {
+                    DATABRICKS_LOG_WARN("Warehouse {} failed its health check, draining: {}", route.http_path,
+                                        e.what());
+                }
+                // Back in service only once a later check passes, however long that takes
+                balancer_.drain_until_restored(i);
+            }
+        }
+        return passed;
+    }
+
+    std::vector<RouteStats> stats() const {
+        std::vector<RouteStats> result;
+        result.reserve(routes_.size());
+        for (size_t i = 0; i < routes_.size(); ++i) {
+            auto state = balancer_.state(i);
+            RouteStats route;
+            route.http_path = routes_[i]->http_path;
+            route.outstanding = state.outstanding;
+            route.queries = state.queries;
+            route.failures = state.failures;
+            route.latency_ms = state.latency_ms;
+            route.error_rate = state.error_rate;
+            route.draining = state.draining;
+            route.healthy = routes_[i]->healthy.load();
+            result.push_back(std::move(route));
+        }
+        return result;
+    }
+
+private:
+    void health_loop() {
+        std::unique_lock<std::mutex> lock(health_mutex_);
+        const auto interval = std::chrono::milliseconds(routing_.health_check_interval_ms);
+        while (!health_cv_.wait_for(lock, interval, [this]() { return stopping_; })) {
+            lock.unlock();
+            check_health();
+            lock.lock();
+        }
+    }
+
+    const RouterConfig routing_;
+    std::vector<std::unique_ptr<Route>> routes_;
+    RouteBalancer balancer_;
+
+    std::mutex health_mutex_; // Guards stopping_
+    std::condition_variable health_cv_;
+    bool stopping_ = false;
+    std::thread health_thread_;
+};
+
+// ========== WarehouseRouter Implementation ==========
+
+WarehouseRouter::WarehouseRouter(const AuthConfig& auth, const std::vector<SQLConfig>& routes,
+                                 const PoolingConfig& pooling, const RouterConfig& routing, const RetryConfig& retry)
+    : pimpl_(std::make_unique<Impl>(auth, routes, pooling, routing, retry)) {}
+
+WarehouseRouter::~WarehouseRouter() = default;
+
+std::vector<std::vector<std::string>> WarehouseRouter::query(const std::string& sql,
+                                                             const std::vector<Client::Parameter>& params) {
+    std::vector<std::vector<std::string>> rows;
+    pimpl_->run([&](Client& client) { rows = client.query(sql, params); });
+    return rows;
+}
+
+std::vector<std::vector<std::string>> WarehouseRouter::query(const std::string& sql,
+                                                             const std::vector<Client::Parameter>& params,
+                                                             const QueryOptions& options) {
+    std::vector<std::vector<std::string>> rows;
+    pimpl_->run([&](Client& client) { rows = client.query(sql, params, options); });
+    return rows;
+}
+
+void WarehouseRouter::run(const std::function<void(Client&)>& work) { pimpl_->run(work); }
+
+size_t WarehouseRouter::check_health() { return pimpl_->check_health(); }
+
+std::vector<RouteStats> WarehouseRouter::stats() const { return pimpl_->stats(); }
+
+} // namespace databricks
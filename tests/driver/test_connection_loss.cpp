@@ -0,0 +1,88 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../src/internal/pool_manager.h"
+#include "bench_config.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include <databricks/core/client.h>
+#include <databricks/core/errors.h>
+#include <gtest/gtest.h>
+
+using databricks::bench::bench_auth;
+using databricks::bench::bench_sql;
+
+namespace {
+class ConnectionLossTest : public ::testing::Test {
+protected:
+    // The first `failures` executions report a lost connection (08S01), which kills it in the fake driver
+    void fail_first(int failures) {
+        auto remaining = std::make_shared<std::atomic<int>>(failures);
+        databricks::bench::FakeResultShape shape;
+        shape.rows = 3;
+        shape.execute_error = [remaining]() { return remaining->fetch_sub(1) > 0 ? "08S01" : ""; };
+        databricks::bench::set_fake_result(shape);
+    }
+
+    void TearDown() override {
+        databricks::bench::set_fake_result({});
+        databricks::internal::PoolManager::instance().shutdown_all(); // No pool state leaks into the next test
+    }
+
+    static databricks::PoolingConfig single_connection_pool() {
+        databricks::PoolingConfig pooling;
+        pooling.enabled = true;
+        pooling.min_connections = 1;
+        pooling.max_connections = 1;
+        pooling.validate_on_borrow = false; // Nothing else would catch a dead connection
+        pooling.maintenance_interval_ms = 0;
+        return pooling;
+    }
+
+    static databricks::RetryConfig fast_retry() {
+        databricks::RetryConfig retry;
+        retry.initial_backoff_ms = 1;
+        return retry;
+    }
+};
+} // namespace
+
+// Test: A retry after a lost connection reconnects instead of reusing the dead handle
+TEST_F(ConnectionLossTest, RetryReconnects) {
+    fail_first(1);
+    auto client =
+        databricks::Client::Builder().with_auth(bench_auth()).with_sql(bench_sql()).with_retry(fast_retry()).build();
+    EXPECT_EQ(client.query("SELECT 1").size(), 3u);
+}
+
+// Test: A pooled query's retry gets a live connection after the first one is lost
+TEST_F(ConnectionLossTest, PooledRetryReconnects) {
+    fail_first(1);
+    auto client = databricks::Client::Builder()
+                      .with_auth(bench_auth())
+                      .with_sql(bench_sql())
+                      .with_pooling(single_connection_pool())
+                      .with_retry(fast_retry())
+                      .build();
+    EXPECT_EQ(client.query("SELECT 1").size(), 3u);
+}
+
+// Test: A connection lost during a pooled query is not handed to the next borrower
+TEST_F(ConnectionLossTest, LostPooledConnectionIsDiscarded) {
+    fail_first(1);
+    databricks::RetryConfig no_retry;
+    no_retry.enabled = false;
+    auto client = databricks::Client::Builder()
+                      .with_auth(bench_auth())
+                      .with_sql(bench_sql())
+                      .with_pooling(single_connection_pool())
+                      .with_retry(no_retry)
+                      .build();
+    EXPECT_THROW(client.query("SELECT 1"), databricks::ConnectionError);
+    EXPECT_EQ(client.query("SELECT 1").size(), 3u);
+    EXPECT_EQ(client.query_result("SELECT 1").num_rows(), 3u);
+}
+
+// Note: main() is provided by gtest_main linked in CMakeLists.txt
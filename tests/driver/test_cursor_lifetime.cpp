@@ -0,0 +1,59 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../src/internal/pool_manager.h"
+#include "bench_config.h"
+
+#include <chrono>
+#include <optional>
+#include <thread>
+
+#include <databricks/core/client.h>
+#include <databricks/core/cursor.h>
+#include <gtest/gtest.h>
+
+using databricks::bench::bench_auth;
+using databricks::bench::bench_sql;
+
+namespace {
+class CursorLifetimeTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        databricks::bench::FakeResultShape shape;
+        shape.rows = 3;
+        databricks::bench::set_fake_result(shape);
+    }
+
+    void TearDown() override {
+        databricks::bench::set_fake_result({});
+        databricks::internal::PoolManager::instance().shutdown_all(); // No pool state leaks into the next test
+    }
+};
+} // namespace
+
+// Test: A pooled cursor that outlives its Client keeps its pool from being reclaimed until it is closed
+TEST_F(CursorLifetimeTest, CursorOutlivesClientAcrossReclaim) {
+    auto& manager = databricks::internal::PoolManager::instance();
+    databricks::AuthConfig auth = bench_auth("https://cursor-lifetime.cloud.databricks.com");
+    databricks::PoolingConfig pooling;
+    pooling.enabled = true;
+    pooling.min_connections = 1;
+    pooling.max_connections = 1;
+    pooling.idle_timeout_ms = 1;
+    pooling.maintenance_interval_ms = 0;
+
+    std::optional<databricks::Cursor> cursor;
+    {
+        auto client = databricks::Client::Builder().with_auth(auth).with_sql(bench_sql()).with_pooling(pooling).build();
+        cursor.emplace(client.execute_cursor("SELECT 1"));
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(manager.reclaim_idle(), 0u);
+    EXPECT_EQ(cursor->next_batch(10).size(), 3u);
+
+    cursor.reset(); // Returns its connection to the pool
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(manager.reclaim_idle(), 1u);
+}
+
+// Note: main() is provided by gtest_main linked in CMakeLists.txt
@@ -0,0 +1,135 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../src/internal/pool_manager.h"
+#include "bench_config.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+
+#include <databricks/core/client.h>
+#include <databricks/core/metrics.h>
+#include <gtest/gtest.h>
+
+using databricks::bench::bench_auth;
+using databricks::bench::bench_sql;
+
+namespace {
+constexpr auto SLOW_STEP = std::chrono::microseconds(20000);
+constexpr size_t SLOW_ROWS = 50; // Fetched a row at a time, SLOW_STEP each: one second in all
+
+class HedgingTest : public ::testing::Test {
+protected:
+    void SetUp() override { databricks::set_metrics_sink(registry_); }
+
+    void TearDown() override {
+        databricks::set_metrics_sink(nullptr);
+        databricks::bench::set_fake_result({});
+        databricks::internal::PoolManager::instance().shutdown_all(); // No pool state leaks into the next test
+    }
+
+    // The first execution takes 300ms, long past the hedge delay; the rest answer at once
+    static void slow_first_execution() {
+        auto executions = std::make_shared<std::atomic<int>>(0);
+        databricks::bench::FakeResultShape shape;
+        shape.rows = 3;
+        shape.execute_latency = [executions]() {
+            return executions->fetch_add(1) == 0 ? std::chrono::microseconds(300000) : std::chrono::microseconds(0);
+        };
+        databricks::bench::set_fake_result(shape);
+    }
+
+    // Fetching is slow on the test's own thread (the primary copy) or on every other thread (the hedge)
+    static void slow_fetch(bool on_test_thread) {
+        const std::thread::id test_thread = std::this_thread::get_id();
+        databricks::bench::FakeResultShape shape;
+        shape.rows = SLOW_ROWS;
+        shape.fetch_latency = [test_thread, on_test_thread]() {
+            bool slow = (std::this_thread::get_id() == test_thread) == on_test_thread;
+            return slow ? SLOW_STEP : std::chrono::microseconds(0);
+        };
+        if (!on_test_thread) {
+            // Let the hedge start fetching before the primary answers
+            shape.execute_latency = [test_thread]() {
+                return std::this_thread::get_id() == test_thread ? 5 * SLOW_STEP : std::chrono::microseconds(0);
+            };
+        }
+        databricks::bench::set_fake_result(shape);
+    }
+
+    static databricks::PoolingConfig two_connection_pool() {
+        databricks::PoolingConfig pooling;
+        pooling.enabled = true;
+        pooling.min_connections = 2;
+        pooling.max_connections = 2;
+        pooling.validate_on_borrow = false; // Keep executions to the queries themselves
+        pooling.maintenance_interval_ms = 0;
+        return pooling;
+    }
+
+    static databricks::HedgeConfig fast_hedge() {
+        databricks::HedgeConfig hedge;
+        hedge.enabled = true;
+        hedge.initial_delay_ms = 20;
+        return hedge;
+    }
+
+    static databricks::Client hedging_client() {
+        databricks::SQLConfig sql = bench_sql();
+        sql.fetch_batch_rows = 1;
+        return databricks::Client::Builder()
+            .with_auth(bench_auth())
+            .with_sql(sql)
+            .with_pooling(two_connection_pool())
+            .with_hedging(fast_hedge())
+            .build();
+    }
+
+    std::shared_ptr<databricks::MetricsRegistry> registry_ = std::make_shared<databricks::MetricsRegistry>();
+};
+} // namespace
+
+// Test: A hedged query_async on a single async worker sends its hedge instead of waiting on that worker
+TEST_F(HedgingTest, HedgesOnSingleAsyncWorker) {
+    slow_first_execution();
+    auto client = databricks::Client::Builder()
+                      .with_auth(bench_auth())
+                      .with_sql(bench_sql())
+                      .with_pooling(two_connection_pool())
+                      .with_async(databricks::AsyncConfig{1, 16})
+                      .with_hedging(fast_hedge())
+                      .build();
+
+    auto rows = client.query_async("SELECT 1");
+    ASSERT_EQ(rows.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    EXPECT_EQ(rows.get().size(), 3u);
+    EXPECT_EQ(registry_->counter(databricks::MetricCounter::HedgedQueries), 1u);
+    EXPECT_EQ(registry_->counter(databricks::MetricCounter::HedgeWins), 1u);
+}
+
+// Test: A primary that loses while fetching stops fetching instead of finishing its slow result first
+TEST_F(HedgingTest, LosingPrimaryStopsFetching) {
+    slow_fetch(true);
+    auto client = hedging_client();
+
+    const auto started = std::chrono::steady_clock::now();
+    EXPECT_EQ(client.query("SELECT 1").size(), SLOW_ROWS);
+    EXPECT_LT(std::chrono::steady_clock::now() - started, SLOW_ROWS * SLOW_STEP / 2);
+    EXPECT_EQ(registry_->counter(databricks::MetricCounter::HedgeWins), 1u);
+}
+
+// Test: A hedge that loses while fetching stops fetching, so the caller isn't left joining it
+TEST_F(HedgingTest, LosingHedgeStopsFetching) {
+    slow_fetch(false);
+    auto client = hedging_client();
+
+    const auto started = std::chrono::steady_clock::now();
+    EXPECT_EQ(client.query("SELECT 1").size(), SLOW_ROWS);
+    EXPECT_LT(std::chrono::steady_clock::now() - started, SLOW_ROWS * SLOW_STEP / 2);
+    EXPECT_EQ(registry_->counter(databricks::MetricCounter::HedgedQueries), 1u);
+    EXPECT_EQ(registry_->counter(databricks::MetricCounter::HedgeWins), 0u);
+}
+
+// Note: main() is provided by gtest_main linked in CMakeLists.txt
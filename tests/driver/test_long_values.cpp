@@ -0,0 +1,114 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "bench_config.h"
+
+#include <string>
+#include <vector>
+
+#include <databricks/core/client.h>
+#include <gtest/gtest.h>
+
+using databricks::bench::bench_auth;
+using databricks::bench::bench_sql;
+
+namespace {
+constexpr size_t ROWS = 10;
+constexpr size_t DECLARED_BYTES = 8; // Bound as 33 bytes (4 per character plus the terminator)
+
+// Every third row of column 0 is far longer than the declared size; the rest fit
+std::string cell(size_t row, size_t column) {
+    if (column == 0 && row % 3 == 0) {
+        return std::string(5000 + row, static_cast<char>('a' + row));
+    }
+    return "r" + std::to_string(row) + "c" + std::to_string(column);
+}
+
+class LongValuesTest : public ::testing::Test {
+protected:
+    void SetUp() override { databricks::bench::set_fake_result(long_values(true)); }
+
+    static databricks::bench::FakeResultShape long_values(bool bound_rereads) {
+        databricks::bench::FakeResultShape shape;
+        shape.rows = ROWS;
+        shape.columns = 2;
+        shape.value_bytes = DECLARED_BYTES;
+        shape.generator = cell;
+        shape.bound_rereads = bound_rereads;
+        return shape;
+    }
+
+    void TearDown() override { databricks::bench::set_fake_result({}); }
+
+    databricks::Client client() {
+        auto sql = bench_sql();
+        sql.fetch_batch_rows = 4; // Several blocks, each with long and short values
+        return databricks::Client::Builder().with_auth(bench_auth()).with_sql(sql).build();
+    }
+};
+} // namespace
+
+// Test: query() returns values longer than their declared column size in full
+TEST_F(LongValuesTest, QueryReadsPastDeclaredSize) {
+    auto c = client();
+    auto rows = c.query("SELECT long_string_col, id FROM t");
+    ASSERT_EQ(rows.size(), ROWS);
+    for (size_t r = 0; r < ROWS; r++) {
+        EXPECT_EQ(rows[r][0], cell(r, 0)) << "row " << r;
+        EXPECT_EQ(rows[r][1], cell(r, 1)) << "row " << r;
+    }
+}
+
+// Test: query_columnar() delivers overflowing values whole, in every block
+TEST_F(LongValuesTest, ColumnarReadsPastDeclaredSize) {
+    auto c = client();
+    size_t row = 0;
+    c.query_columnar("SELECT long_string_col, id FROM t", {}, [&](const databricks::ColumnarBatch& batch) {
+        for (size_t r = 0; r < batch.num_rows(); r++, row++) {
+            EXPECT_EQ(batch.value(r, 0), cell(row, 0)) << "row " << row;
+            EXPECT_EQ(batch.value(r, 1), cell(row, 1)) << "row " << row;
+        }
+    });
+    EXPECT_EQ(row, ROWS);
+}
+
+// Test: query_typed() re-reads overflowing string columns the same way
+TEST_F(LongValuesTest, TypedReadsPastDeclaredSize) {
+    auto c = client();
+    size_t row = 0;
+    c.query_typed("SELECT long_string_col, id FROM t", {}, [&](const databricks::TypedBatch& batch) {
+        for (size_t r = 0; r < batch.num_rows(); r++, row++) {
+            EXPECT_EQ(batch.get_string(r, 0), cell(row, 0)) << "row " << row;
+        }
+    });
+    EXPECT_EQ(row, ROWS);
+}
+
+// Test: On a driver that can't SQLGetData a bound row of a block cursor, long values are still read whole
+TEST_F(LongValuesTest, ReadsPastDeclaredSizeWithoutBoundRereads) {
+    databricks::bench::set_fake_result(long_values(false));
+    auto c = client();
+
+    auto rows = c.query("SELECT long_string_col, id FROM t");
+    ASSERT_EQ(rows.size(), ROWS);
+    for (size_t r = 0; r < ROWS; r++) {
+        EXPECT_EQ(rows[r][0], cell(r, 0)) << "row " << r;
+    }
+
+    size_t row = 0;
+    c.query_columnar("SELECT long_string_col, id FROM t", {}, [&](const databricks::ColumnarBatch& batch) {
+        for (size_t r = 0; r < batch.num_rows(); r++, row++) {
+            EXPECT_EQ(batch.value(r, 0), cell(row, 0)) << "row " << row;
+        }
+    });
+    EXPECT_EQ(row, ROWS);
+
+    row = 0;
+    c.query_typed("SELECT long_string_col, id FROM t", {}, [&](const databricks::TypedBatch& batch) {
+        for (size_t r = 0; r < batch.num_rows(); r++, row++) {
+            EXPECT_EQ(batch.get_string(r, 0), cell(row, 0)) << "row " << row;
+        }
+    });
+    EXPECT_EQ(row, ROWS);
+}
+
+// Note: main() is provided by gtest_main linked in CMakeLists.txt
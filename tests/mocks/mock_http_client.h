@@ -28,6 +28,10 @@ public:
 
     MOCK_METHOD(internal::HttpResponse, get, (const std::string& path), (override));
     MOCK_METHOD(internal::HttpResponse, post, (const std::string& path, const std::string& json_body), (override));
+    MOCK_METHOD(internal::HttpResponse, get_external,
+                (const std::string& url, (const std::map<std::string, std::string>&)headers), (override));
+    MOCK_METHOD(internal::HttpResponse, put, (const std::string& path, const std::string& body), (override));
+    MOCK_METHOD(internal::HttpResponse, del, (const std::string& path), (override));
     MOCK_METHOD(void, check_response, (const internal::HttpResponse& response, const std::string& operation_name),
                 (const, override));
 
@@ -532,3 +532,101 @@ TEST(CreateComputeMockTest, CreateMultipleClustersSequentially) {
         EXPECT_TRUE(result);
     }
 }
+
+// ============================================================================
+// Wait API Tests
+// ============================================================================
+
+// Test: wait_for_state() resolves once the cluster reports the requested state
+TEST(ComputeWaitTest, WaitForStateResolvesOnTarget) {
+    auto mock_client = std::make_shared<::testing::NiceMock<databricks::test::MockHttpClient>>();
+    EXPECT_CALL(*mock_client, get("/clusters/get?cluster_id=abc"))
+        .WillOnce(::testing::Return(databricks::test::MockHttpClient::success_response(
+            R"({"cluster_id":"abc","state":"TERMINATED"})")))
+        .WillOnce(::testing::Return(
+            databricks::test::MockHttpClient::success_response(R"({"cluster_id":"abc","state":"PENDING"})")))
+        .WillOnce(::testing::Return(
+            databricks::test::MockHttpClient::success_response(R"({"cluster_id":"abc","state":"RUNNING"})")));
+
+    databricks::PollConfig poll;
+    poll.initial_interval_ms = 5;
+
+    databricks::Compute compute(mock_client);
+    auto cluster =
+        compute.wait_for_state("abc", databricks::ClusterStateEnum::RUNNING, std::chrono::seconds(10), poll).get();
+    EXPECT_EQ(cluster.state, "RUNNING");
+}
+
+// Test: wait_for_state() fails if the cluster settles in another terminal state
+TEST(ComputeWaitTest, WaitForStateFailsOnUnexpectedTermination) {
+    auto mock_client = std::make_shared<::testing::NiceMock<databricks::test::MockHttpClient>>();
+    EXPECT_CALL(*mock_client, get("/clusters/get?cluster_id=abc"))
+        .WillOnce(::testing::Return(
+            databricks::test::MockHttpClient::success_response(R"({"cluster_id":"abc","state":"PENDING"})")))
+        .WillOnce(::testing::Return(
+            databricks::test::MockHttpClient::success_response(R"({"cluster_id":"abc","state":"ERROR"})")));
+
+    databricks::PollConfig poll;
+    poll.initial_interval_ms = 5;
+
+    databricks::Compute compute(mock_client);
+    auto cluster = compute.wait_for_state("abc", databricks::ClusterStateEnum::RUNNING, std::chrono::seconds(10), poll);
+    EXPECT_THROW(cluster.get(), std::runtime_error);
+}
+
+// ============================================================================
+// Batch and Filtered Listing Tests
+// ============================================================================
+
+// Test: list_compute() sends the server-side filters, follows pages and applies the creator filter
+TEST(ComputeListTest, ListComputeFiltersAndFollowsPages) {
+    auto mock_client = std::make_shared<::testing::NiceMock<databricks::test::MockHttpClient>>();
+    EXPECT_CALL(*mock_client, get("/clusters/list?filter_by.cluster_states=RUNNING&filter_by.is_pinned=false"
+                                  "&page_size=2"))
+        .WillOnce(Return(databricks::test::MockHttpClient::success_response(
+            R"({"clusters":[{"cluster_id":"a","creator_user_name":"ops"},{"cluster_id":"b","creator_user_name":"dev"}],
+                "next_page_token":"p2"})")));
+    EXPECT_CALL(*mock_client, get("/clusters/list?filter_by.cluster_states=RUNNING&filter_by.is_pinned=false"
+                                  "&page_size=2&page_token=p2"))
+        .WillOnce(Return(databricks::test::MockHttpClient::success_response(
+            R"({"clusters":[{"cluster_id":"c","creator_user_name":"ops"}]})")));
+
+    databricks::ClusterListFilter filter;
+    filter.states = {databricks::ClusterStateEnum::RUNNING};
+    filter.is_pinned = false;
+    filter.creator_user_name = "ops";
+    filter.page_size = 2;
+
+    databricks::Compute compute(mock_client);
+    auto clusters = compute.list_compute(filter);
+    ASSERT_EQ(clusters.size(), 2);
+    EXPECT_EQ(clusters[0].cluster_id, "a");
+    EXPECT_EQ(clusters[1].cluster_id, "c");
+}
+
+// Test: A batch reports each cluster's outcome in input order without stopping at a failure
+TEST(ComputeBatchTest, TerminateBatchReportsEachCluster) {
+    auto mock_client = std::make_shared<::testing::NiceMock<databricks::test::MockHttpClient>>();
+    EXPECT_CALL(*mock_client, post("/clusters/delete", _))
+        .WillRepeatedly(Return(databricks::test::MockHttpClient::success_response()));
+    EXPECT_CALL(*mock_client, post("/clusters/delete", R"({"cluster_id":"b"})"))
+        .WillOnce(Return(databricks::test::MockHttpClient::server_error_response()));
+    EXPECT_CALL(*mock_client, check_response(_, "terminateCompute"))
+        .WillRepeatedly(::testing::Invoke([](const databricks::internal::HttpResponse& response, const std::string&) {
+            if (response.status_code >= 400) {
+                throw std::runtime_error("Internal server error");
+            }
+        }));
+
+    databricks::Compute compute(mock_client);
+    auto results = compute.terminate_compute_batch({"a", "b", "c"}, 2);
+    ASSERT_EQ(results.size(), 3);
+    EXPECT_EQ(results[0].cluster_id, "a");
+    EXPECT_TRUE(results[0].success);
+    EXPECT_FALSE(results[1].success);
+    EXPECT_EQ(results[1].status_code, 500);
+    EXPECT_EQ(results[1].error, "Internal server error");
+    EXPECT_TRUE(results[2].success);
+
+    EXPECT_THROW(compute.start_compute_batch({"a"}, 0), std::invalid_argument);
+}
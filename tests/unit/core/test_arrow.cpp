@@ -0,0 +1,114 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+// Built only with -DENABLE_ARROW=ON
+#ifdef DATABRICKS_ENABLE_ARROW
+#    include "../../src/internal/odbc_statement.h"
+
+#    include <databricks/core/arrow.h>
+
+#    include <cstring>
+#    include <string>
+
+#    include <arrow/api.h>
+#    include <gtest/gtest.h>
+
+using databricks::ColumnMetadata;
+using databricks::TypedBatch;
+using databricks::ValueType;
+
+namespace {
+ColumnMetadata column(const std::string& name, SQLSMALLINT sql_type, uint64_t size = 0, SQLSMALLINT digits = 0) {
+    ColumnMetadata metadata;
+    metadata.name = name;
+    metadata.sql_type = sql_type;
+    metadata.column_size = size;
+    metadata.decimal_digits = digits;
+    return metadata;
+}
+
+void append_text(TypedBatch::Column& column, const std::string& value) {
+    column.text.insert(column.text.end(), value.begin(), value.end());
+    column.text_offsets.push_back(column.text.size());
+    column.nulls.push_back(0);
+}
+
+void append_null_text(TypedBatch::Column& column) {
+    column.text_offsets.push_back(column.text.size());
+    column.nulls.push_back(1);
+}
+} // namespace
+
+// Test: SQL types map to the matching Arrow types
+TEST(ArrowTest, SchemaMapsSqlTypes) {
+    auto schema = databricks::to_arrow_schema(
+        {column("small", SQL_SMALLINT), column("big", SQL_BIGINT), column("real", SQL_REAL),
+         column("amount", SQL_DECIMAL, 10, 2), column("day", SQL_TYPE_DATE), column("name", SQL_VARCHAR, 64)},
+        {ValueType::Int64, ValueType::Int64, ValueType::Double, ValueType::String, ValueType::Date,
+         ValueType::String});
+
+    ASSERT_EQ(schema->num_fields(), 6);
+    EXPECT_TRUE(schema->field(0)->type()->Equals(arrow::int16()));
+    EXPECT_TRUE(schema->field(1)->type()->Equals(arrow::int64()));
+    EXPECT_TRUE(schema->field(2)->type()->Equals(arrow::float32()));
+    EXPECT_TRUE(schema->field(3)->type()->Equals(arrow::decimal128(10, 2)));
+    EXPECT_TRUE(schema->field(4)->type()->Equals(arrow::date32()));
+    EXPECT_TRUE(schema->field(5)->type()->Equals(arrow::utf8()));
+    EXPECT_THROW(databricks::to_arrow_schema({column("id", SQL_BIGINT)}, {}), std::invalid_argument);
+}
+
+// Test: Values, NULLs, dates, timestamps and decimals convert without loss
+TEST(ArrowTest, RecordBatchCopiesValues) {
+    TypedBatch batch;
+    batch.reset({column("id", SQL_INTEGER), column("amount", SQL_DECIMAL, 10, 2), column("day", SQL_TYPE_DATE),
+                 column("at", SQL_TYPE_TIMESTAMP), column("name", SQL_VARCHAR, 64)},
+                {ValueType::Int64, ValueType::String, ValueType::Date, ValueType::Timestamp, ValueType::String});
+
+    auto& ids = batch.mutable_column(0);
+    ids.int64s = {7, 0};
+    ids.nulls = {0, 1};
+    auto& amounts = batch.mutable_column(1);
+    append_text(amounts, "12.5");
+    append_text(amounts, "-0.01");
+    auto& days = batch.mutable_column(2);
+    days.dates = {databricks::Date{1970, 1, 2}, databricks::Date{2000, 3, 1}};
+    days.nulls = {0, 0};
+    auto& times = batch.mutable_column(3);
+    times.timestamps = {databricks::Timestamp{1970, 1, 1, 0, 0, 1, 500000000}, databricks::Timestamp{}};
+    times.nulls = {0, 1};
+    auto& names = batch.mutable_column(4);
+    append_text(names, "alice");
+    append_null_text(names);
+    batch.commit_rows(2);
+
+    auto record_batch = databricks::to_record_batch(batch);
+    ASSERT_EQ(record_batch->num_rows(), 2);
+
+    auto id = std::static_pointer_cast<arrow::Int32Array>(record_batch->column(0));
+    EXPECT_EQ(id->Value(0), 7);
+    EXPECT_TRUE(id->IsNull(1));
+
+    auto amount = std::static_pointer_cast<arrow::Decimal128Array>(record_batch->column(1));
+    EXPECT_EQ(amount->FormatValue(0), "12.50");
+    EXPECT_EQ(amount->FormatValue(1), "-0.01");
+
+    auto day = std::static_pointer_cast<arrow::Date32Array>(record_batch->column(2));
+    EXPECT_EQ(day->Value(0), 1);
+    EXPECT_EQ(day->Value(1), 11017);
+
+    auto at = std::static_pointer_cast<arrow::TimestampArray>(record_batch->column(3));
+    EXPECT_EQ(at->Value(0), 1500000);
+    EXPECT_TRUE(at->IsNull(1));
+
+    auto name = std::static_pointer_cast<arrow::StringArray>(record_batch->column(4));
+    EXPECT_EQ(name->GetView(0), "alice");
+    EXPECT_TRUE(name->IsNull(1));
+}
+
+// Test: A schema for a different result is rejected
+TEST(ArrowTest, RecordBatchChecksSchema) {
+    TypedBatch batch;
+    batch.reset({column("id", SQL_BIGINT)}, {ValueType::Int64});
+    auto other = databricks::to_arrow_schema({}, {});
+    EXPECT_THROW(databricks::to_record_batch(batch, other), std::invalid_argument);
+}
+#endif
@@ -0,0 +1,91 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+// Built only with -DENABLE_COROUTINES=ON
+#ifdef DATABRICKS_ENABLE_COROUTINES
+#    include "../../mocks/mock_http_client.h"
+
+#    include <databricks/core/awaitable.h>
+#    include <databricks/jobs/jobs.h>
+
+#    include <chrono>
+#    include <coroutine>
+#    include <future>
+#    include <stdexcept>
+#    include <string>
+#    include <thread>
+
+#    include <gtest/gtest.h>
+
+using databricks::Awaitable;
+using databricks::test::MockHttpClient;
+using ::testing::_;
+using ::testing::Return;
+
+namespace {
+// Minimal fire-and-forget coroutine; the tests observe it through promises
+struct Detached {
+    struct promise_type {
+        Detached get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+Awaitable<int> later(int value, std::chrono::milliseconds delay) {
+    return Awaitable<int>([value, delay](Awaitable<int>::Completion done) {
+        std::thread([value, delay, done]() mutable {
+            std::this_thread::sleep_for(delay);
+            done.set_value(value);
+        }).detach();
+    });
+}
+
+Detached add(std::promise<int>& out) {
+    int a = co_await later(1, std::chrono::milliseconds(20));
+    int b = co_await later(2, std::chrono::milliseconds(0));
+    out.set_value(a + b);
+}
+
+Detached read_output(databricks::Jobs& jobs, std::promise<std::string>& out) {
+    try {
+        auto output = co_await jobs.co_get_run_output(123);
+        out.set_value(output.notebook_output);
+    } catch (const std::exception& e) {
+        out.set_value(std::string("error: ") + e.what());
+    }
+}
+} // namespace
+
+// Test: A coroutine suspends on an operation completed by another thread and resumes with its value
+TEST(AwaitableTest, ResumesWithValueFromAnotherThread) {
+    std::promise<int> sum;
+    auto result = sum.get_future();
+    add(sum);
+    ASSERT_EQ(result.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(result.get(), 3);
+}
+
+// Test: REST awaitables yield the parsed result, and errors surface at co_await
+TEST(AwaitableTest, JobsRunOutputAwaitsResultAndErrors) {
+    auto mock_client = std::make_shared<MockHttpClient>();
+    EXPECT_CALL(*mock_client, get("/jobs/runs/get-output?run_id=123"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"notebook_output":"success"})")))
+        .WillOnce(Return(MockHttpClient::not_found_response("Run")));
+    EXPECT_CALL(*mock_client, check_response(_, "getRunOutput"))
+        .WillOnce(Return())
+        .WillOnce(::testing::Throw(std::runtime_error("HTTP 404")));
+    databricks::Jobs jobs(mock_client);
+
+    std::promise<std::string> first;
+    read_output(jobs, first);
+    EXPECT_EQ(first.get_future().get(), "success");
+
+    std::promise<std::string> second;
+    read_output(jobs, second);
+    EXPECT_EQ(second.get_future().get(), "error: HTTP 404");
+}
+#endif
+
+// Note: main() is provided by gtest_main linked in CMakeLists.txt
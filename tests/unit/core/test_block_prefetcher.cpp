@@ -0,0 +1,87 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../src/internal/block_prefetcher.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using databricks::ColumnarBatch;
+using databricks::ColumnMetadata;
+using databricks::internal::BlockPrefetcher;
+using namespace std::chrono_literals;
+
+namespace {
+std::vector<ColumnMetadata> one_column() {
+    ColumnMetadata column;
+    column.name = "n";
+    return {column};
+}
+
+// Fills a block with one row holding the block number, until blocks run out
+auto counting_fetch(std::atomic<int>& fetched, int blocks) {
+    return [&fetched, blocks](ColumnarBatch& batch) {
+        if (fetched.load() >= blocks) {
+            return false;
+        }
+        batch.clear();
+        std::string value = std::to_string(fetched.fetch_add(1));
+        batch.append_value(0, value.data(), value.size());
+        batch.commit_row();
+        return true;
+    };
+}
+} // namespace
+
+// Test: Blocks arrive in order, and the fetch thread stops depth blocks ahead
+TEST(BlockPrefetcherTest, DeliversBlocksInOrderWithinDepth) {
+    std::atomic<int> fetched{0};
+    BlockPrefetcher prefetcher(counting_fetch(fetched, 10), one_column(), 2);
+    std::this_thread::sleep_for(50ms);
+    EXPECT_EQ(fetched.load(), 2);
+
+    ColumnarBatch batch;
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(prefetcher.next(batch));
+        ASSERT_EQ(batch.num_rows(), 1u);
+        EXPECT_EQ(batch.value(0, 0), std::to_string(i));
+    }
+    EXPECT_FALSE(prefetcher.next(batch));
+    EXPECT_FALSE(prefetcher.next(batch));
+}
+
+// Test: A fetch error reaches the consumer after the blocks fetched before it
+TEST(BlockPrefetcherTest, RethrowsFetchErrorInOrder) {
+    int calls = 0;
+    BlockPrefetcher prefetcher(
+        [&calls](ColumnarBatch& batch) {
+            if (++calls > 1) {
+                throw std::runtime_error("connection lost");
+            }
+            batch.append_value(0, "x", 1);
+            batch.commit_row();
+            return true;
+        },
+        one_column(), 1);
+
+    ColumnarBatch batch;
+    EXPECT_TRUE(prefetcher.next(batch));
+    EXPECT_THROW(prefetcher.next(batch), std::runtime_error);
+}
+
+// Test: Destroying the prefetcher early stops the fetch thread without draining the result
+TEST(BlockPrefetcherTest, StopsWhenDestroyedEarly) {
+    std::atomic<int> fetched{0};
+    {
+        BlockPrefetcher prefetcher(counting_fetch(fetched, 1000), one_column(), 1);
+        ColumnarBatch batch;
+        ASSERT_TRUE(prefetcher.next(batch));
+    }
+    EXPECT_LE(fetched.load(), 3);
+}
+
+// Note: main() is provided by gtest_main linked in CMakeLists.txt
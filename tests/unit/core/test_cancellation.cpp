@@ -0,0 +1,114 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../src/internal/cancel_scope.h"
+#include "../../src/internal/timer_queue.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using databricks::internal::CancelScope;
+using databricks::internal::TimerQueue;
+using namespace std::chrono_literals;
+
+// Test: Timers fire in deadline order, and cancelled timers never fire
+TEST(CancellationTest, TimerQueueOrdersAndCancels) {
+    TimerQueue timers;
+    std::mutex mutex;
+    std::vector<int> fired;
+    auto record = [&](int value) {
+        return [&, value]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            fired.push_back(value);
+        };
+    };
+    auto now = TimerQueue::Clock::now();
+    timers.schedule(now + 30ms, record(3));
+    timers.schedule(now + 10ms, record(1));
+    uint64_t dropped = timers.schedule(now + 20ms, record(2));
+    EXPECT_TRUE(timers.cancel(dropped));
+
+    std::this_thread::sleep_for(80ms);
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_EQ(fired, (std::vector<int>{1, 3}));
+}
+
+// Test: Cancelling any copy of a token fires the scopes using it, including later ones
+TEST(CancellationTest, TokenFiresScopes) {
+    databricks::CancellationToken token;
+    databricks::QueryOptions options;
+    options.cancel = token;
+
+    CancelScope scope(options);
+    EXPECT_FALSE(scope.fired());
+    databricks::CancellationToken copy = token;
+    copy.cancel();
+    copy.cancel(); // Idempotent
+    EXPECT_TRUE(token.is_cancelled());
+    EXPECT_TRUE(scope.fired());
+    EXPECT_FALSE(scope.timed_out());
+    EXPECT_THROW(scope.throw_if_fired(), databricks::CancelledError);
+
+    CancelScope later(options);
+    EXPECT_TRUE(later.fired());
+}
+
+// Test: A scope fires at its timeout and reports it as such
+TEST(CancellationTest, ScopeTimesOut) {
+    databricks::QueryOptions options;
+    options.timeout = 20ms;
+    CancelScope scope(options);
+    EXPECT_FALSE(scope.fired());
+    ASSERT_TRUE(scope.deadline().has_value());
+    EXPECT_LE(scope.remaining().timeout, 20ms);
+
+    std::this_thread::sleep_for(60ms);
+    EXPECT_TRUE(scope.fired());
+    EXPECT_TRUE(scope.timed_out());
+    databricks::CancelledError error = scope.cancelled_error({{"HY008", 0, "Operation canceled"}});
+    EXPECT_TRUE(error.timed_out());
+    EXPECT_EQ(error.sqlstate(), "HY008");
+    EXPECT_EQ(scope.remaining().timeout, 1ms);
+
+    CancelScope unlimited(databricks::QueryOptions{});
+    EXPECT_FALSE(unlimited.deadline().has_value());
+    EXPECT_EQ(unlimited.remaining().timeout, 0ms);
+}
+
+// Test: Attaching a statement to a scope that fired while nothing was attached throws instead of executing it
+TEST(CancellationTest, AttachAfterFireThrows) {
+    databricks::CancellationToken token;
+    databricks::QueryOptions options;
+    options.cancel = token;
+    CancelScope scope(options);
+    token.cancel(); // E.g. while the connection was being acquired
+
+    EXPECT_THROW(CancelScope::Attachment(&scope, SQL_NULL_HSTMT), databricks::CancelledError);
+    EXPECT_NO_THROW(CancelScope::Attachment(nullptr, SQL_NULL_HSTMT));
+}
+
+// Test: Destroying scopes while their timers and tokens fire concurrently is safe
+TEST(CancellationTest, ScopesRaceWithCancel) {
+    for (int round = 0; round < 50; round++) {
+        databricks::CancellationToken token;
+        databricks::QueryOptions options;
+        options.timeout = 1ms;
+        options.cancel = token;
+        std::atomic<bool> go{false};
+        std::thread canceller([&]() {
+            while (!go) {
+            }
+            token.cancel();
+        });
+        {
+            CancelScope scope(options);
+            go = true;
+        }
+        canceller.join();
+    }
+    SUCCEED();
+}
@@ -0,0 +1,111 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../src/internal/circuit_breaker.h"
+#include "../../src/internal/pool_manager.h"
+
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using databricks::internal::CircuitBreaker;
+using State = CircuitBreaker::State;
+using namespace std::chrono_literals;
+
+namespace {
+databricks::RetryConfig breaker_config(size_t threshold, size_t open_ms) {
+    databricks::RetryConfig retry;
+    retry.circuit_failure_threshold = threshold;
+    retry.circuit_open_ms = open_ms;
+    return retry;
+}
+} // namespace
+
+// Test: Consecutive transient failures open the circuit; a success in between resets the count
+TEST(CircuitBreakerTest, OpensAfterConsecutiveFailures) {
+    CircuitBreaker breaker(breaker_config(3, 60000));
+    breaker.record_failure();
+    breaker.record_failure();
+    breaker.record_success();
+    breaker.record_failure();
+    breaker.record_failure();
+    EXPECT_EQ(breaker.state(), State::Closed);
+    EXPECT_TRUE(breaker.allow());
+
+    breaker.record_failure();
+    EXPECT_EQ(breaker.state(), State::Open);
+    EXPECT_FALSE(breaker.allow());
+    EXPECT_GT(breaker.retry_after(), 0ms);
+}
+
+// Test: After the open period one probe goes through; its outcome closes or reopens the circuit
+TEST(CircuitBreakerTest, HalfOpenProbe) {
+    CircuitBreaker breaker(breaker_config(1, 5));
+    breaker.record_failure();
+    ASSERT_EQ(breaker.state(), State::Open);
+    std::this_thread::sleep_for(10ms);
+
+    EXPECT_TRUE(breaker.allow()); // The probe
+    EXPECT_EQ(breaker.state(), State::HalfOpen);
+    EXPECT_FALSE(breaker.allow()); // Others wait for it
+    breaker.record_failure();
+    EXPECT_EQ(breaker.state(), State::Open);
+
+    std::this_thread::sleep_for(10ms);
+    EXPECT_TRUE(breaker.allow());
+    breaker.record_success();
+    EXPECT_EQ(breaker.state(), State::Closed);
+    EXPECT_TRUE(breaker.allow());
+}
+
+// Test: A zero threshold disables the breaker
+TEST(CircuitBreakerTest, ZeroThresholdNeverOpens) {
+    CircuitBreaker breaker(breaker_config(0, 1000));
+    for (int i = 0; i < 100; i++) {
+        breaker.record_failure();
+    }
+    EXPECT_EQ(breaker.state(), State::Closed);
+    EXPECT_TRUE(breaker.allow());
+}
+
+// Test: Retries are capped at the ratio of recent calls plus the per-second floor
+TEST(CircuitBreakerTest, RetryBudget) {
+    databricks::RetryConfig retry;
+    retry.retry_budget_ratio = 0.5;
+    retry.retry_budget_min_per_second = 0;
+    CircuitBreaker breaker(retry);
+    EXPECT_FALSE(breaker.try_acquire_retry());
+
+    for (int i = 0; i < 4; i++) {
+        breaker.allow();
+    }
+    EXPECT_TRUE(breaker.try_acquire_retry());
+    EXPECT_TRUE(breaker.try_acquire_retry());
+    EXPECT_FALSE(breaker.try_acquire_retry());
+
+    databricks::RetryConfig floor;
+    floor.retry_budget_ratio = 0.0;
+    floor.retry_budget_min_per_second = 1;
+    CircuitBreaker idle(floor);
+    EXPECT_TRUE(idle.try_acquire_retry()); // Ten seconds' worth of the floor
+}
+
+// Test: Clients of one warehouse share a breaker whatever their token
+TEST(CircuitBreakerTest, SharedPerWarehouse) {
+    databricks::AuthConfig auth;
+    auth.host = "https://breaker.databricks.com";
+    auth.set_token("token-a");
+    databricks::SQLConfig sql;
+    sql.http_path = "/sql/1.0/warehouses/a";
+
+    auto& manager = databricks::internal::PoolManager::instance();
+    auto first = manager.circuit_breaker(auth, sql, databricks::RetryConfig{});
+    auth.set_token("token-b");
+    EXPECT_EQ(manager.circuit_breaker(auth, sql, databricks::RetryConfig{}), first);
+
+    sql.http_path = "/sql/1.0/warehouses/b";
+    EXPECT_NE(manager.circuit_breaker(auth, sql, databricks::RetryConfig{}), first);
+
+    EXPECT_FALSE(breaker_config(5, 0).is_valid());
+    EXPECT_TRUE(breaker_config(0, 0).is_valid());
+}
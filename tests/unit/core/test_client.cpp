@@ -1,5 +1,7 @@
 // Copyright (c) 2025 Calvin Min
 // SPDX-License-Identifier: MIT
+#include <type_traits>
+
 #include <databricks/core/client.h>
 #include <databricks/core/config.h>
 #include <gtest/gtest.h>
@@ -253,4 +255,215 @@ TEST(ClientTest, MissingSQLConfig) {
     auth.set_token("test_token");
 
     EXPECT_THROW({ databricks::Client::Builder().with_auth(auth).build(); }, std::runtime_error);
-}
\ No newline at end of file
+}
+/**
+ * @brief Test that execute_cursor surfaces connection failures
+ */
+TEST(ClientTest, ExecuteCursorWithoutConnectionThrows) {
+    databricks::AuthConfig auth;
+    auth.host = "https://invalid.databricks.com";
+    auth.set_token("invalid_token");
+
+    databricks::SQLConfig sql;
+    sql.http_path = "/sql/1.0/warehouses/invalid";
+
+    auto client = databricks::Client::Builder().with_auth(auth).with_sql(sql).build();
+
+    EXPECT_THROW({ client.execute_cursor("SELECT 1"); }, std::exception);
+}
+
+/**
+ * @brief Test that cursors are move-only
+ */
+TEST(ClientTest, CursorIsMoveOnly) {
+    static_assert(!std::is_copy_constructible_v<databricks::Cursor>);
+    static_assert(!std::is_copy_assignable_v<databricks::Cursor>);
+    static_assert(std::is_nothrow_move_constructible_v<databricks::Cursor>);
+    static_assert(std::is_nothrow_move_assignable_v<databricks::Cursor>);
+}
+
+// Test: execute_batch rejects empty, ragged and inconsistently typed rows before connecting
+TEST(ClientTest, ExecuteBatchValidatesRows) {
+    databricks::AuthConfig auth;
+    auth.host = "https://invalid.databricks.com";
+    auth.set_token("invalid_token");
+
+    databricks::SQLConfig sql;
+    sql.http_path = "/sql/1.0/warehouses/invalid";
+
+    auto client = databricks::Client::Builder().with_auth(auth).with_sql(sql).build();
+    using Parameter = databricks::Client::Parameter;
+    const std::string insert = "INSERT INTO t (id, name) VALUES (?, ?)";
+
+    EXPECT_THROW({ client.execute_batch(insert, {}); }, std::invalid_argument);
+    EXPECT_THROW({ client.execute_batch(insert, {{Parameter::from_int64(1), {"a"}}, {Parameter::from_int64(2)}}); },
+                 std::invalid_argument);
+    EXPECT_THROW({ client.execute_batch(insert, {{Parameter::from_int64(1), {"a"}}, {{"2"}, {"b"}}}); },
+                 std::invalid_argument);
+}
+
+// Test: BatchResult counts successful and failed rows
+TEST(ClientTest, BatchResultCounts) {
+    using RowStatus = databricks::Client::BatchResult::RowStatus;
+    databricks::Client::BatchResult result;
+    EXPECT_TRUE(result.all_succeeded());
+
+    result.row_status = {RowStatus::Success, RowStatus::SuccessWithInfo, RowStatus::Error, RowStatus::NotExecuted};
+    EXPECT_EQ(result.success_count(), 2);
+    EXPECT_EQ(result.error_count(), 2);
+    EXPECT_FALSE(result.all_succeeded());
+}
+
+// Test: Async configuration is applied through the builder and validated
+TEST(ClientTest, AsyncConfiguration) {
+    databricks::AuthConfig auth;
+    auth.host = "https://test.databricks.com";
+    auth.set_token("test_token");
+
+    databricks::SQLConfig sql;
+    sql.http_path = "/sql/1.0/warehouses/test";
+
+    databricks::AsyncConfig async;
+    EXPECT_EQ(async.worker_threads, 4);
+    EXPECT_EQ(async.max_pending_tasks, 256);
+    EXPECT_TRUE(async.is_valid());
+
+    async.worker_threads = 2;
+    auto client = databricks::Client::Builder().with_auth(auth).with_sql(sql).with_async(async).build();
+    EXPECT_EQ(client.get_async_config().worker_threads, 2);
+
+    async.worker_threads = 0;
+    EXPECT_FALSE(async.is_valid());
+    EXPECT_THROW({ databricks::Client::Builder().with_auth(auth).with_sql(sql).with_async(async).build(); },
+                 std::runtime_error);
+}
+
+// Test: query_async delivers failures through the future
+TEST(ClientTest, QueryAsyncPropagatesErrors) {
+    databricks::AuthConfig auth;
+    auth.host = "https://invalid.databricks.com";
+    auth.set_token("invalid_token");
+
+    databricks::SQLConfig sql;
+    sql.http_path = "/sql/1.0/warehouses/invalid";
+
+    databricks::RetryConfig retry;
+    retry.enabled = false;
+
+    auto client =
+        databricks::Client::Builder().with_auth(auth).with_sql(sql).with_retry(retry).with_async({1, 4}).build();
+
+    auto first = client.query_async("SELECT 1");
+    auto second = client.query_async("SELECT 2");
+    EXPECT_THROW(first.get(), std::exception);
+    EXPECT_THROW(second.get(), std::exception);
+}
+
+// Test: The query cache is configured through the builder and never caches failures
+TEST(ClientTest, QueryCacheConfiguration) {
+    databricks::AuthConfig auth;
+    auth.host = "https://invalid.databricks.com";
+    auth.set_token("invalid_token");
+
+    databricks::SQLConfig sql;
+    sql.http_path = "/sql/1.0/warehouses/invalid";
+
+    databricks::RetryConfig retry;
+    retry.enabled = false;
+
+    databricks::QueryCacheConfig cache;
+    EXPECT_FALSE(cache.enabled);
+    EXPECT_TRUE(cache.is_valid());
+    cache.enabled = true;
+
+    auto client =
+        databricks::Client::Builder().with_auth(auth).with_sql(sql).with_retry(retry).with_query_cache(cache).build();
+    EXPECT_TRUE(client.get_query_cache_config().enabled);
+
+    EXPECT_THROW(client.query("SELECT 1"), std::exception);
+    EXPECT_THROW(client.query_cached("SELECT  1;", {}, std::chrono::seconds(5)), std::exception);
+    auto stats = client.query_cache_stats();
+    EXPECT_EQ(stats.misses, 2u);
+    EXPECT_EQ(stats.entries, 0u);
+
+    cache.max_bytes = 0;
+    EXPECT_THROW(
+        { databricks::Client::Builder().with_auth(auth).with_sql(sql).with_query_cache(cache).build(); },
+        std::runtime_error);
+}
+
+// Test: Hedging is opt-in and needs pooling
+TEST(ClientTest, HedgeConfiguration) {
+    databricks::AuthConfig auth;
+    auth.host = "https://invalid.databricks.com";
+    auth.set_token("invalid_token");
+
+    databricks::SQLConfig sql;
+    sql.http_path = "/sql/1.0/warehouses/invalid";
+
+    auto plain = databricks::Client::Builder().with_auth(auth).with_sql(sql).build();
+    EXPECT_FALSE(plain.get_hedge_config().enabled);
+    EXPECT_EQ(plain.hedge_delay(), std::chrono::milliseconds(0));
+    EXPECT_FALSE(plain.cancel()); // Nothing executing
+
+    databricks::HedgeConfig hedge;
+    hedge.enabled = true;
+    hedge.initial_delay_ms = 40;
+    EXPECT_THROW(
+        { databricks::Client::Builder().with_auth(auth).with_sql(sql).with_hedging(hedge).build(); },
+        std::runtime_error);
+
+    databricks::PoolingConfig pooling;
+    pooling.enabled = true;
+    auto hedged =
+        databricks::Client::Builder().with_auth(auth).with_sql(sql).with_pooling(pooling).with_hedging(hedge).build();
+    EXPECT_EQ(hedged.hedge_delay(), std::chrono::milliseconds(40));
+
+    hedge.percentile = 100.0;
+    EXPECT_FALSE(hedge.is_valid());
+}
+
+// Test: A token cancelled before the call stops the query before it reaches the driver
+TEST(ClientTest, CancelledTokenStopsQuery) {
+    databricks::AuthConfig auth;
+    auth.host = "https://invalid.databricks.com";
+    auth.set_token("invalid_token");
+
+    databricks::SQLConfig sql;
+    sql.http_path = "/sql/1.0/warehouses/invalid";
+
+    auto client = databricks::Client::Builder().with_auth(auth).with_sql(sql).build();
+    databricks::QueryOptions options;
+    options.cancel = databricks::CancellationToken();
+    options.cancel->cancel();
+
+    try {
+        client.query("SELECT 1", {}, options);
+        FAIL() << "Expected CancelledError";
+    } catch (const databricks::CancelledError& e) {
+        EXPECT_FALSE(e.timed_out());
+        EXPECT_TRUE(e.diagnostics().empty());
+    }
+    EXPECT_THROW(client.query_async("SELECT 1", {}, options).get(), databricks::CancelledError);
+    EXPECT_THROW(client.execute_cursor("SELECT 1", {}, options), databricks::CancelledError);
+}
+
+// Test: preinitialize() reports a missing driver without throwing, and clients still use the shared environment
+TEST(ClientTest, PreinitializeReportsMissingDriver) {
+    EXPECT_FALSE(databricks::Client::preinitialize("No Such ODBC Driver"));
+    EXPECT_FALSE(databricks::Client::preinitialize("No Such ODBC Driver"));
+
+    databricks::AuthConfig auth;
+    auth.host = "https://invalid.databricks.com";
+    auth.set_token("invalid_token");
+
+    databricks::SQLConfig sql;
+    sql.http_path = "/sql/1.0/warehouses/invalid";
+    sql.odbc_driver_name = "No Such ODBC Driver";
+
+    // Clients come and go without releasing the environment the next one needs
+    for (int i = 0; i < 2; ++i) {
+        auto client = databricks::Client::Builder().with_auth(auth).with_sql(sql).build();
+        EXPECT_THROW(client.connect(), std::runtime_error);
+    }
+}
@@ -0,0 +1,37 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../src/internal/compression.h"
+
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using databricks::internal::gzip_compress;
+using databricks::internal::gzip_decompress;
+
+// Test: Compressed payloads are gzip streams that round-trip exactly
+TEST(CompressionTest, GzipRoundTrip) {
+    std::string json = "{\"tables\":[";
+    for (int i = 0; i < 1000; i++) {
+        json += "{\"name\":\"table_" + std::to_string(i) + "\",\"catalog_name\":\"main\"},";
+    }
+    json += "{}]}";
+
+    std::string compressed = gzip_compress(json);
+    ASSERT_GE(compressed.size(), 2);
+    EXPECT_EQ(static_cast<unsigned char>(compressed[0]), 0x1f);
+    EXPECT_EQ(static_cast<unsigned char>(compressed[1]), 0x8b);
+    EXPECT_LT(compressed.size(), json.size() / 5);
+
+    EXPECT_EQ(gzip_decompress(compressed), json);
+    EXPECT_EQ(gzip_decompress(gzip_compress("")), "");
+}
+
+// Test: Corrupt or truncated input is rejected
+TEST(CompressionTest, RejectsInvalidStreams) {
+    EXPECT_THROW(gzip_decompress("not gzip"), std::runtime_error);
+
+    std::string compressed = gzip_compress(std::string(10000, 'x'));
+    EXPECT_THROW(gzip_decompress(compressed.substr(0, compressed.size() / 2)), std::runtime_error);
+}
@@ -1,5 +1,6 @@
 // Copyright (c) 2025 Calvin Min
 // SPDX-License-Identifier: MIT
+#include <chrono>
 #include <cstdlib>
 #include <filesystem>
 #include <fstream>
@@ -139,6 +140,22 @@ token = staging_token
     EXPECT_TRUE(auth.has_secure_token());
 }
 
+/**
+ * @brief Test that a cached profile file is re-read once it changes
+ */
+TEST_F(ConfigTest, ProfileFileReloadsAfterChange) {
+    create_config_file("[DEFAULT]\nhost = https://one.databricks.com\ntoken = token_1\n");
+    fs::path config_path = temp_dir / ".databrickscfg";
+    fs::last_write_time(config_path, fs::file_time_type::clock::now() - std::chrono::hours(1));
+    EXPECT_EQ(databricks::AuthConfig::from_profile("DEFAULT").host, "https://one.databricks.com");
+    EXPECT_EQ(databricks::AuthConfig::from_profile("DEFAULT").host, "https://one.databricks.com");
+
+    // Same size, new contents
+    create_config_file("[DEFAULT]\nhost = https://two.databricks.com\ntoken = token_2\n");
+    EXPECT_EQ(databricks::AuthConfig::from_profile("DEFAULT").host, "https://two.databricks.com");
+    EXPECT_THROW(databricks::AuthConfig::from_profile("missing"), std::runtime_error);
+}
+
 /**
  * @brief Test loading AuthConfig from environment variables
  */
@@ -282,3 +299,53 @@ TEST_F(ConfigTest, PoolingConfigValidation) {
     pooling.connection_timeout_ms = 0;
     EXPECT_FALSE(pooling.is_valid());
 }
+
+/**
+ * @brief Test HttpConfig defaults and validation
+ */
+TEST_F(ConfigTest, HttpConfigValidation) {
+    databricks::HttpConfig http;
+
+    // Default config is valid and multiplexes over HTTP/2
+    EXPECT_TRUE(http.is_valid());
+    EXPECT_TRUE(http.http2);
+    EXPECT_EQ(http.max_concurrent_requests, 16);
+
+    // At least one request must be allowed in flight
+    http.max_concurrent_requests = 0;
+    EXPECT_FALSE(http.is_valid());
+
+    // Responses are compressed by default; request compression is opt-in
+    http = databricks::HttpConfig{};
+    EXPECT_TRUE(http.accept_compressed);
+    EXPECT_EQ(http.gzip_request_min_bytes, 0);
+
+    // Rate limiting is off by default; the retry policy and burst are validated too
+    EXPECT_EQ(http.requests_per_second, 0.0);
+    http.requests_per_second = -1.0;
+    EXPECT_FALSE(http.is_valid());
+    http = databricks::HttpConfig{};
+    http.burst = 0;
+    EXPECT_FALSE(http.is_valid());
+    http = databricks::HttpConfig{};
+    http.retry.max_attempts = 0;
+    EXPECT_FALSE(http.is_valid());
+}
+
+/**
+ * @brief Test PollConfig defaults and validation
+ */
+TEST_F(ConfigTest, PollConfigValidation) {
+    databricks::PollConfig poll;
+    EXPECT_TRUE(poll.is_valid());
+
+    // The interval may only grow, and never beyond its cap
+    poll.backoff_multiplier = 0.9;
+    EXPECT_FALSE(poll.is_valid());
+    poll = databricks::PollConfig{};
+    poll.max_interval_ms = poll.initial_interval_ms - 1;
+    EXPECT_FALSE(poll.is_valid());
+    poll = databricks::PollConfig{};
+    poll.initial_interval_ms = 0;
+    EXPECT_FALSE(poll.is_valid());
+}
@@ -1,5 +1,8 @@
 // Copyright (c) 2025 Calvin Min
 // SPDX-License-Identifier: MIT
+#include "../../src/internal/pool_manager.h"
+
+#include <atomic>
 #include <chrono>
 #include <thread>
 #include <vector>
@@ -130,3 +133,224 @@ TEST_F(ConnectionPoolTest, PoolingConfigValidation) {
     invalid_pooling.max_connections = 5;
     EXPECT_FALSE(invalid_pooling.is_valid());
 }
+
+/**
+ * @brief Test that failed connection attempts give their pool slot back
+ */
+TEST_F(ConnectionPoolTest, FailedAcquireReleasesSlot) {
+    databricks::ConnectionPool pool(auth, sql, 1, 2);
+
+    // More attempts than max_connections: a leaked slot would make later attempts time out
+    for (int i = 0; i < 3; i++) {
+        try {
+            pool.acquire();
+            GTEST_SKIP() << "Connection unexpectedly succeeded";
+        } catch (const std::runtime_error& e) {
+            EXPECT_EQ(std::string(e.what()).find("Timeout"), std::string::npos);
+        }
+    }
+
+    auto stats = pool.get_stats();
+    EXPECT_EQ(stats.total_connections, 0);
+    EXPECT_EQ(stats.active_connections, 0);
+    EXPECT_EQ(stats.pending_connections, 0);
+}
+
+/**
+ * @brief Test that a failed warm-up leaves no reserved slots behind
+ */
+TEST_F(ConnectionPoolTest, FailedWarmUpReleasesSlots) {
+    databricks::ConnectionPool pool(auth, sql, 3, 5);
+
+    EXPECT_THROW(pool.warm_up(), std::runtime_error);
+
+    auto stats = pool.get_stats();
+    EXPECT_EQ(stats.total_connections, 0);
+    EXPECT_EQ(stats.available_connections, 0);
+    EXPECT_EQ(stats.pending_connections, 0);
+}
+
+/**
+ * @brief Test health, eviction and maintenance settings in PoolingConfig
+ */
+TEST_F(ConnectionPoolTest, PoolingHealthConfig) {
+    databricks::PoolingConfig defaults;
+    EXPECT_EQ(defaults.idle_timeout_ms, 600000);
+    EXPECT_EQ(defaults.max_lifetime_ms, 1800000);
+    EXPECT_TRUE(defaults.validate_on_borrow);
+    EXPECT_EQ(defaults.validation_idle_ms, 30000);
+    EXPECT_EQ(defaults.maintenance_interval_ms, 30000);
+
+    // Zero disables a feature; negative values are invalid
+    pooling.idle_timeout_ms = 0;
+    pooling.max_lifetime_ms = 0;
+    pooling.maintenance_interval_ms = 0;
+    EXPECT_TRUE(pooling.is_valid());
+
+    pooling.max_lifetime_ms = -1;
+    EXPECT_FALSE(pooling.is_valid());
+}
+
+/**
+ * @brief Test that maintenance leaves an unused pool empty and stops on shutdown
+ */
+TEST_F(ConnectionPoolTest, MaintenanceSkipsUnusedPool) {
+    pooling.maintenance_interval_ms = 10;
+    databricks::ConnectionPool pool(auth, sql, pooling);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_NO_THROW(pool.run_maintenance());
+    EXPECT_EQ(pool.get_stats().total_connections, 0);
+
+    pool.shutdown();
+    EXPECT_NO_THROW(pool.run_maintenance());
+}
+
+/**
+ * @brief Test that an unconnected client reports itself unhealthy without throwing
+ */
+TEST_F(ConnectionPoolTest, UnconnectedClientIsUnhealthy) {
+    auto client = databricks::Client::Builder().with_auth(auth).with_sql(sql).build();
+    EXPECT_FALSE(client.is_healthy());
+    EXPECT_FALSE(client.is_healthy(true));
+}
+
+/**
+ * @brief Test that try_acquire still throws once the pool is shut down
+ */
+TEST_F(ConnectionPoolTest, TryAcquireOnShutdownPoolThrows) {
+    databricks::ConnectionPool pool(auth, sql, pooling);
+    pool.shutdown();
+
+    // A shut down pool still throws; only running out of time is reported as empty
+    EXPECT_THROW(pool.try_acquire(std::chrono::steady_clock::now()), std::runtime_error);
+}
+
+/**
+ * @brief Test acquire timeout and reuse policy configuration
+ */
+TEST_F(ConnectionPoolTest, PoolTuningConfig) {
+    databricks::PoolingConfig defaults;
+    EXPECT_EQ(defaults.connection_timeout_ms, 5000);
+    EXPECT_EQ(defaults.reuse_policy, databricks::PoolingConfig::ReusePolicy::FIFO);
+    EXPECT_EQ(defaults.shards, 0u);
+
+    pooling.connection_timeout_ms = 50;
+    pooling.reuse_policy = databricks::PoolingConfig::ReusePolicy::LIFO;
+    databricks::RetryConfig retry;
+    retry.enabled = false;
+
+    auto client =
+        databricks::Client::Builder().with_auth(auth).with_sql(sql).with_pooling(pooling).with_retry(retry).build();
+    EXPECT_EQ(client.get_pooling_config().reuse_policy, databricks::PoolingConfig::ReusePolicy::LIFO);
+    EXPECT_EQ(client.get_pooling_config().connection_timeout_ms, 50);
+}
+
+/**
+ * @brief Test that a waiter on a full pool times out and leaves no waiter behind
+ */
+TEST_F(ConnectionPoolTest, WaiterTimesOutOnFullPool) {
+    pooling.min_connections = 0;
+    pooling.max_connections = 0;
+    pooling.shards = 4;
+    databricks::ConnectionPool pool(auth, sql, pooling);
+
+    // No capacity at all, so every attempt has to wait for a return that never comes
+    for (int i = 0; i < 2; i++) {
+        auto start = std::chrono::steady_clock::now();
+        EXPECT_FALSE(pool.try_acquire(start + std::chrono::milliseconds(20)).has_value());
+        EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20));
+    }
+
+    auto stats = pool.get_stats();
+    EXPECT_EQ(stats.total_connections, 0);
+    EXPECT_EQ(stats.available_connections, 0);
+    EXPECT_EQ(stats.active_connections, 0);
+}
+
+/**
+ * @brief Test that shutdown wakes threads waiting for a connection
+ */
+TEST_F(ConnectionPoolTest, ShutdownWakesWaiters) {
+    pooling.min_connections = 0;
+    pooling.max_connections = 0;
+    pooling.connection_timeout_ms = 60000;
+    databricks::ConnectionPool pool(auth, sql, pooling);
+
+    std::vector<std::thread> waiters;
+    std::atomic<int> woken{0};
+    for (int i = 0; i < 3; i++) {
+        waiters.emplace_back([&]() {
+            EXPECT_THROW(pool.acquire(), std::runtime_error);
+            woken++;
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    auto start = std::chrono::steady_clock::now();
+    pool.shutdown();
+    for (auto& waiter : waiters) {
+        waiter.join();
+    }
+    EXPECT_EQ(woken.load(), 3);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(10));
+}
+
+/**
+ * @brief Test that pools are shared by full key and kept apart by any differing field
+ */
+TEST_F(ConnectionPoolTest, PoolManagerKeysOnFullConfig) {
+    auto& manager = databricks::internal::PoolManager::instance();
+    auth.host = "https://pool-manager-keys.databricks.com";
+
+    auto pool = manager.get_pool(auth, sql, pooling);
+    EXPECT_EQ(manager.get_pool(auth, sql, pooling), pool);
+
+    databricks::AuthConfig rotated = auth;
+    rotated.set_token("test_token_rotated");
+    EXPECT_NE(manager.get_pool(rotated, sql, pooling), pool);
+
+    databricks::SQLConfig other_path = sql;
+    other_path.http_path = "/sql/1.0/warehouses/other";
+    EXPECT_NE(manager.get_pool(auth, other_path, pooling), pool);
+
+    // Each pool runs with the settings its Clients asked for
+    databricks::PoolingConfig bigger = pooling;
+    bigger.max_connections++;
+    EXPECT_NE(manager.get_pool(auth, sql, bigger), pool);
+    databricks::RetryConfig no_retry;
+    no_retry.enabled = false;
+    EXPECT_NE(manager.get_pool(auth, sql, pooling, no_retry), pool);
+    EXPECT_EQ(manager.get_pool(auth, sql, pooling, databricks::RetryConfig{}), pool);
+
+    // The key's hash covers the token by value, not the SecureString's address
+    databricks::RetryConfig retry;
+    databricks::internal::PoolKey key{auth.host, auth.get_secure_token(), sql.http_path, auth.timeout_seconds,
+                                      sql.odbc_driver_name, pooling, retry};
+    databricks::internal::PoolKey copy = key;
+    EXPECT_EQ(key.hash(), copy.hash());
+    EXPECT_EQ(key.hash(), databricks::internal::PoolKeyView::of(auth, sql, pooling, retry).hash());
+    EXPECT_TRUE(databricks::internal::PoolKeyView::of(auth, sql, pooling, retry).matches(copy));
+    EXPECT_FALSE(databricks::internal::PoolKeyView::of(auth, sql, bigger, retry).matches(copy));
+}
+
+/**
+ * @brief Test that pools nobody holds are reclaimed after their idle timeout
+ */
+TEST_F(ConnectionPoolTest, PoolManagerReclaimsIdlePools) {
+    auto& manager = databricks::internal::PoolManager::instance();
+    auth.host = "https://pool-manager-reclaim.databricks.com";
+    pooling.idle_timeout_ms = 1;
+    pooling.maintenance_interval_ms = 0;
+
+    auto held = manager.get_pool(auth, sql, pooling);
+    databricks::AuthConfig rotated = auth;
+    rotated.set_token("test_token_rotated");
+    std::weak_ptr<databricks::ConnectionPool> released = manager.get_pool(rotated, sql, pooling);
+    EXPECT_FALSE(released.expired());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_GE(manager.reclaim_idle(), 1u);
+    EXPECT_TRUE(released.expired());
+    EXPECT_EQ(manager.get_pool(auth, sql, pooling), held);
+}
@@ -0,0 +1,56 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../src/internal/curl_multi.h"
+
+#include <chrono>
+#include <future>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+using databricks::internal::CurlMulti;
+using databricks::internal::CurlSession;
+
+namespace {
+// A request whose outcome is delivered through the returned future
+std::future<CurlMulti::Result> submit_to(CurlMulti& engine, CurlMulti::Request request) {
+    auto promise = std::make_shared<std::promise<CurlMulti::Result>>();
+    auto future = promise->get_future();
+    request.on_complete = [promise](CurlMulti::Result&& result) { promise->set_value(std::move(result)); };
+    EXPECT_TRUE(engine.submit(std::move(request)));
+    return future;
+}
+} // namespace
+
+// Test: A transport failure completes the request with an error instead of hanging
+TEST(CurlMultiTest, ReportsTransportErrors) {
+    CurlMulti engine(std::make_shared<CurlSession>(), 4, false);
+
+    CurlMulti::Request request;
+    request.url = "http://127.0.0.1:1/";
+    request.timeout_seconds = 5;
+    auto result = submit_to(engine, std::move(request));
+
+    ASSERT_EQ(result.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    auto outcome = result.get();
+    EXPECT_FALSE(outcome.error.empty());
+    EXPECT_FALSE(outcome.cancelled);
+    EXPECT_EQ(engine.in_flight(), 0);
+}
+
+// Test: Requests still waiting when the engine stops are cancelled, not dropped
+TEST(CurlMultiTest, ShutdownCancelsQueuedRequests) {
+    std::future<CurlMulti::Result> result;
+    {
+        CurlMulti engine(std::make_shared<CurlSession>(), 0, true);
+        EXPECT_EQ(engine.max_in_flight(), 1);
+
+        CurlMulti::Request request;
+        request.url = "http://127.0.0.1:1/";
+        request.not_before = std::chrono::steady_clock::now() + std::chrono::hours(1);
+        result = submit_to(engine, std::move(request));
+    }
+
+    ASSERT_EQ(result.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_TRUE(result.get().cancelled);
+}
@@ -0,0 +1,124 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../src/internal/curl_session.h"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using databricks::internal::BodyChunkCallback;
+using databricks::internal::curl_collect_header;
+using databricks::internal::curl_write_body;
+using databricks::internal::CurlSession;
+using databricks::internal::HttpResponse;
+using databricks::internal::ResponseWriter;
+
+namespace {
+size_t header(ResponseWriter& writer, std::string line) {
+    return curl_collect_header(line.data(), 1, line.size(), &writer);
+}
+
+size_t body(ResponseWriter& writer, std::string chunk) {
+    return curl_write_body(chunk.data(), 1, chunk.size(), &writer);
+}
+} // namespace
+
+// Test: A released handle is handed out again instead of creating a new one
+TEST(CurlSessionTest, ReusesReleasedHandles) {
+    CurlSession session(4);
+
+    CURL* first = nullptr;
+    {
+        auto lease = session.acquire();
+        first = lease.get();
+        ASSERT_NE(first, nullptr);
+    }
+    EXPECT_EQ(session.idle_handles(), 1);
+
+    auto again = session.acquire();
+    EXPECT_EQ(again.get(), first);
+    EXPECT_EQ(session.idle_handles(), 0);
+}
+
+// Test: Handles beyond the idle limit are freed when returned
+TEST(CurlSessionTest, CapsIdleHandles) {
+    CurlSession session(2);
+    {
+        std::vector<CurlSession::Lease> leases;
+        for (int i = 0; i < 5; i++) {
+            leases.push_back(session.acquire());
+        }
+    }
+    EXPECT_EQ(session.idle_handles(), 2);
+}
+
+// Test: The process-wide session is a single instance
+TEST(CurlSessionTest, SharedSessionIsSingleton) {
+    EXPECT_EQ(CurlSession::shared(), CurlSession::shared());
+}
+
+// Test: Headers are parsed without copies of the line, and Content-Length sizes the body once
+TEST(CurlSessionTest, CollectsHeadersAndReservesBody) {
+    HttpResponse response{};
+    ResponseWriter writer;
+    writer.response = &response;
+
+    header(writer, "HTTP/1.1 100 Continue\r\n");
+    header(writer, "X-Stale: yes\r\n");
+    header(writer, "HTTP/2 200\r\n");
+    header(writer, "content-length: 4096\r\n");
+    header(writer, "Retry-After:  3 \r\n");
+    header(writer, "\r\n");
+
+    EXPECT_EQ(response.status_code, 200);
+    EXPECT_EQ(response.headers.count("X-Stale"), 0);
+    EXPECT_EQ(response.headers["Retry-After"], "3");
+    EXPECT_EQ(response.headers["content-length"], "4096");
+    EXPECT_GE(response.body.capacity(), 4096);
+
+    EXPECT_EQ(body(writer, "{\"ok\":true}"), 11);
+    EXPECT_EQ(response.body, "{\"ok\":true}");
+}
+
+// Test: A streamed 200 body goes to the consumer; error bodies are still buffered
+TEST(CurlSessionTest, StreamsSuccessfulBodies) {
+    std::string received;
+    BodyChunkCallback on_chunk = [&](std::string_view chunk) { received.append(chunk); };
+
+    HttpResponse ok{};
+    ResponseWriter streaming;
+    streaming.response = &ok;
+    streaming.on_chunk = &on_chunk;
+    header(streaming, "HTTP/2 200\r\n");
+    body(streaming, "[1,");
+    body(streaming, "2]");
+    EXPECT_EQ(received, "[1,2]");
+    EXPECT_TRUE(ok.body.empty());
+    EXPECT_EQ(streaming.streamed, 5);
+
+    HttpResponse failed{};
+    ResponseWriter buffered;
+    buffered.response = &failed;
+    buffered.on_chunk = &on_chunk;
+    header(buffered, "HTTP/2 404\r\n");
+    body(buffered, "not found");
+    EXPECT_EQ(failed.body, "not found");
+    EXPECT_EQ(received, "[1,2]");
+}
+
+// Test: A consumer that throws aborts the transfer and keeps its exception
+TEST(CurlSessionTest, ConsumerErrorAbortsTransfer) {
+    BodyChunkCallback on_chunk = [](std::string_view) { throw std::invalid_argument("bad json"); };
+
+    HttpResponse response{};
+    ResponseWriter writer;
+    writer.response = &response;
+    writer.on_chunk = &on_chunk;
+    header(writer, "HTTP/2 200\r\n");
+
+    EXPECT_EQ(body(writer, "{"), 0);
+    ASSERT_TRUE(writer.error);
+    EXPECT_THROW(std::rethrow_exception(writer.error), std::invalid_argument);
+}
@@ -0,0 +1,62 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../src/internal/odbc_statement.h"
+
+#include <databricks/core/errors.h>
+
+#include <gtest/gtest.h>
+
+using databricks::DiagnosticRecord;
+using databricks::ErrorCategory;
+using databricks::classify_diagnostic;
+
+// Test: SQLSTATEs are classified exactly first, then by class
+TEST(ErrorsTest, ClassifiesBySqlstate) {
+    EXPECT_EQ(classify_diagnostic({"HYT00", 0, "Timeout expired"}), ErrorCategory::Timeout);
+    EXPECT_EQ(classify_diagnostic({"08S01", 0, "Communication link failure"}), ErrorCategory::Connection);
+    EXPECT_EQ(classify_diagnostic({"08001", 0, ""}), ErrorCategory::Connection);
+    EXPECT_EQ(classify_diagnostic({"28000", 0, ""}), ErrorCategory::Authentication);
+    EXPECT_EQ(classify_diagnostic({"42S02", 0, "Table not found"}), ErrorCategory::Query);
+    EXPECT_EQ(classify_diagnostic({"HY013", 0, ""}), ErrorCategory::Resource);
+    EXPECT_EQ(classify_diagnostic({"HY010", 0, ""}), ErrorCategory::Other);
+    EXPECT_EQ(classify_diagnostic({"", 0, "timeout"}), ErrorCategory::Other);
+}
+
+// Test: General errors count as transient only with a throttling or gateway HTTP status
+TEST(ErrorsTest, GeneralErrorNeedsTransientHttpStatus) {
+    EXPECT_EQ(classify_diagnostic({"HY000", 14, "Unexpected response: HTTP Response code: 503"}),
+              ErrorCategory::Unavailable);
+    EXPECT_EQ(classify_diagnostic({"HY000", 14, "http error 429 Too Many Requests"}), ErrorCategory::Unavailable);
+    EXPECT_EQ(classify_diagnostic({"HY000", 14, "HTTP Response code: 401"}), ErrorCategory::Other);
+    EXPECT_EQ(classify_diagnostic({"HY000", 0, "Table has 5030 rows"}), ErrorCategory::Other);
+    EXPECT_EQ(classify_diagnostic({"HY000", 0, "error 503 before any mention of HTTP 400"}), ErrorCategory::Other);
+}
+
+// Test: The first classified record decides the category and fields
+TEST(ErrorsTest, SqlErrorUsesFirstClassifiedRecord) {
+    databricks::SqlError error("Query failed", {{"01000", 1, "General warning"}, {"42000", 42, "Syntax error"}});
+    EXPECT_EQ(error.category(), ErrorCategory::Query);
+    EXPECT_EQ(error.sqlstate(), "42000");
+    EXPECT_EQ(error.native_error(), 42);
+    EXPECT_FALSE(error.is_transient());
+    EXPECT_EQ(error.diagnostics().size(), 2u);
+
+    databricks::SqlError empty("No diagnostics", {});
+    EXPECT_EQ(empty.category(), ErrorCategory::Other);
+    EXPECT_EQ(empty.sqlstate(), "");
+}
+
+// Test: Thrown errors use the subclass for their category
+TEST(ErrorsTest, ThrowsSubclassForCategory) {
+    EXPECT_THROW(databricks::internal::throw_sql_error("x", {{"08S01", 0, ""}}), databricks::ConnectionError);
+    EXPECT_THROW(databricks::internal::throw_sql_error("x", {{"HYT01", 0, ""}}), databricks::TimeoutError);
+    EXPECT_THROW(databricks::internal::throw_sql_error("x", {{"28000", 0, ""}}), databricks::AuthenticationError);
+    EXPECT_THROW(databricks::internal::throw_sql_error("x", {{"22003", 0, ""}}), databricks::QueryError);
+    try {
+        databricks::internal::throw_sql_error("x", {{"HY000", 0, "HTTP 503"}});
+        FAIL() << "Expected SqlError";
+    } catch (const databricks::SqlError& e) {
+        EXPECT_TRUE(e.is_transient());
+        EXPECT_EQ(databricks::error_category_to_string(e.category()), "UNAVAILABLE");
+    }
+}
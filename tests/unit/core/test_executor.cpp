@@ -0,0 +1,117 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../src/internal/executor.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using databricks::internal::Executor;
+
+// Test: submit() returns the task's result and propagates its exceptions
+TEST(ExecutorTest, SubmitReturnsResultsAndExceptions) {
+    Executor executor(2, 8);
+
+    auto value = executor.submit([]() { return 42; });
+    auto failure = executor.submit([]() -> int { throw std::runtime_error("boom"); });
+
+    EXPECT_EQ(value.get(), 42);
+    EXPECT_THROW(failure.get(), std::runtime_error);
+}
+
+// Test: No more tasks run at once than there are workers
+TEST(ExecutorTest, ConcurrencyBoundedByWorkerCount) {
+    Executor executor(3, 64);
+    std::atomic<int> running{0};
+    std::atomic<int> peak{0};
+
+    std::vector<std::future<void>> futures;
+    for (int i = 0; i < 20; i++) {
+        futures.push_back(executor.submit([&]() {
+            int now = ++running;
+            int seen = peak.load();
+            while (now > seen && !peak.compare_exchange_weak(seen, now)) {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            --running;
+        }));
+    }
+    for (auto& f : futures) {
+        f.get();
+    }
+
+    EXPECT_EQ(executor.worker_count(), 3);
+    EXPECT_LE(peak.load(), 3);
+}
+
+// Test: post() blocks once the queue is full until a worker takes a task
+TEST(ExecutorTest, FullQueueAppliesBackpressure) {
+    Executor executor(1, 1);
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool release = false;
+
+    auto blocker = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&]() { return release; });
+    };
+
+    executor.post(blocker); // Occupies the only worker
+    while (executor.pending() > 0) {
+        std::this_thread::yield();
+    }
+    executor.post(blocker); // Fills the queue
+
+    std::atomic<bool> third_posted{false};
+    std::thread producer([&]() {
+        executor.post([]() {});
+        third_posted = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(third_posted.load());
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        release = true;
+    }
+    cv.notify_all();
+    producer.join();
+    EXPECT_TRUE(third_posted.load());
+}
+
+// Test: A worker posting to its own full queue runs the task inline instead of deadlocking
+TEST(ExecutorTest, PostFromWorkerDoesNotDeadlock) {
+    Executor executor(1, 1);
+
+    auto outer = executor.submit([&]() {
+        executor.post([]() {}); // Fits in the queue
+        auto inner = executor.submit([]() { return 7; });
+        return inner.get();
+    });
+
+    EXPECT_EQ(outer.get(), 7);
+}
+
+// Test: Shutdown runs queued tasks and rejects new ones
+TEST(ExecutorTest, ShutdownDrainsQueue) {
+    std::atomic<int> completed{0};
+    Executor executor(1, 16);
+
+    for (int i = 0; i < 10; i++) {
+        executor.post([&]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            ++completed;
+        });
+    }
+    executor.shutdown();
+
+    EXPECT_EQ(completed.load(), 10);
+    EXPECT_THROW(executor.post([]() {}), std::runtime_error);
+}
@@ -0,0 +1,136 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../src/internal/http_client.h"
+
+#include <chrono>
+#include <exception>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <curl/curl.h>
+#include <gtest/gtest.h>
+
+using databricks::internal::HttpClient;
+using databricks::internal::parse_retry_after;
+
+namespace {
+std::vector<std::string> lines(const curl_slist* headers) {
+    std::vector<std::string> out;
+    for (const curl_slist* node = headers; node; node = node->next) {
+        out.emplace_back(node->data);
+    }
+    return out;
+}
+
+databricks::AuthConfig test_auth() {
+    databricks::AuthConfig auth;
+    auth.host = "https://test.databricks.com";
+    auth.set_token("first_token");
+    return auth;
+}
+} // namespace
+
+// Test: The header list is built once and shared by every request
+TEST(HttpClientTest, HeaderListIsCached) {
+    HttpClient client(test_auth());
+
+    auto headers = client.header_list();
+    ASSERT_NE(headers, nullptr);
+    EXPECT_EQ(client.header_list(), headers);
+
+    auto entries = lines(headers.get());
+    ASSERT_EQ(entries.size(), 3);
+    EXPECT_EQ(entries[0], "Authorization: Bearer first_token");
+    EXPECT_EQ(entries[1], "Content-Type: application/json");
+    EXPECT_EQ(entries[2], "Accept: application/json");
+}
+
+// Test: Gzip-compressed POST bodies are labelled with Content-Encoding
+TEST(HttpClientTest, GzipHeaderListAddsContentEncoding) {
+    HttpClient client(test_auth());
+
+    auto entries = lines(client.header_list(true).get());
+    ASSERT_EQ(entries.size(), 4);
+    EXPECT_EQ(entries[0], "Authorization: Bearer first_token");
+    EXPECT_EQ(entries[3], "Content-Encoding: gzip");
+
+    client.set_token("second_token");
+    EXPECT_EQ(lines(client.header_list(true).get())[0], "Authorization: Bearer second_token");
+}
+
+// Test: Rotating the token rebuilds the list without touching one still in use
+TEST(HttpClientTest, SetTokenRebuildsHeaders) {
+    HttpClient client(test_auth());
+    auto before = client.header_list();
+
+    client.set_token("second_token");
+    auto after = client.header_list();
+
+    EXPECT_NE(after, before);
+    EXPECT_EQ(lines(after.get())[0], "Authorization: Bearer second_token");
+    EXPECT_EQ(lines(before.get())[0], "Authorization: Bearer first_token");
+}
+
+// Test: Retry-After is read in seconds or as an HTTP-date, under any header case
+TEST(HttpClientTest, ParsesRetryAfter) {
+    databricks::internal::HttpResponse response;
+    EXPECT_FALSE(parse_retry_after(response).has_value());
+
+    response.headers["Retry-After"] = "3";
+    EXPECT_EQ(parse_retry_after(response), std::chrono::milliseconds(3000));
+
+    response.headers.clear();
+    response.headers["retry-after"] = "Wed, 21 Oct 2015 07:28:30 GMT";
+    auto now = std::chrono::system_clock::from_time_t(1445412500); // 07:28:20 GMT
+    EXPECT_EQ(parse_retry_after(response, now), std::chrono::milliseconds(10000));
+    EXPECT_EQ(parse_retry_after(response, now + std::chrono::minutes(1)), std::chrono::milliseconds(0));
+
+    response.headers["retry-after"] = "soon";
+    EXPECT_FALSE(parse_retry_after(response).has_value());
+}
+
+// Test: Transport errors are retried per RetryConfig and rethrown once attempts run out
+TEST(HttpClientTest, RetriesConnectionErrorsPerConfig) {
+    databricks::AuthConfig auth = test_auth();
+    auth.host = "http://127.0.0.1:1";
+
+    databricks::HttpConfig http;
+    http.retry.max_attempts = 3;
+    http.retry.initial_backoff_ms = 50;
+    http.retry.max_backoff_ms = 50;
+    HttpClient client(auth, "2.2", http);
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_THROW(client.get("/clusters/list"), std::runtime_error);
+    // Two backoffs of 50ms ±25% between the three attempts
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(75));
+
+    http.retry.retry_on_connection_lost = false;
+    HttpClient no_retry(auth, "2.2", http);
+    start = std::chrono::steady_clock::now();
+    EXPECT_THROW(no_retry.get("/clusters/list"), std::runtime_error);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(1000));
+}
+
+// Test: A callback-style async request reports a transport error through its callback, off the caller's thread
+TEST(HttpClientTest, AsyncCallbackReceivesError) {
+    databricks::AuthConfig auth = test_auth();
+    auth.host = "http://127.0.0.1:1";
+    databricks::HttpConfig http;
+    http.retry.retry_on_connection_lost = false;
+    HttpClient client(auth, "2.2", http);
+
+    std::promise<std::thread::id> called_on;
+    std::exception_ptr received;
+    client.get_async("/clusters/list", [&](std::exception_ptr error, databricks::internal::HttpResponse&&) {
+        received = error;
+        called_on.set_value(std::this_thread::get_id());
+    });
+    auto future = called_on.get_future();
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    EXPECT_NE(future.get(), std::this_thread::get_id());
+    ASSERT_TRUE(received);
+    EXPECT_THROW(std::rethrow_exception(received), std::runtime_error);
+}
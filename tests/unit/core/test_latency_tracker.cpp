@@ -0,0 +1,35 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../src/internal/latency_tracker.h"
+
+#include <gtest/gtest.h>
+
+using databricks::internal::LatencyTracker;
+using namespace std::chrono_literals;
+
+// Test: The initial delay holds until enough samples are known
+TEST(LatencyTrackerTest, InitialDelayUntilMinSamples) {
+    LatencyTracker tracker(90.0, 100ms, 1ms, 10);
+    EXPECT_EQ(tracker.threshold(), 100ms);
+    for (int i = 0; i < 9; i++) {
+        tracker.record(5ms);
+    }
+    EXPECT_EQ(tracker.threshold(), 100ms);
+    tracker.record(5ms);
+    EXPECT_EQ(tracker.threshold(), 5ms);
+}
+
+// Test: The threshold follows the percentile of recent samples, never below the floor
+TEST(LatencyTrackerTest, TracksPercentile) {
+    LatencyTracker tracker(90.0, 100ms, 2ms, 10);
+    for (int i = 1; i <= 80; i++) { // A multiple of RECOMPUTE_EVERY
+        tracker.record(std::chrono::milliseconds(i));
+    }
+    EXPECT_EQ(tracker.threshold(), 72ms);
+
+    LatencyTracker floored(50.0, 100ms, 20ms, 1);
+    for (size_t i = 0; i < LatencyTracker::RECOMPUTE_EVERY; i++) {
+        floored.record(1ms);
+    }
+    EXPECT_EQ(floored.threshold(), 20ms);
+}
@@ -0,0 +1,180 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../src/internal/http_client.h"
+#include "../../src/internal/metrics.h"
+
+#include <databricks/core/metrics.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using databricks::MetricCounter;
+using databricks::MetricLabels;
+using databricks::MetricsRegistry;
+using databricks::MetricTimer;
+using namespace std::chrono_literals;
+
+namespace {
+/**
+ * @brief Removes any installed sink when a test ends
+ */
+class MetricsSinkTest : public ::testing::Test {
+protected:
+    void TearDown() override { databricks::set_metrics_sink(nullptr); }
+};
+
+size_t count_occurrences(const std::string& text, const std::string& needle) {
+    size_t count = 0;
+    for (size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + 1)) {
+        ++count;
+    }
+    return count;
+}
+} // namespace
+
+// Test: Percentiles land within the histogram's bucket precision
+TEST(MetricsRegistryTest, PercentilesWithinBucketPrecision) {
+    MetricsRegistry registry;
+    for (int us = 1; us <= 1000; ++us) {
+        registry.observe(MetricTimer::QueryExecute, std::chrono::microseconds(us), {});
+    }
+
+    auto snapshot = registry.histogram(MetricTimer::QueryExecute);
+    EXPECT_EQ(snapshot.count, 1000u);
+    EXPECT_EQ(snapshot.max, 1000us);
+    EXPECT_EQ(snapshot.sum, std::chrono::microseconds(500500));
+
+    for (double q : {0.5, 0.9, 0.99}) {
+        double expected = q * 1000e3;
+        double actual = static_cast<double>(snapshot.percentile(q).count());
+        EXPECT_GE(actual, expected) << "q=" << q;
+        EXPECT_LE(actual, expected * 1.07) << "q=" << q;
+    }
+    EXPECT_EQ(snapshot.percentile(1.0), 1000us);
+}
+
+// Test: An empty histogram reports zero everywhere
+TEST(MetricsRegistryTest, EmptyHistogram) {
+    MetricsRegistry registry;
+    auto snapshot = registry.histogram(MetricTimer::HttpRequest);
+    EXPECT_EQ(snapshot.count, 0u);
+    EXPECT_TRUE(snapshot.buckets.empty());
+    EXPECT_EQ(snapshot.percentile(0.99), 0ns);
+}
+
+// Test: Samples from several threads, including ones that have exited, are merged
+TEST(MetricsRegistryTest, MergesAcrossThreads) {
+    MetricsRegistry registry;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&registry]() {
+            for (int i = 0; i < 1000; ++i) {
+                registry.observe(MetricTimer::PoolAcquireWait, 5us, {});
+                registry.add(MetricCounter::RowsFetched, 2, {});
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    registry.add(MetricCounter::RowsFetched, 1, {});
+
+    EXPECT_EQ(registry.histogram(MetricTimer::PoolAcquireWait).count, 8000u);
+    EXPECT_EQ(registry.counter(MetricCounter::RowsFetched), 16001u);
+}
+
+// Test: Series with different labels are kept apart
+TEST(MetricsRegistryTest, LabelledSeriesAreSeparate) {
+    MetricsRegistry registry;
+    MetricLabels ok{"", "GET", "/jobs/list", 200};
+    MetricLabels throttled{"", "GET", "/jobs/list", 429};
+    registry.add(MetricCounter::HttpResponses, 3, ok);
+    registry.add(MetricCounter::HttpResponses, 1, throttled);
+    registry.observe(MetricTimer::HttpRequest, 1ms, MetricLabels{"", "GET", "/jobs/list"});
+
+    EXPECT_EQ(registry.counter(MetricCounter::HttpResponses, ok), 3u);
+    EXPECT_EQ(registry.counter(MetricCounter::HttpResponses, throttled), 1u);
+    EXPECT_EQ(registry.counter(MetricCounter::HttpResponses), 0u);
+    EXPECT_EQ(registry.histogram(MetricTimer::HttpRequest, MetricLabels{"", "GET", "/jobs/list"}).count, 1u);
+    EXPECT_EQ(registry.histogram(MetricTimer::HttpRequest, MetricLabels{"", "POST", "/jobs/list"}).count, 0u);
+}
+
+// Test: Prometheus export has metadata, cumulative buckets and escaped labels
+TEST(MetricsRegistryTest, PrometheusExport) {
+    MetricsRegistry registry;
+    registry.observe(MetricTimer::QueryExecute, 50us, {});
+    registry.observe(MetricTimer::QueryExecute, 2ms, {});
+    registry.observe(MetricTimer::QueryExecute, 2min, {});
+    registry.add(MetricCounter::Retries, 2, MetricLabels{"say \"hi\"\n", "", ""});
+    registry.add(MetricCounter::HttpResponses, 1, MetricLabels{"", "GET", "/clusters/get", 503});
+
+    std::string text = registry.to_prometheus();
+    EXPECT_NE(text.find("# TYPE databricks_query_execute_seconds histogram"), std::string::npos);
+    EXPECT_NE(text.find("databricks_query_execute_seconds_bucket{le=\"0.0001\"} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("databricks_query_execute_seconds_bucket{le=\"60\"} 2\n"), std::string::npos);
+    EXPECT_NE(text.find("databricks_query_execute_seconds_bucket{le=\"+Inf\"} 3\n"), std::string::npos);
+    EXPECT_NE(text.find("databricks_query_execute_seconds_count 3\n"), std::string::npos);
+    EXPECT_NE(text.find("# TYPE databricks_retries_total counter"), std::string::npos);
+    EXPECT_NE(text.find("databricks_retries_total{operation=\"say \\\"hi\\\"\\n\"} 2\n"), std::string::npos);
+    EXPECT_NE(text.find("status=\"503\""), std::string::npos);
+    EXPECT_EQ(count_occurrences(text, "# TYPE databricks_query_execute_seconds "), 1u);
+    // Timers with no samples are left out
+    EXPECT_EQ(text.find("databricks_http_request_seconds_bucket"), std::string::npos);
+}
+
+// Test: Endpoint labels drop query strings and Unity Catalog object names
+TEST(MetricsRegistryTest, EndpointLabelNormalization) {
+    using databricks::internal::endpoint_label;
+    EXPECT_EQ(endpoint_label("/jobs/runs/get?run_id=42"), "/jobs/runs/get");
+    EXPECT_EQ(endpoint_label("/clusters/list"), "/clusters/list");
+    EXPECT_EQ(endpoint_label("/unity-catalog/tables/main.default.orders"), "/unity-catalog/tables/{name}");
+    EXPECT_EQ(endpoint_label("/unity-catalog/schemas?catalog_name=main"), "/unity-catalog/schemas");
+}
+
+// Test: Recording is off until a sink is installed, and instrumented helpers reach it
+TEST_F(MetricsSinkTest, InstalledSinkReceivesMeasurements) {
+    EXPECT_EQ(databricks::get_metrics_sink(), nullptr);
+    databricks::internal::add_metric(MetricCounter::BytesFetched, 10);
+
+    auto registry = std::make_shared<MetricsRegistry>();
+    databricks::set_metrics_sink(registry);
+    EXPECT_EQ(databricks::get_metrics_sink(), registry);
+
+    databricks::internal::add_metric(MetricCounter::BytesFetched, 10);
+    {
+        databricks::internal::ScopedTimer timer(MetricTimer::ConnectionCreate);
+    }
+    {
+        databricks::internal::ScopedTimer cancelled(MetricTimer::ConnectionCreate);
+        cancelled.cancel();
+    }
+    EXPECT_EQ(registry->counter(MetricCounter::BytesFetched), 10u);
+    EXPECT_EQ(registry->histogram(MetricTimer::ConnectionCreate).count, 1u);
+}
+
+// Test: HttpClient records each attempt with status 0 and its retries for transport errors
+TEST_F(MetricsSinkTest, HttpClientRecordsAttempts) {
+    auto registry = std::make_shared<MetricsRegistry>();
+    databricks::set_metrics_sink(registry);
+
+    databricks::AuthConfig auth;
+    auth.host = "http://127.0.0.1:1";
+    auth.set_token("token");
+    databricks::HttpConfig http;
+    http.retry.max_attempts = 2;
+    http.retry.initial_backoff_ms = 1;
+    http.retry.max_backoff_ms = 1;
+    databricks::internal::HttpClient client(auth, "2.2", http);
+
+    EXPECT_THROW(client.get("/jobs/runs/get?run_id=1"), std::runtime_error);
+
+    MetricLabels labels{"", "GET", "/jobs/runs/get", 0};
+    EXPECT_EQ(registry->counter(MetricCounter::HttpResponses, labels), 2u);
+    EXPECT_EQ(registry->histogram(MetricTimer::HttpRequest, MetricLabels{"", "GET", "/jobs/runs/get"}).count, 2u);
+    EXPECT_EQ(registry->counter(MetricCounter::Retries, MetricLabels{"http", "", ""}), 1u);
+}
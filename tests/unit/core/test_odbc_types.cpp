@@ -0,0 +1,134 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../src/internal/odbc_types.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include <databricks/core/client.h>
+#include <gtest/gtest.h>
+
+using databricks::Date;
+using databricks::Timestamp;
+using databricks::ValueType;
+using namespace databricks::internal;
+
+namespace {
+template <typename T> T decode(const EncodedParameter& param) {
+    T value;
+    EXPECT_EQ(param.buffer.size(), sizeof(T));
+    std::memcpy(&value, param.buffer.data(), sizeof(T));
+    return value;
+}
+} // namespace
+
+// Test: SQL types map to the expected native value types
+TEST(OdbcTypesTest, ValueTypeMapping) {
+    EXPECT_EQ(value_type_for(SQL_BIT), ValueType::Boolean);
+    EXPECT_EQ(value_type_for(SQL_INTEGER), ValueType::Int64);
+    EXPECT_EQ(value_type_for(SQL_BIGINT), ValueType::Int64);
+    EXPECT_EQ(value_type_for(SQL_DOUBLE), ValueType::Double);
+    EXPECT_EQ(value_type_for(SQL_TYPE_DATE), ValueType::Date);
+    EXPECT_EQ(value_type_for(SQL_TYPE_TIMESTAMP), ValueType::Timestamp);
+    EXPECT_EQ(value_type_for(SQL_DECIMAL), ValueType::String);
+    EXPECT_EQ(value_type_for(SQL_VARCHAR), ValueType::String);
+
+    EXPECT_EQ(c_type_for(ValueType::Int64), SQL_C_SBIGINT);
+    EXPECT_EQ(c_type_for(ValueType::Timestamp), SQL_C_TYPE_TIMESTAMP);
+    EXPECT_EQ(c_type_for(ValueType::String), SQL_C_CHAR);
+}
+
+// Test: Dates and timestamps round-trip through their text form
+TEST(OdbcTypesTest, DateTimeRoundTrip) {
+    Date date;
+    ASSERT_TRUE(parse_date("2025-03-09", date));
+    EXPECT_EQ(date.year, 2025);
+    EXPECT_EQ(date.month, 3);
+    EXPECT_EQ(date.day, 9);
+    EXPECT_EQ(format_date(date), "2025-03-09");
+
+    Timestamp ts;
+    ASSERT_TRUE(parse_timestamp("2025-03-09T14:05:59.123", ts));
+    EXPECT_EQ(ts.hour, 14);
+    EXPECT_EQ(ts.minute, 5);
+    EXPECT_EQ(ts.second, 59);
+    EXPECT_EQ(ts.fraction, 123000000u);
+    EXPECT_EQ(format_timestamp(ts), "2025-03-09 14:05:59.123");
+
+    ASSERT_TRUE(parse_timestamp("2025-03-09 00:00:00", ts));
+    EXPECT_EQ(ts.fraction, 0u);
+    EXPECT_EQ(format_timestamp(ts), "2025-03-09 00:00:00");
+}
+
+// Test: Malformed dates and timestamps are rejected
+TEST(OdbcTypesTest, RejectsInvalidDateTime) {
+    Date date;
+    EXPECT_FALSE(parse_date("2025-3-9", date));
+    EXPECT_FALSE(parse_date("2025-13-01", date));
+    EXPECT_FALSE(parse_date("2025-01-01x", date));
+
+    Timestamp ts;
+    EXPECT_FALSE(parse_timestamp("2025-01-01", ts));
+    EXPECT_FALSE(parse_timestamp("2025-01-01 25:00:00", ts));
+    EXPECT_FALSE(parse_timestamp("2025-01-01 00:00:00.", ts));
+    EXPECT_FALSE(parse_timestamp("2025-01-01 00:00:00.1234567890", ts));
+}
+
+// Test: Native C types are encoded as binary values
+TEST(OdbcTypesTest, EncodesNativeParameters) {
+    EXPECT_EQ(decode<int64_t>(encode_parameter("-42", SQL_C_SBIGINT)), -42);
+    EXPECT_EQ(decode<int32_t>(encode_parameter("7", SQL_C_SLONG)), 7);
+    EXPECT_DOUBLE_EQ(decode<double>(encode_parameter("2.5", SQL_C_DOUBLE)), 2.5);
+    EXPECT_EQ(decode<unsigned char>(encode_parameter("true", SQL_C_BIT)), 1);
+
+    auto ts_param = encode_parameter("2025-01-02 03:04:05.000006", SQL_C_TYPE_TIMESTAMP);
+    Timestamp ts = decode<Timestamp>(ts_param);
+    EXPECT_EQ(ts.day, 2);
+    EXPECT_EQ(ts.fraction, 6000u);
+    EXPECT_EQ(ts_param.length, static_cast<SQLLEN>(sizeof(Timestamp)));
+}
+
+// Test: Character parameters are passed through as text
+TEST(OdbcTypesTest, EncodesCharacterParameters) {
+    auto param = encode_parameter("O'Brien", SQL_C_CHAR);
+    EXPECT_EQ(param.length, 7);
+    EXPECT_EQ(param.column_size, 7u);
+    EXPECT_EQ(std::string(param.buffer.data(), static_cast<size_t>(param.length)), "O'Brien");
+
+    auto empty = encode_parameter("", SQL_C_CHAR);
+    EXPECT_EQ(empty.length, 0);
+    EXPECT_NE(empty.buffer.data(), nullptr);
+}
+
+// Test: Text that does not match the C type throws
+TEST(OdbcTypesTest, InvalidNativeParameterThrows) {
+    EXPECT_THROW(encode_parameter("12abc", SQL_C_SBIGINT), std::runtime_error);
+    EXPECT_THROW(encode_parameter("", SQL_C_DOUBLE), std::runtime_error);
+    EXPECT_THROW(encode_parameter("yes", SQL_C_BIT), std::runtime_error);
+    EXPECT_THROW(encode_parameter("3000000000", SQL_C_SLONG), std::runtime_error);
+    EXPECT_THROW(encode_parameter("01/02/2025", SQL_C_TYPE_DATE), std::runtime_error);
+}
+
+// Test: Typed Parameter factories produce values their C type can decode
+TEST(OdbcTypesTest, ParameterFactoriesRoundTrip) {
+    using Parameter = databricks::Client::Parameter;
+
+    auto big = Parameter::from_int64(INT64_MIN);
+    EXPECT_EQ(big.c_type, SQL_C_SBIGINT);
+    EXPECT_EQ(big.sql_type, SQL_BIGINT);
+    EXPECT_EQ(decode<int64_t>(encode_parameter(big.value, big.c_type)), INT64_MIN);
+
+    auto dbl = Parameter::from_double(0.1);
+    EXPECT_EQ(decode<double>(encode_parameter(dbl.value, dbl.c_type)), 0.1);
+
+    auto flag = Parameter::from_bool(true);
+    EXPECT_EQ(decode<unsigned char>(encode_parameter(flag.value, flag.c_type)), 1);
+
+    auto day = Parameter::from_date({2024, 2, 29});
+    EXPECT_EQ(day.value, "2024-02-29");
+    EXPECT_EQ(day.sql_type, SQL_TYPE_DATE);
+
+    auto ts = Parameter::from_timestamp({2024, 2, 29, 23, 59, 59, 500000000});
+    EXPECT_EQ(ts.value, "2024-02-29 23:59:59.5");
+    EXPECT_EQ(decode<Timestamp>(encode_parameter(ts.value, ts.c_type)).fraction, 500000000u);
+}
@@ -0,0 +1,92 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "databricks/core/paginator.h"
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using databricks::Paginator;
+
+namespace {
+// Serves pages keyed by token; "" is the first page
+class FakeListing {
+public:
+    explicit FakeListing(std::map<std::string, Paginator<int>::Page> pages)
+        : pages_(std::move(pages)) {}
+
+    Paginator<int>::FetchPage fetcher(std::shared_ptr<std::atomic<int>> calls) const {
+        auto pages = pages_;
+        return [pages, calls](const std::string& token) {
+            (*calls)++;
+            auto it = pages.find(token);
+            if (it == pages.end()) {
+                throw std::runtime_error("unknown page token: " + token);
+            }
+            return it->second;
+        };
+    }
+
+private:
+    std::map<std::string, Paginator<int>::Page> pages_;
+};
+} // namespace
+
+// Test: Iteration follows page tokens across pages, including empty ones
+TEST(PaginatorTest, FollowsPageTokens) {
+    FakeListing listing({{"", {{1, 2}, "p2"}}, {"p2", {{}, "p3"}}, {"p3", {{3}, ""}}});
+    auto calls = std::make_shared<std::atomic<int>>(0);
+
+    for (bool prefetch : {true, false}) {
+        calls->store(0);
+        Paginator<int> pages(listing.fetcher(calls), prefetch);
+
+        std::vector<int> seen;
+        for (int value : pages) {
+            seen.push_back(value);
+        }
+        EXPECT_EQ(seen, (std::vector<int>{1, 2, 3}));
+        EXPECT_EQ(pages.pages_fetched(), 3);
+        EXPECT_EQ(calls->load(), 3);
+
+        // Exhausted paginators stay empty
+        EXPECT_EQ(pages.begin(), pages.end());
+    }
+}
+
+// Test: next_page() hands back one page at a time
+TEST(PaginatorTest, NextPageReturnsPages) {
+    FakeListing listing({{"", {{1, 2}, "next"}}, {"next", {{3}, ""}}});
+    Paginator<int> pages(listing.fetcher(std::make_shared<std::atomic<int>>(0)));
+
+    EXPECT_EQ(pages.next_page(), (std::vector<int>{1, 2}));
+    EXPECT_EQ(pages.next_page(), (std::vector<int>{3}));
+    EXPECT_TRUE(pages.next_page().empty());
+}
+
+// Test: A failed page request is thrown when iteration reaches it
+TEST(PaginatorTest, PropagatesFetchErrors) {
+    FakeListing listing({{"", {{1}, "missing"}}});
+    Paginator<int> pages(listing.fetcher(std::make_shared<std::atomic<int>>(0)));
+
+    auto it = pages.begin();
+    ASSERT_NE(it, pages.end());
+    EXPECT_EQ(*it, 1);
+    EXPECT_THROW(++it, std::runtime_error);
+}
+
+// Test: Nothing is fetched until iteration starts
+TEST(PaginatorTest, FetchesLazily) {
+    FakeListing listing({{"", {{}, ""}}});
+    auto calls = std::make_shared<std::atomic<int>>(0);
+    Paginator<int> pages(listing.fetcher(calls));
+
+    EXPECT_EQ(calls->load(), 0);
+    EXPECT_EQ(pages.begin(), pages.end());
+    EXPECT_EQ(calls->load(), 1);
+}
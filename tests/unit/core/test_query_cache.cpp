@@ -0,0 +1,40 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../src/internal/query_cache.h"
+
+#include <gtest/gtest.h>
+
+using databricks::internal::is_read_only_sql;
+using databricks::internal::normalize_sql;
+using databricks::internal::query_cache_key;
+using Parameter = databricks::Client::Parameter;
+
+// Test: Layout and comments normalize away; quoted text is kept as written
+TEST(QueryCacheTest, NormalizesLayout) {
+    EXPECT_EQ(normalize_sql("  SELECT *\n\tFROM  t -- all rows\nWHERE x = 1 ;  "), "SELECT * FROM t WHERE x = 1");
+    EXPECT_EQ(normalize_sql("SELECT /* hint */ 1"), "SELECT 1");
+    EXPECT_EQ(normalize_sql("SELECT 'a  -- b', \"c  d\", `e  f`"), "SELECT 'a  -- b', \"c  d\", `e  f`");
+    EXPECT_EQ(normalize_sql("SELECT 'it''s  x'"), "SELECT 'it''s  x'");
+    EXPECT_NE(normalize_sql("SELECT 'A'"), normalize_sql("SELECT 'a'"));
+}
+
+// Test: Only statements that read are cached by query()
+TEST(QueryCacheTest, DetectsReadOnlyStatements) {
+    EXPECT_TRUE(is_read_only_sql("select 1"));
+    EXPECT_TRUE(is_read_only_sql("(SELECT 1) UNION (SELECT 2)"));
+    EXPECT_TRUE(is_read_only_sql("SHOW TABLES"));
+    EXPECT_TRUE(is_read_only_sql("WITH t AS (SELECT 'insert' AS op) SELECT * FROM t"));
+    EXPECT_FALSE(is_read_only_sql("WITH t AS (SELECT 1) INSERT INTO x SELECT * FROM t"));
+    EXPECT_FALSE(is_read_only_sql("INSERT INTO x VALUES (1)"));
+    EXPECT_FALSE(is_read_only_sql("SELECTED"));
+    EXPECT_FALSE(is_read_only_sql(""));
+}
+
+// Test: Keys separate parameter values and types without ambiguity
+TEST(QueryCacheTest, KeysIncludeParameters) {
+    const std::string sql = "SELECT ? , ?";
+    EXPECT_EQ(query_cache_key(sql, {{"a"}, {"b"}}), query_cache_key(sql, {{"a"}, {"b"}}));
+    EXPECT_NE(query_cache_key(sql, {{"a"}, {"b"}}), query_cache_key(sql, {{"ab"}, {""}}));
+    EXPECT_NE(query_cache_key(sql, {{"1"}}), query_cache_key(sql, {Parameter::from_int64(1)}));
+    EXPECT_NE(query_cache_key(sql, {}), query_cache_key("SELECT ?", {}));
+}
@@ -0,0 +1,47 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../src/internal/rate_limiter.h"
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+using databricks::internal::RateLimiter;
+using namespace std::chrono_literals;
+
+// Test: A full bucket admits a burst, then spaces requests at the configured rate
+TEST(RateLimiterTest, SpacesRequestsAfterBurst) {
+    RateLimiter limiter(10.0, 2);
+    auto start = RateLimiter::Clock::now();
+
+    EXPECT_LE(limiter.reserve(), start + 5ms);
+    EXPECT_LE(limiter.reserve(), start + 5ms);
+
+    // The third and fourth tokens refill 100ms apart
+    EXPECT_GE(limiter.reserve(), start + 90ms);
+    EXPECT_GE(limiter.reserve(), start + 190ms);
+}
+
+// Test: An unlimited bucket never delays, except while paused
+TEST(RateLimiterTest, PauseHoldsUnlimitedBucket) {
+    RateLimiter limiter(0.0, 1);
+    auto now = RateLimiter::Clock::now();
+    for (int i = 0; i < 100; i++) {
+        EXPECT_LE(limiter.reserve(), now + 5ms);
+    }
+
+    limiter.pause_until(now + 1s);
+    EXPECT_GE(limiter.reserve(), now + 1s);
+}
+
+// Test: Clients sharing a host share one bucket at the strictest configured rate
+TEST(RateLimiterTest, ForHostSharesStrictestLimits) {
+    auto unlimited = RateLimiter::for_host("https://rate-limiter-test.databricks.com", 0.0, 10);
+    auto limited = RateLimiter::for_host("https://rate-limiter-test.databricks.com", 5.0, 10);
+    auto looser = RateLimiter::for_host("https://rate-limiter-test.databricks.com", 50.0, 10);
+
+    EXPECT_EQ(unlimited, limited);
+    EXPECT_EQ(limited, looser);
+    EXPECT_DOUBLE_EQ(looser->requests_per_second(), 5.0);
+    EXPECT_NE(RateLimiter::for_host("https://other.databricks.com", 0.0, 10), unlimited);
+}
@@ -0,0 +1,340 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../src/internal/odbc_statement.h"
+
+#include <cstring>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+
+#include <databricks/core/result_set.h>
+#include <gtest/gtest.h>
+
+namespace {
+std::vector<databricks::ColumnMetadata> two_column_schema() {
+    databricks::ColumnMetadata id;
+    id.name = "id";
+    id.sql_type = SQL_BIGINT;
+
+    databricks::ColumnMetadata name;
+    name.name = "name";
+    name.sql_type = SQL_VARCHAR;
+    name.column_size = 64;
+
+    return {id, name};
+}
+
+void append(databricks::ColumnarBatch& batch, size_t col, const std::string& value) {
+    batch.append_value(col, value.data(), value.size());
+}
+} // namespace
+
+// Test: A fresh batch is empty
+TEST(ColumnarBatchTest, DefaultIsEmpty) {
+    databricks::ColumnarBatch batch;
+    EXPECT_EQ(batch.num_rows(), 0);
+    EXPECT_EQ(batch.num_columns(), 0);
+    EXPECT_TRUE(batch.schema().empty());
+}
+
+// Test: Values appended column by column are readable as views
+TEST(ColumnarBatchTest, AppendAndReadValues) {
+    databricks::ColumnarBatch batch;
+    batch.reset(two_column_schema());
+
+    append(batch, 0, "1");
+    append(batch, 1, "alice");
+    batch.commit_row();
+    append(batch, 0, "2");
+    batch.append_null(1);
+    batch.commit_row();
+
+    ASSERT_EQ(batch.num_rows(), 2);
+    ASSERT_EQ(batch.num_columns(), 2);
+    EXPECT_EQ(batch.schema()[1].name, "name");
+
+    EXPECT_EQ(batch.value(0, 0), "1");
+    EXPECT_EQ(batch.value(0, 1), "alice");
+    EXPECT_FALSE(batch.is_null(0, 1));
+
+    EXPECT_EQ(batch.value(1, 0), "2");
+    EXPECT_TRUE(batch.is_null(1, 1));
+    EXPECT_TRUE(batch.value(1, 1).empty());
+}
+
+// Test: Each column stores its values contiguously with offsets
+TEST(ColumnarBatchTest, ColumnLayoutIsContiguous) {
+    databricks::ColumnarBatch batch;
+    batch.reset(two_column_schema());
+
+    for (const std::string name : {"ab", "", "cde"}) {
+        append(batch, 0, "0");
+        append(batch, 1, name);
+        batch.commit_row();
+    }
+
+    const auto& column = batch.column(1);
+    EXPECT_EQ(std::string(column.data.begin(), column.data.end()), "abcde");
+    EXPECT_EQ(column.offsets, (std::vector<uint64_t>{0, 2, 2, 5}));
+    EXPECT_EQ(column.nulls, (std::vector<uint8_t>{0, 0, 0}));
+}
+
+// Test: Values with embedded NUL bytes are kept intact
+TEST(ColumnarBatchTest, EmbeddedNullBytesPreserved) {
+    databricks::ColumnarBatch batch;
+    batch.reset(two_column_schema());
+
+    const char raw[] = {'a', '\0', 'b'};
+    append(batch, 0, "1");
+    batch.append_value(1, raw, sizeof(raw));
+    batch.commit_row();
+
+    EXPECT_EQ(batch.value(0, 1).size(), 3);
+    EXPECT_EQ(std::memcmp(batch.value(0, 1).data(), raw, sizeof(raw)), 0);
+}
+
+// Test: clear() drops rows but keeps schema and capacity
+TEST(ColumnarBatchTest, ClearKeepsSchemaAndCapacity) {
+    databricks::ColumnarBatch batch;
+    batch.reset(two_column_schema());
+    batch.reserve_rows(100);
+
+    append(batch, 0, "1");
+    append(batch, 1, "a fairly long value to force an allocation");
+    batch.commit_row();
+
+    size_t capacity = batch.column(1).data.capacity();
+    batch.clear();
+
+    EXPECT_EQ(batch.num_rows(), 0);
+    EXPECT_EQ(batch.num_columns(), 2);
+    EXPECT_EQ(batch.schema().size(), 2);
+    EXPECT_EQ(batch.column(1).data.capacity(), capacity);
+    EXPECT_EQ(batch.column(1).offsets.size(), 1);
+}
+
+// Test: commit_rows() accounts for rows appended in bulk
+TEST(ColumnarBatchTest, CommitRowsInBulk) {
+    databricks::ColumnarBatch batch;
+    batch.reset(two_column_schema());
+
+    for (int i = 0; i < 3; i++) {
+        append(batch, 0, std::to_string(i));
+    }
+    for (int i = 0; i < 3; i++) {
+        batch.append_null(1);
+    }
+    batch.commit_rows(3);
+
+    EXPECT_EQ(batch.num_rows(), 3);
+    EXPECT_EQ(batch.value(2, 0), "2");
+    EXPECT_TRUE(batch.is_null(2, 1));
+}
+
+// Test: column() rejects out-of-range indexes
+TEST(ColumnarBatchTest, ColumnOutOfRangeThrows) {
+    databricks::ColumnarBatch batch;
+    batch.reset(two_column_schema());
+    EXPECT_THROW(batch.column(2), std::out_of_range);
+}
+
+// ========== BlockFetcher bound widths ==========
+
+// Test: Fixed-width types get a bound large enough for their text form
+TEST(BlockFetcherTest, BoundWidthForFixedTypes) {
+    databricks::ColumnMetadata column;
+
+    column.sql_type = SQL_BIGINT;
+    EXPECT_EQ(databricks::internal::BlockFetcher::bound_width(column, 65536),
+              std::string("-9223372036854775808").size() + 1);
+
+    column.sql_type = SQL_INTEGER;
+    EXPECT_EQ(databricks::internal::BlockFetcher::bound_width(column, 65536), std::string("-2147483648").size() + 1);
+
+    column.sql_type = SQL_DECIMAL;
+    column.column_size = 38;
+    EXPECT_EQ(databricks::internal::BlockFetcher::bound_width(column, 65536), 41);
+}
+
+// Test: String columns are sized from the declared length
+TEST(BlockFetcherTest, BoundWidthForStrings) {
+    databricks::ColumnMetadata column;
+    column.sql_type = SQL_VARCHAR;
+    column.column_size = 255;
+    EXPECT_EQ(databricks::internal::BlockFetcher::bound_width(column, 65536), 255 * 4 + 1);
+}
+
+// Test: Unknown or oversized columns are not bound
+TEST(BlockFetcherTest, UnboundedColumnsFallBack) {
+    databricks::ColumnMetadata column;
+    column.sql_type = SQL_VARCHAR;
+
+    column.column_size = 0;
+    EXPECT_EQ(databricks::internal::BlockFetcher::bound_width(column, 65536), 0);
+
+    column.column_size = 1 << 20;
+    EXPECT_EQ(databricks::internal::BlockFetcher::bound_width(column, 65536), 0);
+}
+
+// ========== RowView ==========
+
+// Test: RowView reads one row of a batch and copies it like Client::query
+TEST(RowViewTest, ViewsAndCopiesRow) {
+    databricks::ColumnarBatch batch;
+    batch.reset(two_column_schema());
+    append(batch, 0, "7");
+    batch.append_null(1);
+    batch.commit_row();
+
+    databricks::RowView row(batch, 0);
+    ASSERT_EQ(row.size(), 2);
+    EXPECT_EQ(row[0], "7");
+    EXPECT_TRUE(row.is_null(1));
+    EXPECT_EQ(row.to_strings(), (std::vector<std::string>{"7", ""}));
+}
+
+// ========== TypedBatch ==========
+
+// Test: Typed columns expose values through matching accessors only
+TEST(TypedBatchTest, TypedAccessors) {
+    databricks::TypedBatch batch;
+    batch.reset(two_column_schema(), {databricks::ValueType::Int64, databricks::ValueType::String});
+
+    auto& ids = batch.mutable_column(0);
+    ids.int64s = {10, 0};
+    ids.nulls = {0, 1};
+
+    auto& names = batch.mutable_column(1);
+    names.text = {'b', 'o', 'b'};
+    names.text_offsets = {0, 3, 3};
+    names.nulls = {0, 1};
+    batch.commit_rows(2);
+
+    ASSERT_EQ(batch.num_rows(), 2);
+    EXPECT_EQ(batch.get_int64(0, 0), 10);
+    EXPECT_TRUE(batch.is_null(1, 0));
+    EXPECT_EQ(batch.get_string(0, 1), "bob");
+    EXPECT_TRUE(batch.get_string(1, 1).empty());
+
+    EXPECT_THROW(batch.get_double(0, 0), std::runtime_error);
+    EXPECT_THROW(batch.get_int64(0, 1), std::runtime_error);
+}
+
+// Test: clear() empties every typed column but keeps types
+TEST(TypedBatchTest, ClearKeepsTypes) {
+    databricks::TypedBatch batch;
+    batch.reset(two_column_schema(), {databricks::ValueType::Int64, databricks::ValueType::String});
+    batch.mutable_column(0).int64s = {1};
+    batch.mutable_column(0).nulls = {0};
+    batch.commit_rows(1);
+
+    batch.clear();
+    EXPECT_EQ(batch.num_rows(), 0);
+    EXPECT_TRUE(batch.column(0).int64s.empty());
+    EXPECT_EQ(batch.column(0).type, databricks::ValueType::Int64);
+    EXPECT_EQ(batch.column(1).text_offsets.size(), 1);
+}
+
+// Test: reset() requires one type per column
+TEST(TypedBatchTest, ResetValidatesTypes) {
+    databricks::TypedBatch batch;
+    EXPECT_THROW(batch.reset(two_column_schema(), {databricks::ValueType::Int64}), std::invalid_argument);
+}
+
+namespace {
+// Counts allocations passed through to the default resource
+class CountingResource : public std::pmr::memory_resource {
+public:
+    size_t allocations = 0;
+    size_t live_bytes = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        ++allocations;
+        live_bytes += bytes;
+        return std::pmr::get_default_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        live_bytes -= bytes;
+        std::pmr::get_default_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+databricks::ColumnarBatch numbered_batch(size_t rows) {
+    databricks::ColumnarBatch batch;
+    batch.reset(two_column_schema());
+    for (size_t r = 0; r < rows; r++) {
+        append(batch, 0, std::to_string(r));
+        if (r % 3 == 0) {
+            batch.append_null(1);
+        } else {
+            append(batch, 1, "name" + std::to_string(r));
+        }
+        batch.commit_row();
+    }
+    return batch;
+}
+} // namespace
+
+// Test: A ResultSet copies rows out of batches and reads them back as views
+TEST(ResultSetTest, AppendsBatches) {
+    databricks::ResultSet result;
+    result.reset(two_column_schema());
+    EXPECT_EQ(result.num_rows(), 0u);
+    EXPECT_EQ(result.num_columns(), 2u);
+
+    result.append(numbered_batch(4));
+    result.append(numbered_batch(5), 1, 2);
+    ASSERT_EQ(result.num_rows(), 6u);
+
+    EXPECT_EQ(result.value(0, 0), "0");
+    EXPECT_TRUE(result.is_null(0, 1));
+    EXPECT_EQ(result.value(0, 1), "");
+    EXPECT_EQ(result.value(2, 1), "name2");
+    EXPECT_FALSE(result.is_null(2, 1));
+    EXPECT_EQ(result.value(4, 0), "1");
+    EXPECT_EQ(result.value(5, 1), "name2");
+
+    EXPECT_THROW(result.append(numbered_batch(2), 1, 2), std::out_of_range);
+    databricks::ColumnarBatch narrow;
+    narrow.reset({two_column_schema()[0]});
+    EXPECT_THROW(result.append(narrow), std::invalid_argument);
+}
+
+// Test: All buffers come from the caller's resource and are released with the result
+TEST(ResultSetTest, AllocatesFromResource) {
+    CountingResource resource;
+    databricks::ColumnarBatch batch = numbered_batch(1000);
+    {
+        databricks::ResultSet result(&resource);
+        result.reset(two_column_schema());
+        result.append(batch);
+        EXPECT_EQ(result.resource(), &resource);
+        EXPECT_EQ(result.num_rows(), 1000u);
+
+        // A handful of buffer allocations, not one per cell
+        EXPECT_LE(resource.allocations, 8u);
+        EXPECT_GT(resource.live_bytes, result.data_bytes());
+
+        databricks::ResultSet moved = std::move(result);
+        EXPECT_EQ(moved.value(998, 1), "name998");
+    }
+    EXPECT_EQ(resource.live_bytes, 0u);
+}
+
+// Test: clear() keeps capacity so refilling with the same rows allocates nothing
+TEST(ResultSetTest, ClearReusesBuffers) {
+    CountingResource resource;
+    databricks::ColumnarBatch batch = numbered_batch(100);
+    databricks::ResultSet result(&resource);
+    result.reset(two_column_schema());
+    result.append(batch);
+
+    const size_t allocations = resource.allocations;
+    result.reset(two_column_schema());
+    EXPECT_EQ(result.num_rows(), 0u);
+    result.append(batch);
+    EXPECT_EQ(resource.allocations, allocations);
+    EXPECT_EQ(result.value(99, 0), "99");
+}
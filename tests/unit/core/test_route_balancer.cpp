@@ -0,0 +1,93 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../src/internal/route_balancer.h"
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using databricks::RouterConfig;
+using databricks::internal::RouteBalancer;
+using namespace std::chrono_literals;
+
+// Test: Busy or slow routes lose queries to idle, fast ones
+TEST(RouteBalancerTest, PrefersIdleAndFastRoutes) {
+    RouteBalancer balancer(2, RouterConfig{});
+    auto first = balancer.pick();
+    auto second = balancer.pick();
+    ASSERT_TRUE(first && second);
+    EXPECT_NE(*first, *second); // Equal scores rotate
+
+    balancer.finish(0, 100ms, RouteBalancer::Outcome::Success);
+    balancer.finish(1, 10ms, RouteBalancer::Outcome::Success);
+    EXPECT_EQ(balancer.pick(), 1u);
+    EXPECT_EQ(balancer.pick(), 1u); // 2 x 10ms still beats 1 x 100ms
+    EXPECT_EQ(balancer.state(1).outstanding, 2u);
+
+    EXPECT_EQ(balancer.pick({false, true}), 0u);
+    EXPECT_FALSE(balancer.pick({true, true}).has_value());
+}
+
+// Test: A route whose error rate passes the threshold is drained, then returns with a clean slate
+TEST(RouteBalancerTest, DrainsFailingRoute) {
+    RouterConfig config;
+    config.error_smoothing = 0.5;
+    config.max_error_rate = 0.5;
+    config.min_samples = 3;
+    config.drain_ms = 50;
+    RouteBalancer balancer(2, config);
+    balancer.finish(1, 5ms, RouteBalancer::Outcome::Success);
+
+    for (int i = 0; i < 3; ++i) {
+        balancer.finish(0, 1ms, RouteBalancer::Outcome::Failure);
+    }
+    auto state = balancer.state(0);
+    EXPECT_TRUE(state.draining);
+    EXPECT_EQ(state.failures, 3u);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(balancer.pick(), 1u);
+    }
+    EXPECT_EQ(balancer.pick({false, true}), 0u); // A drained route still beats none
+
+    std::this_thread::sleep_for(60ms);
+    state = balancer.state(0);
+    EXPECT_FALSE(state.draining);
+    EXPECT_EQ(state.error_rate, 0.0);
+}
+
+// Test: Ignored outcomes touch neither the error rate nor the latency
+TEST(RouteBalancerTest, IgnoredOutcomesOnlyEndTheCall) {
+    RouteBalancer balancer(1, RouterConfig{});
+    ASSERT_EQ(balancer.pick(), 0u);
+    balancer.finish(0, 5s, RouteBalancer::Outcome::Ignored);
+    auto state = balancer.state(0);
+    EXPECT_EQ(state.outstanding, 0u);
+    EXPECT_EQ(state.latency_ms, 0.0);
+    EXPECT_EQ(state.error_rate, 0.0);
+
+    balancer.drain(0, 10s);
+    EXPECT_TRUE(balancer.state(0).draining);
+    balancer.restore(0);
+    EXPECT_FALSE(balancer.state(0).draining);
+}
+
+// Test: A route drained until restored outlasts any drain timeout, and drained routes that time out win the fallback
+TEST(RouteBalancerTest, HealthDrainLastsUntilRestored) {
+    RouterConfig config;
+    config.drain_ms = 1;
+    RouteBalancer balancer(2, config);
+    balancer.drain_until_restored(0);
+    balancer.drain(0, 1ms); // Does not shorten it
+    balancer.drain(1, 10s);
+
+    std::this_thread::sleep_for(20ms);
+    EXPECT_TRUE(balancer.state(0).draining);
+    EXPECT_EQ(balancer.pick(), 1u); // Both drained: the one whose drain ends first
+    balancer.finish(1, 1ms, RouteBalancer::Outcome::Success);
+
+    balancer.restore(0);
+    EXPECT_FALSE(balancer.state(0).draining);
+    EXPECT_EQ(balancer.pick({false, true}), 0u);
+}
+
+// Note: main() is provided by gtest_main linked in CMakeLists.txt
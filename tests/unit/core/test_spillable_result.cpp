@@ -0,0 +1,97 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include <stdexcept>
+#include <string>
+
+#include <databricks/core/spillable_result.h>
+#include <gtest/gtest.h>
+
+using databricks::ColumnarBatch;
+using databricks::ColumnMetadata;
+using databricks::SpillableResult;
+using databricks::SpillConfig;
+
+namespace {
+std::vector<ColumnMetadata> two_columns() {
+    ColumnMetadata id;
+    id.name = "id";
+    ColumnMetadata note;
+    note.name = "note";
+    return {id, note};
+}
+
+// Rows first..first+count-1: id as text, note NULL on every third row
+ColumnarBatch make_block(size_t first, size_t count) {
+    ColumnarBatch batch;
+    batch.reset(two_columns());
+    for (size_t row = first; row < first + count; ++row) {
+        std::string id = std::to_string(row);
+        batch.append_value(0, id.data(), id.size());
+        if (row % 3 == 0) {
+            batch.append_null(1);
+        } else {
+            std::string note = "note-" + id;
+            batch.append_value(1, note.data(), note.size());
+        }
+        batch.commit_row();
+    }
+    return batch;
+}
+
+void expect_rows(const SpillableResult& result, size_t rows) {
+    ASSERT_EQ(result.num_rows(), rows);
+    // Out of order, across block boundaries
+    for (size_t i = 0; i < rows; ++i) {
+        size_t row = (i * 7919) % rows;
+        EXPECT_EQ(result.value(row, 0), std::to_string(row));
+        EXPECT_EQ(result.is_null(row, 1), row % 3 == 0);
+        EXPECT_EQ(result.value(row, 1), row % 3 == 0 ? "" : "note-" + std::to_string(row));
+    }
+}
+} // namespace
+
+// Test: a result under the memory limit stays in memory
+TEST(SpillableResultTest, SmallResultStaysInMemory) {
+    SpillableResult result(two_columns());
+    result.append(make_block(0, 100));
+    result.append(make_block(100, 50));
+    result.seal();
+
+    EXPECT_FALSE(result.spilled());
+    EXPECT_EQ(result.spilled_bytes(), 0u);
+    EXPECT_GT(result.resident_bytes(), 0u);
+    expect_rows(result, 150);
+}
+
+// Test: past the limit, earlier and later blocks move to the mapped file and read back exactly
+TEST(SpillableResultTest, LargeResultSpillsToDisk) {
+    SpillConfig spill;
+    spill.memory_limit_bytes = 4096;
+    SpillableResult result(two_columns(), spill);
+    for (size_t first = 0; first < 5000; first += 1000) {
+        result.append(make_block(first, 1000));
+    }
+    EXPECT_TRUE(result.spilled());
+    EXPECT_THROW(result.value(0, 0), std::runtime_error);
+    result.seal();
+
+    EXPECT_GT(result.spilled_bytes(), 0u);
+    EXPECT_LT(result.resident_bytes(), 1024u);
+    expect_rows(result, 5000);
+
+    SpillableResult moved = std::move(result);
+    EXPECT_EQ(moved.value(4999, 0), "4999");
+    EXPECT_THROW(moved.value(5000, 0), std::out_of_range);
+    EXPECT_THROW(moved.append(make_block(5000, 1)), std::runtime_error);
+}
+
+// Test: a spill directory that does not exist fails the append that spills
+TEST(SpillableResultTest, UnwritableDirectoryThrows) {
+    SpillConfig spill;
+    spill.memory_limit_bytes = 0;
+    spill.directory = "/nonexistent/spill/dir";
+    SpillableResult result(two_columns(), spill);
+    EXPECT_THROW(result.append(make_block(0, 10)), std::runtime_error);
+}
+
+// Note: main() is provided by gtest_main linked in CMakeLists.txt
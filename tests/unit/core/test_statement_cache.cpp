@@ -0,0 +1,103 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../src/internal/statement_cache.h"
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using databricks::internal::StatementCache;
+
+namespace {
+// Fake statement handles; the cache never dereferences them
+SQLHSTMT fake_handle(uintptr_t id) {
+    return reinterpret_cast<SQLHSTMT>(id);
+}
+} // namespace
+
+/**
+ * @brief Test fixture that records which handles the cache frees
+ */
+class StatementCacheTest : public ::testing::Test {
+protected:
+    StatementCache::Releaser recorder() {
+        return [this](SQLHSTMT h) { released.push_back(h); };
+    }
+
+    std::vector<SQLHSTMT> released;
+};
+
+// Test: A miss returns a null handle and a put statement can be taken back
+TEST_F(StatementCacheTest, TakeReturnsCachedStatement) {
+    StatementCache cache(4, recorder());
+
+    EXPECT_EQ(cache.take("SELECT ?"), nullptr);
+    cache.put("SELECT ?", fake_handle(1));
+    EXPECT_EQ(cache.size(), 1);
+
+    EXPECT_EQ(cache.take("SELECT ?"), fake_handle(1));
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_EQ(cache.hits(), 1);
+    EXPECT_EQ(cache.misses(), 1);
+
+    // Checked out statements are not handed out twice
+    EXPECT_EQ(cache.take("SELECT ?"), nullptr);
+    EXPECT_TRUE(released.empty());
+}
+
+// Test: The least recently used statement is freed when the cache is full
+TEST_F(StatementCacheTest, EvictsLeastRecentlyUsed) {
+    StatementCache cache(2, recorder());
+
+    cache.put("a", fake_handle(1));
+    cache.put("b", fake_handle(2));
+
+    // Touch "a" so "b" becomes the oldest
+    cache.put("a", cache.take("a"));
+    cache.put("c", fake_handle(3));
+
+    ASSERT_EQ(released.size(), 1);
+    EXPECT_EQ(released[0], fake_handle(2));
+    EXPECT_EQ(cache.take("b"), nullptr);
+    EXPECT_EQ(cache.take("a"), fake_handle(1));
+    EXPECT_EQ(cache.take("c"), fake_handle(3));
+}
+
+// Test: Returning a second handle for the same SQL keeps the newest
+TEST_F(StatementCacheTest, DuplicatePutFreesOlderHandle) {
+    StatementCache cache(4, recorder());
+
+    cache.put("a", fake_handle(1));
+    cache.put("a", fake_handle(2));
+
+    ASSERT_EQ(released.size(), 1);
+    EXPECT_EQ(released[0], fake_handle(1));
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_EQ(cache.take("a"), fake_handle(2));
+}
+
+// Test: A zero-capacity cache frees statements immediately
+TEST_F(StatementCacheTest, ZeroCapacityDisablesCaching) {
+    StatementCache cache(0, recorder());
+
+    cache.put("a", fake_handle(1));
+    EXPECT_EQ(cache.size(), 0);
+    ASSERT_EQ(released.size(), 1);
+    EXPECT_EQ(cache.take("a"), nullptr);
+}
+
+// Test: clear() and destruction free every cached statement
+TEST_F(StatementCacheTest, ClearFreesAll) {
+    {
+        StatementCache cache(4, recorder());
+        cache.put("a", fake_handle(1));
+        cache.put("b", fake_handle(2));
+        cache.clear();
+        EXPECT_EQ(cache.size(), 0);
+        EXPECT_EQ(released.size(), 2);
+
+        cache.put("c", fake_handle(3));
+    }
+    EXPECT_EQ(released.size(), 3);
+}
@@ -0,0 +1,122 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../src/internal/status_poller.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using databricks::internal::HttpResponse;
+using databricks::internal::StatusPoller;
+using namespace std::chrono_literals;
+
+namespace {
+std::future<HttpResponse> ready(const std::string& body) {
+    std::promise<HttpResponse> promise;
+    HttpResponse response;
+    response.status_code = 200;
+    response.body = body;
+    promise.set_value(response);
+    return promise.get_future();
+}
+
+// A watch reporting "RUNNING" until `finish_after` checks, then finishing
+StatusPoller::Watch counting_watch(std::shared_ptr<std::atomic<int>> checks, int finish_after,
+                                   std::shared_ptr<std::promise<int>> result, std::chrono::milliseconds timeout) {
+    StatusPoller::Watch watch;
+    watch.description = "test";
+    watch.check = [checks]() { return ready(std::to_string(++*checks)); };
+    watch.on_status = [finish_after, result](const HttpResponse& response, std::string& state) {
+        int count = std::stoi(response.body);
+        state = "RUNNING";
+        if (count < finish_after) {
+            return false;
+        }
+        result->set_value(count);
+        return true;
+    };
+    watch.on_error = [result](std::exception_ptr error) { result->set_exception(error); };
+    watch.deadline = StatusPoller::Clock::now() + timeout;
+    watch.poll.initial_interval_ms = 5;
+    watch.poll.max_interval_ms = 20;
+    return watch;
+}
+} // namespace
+
+// Test: Many watches are served by one poller and each completes with its own result
+TEST(StatusPollerTest, CompletesManyWatches) {
+    StatusPoller poller;
+    std::vector<std::future<int>> results;
+    for (int i = 1; i <= 50; i++) {
+        auto result = std::make_shared<std::promise<int>>();
+        results.push_back(result->get_future());
+        poller.add(counting_watch(std::make_shared<std::atomic<int>>(0), i % 4 + 1, result, 10s));
+    }
+
+    for (int i = 1; i <= 50; i++) {
+        ASSERT_EQ(results[i - 1].wait_for(5s), std::future_status::ready);
+        EXPECT_EQ(results[i - 1].get(), i % 4 + 1);
+    }
+    // The last batch is counted until the poller thread finishes it, just after its results are set
+    auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (poller.watching() != 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(1ms);
+    }
+    EXPECT_EQ(poller.watching(), 0);
+}
+
+// Test: An unchanged state backs the interval off toward max_interval_ms
+TEST(StatusPollerTest, BacksOffWhileStateIsUnchanged) {
+    StatusPoller poller;
+    auto checks = std::make_shared<std::atomic<int>>(0);
+    auto result = std::make_shared<std::promise<int>>();
+    auto future = result->get_future();
+    poller.add(counting_watch(checks, 1000, result, 300ms));
+
+    ASSERT_EQ(future.wait_for(5s), std::future_status::ready);
+    EXPECT_THROW(future.get(), std::runtime_error);
+    // Fixed 5ms intervals would need ~60 checks; backing off to 20ms needs far fewer
+    EXPECT_LT(checks->load(), 30);
+    EXPECT_GE(checks->load(), 10);
+}
+
+// Test: Errors from a status check fail only that watch
+TEST(StatusPollerTest, PropagatesCheckErrors) {
+    StatusPoller poller;
+
+    auto failing = std::make_shared<std::promise<int>>();
+    auto failing_future = failing->get_future();
+    auto watch = counting_watch(std::make_shared<std::atomic<int>>(0), 1, failing, 10s);
+    watch.on_status = [](const HttpResponse&, std::string&) -> bool { throw std::runtime_error("HTTP 404"); };
+    poller.add(std::move(watch));
+
+    auto healthy = std::make_shared<std::promise<int>>();
+    auto healthy_future = healthy->get_future();
+    poller.add(counting_watch(std::make_shared<std::atomic<int>>(0), 2, healthy, 10s));
+
+    ASSERT_EQ(failing_future.wait_for(5s), std::future_status::ready);
+    EXPECT_THROW(failing_future.get(), std::runtime_error);
+    EXPECT_EQ(healthy_future.get(), 2);
+}
+
+// Test: Destroying the poller fails watches that are still waiting
+TEST(StatusPollerTest, ShutdownFailsPendingWatches) {
+    auto result = std::make_shared<std::promise<int>>();
+    auto future = result->get_future();
+    {
+        StatusPoller poller;
+        auto watch = counting_watch(std::make_shared<std::atomic<int>>(0), 1000, result, 1h);
+        watch.poll.initial_interval_ms = 60000;
+        watch.poll.max_interval_ms = 60000;
+        poller.add(std::move(watch));
+    }
+    ASSERT_EQ(future.wait_for(0s), std::future_status::ready);
+    EXPECT_THROW(future.get(), std::runtime_error);
+}
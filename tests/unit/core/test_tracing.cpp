@@ -0,0 +1,233 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../src/internal/http_client.h"
+#include "../../src/internal/tracing.h"
+
+#include <databricks/core/tracing.h>
+
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <gtest/gtest.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using databricks::SpanContext;
+using databricks::SpanData;
+using databricks::internal::Span;
+
+namespace {
+const char* TRACEPARENT = "00-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7-01";
+
+class RecordingExporter : public databricks::SpanExporter {
+public:
+    void on_end(const SpanData& span) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        spans.push_back(span);
+    }
+
+    const SpanData* find(const std::string& name) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const auto& span : spans) {
+            if (span.name == name) {
+                return &span;
+            }
+        }
+        return nullptr;
+    }
+
+    std::mutex mutex;
+    std::vector<SpanData> spans;
+};
+
+/**
+ * @brief Installs a recording exporter for the test; skipped when tracing is compiled out
+ */
+class SpanTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (!databricks::tracing_compiled_in()) {
+            GTEST_SKIP() << "Built without ENABLE_TRACING";
+        }
+        exporter = std::make_shared<RecordingExporter>();
+        databricks::set_span_exporter(exporter);
+    }
+
+    void TearDown() override { databricks::set_span_exporter(nullptr); }
+
+    std::shared_ptr<RecordingExporter> exporter;
+};
+
+/**
+ * @brief Accepts one connection on 127.0.0.1, answers 200 and keeps the request head
+ */
+class OneShotServer {
+public:
+    OneShotServer() {
+        fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t len = sizeof(addr);
+        if (::bind(fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || ::listen(fd_, 1) != 0 ||
+            ::getsockname(fd_, reinterpret_cast<sockaddr*>(&addr), &len) != 0) {
+            throw std::runtime_error("Failed to listen on 127.0.0.1");
+        }
+        port_ = ntohs(addr.sin_port);
+        thread_ = std::thread([this]() {
+            int client = ::accept(fd_, nullptr, nullptr);
+            char buffer[4096];
+            while (request_.find("\r\n\r\n") == std::string::npos) {
+                ssize_t n = ::recv(client, buffer, sizeof(buffer), 0);
+                if (n <= 0) {
+                    break;
+                }
+                request_.append(buffer, static_cast<size_t>(n));
+            }
+            const std::string response = "HTTP/1.1 200 OK\r\nContent-Length: 2\r\nConnection: close\r\n\r\n{}";
+            ::send(client, response.data(), response.size(), MSG_NOSIGNAL);
+            ::close(client);
+        });
+    }
+
+    ~OneShotServer() {
+        ::shutdown(fd_, SHUT_RDWR);
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+        ::close(fd_);
+    }
+
+    std::string url() const { return "http://127.0.0.1:" + std::to_string(port_); }
+
+    // Waits for the connection to be served
+    const std::string& request() {
+        thread_.join();
+        return request_;
+    }
+
+private:
+    int fd_ = -1;
+    int port_ = 0;
+    std::string request_;
+    std::thread thread_;
+};
+} // namespace
+
+// Test: traceparent values round-trip and malformed ones are rejected
+TEST(SpanContextTest, TraceparentRoundTrip) {
+    SpanContext context = SpanContext::from_traceparent(TRACEPARENT);
+    ASSERT_TRUE(context.is_valid());
+    EXPECT_TRUE(context.is_sampled());
+    EXPECT_EQ(context.trace_id_hex(), "4bf92f3577b34da6a3ce929d0e0e4736");
+    EXPECT_EQ(context.span_id_hex(), "00f067aa0ba902b7");
+    EXPECT_EQ(context.to_traceparent(), TRACEPARENT);
+
+    // Future versions may append fields
+    EXPECT_TRUE(SpanContext::from_traceparent(std::string("01-") + (TRACEPARENT + 3) + "-extra").is_valid());
+
+    EXPECT_FALSE(SpanContext::from_traceparent("").is_valid());
+    EXPECT_FALSE(SpanContext::from_traceparent("00-00000000000000000000000000000000-00f067aa0ba902b7-01").is_valid());
+    EXPECT_FALSE(SpanContext::from_traceparent("00-4BF92F3577B34DA6A3CE929D0E0E4736-00f067aa0ba902b7-01").is_valid());
+    EXPECT_FALSE(SpanContext::from_traceparent(std::string(TRACEPARENT) + "-extra").is_valid());
+    EXPECT_FALSE(SpanContext::from_traceparent(std::string("ff-") + (TRACEPARENT + 3)).is_valid());
+}
+
+// Test: TraceContextScope makes a context current and restores the previous one
+TEST(SpanContextTest, ScopeRestoresPreviousContext) {
+    EXPECT_FALSE(databricks::current_span_context().is_valid());
+    {
+        databricks::TraceContextScope scope(SpanContext::from_traceparent(TRACEPARENT));
+        EXPECT_EQ(databricks::current_span_context().to_traceparent(), TRACEPARENT);
+    }
+    EXPECT_FALSE(databricks::current_span_context().is_valid());
+}
+
+// Test: Nested spans share the trace and point at their parent
+TEST_F(SpanTest, NestedSpansFormOneTrace) {
+    {
+        Span outer("outer");
+        Span inner("inner");
+        inner.set_attribute("rows", int64_t{3});
+    }
+    ASSERT_EQ(exporter->spans.size(), 2u);
+    const SpanData* outer = exporter->find("outer");
+    const SpanData* inner = exporter->find("inner");
+    ASSERT_TRUE(outer && inner);
+    EXPECT_EQ(inner->context.trace_id, outer->context.trace_id);
+    EXPECT_EQ(inner->parent_span_id, outer->context.span_id);
+    EXPECT_EQ(outer->parent_span_id, (std::array<uint8_t, 8>{}));
+    ASSERT_EQ(inner->attributes.size(), 1u);
+    EXPECT_EQ(inner->attributes[0].second, "3");
+    EXPECT_FALSE(databricks::current_span_context().is_valid());
+}
+
+// Test: A span left by an exception is marked as an error
+TEST_F(SpanTest, ExceptionMarksError) {
+    try {
+        Span span("failing");
+        throw std::runtime_error("boom");
+    } catch (const std::runtime_error&) {
+    }
+    ASSERT_NE(exporter->find("failing"), nullptr);
+    EXPECT_TRUE(exporter->find("failing")->error);
+}
+
+// Test: Spans under an unsampled parent are not recorded but keep propagating the parent
+TEST_F(SpanTest, UnsampledParentIsRespected) {
+    SpanContext parent = SpanContext::from_traceparent("00-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7-00");
+    databricks::TraceContextScope scope(parent);
+    Span span("unsampled");
+    EXPECT_FALSE(span.recording());
+    EXPECT_EQ(span.context().span_id, parent.span_id);
+    span.end();
+    EXPECT_TRUE(exporter->spans.empty());
+}
+
+// Test: REST attempts and backoffs become children of the caller's trace
+TEST_F(SpanTest, HttpRetriesAreTraced) {
+    databricks::AuthConfig auth;
+    auth.host = "http://127.0.0.1:1";
+    auth.set_token("token");
+    databricks::HttpConfig http;
+    http.retry.max_attempts = 2;
+    http.retry.initial_backoff_ms = 1;
+    http.retry.max_backoff_ms = 1;
+    databricks::internal::HttpClient client(auth, "2.2", http);
+
+    databricks::TraceContextScope scope(SpanContext::from_traceparent(TRACEPARENT));
+    EXPECT_THROW(client.get("/clusters/list"), std::runtime_error);
+
+    size_t attempts = 0;
+    for (const auto& span : exporter->spans) {
+        EXPECT_EQ(span.context.trace_id_hex(), "4bf92f3577b34da6a3ce929d0e0e4736");
+        if (span.name == "HttpClient::execute_get") {
+            ++attempts;
+            EXPECT_TRUE(span.error);
+        }
+    }
+    EXPECT_EQ(attempts, 2u);
+    EXPECT_NE(exporter->find("HttpClient::backoff"), nullptr);
+}
+
+// Test: REST requests carry a traceparent header naming the request's span
+TEST_F(SpanTest, HttpRequestSendsTraceparent) {
+    OneShotServer server;
+    databricks::AuthConfig auth;
+    auth.host = server.url();
+    auth.set_token("token");
+    databricks::internal::HttpClient client(auth, "2.2");
+
+    auto response = client.get("/jobs/list");
+    EXPECT_EQ(response.status_code, 200);
+
+    const SpanData* span = exporter->find("HttpClient::execute_get");
+    ASSERT_NE(span, nullptr);
+    EXPECT_NE(server.request().find("traceparent: " + span->context.to_traceparent()), std::string::npos);
+}
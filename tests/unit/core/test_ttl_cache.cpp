@@ -0,0 +1,170 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../src/internal/ttl_cache.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using databricks::internal::CacheableError;
+using databricks::internal::TtlCache;
+using namespace std::chrono_literals;
+
+// Test: A loaded value is served from the cache until it expires
+TEST(TtlCacheTest, ServesUntilExpiry) {
+    TtlCache<int> cache(16, 50ms, 0ms, 4);
+    int loads = 0;
+    auto load = [&]() { return ++loads; };
+
+    EXPECT_EQ(cache.get_or_load("a", load), 1);
+    EXPECT_EQ(cache.get_or_load("a", load), 1);
+    EXPECT_EQ(cache.stats().hits, 1);
+    EXPECT_EQ(cache.stats().misses, 1);
+    EXPECT_EQ(cache.stats().entries, 1);
+
+    std::this_thread::sleep_for(80ms);
+    EXPECT_EQ(cache.get_or_load("a", load), 2);
+}
+
+// Test: CacheableError results are remembered; other failures are not
+TEST(TtlCacheTest, CachesOnlyCacheableErrors) {
+    TtlCache<int> cache(16, 10s, 10s);
+    int loads = 0;
+
+    auto not_found = [&]() -> int {
+        ++loads;
+        throw CacheableError("HTTP 404");
+    };
+    EXPECT_THROW(cache.get_or_load("missing", not_found), CacheableError);
+    EXPECT_THROW(cache.get_or_load("missing", not_found), CacheableError);
+    EXPECT_EQ(loads, 1);
+    EXPECT_EQ(cache.stats().negative_hits, 1);
+
+    auto failing = [&]() -> int {
+        ++loads;
+        throw std::runtime_error("HTTP 503");
+    };
+    EXPECT_THROW(cache.get_or_load("flaky", failing), std::runtime_error);
+    EXPECT_THROW(cache.get_or_load("flaky", failing), std::runtime_error);
+    EXPECT_EQ(loads, 3);
+}
+
+// Test: Concurrent misses for one key run the loader once
+TEST(TtlCacheTest, CoalescesConcurrentMisses) {
+    TtlCache<int> cache(16, 10s, 0ms);
+    std::atomic<int> loads{0};
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+
+    auto load = [&]() {
+        loads++;
+        released.wait();
+        return 42;
+    };
+
+    std::vector<std::future<int>> callers;
+    for (int i = 0; i < 8; i++) {
+        callers.push_back(std::async(std::launch::async, [&]() { return cache.get_or_load("key", load); }));
+    }
+    // Let every caller reach the cache before the load completes
+    while (cache.stats().misses + cache.stats().coalesced < 8) {
+        std::this_thread::sleep_for(1ms);
+    }
+    release.set_value();
+
+    for (auto& caller : callers) {
+        EXPECT_EQ(caller.get(), 42);
+    }
+    EXPECT_EQ(loads.load(), 1);
+    EXPECT_EQ(cache.stats().coalesced, 7);
+}
+
+// Test: A full shard evicts its oldest entry
+TEST(TtlCacheTest, EvictsOldestWhenFull) {
+    TtlCache<int> cache(2, 10s, 0ms, 1);
+    cache.get_or_load("a", [] { return 1; });
+    cache.get_or_load("b", [] { return 2; });
+    cache.get_or_load("c", [] { return 3; });
+
+    EXPECT_EQ(cache.stats().evictions, 1);
+    EXPECT_EQ(cache.stats().entries, 2);
+    EXPECT_EQ(cache.get_or_load("a", [] { return 10; }), 10);
+    EXPECT_EQ(cache.get_or_load("c", [] { return 30; }), 3);
+}
+
+// Test: An entry hit since it was inserted survives the next eviction
+TEST(TtlCacheTest, EvictsLeastRecentlyUsed) {
+    TtlCache<int> cache(2, 10s, 0ms, 1);
+    cache.get_or_load("a", [] { return 1; });
+    cache.get_or_load("b", [] { return 2; });
+    cache.get_or_load("a", [] { return 10; }); // Hit
+    cache.get_or_load("c", [] { return 3; });
+
+    EXPECT_EQ(cache.get_or_load("a", [] { return 10; }), 1);
+    EXPECT_EQ(cache.get_or_load("b", [] { return 20; }), 20);
+}
+
+// Test: The byte limit evicts entries and skips values too large to keep
+TEST(TtlCacheTest, EvictsToStayUnderByteLimit) {
+    auto weigh = [](const std::string& value) { return value.size(); };
+    TtlCache<std::string> cache(100, 10s, 0ms, 1, 25, weigh);
+    cache.get_or_load("a", [] { return std::string(10, 'a'); }); // 11 bytes with the key
+    cache.get_or_load("b", [] { return std::string(10, 'b'); });
+    EXPECT_EQ(cache.stats().bytes, 22u);
+
+    cache.get_or_load("c", [] { return std::string(10, 'c'); });
+    EXPECT_EQ(cache.stats().entries, 2u);
+    EXPECT_EQ(cache.stats().evictions, 1u);
+    EXPECT_LE(cache.stats().bytes, 25u);
+
+    EXPECT_EQ(cache.get_or_load("big", [] { return std::string(30, 'x'); }), std::string(30, 'x'));
+    EXPECT_EQ(cache.stats().entries, 2u);
+}
+
+// Test: A lookup can choose its own TTL
+TEST(TtlCacheTest, PerLookupTtl) {
+    TtlCache<int> cache(16, 10s, 0ms);
+    cache.get_or_load("short", [] { return 1; }, 1ms);
+    cache.get_or_load("long", [] { return 1; });
+    std::this_thread::sleep_for(5ms);
+
+    EXPECT_EQ(cache.get_or_load("short", [] { return 2; }), 2);
+    EXPECT_EQ(cache.get_or_load("long", [] { return 2; }), 1);
+}
+
+// Test: invalidate() and invalidate_prefix() force the next lookup to reload
+TEST(TtlCacheTest, InvalidatesKeysAndPrefixes) {
+    TtlCache<std::string> cache(16, 10s, 0ms);
+    cache.get_or_load("main.a", [] { return std::string("a1"); });
+    cache.get_or_load("main.b", [] { return std::string("b1"); });
+    cache.get_or_load("other.c", [] { return std::string("c1"); });
+
+    cache.invalidate("main.a");
+    EXPECT_EQ(cache.get_or_load("main.a", [] { return std::string("a2"); }), "a2");
+
+    cache.invalidate_prefix("main.");
+    EXPECT_EQ(cache.get_or_load("main.b", [] { return std::string("b2"); }), "b2");
+    EXPECT_EQ(cache.get_or_load("other.c", [] { return std::string("c2"); }), "c1");
+
+    cache.clear();
+    EXPECT_EQ(cache.stats().entries, 0);
+}
+
+// Test: find() serves cached values without loading and skips negative entries
+TEST(TtlCacheTest, FindDoesNotLoad) {
+    TtlCache<int> cache(16, 10s, 10s);
+    EXPECT_FALSE(cache.find("a").has_value());
+    cache.get_or_load("a", [] { return 1; });
+    EXPECT_THROW(cache.get_or_load("gone", []() -> int { throw CacheableError("404"); }), CacheableError);
+
+    EXPECT_EQ(cache.find("a"), std::optional<int>(1));
+    EXPECT_FALSE(cache.find("gone").has_value());
+    EXPECT_EQ(cache.stats().hits, 1u);
+    EXPECT_EQ(cache.stats().misses, 2u);
+}
@@ -0,0 +1,66 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include <stdexcept>
+
+#include <databricks/warehouse_router.h>
+#include <gtest/gtest.h>
+
+namespace {
+databricks::AuthConfig test_auth() {
+    databricks::AuthConfig auth;
+    auth.host = "https://test.databricks.com";
+    auth.set_token("test_token_router");
+    return auth;
+}
+
+databricks::SQLConfig warehouse(const std::string& id) {
+    databricks::SQLConfig sql;
+    sql.http_path = "/sql/1.0/warehouses/" + id;
+    return sql;
+}
+
+databricks::RetryConfig no_retry() {
+    databricks::RetryConfig retry;
+    retry.enabled = false;
+    retry.circuit_failure_threshold = 0;
+    return retry;
+}
+} // namespace
+
+// Test: The router needs at least one warehouse and a valid policy
+TEST(WarehouseRouterTest, RejectsInvalidConfig) {
+    EXPECT_THROW(databricks::WarehouseRouter(test_auth(), {}), std::invalid_argument);
+
+    databricks::RouterConfig routing;
+    routing.max_error_rate = 0.0;
+    EXPECT_THROW(databricks::WarehouseRouter(test_auth(), {warehouse("a")}, {}, routing), std::invalid_argument);
+}
+
+// Test: Unreachable warehouses count failures per route, and failing health checks drain them
+TEST(WarehouseRouterTest, CountsFailuresAndDrainsUnhealthyRoutes) {
+    databricks::PoolingConfig pooling;
+    pooling.maintenance_interval_ms = 0;
+    databricks::WarehouseRouter router(test_auth(), {warehouse("router_a"), warehouse("router_b")}, pooling, {},
+                                       no_retry());
+
+    // The test ODBC driver cannot connect, so every query fails
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_ANY_THROW(router.query("SELECT 1"));
+    }
+    auto stats = router.stats();
+    ASSERT_EQ(stats.size(), 2u);
+    EXPECT_EQ(stats[0].http_path, "/sql/1.0/warehouses/router_a");
+    EXPECT_EQ(stats[0].queries + stats[1].queries, 4u);
+    EXPECT_GT(stats[0].queries, 0u);
+    EXPECT_GT(stats[1].queries, 0u);
+    EXPECT_EQ(stats[0].failures + stats[1].failures, 4u);
+    EXPECT_EQ(stats[0].outstanding, 0u);
+
+    EXPECT_EQ(router.check_health(), 0u);
+    for (const auto& route : router.stats()) {
+        EXPECT_FALSE(route.healthy);
+        EXPECT_TRUE(route.draining);
+    }
+}
+
+// Note: main() is provided by gtest_main linked in CMakeLists.txt
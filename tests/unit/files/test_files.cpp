@@ -0,0 +1,157 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../mocks/mock_http_client.h"
+#include "../../src/internal/csv_writer.h"
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include <databricks/files/files.h>
+#include <gtest/gtest.h>
+
+using databricks::test::MockHttpClient;
+using ::testing::_;
+using ::testing::HasSubstr;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace {
+databricks::internal::HttpResponse no_content() {
+    databricks::internal::HttpResponse response;
+    response.status_code = 204;
+    return response;
+}
+} // namespace
+
+class FilesApiTest : public ::testing::Test {
+protected:
+    void SetUp() override { mock_client_ = std::make_shared<NiceMock<MockHttpClient>>(); }
+
+    std::shared_ptr<NiceMock<MockHttpClient>> mock_client_;
+};
+
+// Test: upload PUTs the buffer to the encoded file path and accepts 204 No Content
+TEST_F(FilesApiTest, UploadSendsBufferToEncodedPath) {
+    EXPECT_CALL(*mock_client_, put("/fs/files/Volumes/main/default/landing/my%20file.csv?overwrite=true", "a,b\n"))
+        .WillOnce(Return(no_content()));
+    EXPECT_CALL(*mock_client_, check_response(_, _)).Times(0);
+
+    databricks::Files files(mock_client_);
+    files.upload("/Volumes/main/default/landing/my file.csv", "a,b\n", true);
+}
+
+// Test: a relative path is rejected before any request is made
+TEST_F(FilesApiTest, RelativePathThrows) {
+    EXPECT_CALL(*mock_client_, put(_, _)).Times(0);
+
+    databricks::Files files(mock_client_);
+    EXPECT_THROW(files.upload("Volumes/main/default/landing/x.csv", "x"), std::invalid_argument);
+}
+
+// Test: upload_file streams the local file's bytes
+TEST_F(FilesApiTest, UploadFileStreamsLocalFile) {
+    const std::string local = testing::TempDir() + "files_upload_test.bin";
+    {
+        std::ofstream out(local, std::ios::binary);
+        out << std::string(100000, 'x') << "end";
+    }
+    EXPECT_CALL(*mock_client_, put("/fs/files/Volumes/main/default/landing/data.bin?overwrite=false", _))
+        .WillOnce([](const std::string&, const std::string& body) {
+            EXPECT_EQ(body.size(), 100003u);
+            EXPECT_EQ(body.substr(body.size() - 3), "end");
+            return no_content();
+        });
+
+    databricks::Files files(mock_client_);
+    EXPECT_EQ(files.upload_file(local, "/Volumes/main/default/landing/data.bin"), 100003u);
+    std::remove(local.c_str());
+}
+
+// Test: upload_files reports each file, and one failure does not stop the others
+TEST_F(FilesApiTest, UploadFilesReportsEachResult) {
+    EXPECT_CALL(*mock_client_, put(_, _)).Times(10).WillRepeatedly(Return(no_content()));
+    EXPECT_CALL(*mock_client_, put(HasSubstr("/bad.csv"), _))
+        .WillOnce(Return(MockHttpClient::bad_request_response("File already exists")));
+    ON_CALL(*mock_client_, check_response(_, _)).WillByDefault([](const auto& response, const std::string& op) {
+        throw std::runtime_error("Failed to " + op + ": HTTP " + std::to_string(response.status_code));
+    });
+
+    std::vector<databricks::FileUpload> uploads;
+    for (int i = 0; i < 10; ++i) {
+        uploads.push_back(databricks::FileUpload::from_buffer("row", "/Volumes/v/" + std::to_string(i) + ".csv"));
+    }
+    uploads.push_back(databricks::FileUpload::from_buffer("row", "/Volumes/v/bad.csv"));
+
+    databricks::Files files(mock_client_);
+    auto results = files.upload_files(uploads, 4);
+
+    ASSERT_EQ(results.size(), 11u);
+    for (size_t i = 0; i < 10; ++i) {
+        EXPECT_TRUE(results[i].success);
+        EXPECT_EQ(results[i].path, uploads[i].path);
+        EXPECT_EQ(results[i].bytes, 3u);
+        EXPECT_EQ(results[i].status_code, 204);
+    }
+    EXPECT_FALSE(results[10].success);
+    EXPECT_EQ(results[10].status_code, 400);
+    EXPECT_THAT(results[10].error, HasSubstr("HTTP 400"));
+}
+
+// Test: directories are created with PUT and removed with DELETE
+TEST_F(FilesApiTest, DirectoryOperations) {
+    EXPECT_CALL(*mock_client_, put("/fs/directories/Volumes/main/default/landing/2025", ""))
+        .WillOnce(Return(no_content()));
+    EXPECT_CALL(*mock_client_, del("/fs/directories/Volumes/main/default/landing/2025"))
+        .WillOnce(Return(MockHttpClient::success_response()));
+    EXPECT_CALL(*mock_client_, del("/fs/files/Volumes/main/default/landing/2025/a.csv"))
+        .WillOnce(Return(no_content()));
+
+    databricks::Files files(mock_client_);
+    files.create_directory("/Volumes/main/default/landing/2025");
+    files.delete_file("/Volumes/main/default/landing/2025/a.csv");
+    files.delete_directory("/Volumes/main/default/landing/2025");
+}
+
+// Test: CSV parts quote every value, double embedded quotes and leave NULL unquoted
+TEST(CsvWriterTest, QuotesValuesAndWritesNullsEmpty) {
+    databricks::internal::CsvWriter writer({"id", "note"});
+    writer.add_row({"1", "say \"hi\", then\nleave"});
+
+    databricks::ColumnMetadata id;
+    id.name = "id";
+    databricks::ColumnMetadata note;
+    note.name = "note";
+    databricks::ColumnarBatch batch;
+    batch.reset({id, note});
+    batch.append_value(0, "2", 1);
+    batch.append_null(1);
+    batch.commit_row();
+    batch.append_value(0, "3", 1);
+    batch.append_value(1, "", 0);
+    batch.commit_row();
+    writer.add_rows(batch, 0, batch.num_rows());
+
+    EXPECT_EQ(writer.rows(), 3u);
+    EXPECT_EQ(writer.take(), "\"id\",\"note\"\n"
+                             "\"1\",\"say \"\"hi\"\", then\nleave\"\n"
+                             "\"2\",\n"
+                             "\"3\",\"\"\n");
+    // The next part starts over with a header
+    EXPECT_EQ(writer.rows(), 0u);
+    EXPECT_EQ(writer.take(), "\"id\",\"note\"\n");
+    EXPECT_THROW(writer.add_row({"only one"}), std::invalid_argument);
+}
+
+// Test: COPY INTO reads the staged directory with matching CSV options and rejects quotes in paths
+TEST(CsvWriterTest, CopyIntoStatement) {
+    EXPECT_EQ(databricks::internal::copy_into_statement("main.sales.orders", "/Volumes/main/etl/staging/ingest-1",
+                                                        {{"mergeSchema", "true"}}),
+              "COPY INTO main.sales.orders FROM '/Volumes/main/etl/staging/ingest-1' FILEFORMAT = CSV "
+              "FORMAT_OPTIONS ('header' = 'true', 'multiLine' = 'true', 'escape' = '\"') "
+              "COPY_OPTIONS ('mergeSchema' = 'true')");
+    EXPECT_THROW(databricks::internal::copy_into_statement("t", "/Volumes/it's", {}), std::invalid_argument);
+}
+
+// Note: main() is provided by gtest_main linked in CMakeLists.txt
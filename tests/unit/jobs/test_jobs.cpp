@@ -5,6 +5,7 @@
 #include <databricks/core/config.h>
 #include <databricks/jobs/jobs.h>
 #include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
 
 using databricks::test::MockHttpClient;
 using ::testing::_;
@@ -112,6 +113,21 @@ TEST(JobStructTest, RejectsInvalidJson) {
     EXPECT_THROW({ databricks::Job::from_json(invalid_json); }, std::runtime_error);
 }
 
+// Test: Job parses from an already-parsed JSON object and from literal text alike
+TEST(JobStructTest, ParseFromJsonObject) {
+    nlohmann::json j = {{"job_id", 42}, {"name", "nightly"}, {"settings", {{"max_concurrent_runs", 1}}}};
+
+    databricks::Job job = databricks::Job::from_json(j);
+    EXPECT_EQ(job.job_id, 42);
+    EXPECT_EQ(job.name, "nightly");
+    EXPECT_EQ(job.settings["raw"], R"({"max_concurrent_runs":1})");
+
+    EXPECT_EQ(databricks::Job::from_json(R"({"job_id": 42})").job_id, 42);
+
+    // Wrong field types are still reported as runtime errors
+    EXPECT_THROW(databricks::Job::from_json(nlohmann::json{{"job_id", "not a number"}}), std::runtime_error);
+}
+
 // Test: JobRun struct initialization and default values
 TEST(JobRunStructTest, DefaultInitialization) {
     databricks::JobRun run;
@@ -290,3 +306,137 @@ TEST_F(JobsApiTest, GetRunOutputFailedRun) {
     EXPECT_EQ(output.error, "error message");
     EXPECT_EQ(output.notebook_output, "failed");
 }
+
+// Test: get_jobs() fetches every job and keeps the requested order
+TEST_F(JobsApiTest, GetJobsFetchesEachJob) {
+    // Setup
+    auto mock_client = std::make_shared<MockHttpClient>();
+    EXPECT_CALL(*mock_client, get("/jobs/get?job_id=7"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"job_id":7,"name":"seven"})")));
+    EXPECT_CALL(*mock_client, get("/jobs/get?job_id=3"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"job_id":3,"name":"three"})")));
+
+    EXPECT_CALL(*mock_client, check_response(_, "getJob")).Times(2);
+
+    databricks::Jobs jobs(mock_client);
+    auto result = jobs.get_jobs({7, 3});
+    ASSERT_EQ(result.size(), 2);
+    EXPECT_EQ(result[0].job_id, 7);
+    EXPECT_EQ(result[1].name, "three");
+}
+
+// Test: jobs() follows next_page_token until has_more is false
+TEST_F(JobsApiTest, JobsIteratesAllPages) {
+    // Setup
+    auto mock_client = std::make_shared<MockHttpClient>();
+    EXPECT_CALL(*mock_client, get("/jobs/list?expand_tasks=false&limit=2"))
+        .WillOnce(Return(MockHttpClient::success_response(
+            R"({"jobs":[{"job_id":1},{"job_id":2}],"has_more":true,"next_page_token":"a+b="})")));
+    EXPECT_CALL(*mock_client, get("/jobs/list?expand_tasks=false&limit=2&page_token=a%2Bb%3D"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"jobs":[{"job_id":3}],"has_more":false})")));
+
+    EXPECT_CALL(*mock_client, check_response(_, "listJobs")).Times(2);
+
+    databricks::Jobs jobs(mock_client);
+    std::vector<uint64_t> ids;
+    for (const auto& job : jobs.jobs(2)) {
+        ids.push_back(job.job_id);
+    }
+    EXPECT_EQ(ids, (std::vector<uint64_t>{1, 2, 3}));
+}
+
+// Test: wait_for_run() polls until the run reaches a terminal lifecycle state
+TEST_F(JobsApiTest, WaitForRunPollsUntilTerminated) {
+    // Setup
+    auto mock_client = std::make_shared<MockHttpClient>();
+    EXPECT_CALL(*mock_client, get("/jobs/runs/get?run_id=42"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"run_id":42,"state":{"life_cycle_state":"PENDING"}})")))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"run_id":42,"state":{"life_cycle_state":"RUNNING"}})")))
+        .WillOnce(Return(MockHttpClient::success_response(
+            R"({"run_id":42,"state":{"life_cycle_state":"TERMINATED","result_state":"SUCCESS"}})")));
+    EXPECT_CALL(*mock_client, check_response(_, "getRun")).Times(3);
+
+    databricks::PollConfig poll;
+    poll.initial_interval_ms = 5;
+    poll.max_interval_ms = 10;
+
+    databricks::Jobs jobs(mock_client);
+    auto run = jobs.wait_for_run(42, std::chrono::seconds(10), poll).get();
+    EXPECT_EQ(run.state, "TERMINATED");
+    EXPECT_EQ(run.result_state, "SUCCESS");
+
+    poll.backoff_multiplier = 0.5;
+    EXPECT_THROW(jobs.wait_for_run(42, std::chrono::seconds(10), poll), std::invalid_argument);
+}
+
+// Test: wait_for_run() fails its future once the timeout passes
+TEST_F(JobsApiTest, WaitForRunTimesOut) {
+    // Setup
+    auto mock_client = std::make_shared<::testing::NiceMock<MockHttpClient>>();
+    ON_CALL(*mock_client, get("/jobs/runs/get?run_id=7"))
+        .WillByDefault(
+            Return(MockHttpClient::success_response(R"({"run_id":7,"state":{"life_cycle_state":"RUNNING"}})")));
+
+    databricks::PollConfig poll;
+    poll.initial_interval_ms = 5;
+
+    databricks::Jobs jobs(mock_client);
+    auto run = jobs.wait_for_run(7, std::chrono::milliseconds(50), poll);
+    ASSERT_EQ(run.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_THROW(run.get(), std::runtime_error);
+}
+
+// Test: run_now_batch() reports every trigger in input order, including failures
+TEST_F(JobsApiTest, RunNowBatchReportsEachTrigger) {
+    // Setup
+    auto mock_client = std::make_shared<::testing::NiceMock<MockHttpClient>>();
+    EXPECT_CALL(*mock_client, post("/jobs/run-now", R"({"idempotency_token":"t1","job_id":1})"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"run_id":101})")));
+    EXPECT_CALL(*mock_client, post("/jobs/run-now", R"({"job_id":2,"notebook_params":{"day":"mon"}})"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"run_id":0})")));
+    EXPECT_CALL(*mock_client, post("/jobs/run-now", R"({"job_id":3})"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"run_id":103})")));
+
+    databricks::RunNowRequest first;
+    first.job_id = 1;
+    first.idempotency_token = "t1";
+    databricks::RunNowRequest second;
+    second.job_id = 2;
+    second.notebook_params = {{"day", "mon"}};
+    databricks::RunNowRequest third;
+    third.job_id = 3;
+
+    databricks::Jobs jobs(mock_client);
+    auto results = jobs.run_now_batch({first, second, third}, 2);
+    ASSERT_EQ(results.size(), 3);
+    EXPECT_TRUE(results[0].success);
+    EXPECT_EQ(results[0].run_id, 101);
+    EXPECT_FALSE(results[1].success);
+    EXPECT_EQ(results[1].job_id, 2);
+    EXPECT_FALSE(results[1].error.empty());
+    EXPECT_EQ(results[2].run_id, 103);
+
+    EXPECT_THROW(jobs.run_now_batch({first}, 0), std::invalid_argument);
+}
+
+// Test: list_runs() sends the filters and follows pages until has_more is false
+TEST_F(JobsApiTest, ListRunsIteratesActiveRuns) {
+    // Setup
+    auto mock_client = std::make_shared<MockHttpClient>();
+    EXPECT_CALL(*mock_client,
+                get("/jobs/runs/list?active_only=true&expand_tasks=false&job_id=9&limit=1&start_time_from=1000"))
+        .WillOnce(Return(MockHttpClient::success_response(
+            R"({"runs":[{"run_id":1,"job_id":9}],"has_more":true,"next_page_token":"n2"})")));
+    EXPECT_CALL(*mock_client, get("/jobs/runs/list?active_only=true&expand_tasks=false&job_id=9&limit=1&page_token=n2"
+                                  "&start_time_from=1000"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"runs":[{"run_id":2,"job_id":9}],"has_more":false})")));
+
+    EXPECT_CALL(*mock_client, check_response(_, "listRuns")).Times(2);
+
+    databricks::Jobs jobs(mock_client);
+    std::vector<uint64_t> ids;
+    for (const auto& run : jobs.list_runs(9, true, 1000, 1)) {
+        ids.push_back(run.run_id);
+    }
+    EXPECT_EQ(ids, (std::vector<uint64_t>{1, 2}));
+}
@@ -480,3 +480,73 @@ TEST_F(SecretsApiTest, ListSecretsNoSecretsField) {
 
     EXPECT_EQ(secret_list.size(), 0);
 }
+
+// ============================================================================
+// API Method Tests - get_secret / get_secrets
+// ============================================================================
+
+// Test: get_secret() decodes the base64 value from the response
+TEST_F(SecretsApiTest, GetSecretDecodesValue) {
+    EXPECT_CALL(*mock_client_, get("/secrets/get?scope=test-scope&key=api-key"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"key":"api-key","value":"c2VjcmV0LXZhbHVl"})")));
+
+    databricks::Secrets secrets(mock_client_);
+    EXPECT_EQ(secrets.get_secret("test-scope", "api-key"), "secret-value");
+}
+
+// Test: get_secret() rejects a response without a valid value
+TEST_F(SecretsApiTest, GetSecretRejectsInvalidValue) {
+    EXPECT_CALL(*mock_client_, get("/secrets/get?scope=test-scope&key=a"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"key":"a","value":"not base64!"})")));
+    EXPECT_CALL(*mock_client_, get("/secrets/get?scope=test-scope&key=b"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"key":"b"})")));
+
+    databricks::Secrets secrets(mock_client_);
+    EXPECT_THROW(secrets.get_secret("test-scope", "a"), std::runtime_error);
+    EXPECT_THROW(secrets.get_secret("test-scope", "b"), std::runtime_error);
+}
+
+// Test: get_secrets() returns values in key order
+TEST_F(SecretsApiTest, GetSecretsKeepsOrder) {
+    EXPECT_CALL(*mock_client_, get("/secrets/get?scope=db&key=user"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"key":"user","value":"dXNlcg=="})")));
+    EXPECT_CALL(*mock_client_, get("/secrets/get?scope=db&key=password"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"key":"password","value":"cGFzcw=="})")));
+
+    databricks::Secrets secrets(mock_client_);
+    auto values = secrets.get_secrets("db", {"user", "password"});
+    ASSERT_EQ(values.size(), 2u);
+    EXPECT_EQ(values[0], "user");
+    EXPECT_EQ(values[1], "pass");
+}
+
+// Test: Cached values are served without a request until a write through the client invalidates them
+TEST_F(SecretsApiTest, CacheServesRepeatedReads) {
+    EXPECT_CALL(*mock_client_, get("/secrets/get?scope=db&key=user"))
+        .Times(2)
+        .WillRepeatedly(Return(MockHttpClient::success_response(R"({"key":"user","value":"dXNlcg=="})")));
+    EXPECT_CALL(*mock_client_, get("/secrets/get?scope=db&key=password"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"key":"password","value":"cGFzcw=="})")));
+    EXPECT_CALL(*mock_client_, post("/secrets/put", _)).WillOnce(Return(MockHttpClient::success_response("")));
+
+    databricks::Secrets secrets(mock_client_);
+    databricks::SecretCacheConfig cache;
+    cache.enabled = true;
+    secrets.set_cache_config(cache);
+
+    EXPECT_EQ(secrets.get_secret("db", "user"), "user");
+    auto values = secrets.get_secrets("db", {"user", "password"}); // Only password is requested
+    EXPECT_EQ(values[1], "pass");
+    EXPECT_EQ(secrets.get_secret("db", "password"), "pass");
+    EXPECT_EQ(secrets.cache_stats().hits, 2u);
+    EXPECT_EQ(secrets.cache_stats().entries, 2u);
+
+    secrets.put_secret("db", "user", "rotated");
+    EXPECT_EQ(secrets.get_secret("db", "user"), "user");
+
+    secrets.invalidate_cache();
+    EXPECT_EQ(secrets.cache_stats().entries, 0u);
+
+    cache.ttl_ms = 0;
+    EXPECT_THROW(secrets.set_cache_config(cache), std::invalid_argument);
+}
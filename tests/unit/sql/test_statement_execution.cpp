@@ -0,0 +1,165 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "../../mocks/mock_http_client.h"
+
+#include <databricks/sql/statement_execution.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+using databricks::test::MockHttpClient;
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace {
+std::string link_json(uint64_t chunk_index, const std::string& url, bool has_next) {
+    nlohmann::json link = {{"chunk_index", chunk_index},
+                           {"row_offset", chunk_index * 100},
+                           {"row_count", 100},
+                           {"external_link", url},
+                           {"http_headers", {{"x-ms-blob-type", "BlockBlob"}}}};
+    if (has_next) {
+        link["next_chunk_index"] = chunk_index + 1;
+    }
+    return link.dump();
+}
+
+std::string succeeded_json(uint64_t chunks, const std::string& links) {
+    return R"({"statement_id": "stmt-1", "status": {"state": "SUCCEEDED"},
+               "manifest": {"format": "ARROW_STREAM", "total_chunk_count": )" +
+           std::to_string(chunks) + R"(, "total_row_count": 300,
+                            "schema": {"columns": [{"name": "id", "type_name": "LONG", "type_text": "BIGINT",
+                                                    "position": 0}]}},
+               "result": {"external_links": [)" +
+           links + "]}}";
+}
+
+/**
+ * @brief Mock client whose check_response throws on non-200 like HttpClient
+ */
+class StatementExecutionTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        mock = std::make_shared<NiceMock<MockHttpClient>>();
+        ON_CALL(*mock, check_response(_, _))
+            .WillByDefault(Invoke([](const databricks::internal::HttpResponse& response, const std::string& op) {
+                if (response.status_code != 200) {
+                    throw std::runtime_error("Failed to " + op);
+                }
+            }));
+    }
+
+    static databricks::internal::HttpResponse status(int code, const std::string& body = "") {
+        databricks::internal::HttpResponse response;
+        response.status_code = code;
+        response.body = body;
+        return response;
+    }
+
+    std::shared_ptr<NiceMock<MockHttpClient>> mock;
+};
+} // namespace
+
+// Test: The request asks for external links and binds NULL parameters without a value
+TEST(StatementRequestTest, ToJsonUsesExternalLinks) {
+    databricks::StatementRequest request;
+    request.statement = "SELECT :day, :missing";
+    request.warehouse_id = "wh";
+    request.parameters = {{"day", std::string("2025-01-01"), "DATE"}, {"missing", std::nullopt, ""}};
+    request.row_limit = 10;
+
+    auto body = nlohmann::json::parse(request.to_json());
+    EXPECT_EQ(body["disposition"], "EXTERNAL_LINKS");
+    EXPECT_EQ(body["format"], "ARROW_STREAM");
+    EXPECT_EQ(body["wait_timeout"], "10s");
+    EXPECT_EQ(body["row_limit"], 10);
+    EXPECT_FALSE(body.contains("catalog"));
+    ASSERT_EQ(body["parameters"].size(), 2u);
+    EXPECT_EQ(body["parameters"][0]["type"], "DATE");
+    EXPECT_FALSE(body["parameters"][1].contains("value"));
+}
+
+// Test: Status, manifest and links are parsed
+TEST(StatementResponseTest, ParsesManifestAndLinks) {
+    auto response = databricks::StatementResponse::from_json(succeeded_json(3, link_json(0, "https://s/0", true)));
+    EXPECT_EQ(response.statement_id, "stmt-1");
+    EXPECT_EQ(response.state, databricks::StatementState::SUCCEEDED);
+    EXPECT_TRUE(response.is_terminal());
+    EXPECT_EQ(response.total_chunk_count, 3u);
+    ASSERT_EQ(response.columns.size(), 1u);
+    EXPECT_EQ(response.columns[0].type_text, "BIGINT");
+    ASSERT_EQ(response.external_links.size(), 1u);
+    EXPECT_EQ(response.external_links[0].next_chunk_index, 1u);
+    EXPECT_EQ(response.external_links[0].http_headers.at("x-ms-blob-type"), "BlockBlob");
+    EXPECT_EQ(databricks::parse_statement_state("SOMETHING"), databricks::StatementState::UNKNOWN);
+}
+
+// Test: Chunks arrive in order; links missing from the response are requested once
+TEST_F(StatementExecutionTest, StreamsChunksInOrder) {
+    EXPECT_CALL(*mock, get("/sql/statements/stmt-1/result/chunks/1"))
+        .WillOnce(Return(status(200, "{\"external_links\": [" + link_json(1, "https://s/1", true) + "," +
+                                         link_json(2, "https://s/2", false) + "]}")));
+    EXPECT_CALL(*mock, get_external(_, _))
+        .Times(3)
+        .WillRepeatedly(Invoke([](const std::string& url, const std::map<std::string, std::string>& headers) {
+            EXPECT_EQ(headers.at("x-ms-blob-type"), "BlockBlob");
+            return status(200, "data:" + url.substr(url.size() - 1));
+        }));
+
+    databricks::StatementExecution statements(mock);
+    auto response = databricks::StatementResponse::from_json(succeeded_json(3, link_json(0, "https://s/0", true)));
+    auto stream = statements.fetch_chunks(response, 2);
+
+    std::vector<std::string> data;
+    for (auto& chunk : stream) {
+        EXPECT_EQ(chunk.row_offset, chunk.chunk_index * 100);
+        data.push_back(std::move(chunk.data));
+    }
+    EXPECT_EQ(data, (std::vector<std::string>{"data:0", "data:1", "data:2"}));
+    EXPECT_EQ(stream.chunks_delivered(), 3u);
+}
+
+// Test: An expired link is refreshed and the download retried
+TEST_F(StatementExecutionTest, RefreshesExpiredLink) {
+    EXPECT_CALL(*mock, get_external("https://s/old", _)).WillOnce(Return(status(403)));
+    EXPECT_CALL(*mock, get_external("https://s/new", _)).WillOnce(Return(status(200, "rows")));
+    EXPECT_CALL(*mock, get("/sql/statements/stmt-1/result/chunks/0"))
+        .WillOnce(Return(status(200, "{\"external_links\": [" + link_json(0, "https://s/new", false) + "]}")));
+
+    databricks::StatementExecution statements(mock);
+    auto stream = statements.fetch_chunks(
+        databricks::StatementResponse::from_json(succeeded_json(1, link_json(0, "https://s/old", false))));
+
+    databricks::ResultChunk chunk;
+    ASSERT_TRUE(stream.next(chunk));
+    EXPECT_EQ(chunk.data, "rows");
+    EXPECT_FALSE(stream.next(chunk));
+}
+
+// Test: A failed statement is reported with its error
+TEST_F(StatementExecutionTest, ExecuteThrowsOnFailure) {
+    EXPECT_CALL(*mock, post("/sql/statements", _))
+        .WillOnce(Return(status(200, R"({"statement_id": "stmt-2", "status": {"state": "FAILED",
+                                          "error": {"error_code": "BAD_REQUEST", "message": "syntax error"}}})")));
+
+    databricks::StatementExecution statements(mock);
+    databricks::StatementRequest request;
+    request.statement = "SELEC 1";
+    request.warehouse_id = "wh";
+    try {
+        statements.execute(request);
+        FAIL() << "Expected std::runtime_error";
+    } catch (const std::runtime_error& e) {
+        EXPECT_NE(std::string(e.what()).find("syntax error"), std::string::npos);
+    }
+
+    request.wait_timeout_seconds = 3;
+    EXPECT_THROW(statements.submit(request), std::invalid_argument);
+    EXPECT_THROW(statements.fetch_chunks(databricks::StatementResponse{}), std::invalid_argument);
+}
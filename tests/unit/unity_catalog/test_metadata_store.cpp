@@ -0,0 +1,120 @@
+// Copyright (c) 2025 Calvin Min
+// SPDX-License-Identifier: MIT
+#include "databricks/unity_catalog/metadata_store.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace databricks;
+
+namespace {
+TableInfo make_table(const std::string& schema, const std::string& name) {
+    TableInfo table;
+    table.name = name;
+    table.catalog_name = "main";
+    table.schema_name = schema;
+    table.full_name = "main." + schema + "." + name;
+    table.table_type = "MANAGED";
+    table.data_source_format = "DELTA";
+    table.owner = "etl@example.com";
+    table.metastore_id = "ms-1";
+    table.updated_at = 42;
+    table.properties = {{"delta.minReaderVersion", "1"}, {"delta.minWriterVersion", "2"}};
+    for (int i = 0; i < 3; ++i) {
+        ColumnInfo column;
+        column.name = "c" + std::to_string(i);
+        column.type_name = "INT";
+        column.type_text = "int";
+        column.position = i;
+        table.columns.push_back(column);
+    }
+    return table;
+}
+} // namespace
+
+// Test: Records come back out of the store field for field
+TEST(MetadataStoreTest, RoundTripsRecords) {
+    MetadataStore store;
+    TableInfo table = make_table("sales", "orders");
+    table.comment = "Daily orders";
+    table.storage_location = "s3://bucket/orders";
+    table.table_id = 7;
+    table.columns[1].nullable = false;
+    table.columns[2].partition_index = "0";
+    store.add(table);
+
+    CatalogInfo catalog;
+    catalog.name = "main";
+    catalog.catalog_type = "FEDERATED_CATALOG"; // Not in CatalogTypeEnum, kept as text
+    store.add(catalog);
+
+    SchemaInfo schema;
+    schema.name = "sales";
+    schema.full_name = "main.sales"; // catalog_name derived from full_name
+    store.add(schema);
+
+    auto found = store.find_table("main.sales.orders");
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(found->full_name, "main.sales.orders");
+    EXPECT_EQ(found->table_type, "MANAGED");
+    EXPECT_EQ(found->data_source_format, "DELTA");
+    EXPECT_EQ(found->comment, "Daily orders");
+    EXPECT_EQ(found->storage_location, std::optional<std::string>("s3://bucket/orders"));
+    EXPECT_FALSE(found->view_definition.has_value());
+    EXPECT_EQ(found->table_id, std::optional<uint64_t>(7));
+    EXPECT_EQ(found->properties, table.properties);
+    ASSERT_EQ(found->columns.size(), 3);
+    EXPECT_EQ(found->columns[1].name, "c1");
+    EXPECT_FALSE(found->columns[1].nullable);
+    EXPECT_EQ(found->columns[2].partition_index, std::optional<std::string>("0"));
+
+    EXPECT_EQ(store.find_catalog("main")->catalog_type, "FEDERATED_CATALOG");
+    EXPECT_EQ(store.find_schema("main.sales")->catalog_name, "main");
+    EXPECT_FALSE(store.find_table("main.sales.missing").has_value());
+    EXPECT_FALSE(store.find_table("nope.sales.orders").has_value());
+    EXPECT_FALSE(store.find_table("orders").has_value());
+}
+
+// Test: Adding a held table replaces it, and erased or replaced slots are reclaimed by compact()
+TEST(MetadataStoreTest, ReplacesErasesAndCompacts) {
+    MetadataStore store;
+    store.add(make_table("sales", "orders"));
+    store.add(make_table("sales", "refunds"));
+
+    TableInfo updated = make_table("sales", "orders");
+    updated.columns.resize(1);
+    store.add(updated);
+    EXPECT_EQ(store.table_count(), 2);
+    EXPECT_EQ(store.find_table("main.sales.orders")->columns.size(), 1);
+
+    EXPECT_TRUE(store.erase_table("main.sales.refunds"));
+    EXPECT_FALSE(store.erase_table("main.sales.refunds"));
+    store.compact();
+
+    size_t visited = 0;
+    store.for_each_table([&](const TableInfo& table) {
+        EXPECT_EQ(table.name, "orders");
+        ++visited;
+    });
+    EXPECT_EQ(visited, 1);
+    EXPECT_EQ(store.stats().columns, 1);
+    EXPECT_EQ(store.find_table("main.sales.orders")->updated_at, 42);
+}
+
+// Test: Repeated fields are stored once however many tables share them
+TEST(MetadataStoreTest, InternsRepeatedFields) {
+    MetadataStore store;
+    for (int i = 0; i < 1000; ++i) {
+        store.add(make_table("schema" + std::to_string(i % 10), "table" + std::to_string(i)));
+    }
+
+    auto stats = store.stats();
+    EXPECT_EQ(stats.tables, 1000);
+    EXPECT_EQ(stats.columns, 3000);
+    // Schema names, owner, metastore, format, column names and types, property keys and values
+    EXPECT_LT(stats.distinct_strings, 40);
+    EXPECT_GT(stats.bytes, 0);
+}
+
+// Note: main() is provided by gtest_main linked in CMakeLists.txt
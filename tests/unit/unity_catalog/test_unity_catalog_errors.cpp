@@ -6,6 +6,7 @@
 #include "../../src/internal/logger.h"
 #include "mock_http_client.h"
 
+#include <map>
 #include <memory>
 
 #include <gmock/gmock.h>
@@ -421,4 +422,160 @@ TEST_F(UnityCatalogErrorTest, LongJSONTruncatedInError) {
     }
 }
 
+// =============================================================================
+// Batch Lookup Tests
+// =============================================================================
+
+// Test: get_tables() fetches every table and keeps the requested order
+TEST_F(UnityCatalogErrorTest, GetTablesPreservesOrder) {
+    EXPECT_CALL(*mock_http_client_, get("/unity-catalog/tables/main.default.b"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"name": "b", "full_name": "main.default.b"})")));
+    EXPECT_CALL(*mock_http_client_, get("/unity-catalog/tables/main.default.a"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"name": "a", "full_name": "main.default.a"})")));
+    EXPECT_CALL(*mock_http_client_, check_response(_, "getTable")).Times(2);
+
+    auto tables = unity_catalog_->get_tables({"main.default.b", "main.default.a"});
+    ASSERT_EQ(tables.size(), 2);
+    EXPECT_EQ(tables[0].name, "b");
+    EXPECT_EQ(tables[1].name, "a");
+
+    EXPECT_TRUE(unity_catalog_->get_tables({}).empty());
+}
+
+// Test: A failed lookup in a batch surfaces as an exception
+TEST_F(UnityCatalogErrorTest, GetTablesPropagatesErrors) {
+    EXPECT_CALL(*mock_http_client_, get("/unity-catalog/tables/main.default.a"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"catalog_name": "main"})")));
+
+    EXPECT_THROW(unity_catalog_->get_tables({"main.default.a"}), std::runtime_error);
+}
+
+// Test: tables() walks every page of a schema listing
+TEST_F(UnityCatalogErrorTest, TablesFollowsPageTokens) {
+    EXPECT_CALL(*mock_http_client_, get("/unity-catalog/tables?catalog_name=main&schema_name=default&max_results=1"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"tables": [{"name": "a"}], "next_page_token": "t2"})")));
+    EXPECT_CALL(*mock_http_client_,
+                get("/unity-catalog/tables?catalog_name=main&schema_name=default&max_results=1&page_token=t2"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"tables": [{"name": "b"}]})")));
+
+    std::vector<std::string> names;
+    for (const auto& table : unity_catalog_->tables("main", "default", 1)) {
+        names.push_back(table.name);
+    }
+    EXPECT_EQ(names, (std::vector<std::string>{"a", "b"}));
+}
+
+// =============================================================================
+// Metadata Cache Tests
+// =============================================================================
+
+// Test: With the cache enabled, repeated lookups make one request until a write invalidates them
+TEST_F(UnityCatalogErrorTest, CacheServesRepeatedLookups) {
+    MetadataCacheConfig cache;
+    cache.enabled = true;
+    unity_catalog_->set_cache_config(cache);
+
+    EXPECT_CALL(*mock_http_client_, get("/unity-catalog/tables/main.default.t"))
+        .Times(2)
+        .WillRepeatedly(Return(MockHttpClient::success_response(R"({"name": "t"})")));
+    EXPECT_CALL(*mock_http_client_, post("/unity-catalog/tables/main.default.t", ""))
+        .WillOnce(Return(MockHttpClient::success_response("{}")));
+
+    EXPECT_EQ(unity_catalog_->get_table("main.default.t").name, "t");
+    EXPECT_EQ(unity_catalog_->get_table("main.default.t").name, "t");
+    EXPECT_EQ(unity_catalog_->cache_stats().hits, 1);
+
+    unity_catalog_->delete_table("main.default.t");
+    unity_catalog_->get_table("main.default.t");
+    EXPECT_EQ(unity_catalog_->cache_stats().misses, 2);
+}
+
+// Test: A 404 is cached as a negative entry and rethrown without another request
+TEST_F(UnityCatalogErrorTest, CacheRemembersMissingObjects) {
+    MetadataCacheConfig cache;
+    cache.enabled = true;
+    unity_catalog_->set_cache_config(cache);
+
+    EXPECT_CALL(*mock_http_client_, get("/unity-catalog/catalogs/nope"))
+        .WillOnce(Return(MockHttpClient::not_found_response("catalog")));
+
+    EXPECT_THROW(unity_catalog_->get_catalog("nope"), std::runtime_error);
+    EXPECT_THROW(unity_catalog_->get_catalog("nope"), std::runtime_error);
+    EXPECT_EQ(unity_catalog_->cache_stats().negative_hits, 1);
+
+    // Invalid settings are rejected; disabling clears the counters
+    cache.shards = 0;
+    EXPECT_THROW(unity_catalog_->set_cache_config(cache), std::invalid_argument);
+    unity_catalog_->set_cache_config(MetadataCacheConfig{});
+    EXPECT_EQ(unity_catalog_->cache_stats().negative_hits, 0);
+}
+
+// =============================================================================
+// Metastore Snapshot Tests
+// =============================================================================
+
+// Test: snapshot() follows page tokens at every level and streams each table with its columns
+TEST_F(UnityCatalogErrorTest, SnapshotCrawlsEveryPage) {
+    EXPECT_CALL(*mock_http_client_, get("/unity-catalog/catalogs?max_results=1"))
+        .WillOnce(
+            Return(MockHttpClient::success_response(R"({"catalogs": [{"name": "a"}], "next_page_token": "c2"})")));
+    EXPECT_CALL(*mock_http_client_, get("/unity-catalog/catalogs?max_results=1&page_token=c2"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"catalogs": [{"name": "b"}]})")));
+    EXPECT_CALL(*mock_http_client_, get("/unity-catalog/schemas?catalog_name=a&max_results=1"))
+        .WillOnce(Return(MockHttpClient::success_response(
+            R"({"schemas": [{"name": "s", "catalog_name": "a", "full_name": "a.s", "updated_at": 5}]})")));
+    EXPECT_CALL(*mock_http_client_, get("/unity-catalog/schemas?catalog_name=b&max_results=1"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"schemas": []})")));
+    EXPECT_CALL(*mock_http_client_, get("/unity-catalog/tables?catalog_name=a&schema_name=s&max_results=1"))
+        .WillOnce(Return(MockHttpClient::success_response(
+            R"({"tables": [{"name": "t1", "columns": [{"name": "id"}]}], "next_page_token": "t2"})")));
+    EXPECT_CALL(*mock_http_client_,
+                get("/unity-catalog/tables?catalog_name=a&schema_name=s&max_results=1&page_token=t2"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"tables": [{"name": "t2"}]})")));
+
+    SnapshotOptions options;
+    options.max_concurrent_requests = 2;
+    options.page_size = 1;
+    std::vector<std::string> names;
+    size_t columns = 0;
+    auto snapshot = unity_catalog_->snapshot(
+        [&](const TableInfo& table) {
+            names.push_back(table.name);
+            columns += table.columns.size();
+        },
+        options);
+
+    EXPECT_EQ(names, (std::vector<std::string>{"t1", "t2"}));
+    EXPECT_EQ(columns, 1);
+    EXPECT_EQ(snapshot.tables, 2);
+    EXPECT_EQ(snapshot.catalogs.size(), 2);
+    EXPECT_EQ(snapshot.schema_versions, (std::map<std::string, uint64_t>{{"a.s", 5}}));
+
+    options.max_concurrent_requests = 0;
+    EXPECT_THROW(unity_catalog_->snapshot([](const TableInfo&) {}, options), std::invalid_argument);
+}
+
+// Test: An incremental snapshot skips unchanged schemas and reports removed ones
+TEST_F(UnityCatalogErrorTest, SnapshotSkipsUnchangedSchemas) {
+    EXPECT_CALL(*mock_http_client_, get("/unity-catalog/catalogs/main"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"name": "main"})")));
+    EXPECT_CALL(*mock_http_client_, get("/unity-catalog/schemas?catalog_name=main"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"schemas": [
+            {"name": "same", "catalog_name": "main", "full_name": "main.same", "updated_at": 10},
+            {"name": "new", "catalog_name": "main", "full_name": "main.new", "updated_at": 20}]})")));
+    EXPECT_CALL(*mock_http_client_, get("/unity-catalog/tables?catalog_name=main&schema_name=new"))
+        .WillOnce(Return(MockHttpClient::success_response(R"({"tables": [{"name": "t"}]})")));
+    EXPECT_CALL(*mock_http_client_, get("/unity-catalog/tables?catalog_name=main&schema_name=same")).Times(0);
+
+    SnapshotOptions options;
+    options.catalogs = {"main"};
+    options.previous_schema_versions = {{"main.same", 10}, {"main.gone", 3}, {"other.kept", 1}};
+    auto snapshot = unity_catalog_->snapshot([](const TableInfo&) {}, options);
+
+    EXPECT_EQ(snapshot.tables, 1);
+    EXPECT_EQ(snapshot.schemas.size(), 2);
+    EXPECT_EQ(snapshot.unchanged_schemas, (std::vector<std::string>{"main.same"}));
+    EXPECT_EQ(snapshot.removed_schemas, (std::vector<std::string>{"main.gone"}));
+}
+
 // Note: main() is provided by gtest_main linked in CMakeLists.txt